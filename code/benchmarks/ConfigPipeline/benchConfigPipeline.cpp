@@ -0,0 +1,731 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a benchmark for the complete configuration pipeline (read, resolve, load and write)
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigItem.hpp>
+#include <CppConfigFramework/ConfigReader.hpp>
+#include <CppConfigFramework/ConfigWriter.hpp>
+#include "BenchmarkCommon.hpp"
+
+// Qt includes
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QTemporaryDir>
+
+// System includes
+#include <cmath>
+#include <random>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+using namespace CppConfigFramework::Benchmark;
+
+//! Holds the parameters of the synthetic configuration
+struct GeneratorParameters
+{
+    //! Approximate number of nodes in the generated configuration
+    int nodeCount = 50000;
+
+    //! Depth of the generated configuration tree
+    int depth = 6;
+
+    //! Probability that a leaf is a reference ('&' decorator) instead of a Value node
+    double referenceDensity = 0.1;
+
+    //! Number of includes in each configuration file (except for the deepest ones)
+    int includeFanOut = 4;
+
+    //! Depth of the include tree
+    int includeDepth = 2;
+
+    //! Seed for the random number generator
+    quint32 seed = 1U;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Generates a synthetic configuration
+ *
+ * The generated tree is available both as a single JSON Object ("flat" configuration) and as a set
+ * of configuration files that are combined with includes. Top level members are distributed among
+ * the files in the order in which the reader reads them so that all references (which only point
+ * to previously generated nodes) can be resolved in both variants.
+ */
+class SyntheticConfigGenerator
+{
+public:
+    //! Holds the statistics of the generated configuration
+    struct Statistics
+    {
+        int objectNodes = 0;        //!< Number of Object nodes
+        int valueNodes = 0;         //!< Number of Value nodes
+        int nodeReferences = 0;     //!< Number of NodeReference nodes
+        int derivedObjects = 0;     //!< Number of DerivedObject nodes
+        int files = 0;              //!< Number of configuration files
+        qint64 flatSize = 0;        //!< Size of the flat configuration in bytes
+    };
+
+    /*!
+     * Constructor
+     *
+     * \param   parameters  Generator parameters
+     */
+    explicit SyntheticConfigGenerator(const GeneratorParameters &parameters)
+        : m_parameters(parameters),
+          m_random(parameters.seed)
+    {
+        m_parameters.depth = std::max(1, m_parameters.depth);
+        m_parameters.includeFanOut = std::max(0, m_parameters.includeFanOut);
+        m_parameters.includeDepth = std::max(0, m_parameters.includeDepth);
+
+        m_fanOut = std::max(2, static_cast<int>(std::lround(
+                                   std::pow(static_cast<double>(m_parameters.nodeCount),
+                                            1.0 / static_cast<double>(m_parameters.depth)))));
+    }
+
+    /*!
+     * Generates the configuration
+     *
+     * \param   directory   Directory where the configuration files need to be stored
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool generate(const QDir &directory)
+    {
+        // Prepare the include tree (files are stored in the order in which they are read)
+        m_files.clear();
+        const int mainFileIndex = addFile(0);
+
+        // Generate top level members and distribute them among the files in the read order
+        QJsonObject flatConfig;
+
+        for (int i = 0; i < m_fanOut; i++)
+        {
+            const int fileIndex = static_cast<int>((static_cast<qint64>(i) * m_files.size()) /
+                                                   m_fanOut);
+            const QString name = nextName(QStringLiteral("o"));
+            const QJsonObject member = generateObject(1, QStringLiteral("/") + name);
+
+            m_statistics.objectNodes++;
+            flatConfig.insert(name, member);
+            m_files[static_cast<size_t>(fileIndex)].config.insert(name, member);
+        }
+
+        m_flatConfig = QJsonDocument(QJsonObject { { QStringLiteral("config"), flatConfig } })
+                       .toJson(QJsonDocument::Compact);
+        m_statistics.flatSize = m_flatConfig.size();
+        m_statistics.files = static_cast<int>(m_files.size());
+
+        // Write the configuration files
+        for (const auto &file : m_files)
+        {
+            QJsonArray includes;
+
+            for (const int includeIndex : file.includes)
+            {
+                const QString &fileName = m_files.at(static_cast<size_t>(includeIndex)).fileName;
+
+                includes.append(QJsonObject
+                {
+                    { QStringLiteral("type"), QStringLiteral("CppConfigFramework") },
+                    { QStringLiteral("file_path"), fileName }
+                });
+            }
+
+            const QJsonObject root
+            {
+                { QStringLiteral("includes"), includes },
+                { QStringLiteral("config"), file.config }
+            };
+
+            QFile output(directory.absoluteFilePath(file.fileName));
+
+            if (!output.open(QIODevice::WriteOnly))
+            {
+                return false;
+            }
+
+            output.write(QJsonDocument(root).toJson(QJsonDocument::Compact));
+        }
+
+        m_mainFilePath = directory.absoluteFilePath(
+                             m_files.at(static_cast<size_t>(mainFileIndex)).fileName);
+        return true;
+    }
+
+    //! Returns the flat configuration (a single configuration file without includes)
+    const QByteArray &flatConfig() const
+    {
+        return m_flatConfig;
+    }
+
+    //! Returns the path to the main configuration file
+    const QString &mainFilePath() const
+    {
+        return m_mainFilePath;
+    }
+
+    //! Returns the statistics of the generated configuration
+    const Statistics &statistics() const
+    {
+        return m_statistics;
+    }
+
+private:
+    //! Holds the contents of a generated configuration file
+    struct GeneratedFile
+    {
+        QString fileName;           //!< File name
+        std::vector<int> includes;  //!< Indexes of the included files
+        QJsonObject config;         //!< Contents of the 'config' member
+    };
+
+    /*!
+     * Adds a file with all of its (nested) includes to the list of files
+     *
+     * \param   includeLevel    Include level of the file
+     *
+     * \return  Index of the added file
+     *
+     * \note    Included files are added before the file itself (order in which they are read)
+     */
+    int addFile(const int includeLevel)
+    {
+        std::vector<int> includes;
+
+        if (includeLevel < m_parameters.includeDepth)
+        {
+            for (int i = 0; i < m_parameters.includeFanOut; i++)
+            {
+                includes.push_back(addFile(includeLevel + 1));
+            }
+        }
+
+        GeneratedFile file;
+        file.fileName = QString("config_%1.json").arg(static_cast<int>(m_files.size()));
+        file.includes = std::move(includes);
+
+        m_files.push_back(std::move(file));
+        return static_cast<int>(m_files.size()) - 1;
+    }
+
+    /*!
+     * Generates an Object node
+     *
+     * \param   level   Level of the node in the tree
+     * \param   path    Absolute node path of the node
+     *
+     * \return  JSON Object
+     */
+    QJsonObject generateObject(const int level, const QString &path)
+    {
+        QJsonObject object;
+
+        for (int i = 0; i < m_fanOut; i++)
+        {
+            if ((level + 1) < m_parameters.depth)
+            {
+                const QString name = nextName(QStringLiteral("o"));
+                object.insert(name, generateObject(level + 1, path + QChar('/') + name));
+                m_statistics.objectNodes++;
+            }
+            else
+            {
+                generateLeaf(path, &object);
+            }
+        }
+
+        // Object nodes with leaves only are candidates for bases of DerivedObject nodes
+        if ((level + 1) >= m_parameters.depth)
+        {
+            m_baseCandidates.push_back(path);
+        }
+
+        return object;
+    }
+
+    /*!
+     * Generates a leaf node (Value, NodeReference or DerivedObject node)
+     *
+     * \param           path    Absolute node path of the parent node
+     * \param[in,out]   object  Parent JSON Object
+     */
+    void generateLeaf(const QString &path, QJsonObject *object)
+    {
+        std::uniform_real_distribution<double> probability(0.0, 1.0);
+
+        if ((!m_referenceCandidates.empty()) &&
+            (probability(m_random) < m_parameters.referenceDensity))
+        {
+            if (m_baseCandidates.empty() || (probability(m_random) < 0.5))
+            {
+                // NodeReference node
+                object->insert(QChar('&') + nextName(QStringLiteral("r")),
+                               pickRandom(m_referenceCandidates));
+                m_statistics.nodeReferences++;
+            }
+            else
+            {
+                // DerivedObject node
+                const QJsonObject derivedObject
+                {
+                    { QStringLiteral("base"), pickRandom(m_baseCandidates) },
+                    { QStringLiteral("config"),
+                      QJsonObject { { nextName(QStringLiteral("v")), probability(m_random) } } }
+                };
+
+                object->insert(QChar('&') + nextName(QStringLiteral("d")), derivedObject);
+                m_statistics.derivedObjects++;
+            }
+            return;
+        }
+
+        // Value node
+        const QString name = nextName(QStringLiteral("v"));
+        std::uniform_int_distribution<int> valueType(0, 2);
+
+        switch (valueType(m_random))
+        {
+            case 0:
+                object->insert(name, probability(m_random) * 1000.0);
+                break;
+
+            case 1:
+                object->insert(name, QString("value_%1").arg(m_nameIndex));
+                break;
+
+            default:
+                object->insert(name, (probability(m_random) < 0.5));
+                break;
+        }
+
+        m_referenceCandidates.push_back(path + QChar('/') + name);
+        m_statistics.valueNodes++;
+    }
+
+    /*!
+     * Creates a unique node name
+     *
+     * \param   prefix  Name prefix
+     *
+     * \return  Node name
+     */
+    QString nextName(const QString &prefix)
+    {
+        return prefix + QString::number(m_nameIndex++);
+    }
+
+    /*!
+     * Picks a random item from the list
+     *
+     * \param   items   List of items (must not be empty)
+     *
+     * \return  Picked item
+     */
+    QString pickRandom(const std::vector<QString> &items)
+    {
+        std::uniform_int_distribution<size_t> index(0U, items.size() - 1U);
+        return items.at(index(m_random));
+    }
+
+private:
+    //! Holds the generator parameters
+    GeneratorParameters m_parameters;
+
+    //! Holds the number of members in each Object node
+    int m_fanOut = 2;
+
+    //! Holds the random number generator
+    std::mt19937 m_random;
+
+    //! Holds the index for the next unique node name
+    int m_nameIndex = 0;
+
+    //! Holds the node paths of Value nodes that can be referenced
+    std::vector<QString> m_referenceCandidates;
+
+    //! Holds the node paths of Object nodes that can be used as bases for DerivedObject nodes
+    std::vector<QString> m_baseCandidates;
+
+    //! Holds the generated files
+    std::vector<GeneratedFile> m_files;
+
+    //! Holds the flat configuration
+    QByteArray m_flatConfig;
+
+    //! Holds the path to the main configuration file
+    QString m_mainFilePath;
+
+    //! Holds the statistics of the generated configuration
+    Statistics m_statistics;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+//! Config item that loads all of the parameters in the configuration node
+class GenericConfigItem : public ConfigItem
+{
+public:
+    //! Returns the number of loaded parameters
+    int loadedParameters() const
+    {
+        return m_loadedParameters;
+    }
+
+private:
+    //! \copydoc    ConfigItem::loadConfigParameters()
+    bool loadConfigParameters(const ConfigObjectNode &config) override
+    {
+        m_loadedParameters = 0;
+
+        for (const QString &name : config.names())
+        {
+            const auto *node = config.member(name);
+
+            if (node->isObject())
+            {
+                GenericConfigItem item;
+
+                if (!item.loadConfig(name, config))
+                {
+                    return false;
+                }
+
+                m_loadedParameters += item.loadedParameters();
+                continue;
+            }
+
+            bool success = false;
+
+            switch (node->toValue().value().type())
+            {
+                case QJsonValue::Double:
+                {
+                    double value = 0.0;
+                    success = loadRequiredConfigParameter(&value, name, config);
+                    break;
+                }
+
+                case QJsonValue::Bool:
+                {
+                    bool value = false;
+                    success = loadRequiredConfigParameter(&value, name, config);
+                    break;
+                }
+
+                default:
+                {
+                    QString value;
+                    success = loadRequiredConfigParameter(&value, name, config);
+                    break;
+                }
+            }
+
+            if (!success)
+            {
+                return false;
+            }
+
+            m_loadedParameters++;
+        }
+
+        return true;
+    }
+
+    //! \copydoc    ConfigItem::storeConfigParameters()
+    bool storeConfigParameters(ConfigObjectNode *config) override
+    {
+        Q_UNUSED(config)
+        return true;
+    }
+
+private:
+    //! Holds the number of loaded parameters
+    int m_loadedParameters = 0;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+namespace Benchmark
+{
+
+//! Gives access to the individual stages of the ConfigReader's reading procedure
+class ConfigReaderStages
+{
+public:
+    /*!
+     * Reads an Object node from the JSON Object (without resolving the references)
+     *
+     * \param   jsonObject              JSON Object
+     * \param   environmentVariables    Environment variables
+     *
+     * \return  Configuration node instance or null in case of failure
+     */
+    static std::unique_ptr<ConfigObjectNode> readObject(
+            const QJsonObject &jsonObject,
+            const EnvironmentVariables &environmentVariables)
+    {
+        return ConfigReader::readObjectNode(jsonObject,
+                                            ConfigNodePath::ROOT_PATH,
+                                            environmentVariables);
+    }
+
+    /*!
+     * Resolves all references in the configuration node
+     *
+     * \param   reader  Config reader
+     *
+     * \param[in,out]   config  Configuration node
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    static bool resolve(const ConfigReader &reader, ConfigObjectNode *config)
+    {
+        return reader.resolveReferences({}, config);
+    }
+};
+
+} // namespace Benchmark
+} // namespace CppConfigFramework
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Runs all of the benchmark stages
+ *
+ * \param   generator   Generator of the synthetic configuration
+ * \param   iterations  Number of iterations for each stage
+ *
+ * \param[in,out]   report  Benchmark report
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+static bool runStages(const SyntheticConfigGenerator &generator,
+                      const int iterations,
+                      BenchmarkReport *report)
+{
+    const ConfigReader reader;
+    const EnvironmentVariables environmentVariables;
+
+    // Reference data for the stages
+    const QJsonObject flatConfig =
+            QJsonDocument::fromJson(generator.flatConfig()).object()
+            .value(QStringLiteral("config")).toObject();
+
+    auto resolvedConfig = ConfigReaderStages::readObject(flatConfig, environmentVariables);
+
+    if ((!resolvedConfig) || (!ConfigReaderStages::resolve(reader, resolvedConfig.get())))
+    {
+        QTextStream(stderr) << "Failed to read the generated configuration\n";
+        return false;
+    }
+
+    // JSON parse
+    report->addStage(QStringLiteral("json_parse"), measure(iterations, [&]()
+    {
+        QJsonParseError error {};
+        const auto doc = QJsonDocument::fromJson(generator.flatConfig(), &error);
+        Q_UNUSED(doc)
+    }));
+
+    // ConfigReader::readObjectNode()
+    report->addStage(QStringLiteral("read_object_node"), measure(iterations, [&]()
+    {
+        const auto config = ConfigReaderStages::readObject(flatConfig, environmentVariables);
+        Q_UNUSED(config)
+    }));
+
+    // ConfigReaderBase::resolveReferences()
+    std::unique_ptr<ConfigObjectNode> unresolvedConfig;
+    bool resolved = true;
+
+    report->addStage(QStringLiteral("resolve_references"), measure(iterations, [&]()
+    {
+        unresolvedConfig = ConfigReaderStages::readObject(flatConfig, environmentVariables);
+    },
+    [&]()
+    {
+        resolved = ConfigReaderStages::resolve(reader, unresolvedConfig.get()) && resolved;
+    }));
+
+    if (!resolved)
+    {
+        QTextStream(stderr) << "Failed to resolve the generated configuration\n";
+        return false;
+    }
+
+    // ConfigObjectNode::apply()
+    std::unique_ptr<ConfigNode> applyTarget;
+
+    report->addStage(QStringLiteral("object_node_apply"), measure(iterations, [&]()
+    {
+        applyTarget = resolvedConfig->clone();
+    },
+    [&]()
+    {
+        applyTarget->toObject().apply(*resolvedConfig);
+    }));
+
+    // ConfigItem::loadConfig()
+    bool loaded = true;
+
+    report->addStage(QStringLiteral("config_item_load"), measure(iterations, [&]()
+    {
+        GenericConfigItem item;
+        loaded = item.loadConfig(*resolvedConfig) && loaded;
+    }));
+
+    if (!loaded)
+    {
+        QTextStream(stderr) << "Failed to load the generated configuration\n";
+        return false;
+    }
+
+    // ConfigWriter::writeToJsonConfig()
+    report->addStage(QStringLiteral("write_json_config"), measure(iterations, [&]()
+    {
+        const auto doc = ConfigWriter::writeToJsonConfig(*resolvedConfig);
+        Q_UNUSED(doc)
+    }));
+
+    // End to end: ConfigReader::read() with includes
+    bool read = true;
+
+    report->addStage(QStringLiteral("read_end_to_end"), measure(iterations, [&]()
+    {
+        EnvironmentVariables readEnvironmentVariables;
+        const auto config = ConfigReader().read(generator.mainFilePath(),
+                                                QDir::current(),
+                                                ConfigNodePath::ROOT_PATH,
+                                                ConfigNodePath::ROOT_PATH,
+                                                {},
+                                                &readEnvironmentVariables);
+        read = (config != nullptr) && read;
+    }));
+
+    if (!read)
+    {
+        QTextStream(stderr) << "Failed to read the generated configuration files\n";
+        return false;
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    // Parse command line
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Benchmark for the complete configuration pipeline");
+    parser.addHelpOption();
+
+    const QCommandLineOption nodesOption("nodes", "Approximate number of nodes.", "count", "50000");
+    const QCommandLineOption depthOption("depth", "Depth of the configuration tree.", "depth", "6");
+    const QCommandLineOption referenceDensityOption(
+                "reference-density", "Probability that a leaf is a reference.", "ratio", "0.1");
+    const QCommandLineOption includeFanOutOption(
+                "include-fanout", "Number of includes in each configuration file.", "count", "4");
+    const QCommandLineOption includeDepthOption(
+                "include-depth", "Depth of the include tree.", "depth", "2");
+    const QCommandLineOption iterationsOption(
+                "iterations", "Number of iterations for each stage.", "count", "5");
+    const QCommandLineOption seedOption("seed", "Random number generator seed.", "seed", "1");
+    const QCommandLineOption outputOption(
+                "output", "Path to the results file (JSON format).", "path");
+
+    parser.addOptions({
+                          nodesOption,
+                          depthOption,
+                          referenceDensityOption,
+                          includeFanOutOption,
+                          includeDepthOption,
+                          iterationsOption,
+                          seedOption,
+                          outputOption
+                      });
+    parser.process(app);
+
+    GeneratorParameters parameters;
+    parameters.nodeCount = parser.value(nodesOption).toInt();
+    parameters.depth = parser.value(depthOption).toInt();
+    parameters.referenceDensity = parser.value(referenceDensityOption).toDouble();
+    parameters.includeFanOut = parser.value(includeFanOutOption).toInt();
+    parameters.includeDepth = parser.value(includeDepthOption).toInt();
+    parameters.seed = parser.value(seedOption).toUInt();
+
+    const int iterations = std::max(1, parser.value(iterationsOption).toInt());
+
+    // Generate the configuration
+    QTemporaryDir directory;
+
+    if (!directory.isValid())
+    {
+        QTextStream(stderr) << "Failed to create a temporary directory\n";
+        return 1;
+    }
+
+    SyntheticConfigGenerator generator(parameters);
+
+    if (!generator.generate(QDir(directory.path())))
+    {
+        QTextStream(stderr) << "Failed to generate the configuration files\n";
+        return 1;
+    }
+
+    // Run the benchmark
+    BenchmarkReport report(QStringLiteral("ConfigPipeline"));
+    report.setParameter(QStringLiteral("nodes"), parameters.nodeCount);
+    report.setParameter(QStringLiteral("depth"), parameters.depth);
+    report.setParameter(QStringLiteral("reference_density"), parameters.referenceDensity);
+    report.setParameter(QStringLiteral("include_fanout"), parameters.includeFanOut);
+    report.setParameter(QStringLiteral("include_depth"), parameters.includeDepth);
+    report.setParameter(QStringLiteral("iterations"), iterations);
+    report.setParameter(QStringLiteral("seed"), static_cast<double>(parameters.seed));
+
+    const auto &statistics = generator.statistics();
+    report.setMetric(QStringLiteral("object_nodes"), statistics.objectNodes);
+    report.setMetric(QStringLiteral("value_nodes"), statistics.valueNodes);
+    report.setMetric(QStringLiteral("node_references"), statistics.nodeReferences);
+    report.setMetric(QStringLiteral("derived_objects"), statistics.derivedObjects);
+    report.setMetric(QStringLiteral("files"), statistics.files);
+    report.setMetric(QStringLiteral("flat_size_bytes"), static_cast<double>(statistics.flatSize));
+
+    if (!runStages(generator, iterations, &report))
+    {
+        return 1;
+    }
+
+    return report.write(parser.value(outputOption)) ? 0 : 1;
+}
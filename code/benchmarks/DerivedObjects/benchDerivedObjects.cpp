@@ -0,0 +1,227 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a benchmark for many DerivedObject nodes and NodeReference nodes sharing a large base
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigNodeSharingScope.hpp>
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/ConfigReader.hpp>
+#include "BenchmarkCommon.hpp"
+
+// Qt includes
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QCoreApplication>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+using namespace CppConfigFramework::Benchmark;
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Generates the base configuration
+ *
+ * \param   depth   Depth of the tree
+ * \param   fanOut  Number of members in each Object node
+ *
+ * \return  Generated configuration
+ */
+static QJsonObject generateBase(const int depth, const int fanOut)
+{
+    QJsonObject object;
+
+    for (int i = 0; i < fanOut; i++)
+    {
+        const QString name = QString("member%1").arg(i);
+
+        if (depth > 1)
+        {
+            object.insert(name, generateBase(depth - 1, fanOut));
+        }
+        else
+        {
+            object.insert(name, i);
+        }
+    }
+
+    return object;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Generates the configuration with the derived objects and node references
+ *
+ * \param   depth           Depth of the base tree
+ * \param   fanOut          Number of members in each Object node of the base tree
+ * \param   derivedCount    Number of DerivedObject nodes
+ * \param   referenceCount  Number of NodeReference nodes
+ *
+ * \return  Generated configuration (ready for ConfigReader)
+ */
+static QJsonObject generateConfig(const int depth,
+                                  const int fanOut,
+                                  const int derivedCount,
+                                  const int referenceCount)
+{
+    QJsonObject config;
+    config.insert(QStringLiteral("base"), generateBase(depth, fanOut));
+
+    for (int i = 0; i < derivedCount; i++)
+    {
+        const QJsonObject derivedObject
+        {
+            { QStringLiteral("base"), QStringLiteral("/base") },
+            { QStringLiteral("config"), QJsonObject { { QStringLiteral("member0"), i } } }
+        };
+
+        config.insert(QString("&derived%1").arg(i), derivedObject);
+    }
+
+    for (int i = 0; i < referenceCount; i++)
+    {
+        config.insert(QString("&reference%1").arg(i), QStringLiteral("/base"));
+    }
+
+    return QJsonObject { { QStringLiteral("config"), config } };
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    // Parse command line
+    QCommandLineParser parser;
+    parser.setApplicationDescription(
+                "Benchmark for many DerivedObject and NodeReference nodes sharing a large base");
+    parser.addHelpOption();
+
+    const QCommandLineOption depthOption(
+                "depth", "Depth of the base tree.", "count", "3");
+    const QCommandLineOption fanOutOption(
+                "fan-out", "Number of members in each base Object node.", "count", "16");
+    const QCommandLineOption derivedOption(
+                "derived", "Number of DerivedObject nodes.", "count", "500");
+    const QCommandLineOption referencesOption(
+                "references", "Number of NodeReference nodes.", "count", "500");
+    const QCommandLineOption iterationsOption(
+                "iterations", "Number of iterations for each stage.", "count", "5");
+    const QCommandLineOption outputOption(
+                "output", "Path to the results file (JSON format).", "path");
+
+    parser.addOptions({
+                          depthOption,
+                          fanOutOption,
+                          derivedOption,
+                          referencesOption,
+                          iterationsOption,
+                          outputOption
+                      });
+    parser.process(app);
+
+    const int depth = std::max(1, parser.value(depthOption).toInt());
+    const int fanOut = std::max(1, parser.value(fanOutOption).toInt());
+    const int derivedCount = std::max(0, parser.value(derivedOption).toInt());
+    const int referenceCount = std::max(0, parser.value(referencesOption).toInt());
+    const int iterations = std::max(1, parser.value(iterationsOption).toInt());
+
+    BenchmarkReport report(QStringLiteral("DerivedObjects"));
+    report.setParameter(QStringLiteral("depth"), depth);
+    report.setParameter(QStringLiteral("fan_out"), fanOut);
+    report.setParameter(QStringLiteral("derived"), derivedCount);
+    report.setParameter(QStringLiteral("references"), referenceCount);
+    report.setParameter(QStringLiteral("iterations"), iterations);
+
+    // Read and resolve the configuration
+    const QJsonObject config = generateConfig(depth, fanOut, derivedCount, referenceCount);
+    const auto processEnvironmentVariables = EnvironmentVariables::loadFromProcess();
+    EnvironmentVariables environmentVariables;
+    ConfigReader reader;
+    std::unique_ptr<ConfigObjectNode> tree;
+    bool success = true;
+
+    report.addStage(QStringLiteral("read"), measure(iterations, [&]()
+    {
+        tree.reset();
+        environmentVariables = processEnvironmentVariables;
+    },
+    [&]()
+    {
+        tree = reader.read(config,
+                           QDir::current(),
+                           ConfigNodePath::ROOT_PATH,
+                           ConfigNodePath::ROOT_PATH,
+                           {},
+                           &environmentVariables);
+        success = success && static_cast<bool>(tree);
+    }));
+
+    if (!success)
+    {
+        QTextStream(stderr) << "Failed to read the generated configuration\n";
+        return 1;
+    }
+
+    // Clone of the base node (the read configuration is detached so this makes a complete copy)
+    const ConfigNode *baseNode = tree->member(QStringLiteral("base"));
+    std::unique_ptr<ConfigNode> clone;
+
+    report.addStage(QStringLiteral("clone_base"), measure(iterations, [&]()
+    {
+        clone.reset();
+    },
+    [&]()
+    {
+        clone = baseNode->clone();
+    }));
+
+    // Clone of the base node that belongs to the active sharing scope (shares the members)
+    const ConfigNodeSharingScope sharingScope;
+    const std::unique_ptr<ConfigNode> scopedBaseNode = baseNode->clone();
+
+    report.addStage(QStringLiteral("clone_base_shared"), measure(iterations, [&]()
+    {
+        clone.reset();
+    },
+    [&]()
+    {
+        clone = scopedBaseNode->clone();
+    }));
+
+    report.addStage(QStringLiteral("clone_and_detach_base_shared"), measure(iterations, [&]()
+    {
+        clone.reset();
+    },
+    [&]()
+    {
+        clone = scopedBaseNode->clone();
+        clone->toObject().detach();
+    }));
+
+    return report.write(parser.value(outputOption)) ? 0 : 1;
+}
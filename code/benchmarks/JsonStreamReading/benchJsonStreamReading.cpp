@@ -0,0 +1,301 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a benchmark for reading large configuration files (streaming vs. QJsonDocument)
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/ConfigReader.hpp>
+#include "BenchmarkCommon.hpp"
+
+// Qt includes
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QFile>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QTemporaryDir>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+using namespace CppConfigFramework::Benchmark;
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Generates a configuration tree with all kinds of members
+ *
+ * \param   depth           Depth of the tree
+ * \param   fanOut          Number of members in each Object node
+ * \param   referencePath   Node path used by the NodeReference nodes
+ *
+ * \return  Generated configuration
+ */
+static QJsonObject generateConfig(const int depth, const int fanOut, const QString &referencePath)
+{
+    QJsonObject object;
+
+    for (int i = 0; i < fanOut; i++)
+    {
+        const QString name = QString("member%1").arg(i);
+
+        if (depth > 1)
+        {
+            object.insert(name, generateConfig(depth - 1, fanOut, referencePath));
+            continue;
+        }
+
+        switch (i % 5)
+        {
+            case 0:
+                object.insert(name, i);
+                break;
+
+            case 1:
+                object.insert(name, QString("value of the member %1").arg(i));
+                break;
+
+            case 2:
+                object.insert(name, QJsonArray { i, 0.5 * i, (i % 3) == 0, QJsonValue() });
+                break;
+
+            case 3:
+                object.insert(QStringLiteral("#") + name,
+                              QJsonObject
+                              {
+                                  { QStringLiteral("x"), i },
+                                  { QStringLiteral("y"), -i }
+                              });
+                break;
+
+            default:
+                object.insert(QStringLiteral("&") + name, referencePath);
+                break;
+        }
+    }
+
+    return object;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Runs all stages for the specified reading mode
+ *
+ * \param   streaming   Flag for reading the file directly (otherwise through a QJsonDocument)
+ * \param   filePath    Path to the configuration file
+ * \param   iterations  Number of iterations for each stage
+ *
+ * \param[out]  report  Benchmark report
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+static bool runStages(const bool streaming,
+                      const QString &filePath,
+                      const int iterations,
+                      BenchmarkReport *report)
+{
+    const QString prefix = streaming ? QStringLiteral("streaming") : QStringLiteral("document");
+    const auto processEnvironmentVariables = EnvironmentVariables::loadFromProcess();
+    EnvironmentVariables environmentVariables;
+    ConfigReader reader;
+    std::unique_ptr<ConfigObjectNode> tree;
+    bool success = true;
+
+    // Memory mapped file contents are accounted in the file backed part of the RSS so the anonymous
+    // part (heap) is reported separately
+    const qint64 rssBefore = readProcessMemory(QStringLiteral("VmRSS"));
+    const qint64 rssAnonBefore = readProcessMemory(QStringLiteral("RssAnon"));
+
+    report->addStage(prefix + QStringLiteral("_read"), measure(iterations, [&]()
+    {
+        tree.reset();
+        environmentVariables = processEnvironmentVariables;
+    },
+    [&]()
+    {
+        if (streaming)
+        {
+            tree = reader.read(filePath,
+                               QDir::current(),
+                               ConfigNodePath::ROOT_PATH,
+                               ConfigNodePath::ROOT_PATH,
+                               {},
+                               &environmentVariables);
+        }
+        else
+        {
+            // Previous implementation: parse the whole document and then create the nodes from it
+            QFile file(filePath);
+
+            if (!file.open(QIODevice::ReadOnly))
+            {
+                success = false;
+                return;
+            }
+
+            const auto doc = QJsonDocument::fromJson(file.readAll());
+            tree = reader.read(doc.object(),
+                               QFileInfo(filePath).absoluteDir(),
+                               ConfigNodePath::ROOT_PATH,
+                               ConfigNodePath::ROOT_PATH,
+                               {},
+                               &environmentVariables);
+        }
+
+        success = success && static_cast<bool>(tree);
+    }));
+
+    const qint64 rssAfter = readProcessMemory(QStringLiteral("VmRSS"));
+    const qint64 rssAnonAfter = readProcessMemory(QStringLiteral("RssAnon"));
+
+    if (!success)
+    {
+        QTextStream(stderr) << "Failed to read the generated configuration file\n";
+        return false;
+    }
+
+    if ((rssBefore >= 0) && (rssAfter >= 0))
+    {
+        report->setMetric(prefix + QStringLiteral("_rss_delta_kb"),
+                          static_cast<double>(rssAfter - rssBefore));
+    }
+
+    if ((rssAnonBefore >= 0) && (rssAnonAfter >= 0))
+    {
+        report->setMetric(prefix + QStringLiteral("_rss_anon_delta_kb"),
+                          static_cast<double>(rssAnonAfter - rssAnonBefore));
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    // Parse command line
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Benchmark for reading large configuration files");
+    parser.addHelpOption();
+
+    const QCommandLineOption depthOption(
+                "depth", "Depth of the configuration tree.", "count", "4");
+    const QCommandLineOption fanOutOption(
+                "fan-out", "Number of members in each Object node.", "count", "20");
+    const QCommandLineOption modeOption(
+                "mode",
+                "Reading mode: 'streaming', 'document' or 'both' (a single mode isolates its peak "
+                "RSS).",
+                "mode",
+                "both");
+    const QCommandLineOption iterationsOption(
+                "iterations", "Number of iterations for each stage.", "count", "5");
+    const QCommandLineOption outputOption(
+                "output", "Path to the results file (JSON format).", "path");
+
+    parser.addOptions({
+                          depthOption,
+                          fanOutOption,
+                          modeOption,
+                          iterationsOption,
+                          outputOption
+                      });
+    parser.process(app);
+
+    const int depth = std::max(1, parser.value(depthOption).toInt());
+    const int fanOut = std::max(1, parser.value(fanOutOption).toInt());
+    const QString mode = parser.value(modeOption);
+    const int iterations = std::max(1, parser.value(iterationsOption).toInt());
+
+    if ((mode != QStringLiteral("streaming")) &&
+        (mode != QStringLiteral("document")) &&
+        (mode != QStringLiteral("both")))
+    {
+        QTextStream(stderr) << "Invalid mode: " << mode << '\n';
+        return 1;
+    }
+
+    // Generate the configuration file
+    QTemporaryDir directory;
+
+    if (!directory.isValid())
+    {
+        QTextStream(stderr) << "Failed to create a temporary directory\n";
+        return 1;
+    }
+
+    const QString filePath = QDir(directory.path()).absoluteFilePath("config.json");
+    qint64 fileSize = 0;
+
+    {
+        // All NodeReference nodes reference the first leaf node (an integer Value node)
+        const QString referencePath = QStringLiteral("/member0").repeated(depth);
+        const QJsonObject root
+        {
+            { QStringLiteral("config"), generateConfig(depth, fanOut, referencePath) }
+        };
+        QFile file(filePath);
+
+        if (!file.open(QIODevice::WriteOnly))
+        {
+            QTextStream(stderr) << "Failed to write the configuration file\n";
+            return 1;
+        }
+
+        fileSize = file.write(QJsonDocument(root).toJson(QJsonDocument::Indented));
+    }
+
+    // Run the benchmark
+    BenchmarkReport report(QStringLiteral("JsonStreamReading"));
+    report.setParameter(QStringLiteral("depth"), depth);
+    report.setParameter(QStringLiteral("fan_out"), fanOut);
+    report.setParameter(QStringLiteral("mode"), mode);
+    report.setParameter(QStringLiteral("iterations"), iterations);
+    report.setMetric(QStringLiteral("file_size_bytes"), static_cast<double>(fileSize));
+
+    if ((mode != QStringLiteral("document")) &&
+        (!runStages(true, filePath, iterations, &report)))
+    {
+        return 1;
+    }
+
+    if ((mode != QStringLiteral("streaming")) &&
+        (!runStages(false, filePath, iterations, &report)))
+    {
+        return 1;
+    }
+
+    const qint64 peakRss = readProcessMemory(QStringLiteral("VmHWM"));
+
+    if (peakRss >= 0)
+    {
+        report.setMetric(QStringLiteral("peak_rss_kb"), static_cast<double>(peakRss));
+    }
+
+    return report.write(parser.value(outputOption)) ? 0 : 1;
+}
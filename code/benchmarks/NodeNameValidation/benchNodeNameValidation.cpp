@@ -0,0 +1,191 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a micro benchmark that compares the node name validation with a regular expression
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigNodePath.hpp>
+#include "BenchmarkCommon.hpp"
+
+// Qt includes
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QRegularExpression>
+
+// System includes
+#include <random>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+using namespace CppConfigFramework::Benchmark;
+
+/*!
+ * Generates a set of node names
+ *
+ * \param   count           Number of node names
+ * \param   maxLength       Maximum length of a node name
+ * \param   invalidRatio    Ratio of invalid node names
+ * \param   seed            Seed for the random number generator
+ *
+ * \return  Node names
+ */
+static QStringList generateNodeNames(const int count,
+                                     const int maxLength,
+                                     const double invalidRatio,
+                                     const quint32 seed)
+{
+    static const QString s_firstCharacters =
+            QStringLiteral("abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ");
+    static const QString s_otherCharacters = s_firstCharacters + QStringLiteral("0123456789_");
+    static const QString s_invalidCharacters = QStringLiteral(" -./@[`{");
+
+    std::mt19937 random(seed);
+    std::uniform_int_distribution<int> lengthDistribution(1, std::max(1, maxLength));
+    std::uniform_real_distribution<double> invalidDistribution(0.0, 1.0);
+
+    auto randomCharacter = [&random](const QString &characters)
+    {
+        return characters.at(static_cast<int>(random() % static_cast<quint32>(characters.size())));
+    };
+
+    QStringList nodeNames;
+    nodeNames.reserve(count);
+
+    for (int i = 0; i < count; i++)
+    {
+        const int length = lengthDistribution(random);
+        QString nodeName;
+        nodeName.reserve(length);
+
+        nodeName.append(randomCharacter(s_firstCharacters));
+
+        for (int j = 1; j < length; j++)
+        {
+            nodeName.append(randomCharacter(s_otherCharacters));
+        }
+
+        // Replace a random character with an invalid one
+        if (invalidDistribution(random) < invalidRatio)
+        {
+            const int index = static_cast<int>(random() % static_cast<quint32>(length));
+            nodeName.replace(index, 1, randomCharacter(s_invalidCharacters));
+        }
+
+        nodeNames.append(nodeName);
+    }
+
+    return nodeNames;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    // Parse command line
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Micro benchmark for the node name validation");
+    parser.addHelpOption();
+
+    const QCommandLineOption namesOption("names", "Number of node names.", "count", "100000");
+    const QCommandLineOption maxLengthOption(
+                "max-length", "Maximum length of a node name.", "length", "16");
+    const QCommandLineOption invalidRatioOption(
+                "invalid-ratio", "Ratio of invalid node names.", "ratio", "0.1");
+    const QCommandLineOption iterationsOption(
+                "iterations", "Number of iterations for each stage.", "count", "10");
+    const QCommandLineOption seedOption("seed", "Random number generator seed.", "seed", "1");
+    const QCommandLineOption outputOption(
+                "output", "Path to the results file (JSON format).", "path");
+
+    parser.addOptions({
+                          namesOption,
+                          maxLengthOption,
+                          invalidRatioOption,
+                          iterationsOption,
+                          seedOption,
+                          outputOption
+                      });
+    parser.process(app);
+
+    const int nameCount = std::max(1, parser.value(namesOption).toInt());
+    const int maxLength = std::max(1, parser.value(maxLengthOption).toInt());
+    const double invalidRatio = parser.value(invalidRatioOption).toDouble();
+    const int iterations = std::max(1, parser.value(iterationsOption).toInt());
+    const quint32 seed = parser.value(seedOption).toUInt();
+
+    const QStringList nodeNames = generateNodeNames(nameCount, maxLength, invalidRatio, seed);
+
+    // Run the benchmark
+    BenchmarkReport report(QStringLiteral("NodeNameValidation"));
+    report.setParameter(QStringLiteral("names"), nameCount);
+    report.setParameter(QStringLiteral("max_length"), maxLength);
+    report.setParameter(QStringLiteral("invalid_ratio"), invalidRatio);
+    report.setParameter(QStringLiteral("iterations"), iterations);
+    report.setParameter(QStringLiteral("seed"), static_cast<double>(seed));
+
+    // Reference: validation with the regular expression that was used before the scanner
+    static const QRegularExpression s_regex(QStringLiteral("^[a-zA-Z][a-zA-Z0-9_]*$"));
+    int regexValidCount = 0;
+
+    report.addStage(QStringLiteral("regular_expression"), measure(iterations, [&]()
+    {
+        regexValidCount = 0;
+
+        for (const QString &nodeName : nodeNames)
+        {
+            if (s_regex.match(nodeName).hasMatch())
+            {
+                regexValidCount++;
+            }
+        }
+    }));
+
+    // ConfigNodePath::validateNodeName()
+    int scannerValidCount = 0;
+
+    report.addStage(QStringLiteral("validate_node_name"), measure(iterations, [&]()
+    {
+        scannerValidCount = 0;
+
+        for (const QString &nodeName : nodeNames)
+        {
+            if (ConfigNodePath::validateNodeName(nodeName))
+            {
+                scannerValidCount++;
+            }
+        }
+    }));
+
+    report.setMetric(QStringLiteral("valid_names"), scannerValidCount);
+
+    if (regexValidCount != scannerValidCount)
+    {
+        QTextStream(stderr) << "Validation results do not match: " << regexValidCount << " != "
+                            << scannerValidCount << '\n';
+        return 1;
+    }
+
+    return report.write(parser.value(outputOption)) ? 0 : 1;
+}
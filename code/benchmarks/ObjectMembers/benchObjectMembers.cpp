@@ -0,0 +1,271 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a benchmark for the member storage of Object nodes (narrow and wide objects)
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/ConfigValueNode.hpp>
+#include "BenchmarkCommon.hpp"
+
+// Qt includes
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QCoreApplication>
+
+// System includes
+#include <map>
+#include <random>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+using namespace CppConfigFramework::Benchmark;
+
+//! Reference member storage (the storage that was used before ConfigMemberStorage)
+using ReferenceStorage = std::map<QString, std::unique_ptr<ConfigNode>>;
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Runs all stages for objects with the specified number of members
+ *
+ * \param   prefix          Prefix for the names of the stages
+ * \param   width           Number of members in each object
+ * \param   objectCount     Number of objects
+ * \param   lookupCount     Number of lookups in each object
+ * \param   iterations      Number of iterations for each stage
+ * \param   seed            Seed for the random number generator
+ *
+ * \param[out]  report  Benchmark report
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+static bool runStages(const QString &prefix,
+                      const int width,
+                      const int objectCount,
+                      const int lookupCount,
+                      const int iterations,
+                      const quint32 seed,
+                      BenchmarkReport *report)
+{
+    // Prepare the member names and the order of the lookups
+    QStringList names;
+    std::vector<ConfigNameTable::Atom> atoms;
+
+    for (int i = 0; i < width; i++)
+    {
+        names.append(QString("member%1").arg(i));
+        atoms.push_back(ConfigNameTable::instance()->intern(names.last()));
+    }
+
+    std::mt19937 random(seed);
+    std::uniform_int_distribution<int> distribution(0, width - 1);
+    std::vector<int> lookupOrder;
+
+    for (int i = 0; i < lookupCount; i++)
+    {
+        lookupOrder.push_back(distribution(random));
+    }
+
+    // Build
+    std::vector<ReferenceStorage> referenceObjects;
+
+    report->addStage(prefix + QStringLiteral("_map_build"), measure(iterations, [&]()
+    {
+        referenceObjects = std::vector<ReferenceStorage>(static_cast<size_t>(objectCount));
+    },
+    [&]()
+    {
+        for (auto &object : referenceObjects)
+        {
+            for (int i = 0; i < width; i++)
+            {
+                object.emplace(names.at(i), std::make_unique<ConfigValueNode>(i));
+            }
+        }
+    }));
+
+    std::vector<ConfigObjectNode> objects;
+
+    report->addStage(prefix + QStringLiteral("_storage_build"), measure(iterations, [&]()
+    {
+        objects = std::vector<ConfigObjectNode>(static_cast<size_t>(objectCount));
+    },
+    [&]()
+    {
+        for (auto &object : objects)
+        {
+            for (int i = 0; i < width; i++)
+            {
+                object.setMember(names.at(i), std::make_unique<ConfigValueNode>(i));
+            }
+        }
+    }));
+
+    // Lookup
+    qint64 referenceSum = 0;
+
+    report->addStage(prefix + QStringLiteral("_map_lookup"), measure(iterations, [&]()
+    {
+        referenceSum = 0;
+
+        for (const auto &object : referenceObjects)
+        {
+            for (const int index : lookupOrder)
+            {
+                referenceSum += object.find(names.at(index))->second->toValue().value().toInt();
+            }
+        }
+    }));
+
+    qint64 nameSum = 0;
+
+    report->addStage(prefix + QStringLiteral("_storage_lookup_by_name"), measure(iterations, [&]()
+    {
+        nameSum = 0;
+
+        for (const auto &object : objects)
+        {
+            for (const int index : lookupOrder)
+            {
+                nameSum += object.member(names.at(index))->toValue().value().toInt();
+            }
+        }
+    }));
+
+    qint64 atomSum = 0;
+
+    report->addStage(prefix + QStringLiteral("_storage_lookup_by_atom"), measure(iterations, [&]()
+    {
+        atomSum = 0;
+
+        for (const auto &object : objects)
+        {
+            for (const int index : lookupOrder)
+            {
+                atomSum += object.member(atoms.at(static_cast<size_t>(index)))
+                           ->toValue().value().toInt();
+            }
+        }
+    }));
+
+    if ((referenceSum != nameSum) || (referenceSum != atomSum))
+    {
+        QTextStream(stderr) << "Lookup results do not match for: " << prefix << '\n';
+        return false;
+    }
+
+    // Names
+    report->addStage(prefix + QStringLiteral("_storage_names"), measure(iterations, [&]()
+    {
+        for (const auto &object : objects)
+        {
+            const auto objectNames = object.names();
+            Q_UNUSED(objectNames)
+        }
+    }));
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    // Parse command line
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Benchmark for the member storage of Object nodes");
+    parser.addHelpOption();
+
+    const QCommandLineOption narrowWidthOption(
+                "narrow-width", "Number of members in narrow objects.", "count", "4");
+    const QCommandLineOption narrowObjectsOption(
+                "narrow-objects", "Number of narrow objects.", "count", "25000");
+    const QCommandLineOption wideWidthOption(
+                "wide-width", "Number of members in wide objects.", "count", "10000");
+    const QCommandLineOption wideObjectsOption(
+                "wide-objects", "Number of wide objects.", "count", "10");
+    const QCommandLineOption lookupsOption(
+                "lookups", "Number of lookups in each object.", "count", "16");
+    const QCommandLineOption iterationsOption(
+                "iterations", "Number of iterations for each stage.", "count", "5");
+    const QCommandLineOption seedOption("seed", "Random number generator seed.", "seed", "1");
+    const QCommandLineOption outputOption(
+                "output", "Path to the results file (JSON format).", "path");
+
+    parser.addOptions({
+                          narrowWidthOption,
+                          narrowObjectsOption,
+                          wideWidthOption,
+                          wideObjectsOption,
+                          lookupsOption,
+                          iterationsOption,
+                          seedOption,
+                          outputOption
+                      });
+    parser.process(app);
+
+    const int narrowWidth = std::max(1, parser.value(narrowWidthOption).toInt());
+    const int narrowObjects = std::max(1, parser.value(narrowObjectsOption).toInt());
+    const int wideWidth = std::max(1, parser.value(wideWidthOption).toInt());
+    const int wideObjects = std::max(1, parser.value(wideObjectsOption).toInt());
+    const int lookups = std::max(1, parser.value(lookupsOption).toInt());
+    const int iterations = std::max(1, parser.value(iterationsOption).toInt());
+    const quint32 seed = parser.value(seedOption).toUInt();
+
+    // Run the benchmark
+    BenchmarkReport report(QStringLiteral("ObjectMembers"));
+    report.setParameter(QStringLiteral("narrow_width"), narrowWidth);
+    report.setParameter(QStringLiteral("narrow_objects"), narrowObjects);
+    report.setParameter(QStringLiteral("wide_width"), wideWidth);
+    report.setParameter(QStringLiteral("wide_objects"), wideObjects);
+    report.setParameter(QStringLiteral("lookups"), lookups);
+    report.setParameter(QStringLiteral("iterations"), iterations);
+    report.setParameter(QStringLiteral("seed"), static_cast<double>(seed));
+
+    if (!runStages(QStringLiteral("narrow"),
+                   narrowWidth,
+                   narrowObjects,
+                   lookups,
+                   iterations,
+                   seed,
+                   &report))
+    {
+        return 1;
+    }
+
+    if (!runStages(QStringLiteral("wide"),
+                   wideWidth,
+                   wideObjects,
+                   std::max(lookups, wideWidth),
+                   iterations,
+                   seed,
+                   &report))
+    {
+        return 1;
+    }
+
+    return report.write(parser.value(outputOption)) ? 0 : 1;
+}
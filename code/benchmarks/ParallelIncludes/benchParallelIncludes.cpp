@@ -0,0 +1,234 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a benchmark for reading a configuration file with many independent includes
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/ConfigReader.hpp>
+#include "BenchmarkCommon.hpp"
+
+// Qt includes
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QTemporaryDir>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+using namespace CppConfigFramework::Benchmark;
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Generates the configuration of a single include
+ *
+ * \param   index   Index of the include
+ * \param   nodes   Number of nodes in the include
+ *
+ * \return  Generated configuration
+ */
+static QJsonObject generateInclude(const int index, const int nodes)
+{
+    QJsonObject object;
+
+    for (int i = 0; i < nodes; i++)
+    {
+        object.insert(QString("member%1").arg(i),
+                      QJsonObject
+                      {
+                          { QStringLiteral("id"), i },
+                          { QStringLiteral("name"), QString("include %1 item %2").arg(index).arg(i) },
+                          { QStringLiteral("values"), QJsonArray { i, 0.5 * i, (i % 2) == 0 } }
+                      });
+    }
+
+    return QJsonObject
+    {
+        { QStringLiteral("config"), QJsonObject { { QString("include%1").arg(index), object } } }
+    };
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Writes a JSON object to a file
+ *
+ * \param   filePath    Path to the file
+ * \param   object      JSON object
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+static bool writeFile(const QString &filePath, const QJsonObject &object)
+{
+    QFile file(filePath);
+
+    if (!file.open(QIODevice::WriteOnly))
+    {
+        QTextStream(stderr) << "Failed to write the configuration file: " << filePath << '\n';
+        return false;
+    }
+
+    return (file.write(QJsonDocument(object).toJson(QJsonDocument::Indented)) > 0);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Runs the read stage for the specified mode
+ *
+ * \param   parallel    Flag for reading the includes concurrently
+ * \param   filePath    Path to the root configuration file
+ * \param   iterations  Number of iterations
+ *
+ * \param[out]  report  Benchmark report
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+static bool runStage(const bool parallel,
+                     const QString &filePath,
+                     const int iterations,
+                     BenchmarkReport *report)
+{
+    const auto processEnvironmentVariables = EnvironmentVariables::loadFromProcess();
+    EnvironmentVariables environmentVariables;
+    ConfigReader reader;
+    reader.setParallelIncludesEnabled(parallel);
+    std::unique_ptr<ConfigObjectNode> tree;
+    bool success = true;
+
+    report->addStage(parallel ? QStringLiteral("parallel_read") : QStringLiteral("sequential_read"),
+                     measure(iterations, [&]()
+    {
+        tree.reset();
+        environmentVariables = processEnvironmentVariables;
+    },
+    [&]()
+    {
+        tree = reader.read(filePath,
+                           QDir::current(),
+                           ConfigNodePath::ROOT_PATH,
+                           ConfigNodePath::ROOT_PATH,
+                           {},
+                           &environmentVariables);
+        success = success && static_cast<bool>(tree);
+    }));
+
+    if (!success)
+    {
+        QTextStream(stderr) << "Failed to read the generated configuration file\n";
+        return false;
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    // Parse command line
+    QCommandLineParser parser;
+    parser.setApplicationDescription(
+                "Benchmark for reading a configuration file with many independent includes");
+    parser.addHelpOption();
+
+    const QCommandLineOption includesOption(
+                "includes", "Number of included configuration files.", "count", "40");
+    const QCommandLineOption nodesOption(
+                "nodes", "Number of Object nodes in each included file.", "count", "500");
+    const QCommandLineOption iterationsOption(
+                "iterations", "Number of iterations for each stage.", "count", "5");
+    const QCommandLineOption outputOption(
+                "output", "Path to the results file (JSON format).", "path");
+
+    parser.addOptions({
+                          includesOption,
+                          nodesOption,
+                          iterationsOption,
+                          outputOption
+                      });
+    parser.process(app);
+
+    const int includes = std::max(1, parser.value(includesOption).toInt());
+    const int nodes = std::max(1, parser.value(nodesOption).toInt());
+    const int iterations = std::max(1, parser.value(iterationsOption).toInt());
+
+    // Generate the configuration files
+    QTemporaryDir directory;
+
+    if (!directory.isValid())
+    {
+        QTextStream(stderr) << "Failed to create a temporary directory\n";
+        return 1;
+    }
+
+    const QDir dir(directory.path());
+    QJsonArray includesArray;
+
+    for (int i = 0; i < includes; i++)
+    {
+        const QString fileName = QString("include%1.json").arg(i);
+
+        if (!writeFile(dir.absoluteFilePath(fileName), generateInclude(i, nodes)))
+        {
+            return 1;
+        }
+
+        includesArray.append(QJsonObject { { QStringLiteral("file_path"), fileName } });
+    }
+
+    const QString filePath = dir.absoluteFilePath("config.json");
+    const QJsonObject root
+    {
+        { QStringLiteral("includes"), includesArray },
+        { QStringLiteral("config"), QJsonObject() }
+    };
+
+    if (!writeFile(filePath, root))
+    {
+        return 1;
+    }
+
+    // Run the benchmark
+    BenchmarkReport report(QStringLiteral("ParallelIncludes"));
+    report.setParameter(QStringLiteral("includes"), includes);
+    report.setParameter(QStringLiteral("nodes"), nodes);
+    report.setParameter(QStringLiteral("iterations"), iterations);
+
+    if ((!runStage(false, filePath, iterations, &report)) ||
+        (!runStage(true, filePath, iterations, &report)))
+    {
+        return 1;
+    }
+
+    return report.write(parser.value(outputOption)) ? 0 : 1;
+}
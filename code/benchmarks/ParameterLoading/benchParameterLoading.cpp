@@ -0,0 +1,273 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a micro benchmark for loading configuration parameters to configuration items
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigTableItem.hpp>
+#include "BenchmarkCommon.hpp"
+
+// Qt includes
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QCoreApplication>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+using namespace CppConfigFramework::Benchmark;
+
+//! Configuration item with hand-written loading and storing of its parameters
+class HandWrittenConfig : public ConfigItem
+{
+public:
+    int count = 0;
+    int limit = 0;
+    double ratio = 0.0;
+    double scale = 0.0;
+    bool enabled = false;
+    bool verbose = false;
+    QString label;
+    QString mode;
+
+private:
+    //! \copydoc    ConfigItem::loadConfigParameters()
+    bool loadConfigParameters(const ConfigObjectNode &config) override
+    {
+        return loadRequiredConfigParameter(&count,
+                                           "count",
+                                           config,
+                                           makeConfigParameterRangeValidator(0, 1000000)) &&
+                loadRequiredConfigParameter(&limit, "limit", config) &&
+                loadRequiredConfigParameter(&ratio, "ratio", config) &&
+                loadOptionalConfigParameter(&scale, "scale", config) &&
+                loadRequiredConfigParameter(&enabled, "enabled", config) &&
+                loadOptionalConfigParameter(&verbose, "verbose", config) &&
+                loadRequiredConfigParameter(&label, "label", config) &&
+                loadOptionalConfigParameter(&mode, "mode", config);
+    }
+
+    //! \copydoc    ConfigItem::storeConfigParameters()
+    bool storeConfigParameters(ConfigObjectNode *config) override
+    {
+        return storeConfigParameter(count, "count", config) &&
+                storeConfigParameter(limit, "limit", config) &&
+                storeConfigParameter(ratio, "ratio", config) &&
+                storeConfigParameter(scale, "scale", config) &&
+                storeConfigParameter(enabled, "enabled", config) &&
+                storeConfigParameter(verbose, "verbose", config) &&
+                storeConfigParameter(label, "label", config) &&
+                storeConfigParameter(mode, "mode", config);
+    }
+};
+
+// -------------------------------------------------------------------------------------------------
+
+//! Configuration item with the same parameters loaded with a parameter batch
+class BatchConfig : public HandWrittenConfig
+{
+private:
+    //! \copydoc    ConfigItem::loadConfigParameters()
+    bool loadConfigParameters(const ConfigObjectNode &config) override
+    {
+        static const ConfigParameterNames s_names
+        {
+            "count", "limit", "ratio", "scale", "enabled", "verbose", "label", "mode"
+        };
+        const ConfigParameterBatch batch(s_names, config);
+
+        return loadRequiredConfigParameter(&count,
+                                           batch,
+                                           0,
+                                           makeConfigParameterRangeValidator(0, 1000000)) &&
+                loadRequiredConfigParameter(&limit, batch, 1) &&
+                loadRequiredConfigParameter(&ratio, batch, 2) &&
+                loadOptionalConfigParameter(&scale, batch, 3) &&
+                loadRequiredConfigParameter(&enabled, batch, 4) &&
+                loadOptionalConfigParameter(&verbose, batch, 5) &&
+                loadRequiredConfigParameter(&label, batch, 6) &&
+                loadOptionalConfigParameter(&mode, batch, 7);
+    }
+};
+
+// -------------------------------------------------------------------------------------------------
+
+//! Configuration item with the same parameters described by a parameter table
+class TableConfig : public ConfigTableItem<TableConfig>
+{
+public:
+    //! Gets the parameter table
+    static auto configParameters()
+    {
+        return makeConfigParameterTable(
+                    CPPCONFIGFRAMEWORK_REQUIRED_PARAMETER(
+                        "count",
+                        &TableConfig::count,
+                        makeConfigParameterRangeValidator(0, 1000000)),
+                    CPPCONFIGFRAMEWORK_REQUIRED_PARAMETER("limit", &TableConfig::limit),
+                    CPPCONFIGFRAMEWORK_REQUIRED_PARAMETER("ratio", &TableConfig::ratio),
+                    CPPCONFIGFRAMEWORK_OPTIONAL_PARAMETER("scale", &TableConfig::scale),
+                    CPPCONFIGFRAMEWORK_REQUIRED_PARAMETER("enabled", &TableConfig::enabled),
+                    CPPCONFIGFRAMEWORK_OPTIONAL_PARAMETER("verbose", &TableConfig::verbose),
+                    CPPCONFIGFRAMEWORK_REQUIRED_PARAMETER("label", &TableConfig::label),
+                    CPPCONFIGFRAMEWORK_OPTIONAL_PARAMETER("mode", &TableConfig::mode));
+    }
+
+    int count = 0;
+    int limit = 0;
+    double ratio = 0.0;
+    double scale = 0.0;
+    bool enabled = false;
+    bool verbose = false;
+    QString label;
+    QString mode;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Creates the configuration node with the parameters
+ *
+ * \param   extraMembers    Number of additional members that are not loaded
+ *
+ * \return  Configuration node
+ */
+static ConfigObjectNode createConfig(const int extraMembers)
+{
+    ConfigObjectNode config;
+    config.setMember("count", ConfigValueNode(10));
+    config.setMember("limit", ConfigValueNode(20));
+    config.setMember("ratio", ConfigValueNode(0.5));
+    config.setMember("scale", ConfigValueNode(2.0));
+    config.setMember("enabled", ConfigValueNode(true));
+    config.setMember("verbose", ConfigValueNode(false));
+    config.setMember("label", ConfigValueNode("label"));
+    config.setMember("mode", ConfigValueNode("mode"));
+
+    for (int i = 0; i < extraMembers; i++)
+    {
+        config.setMember(QString("extra%1").arg(i), ConfigValueNode(i));
+    }
+
+    return config;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    // Parse command line
+    QCommandLineParser parser;
+    parser.setApplicationDescription(
+                "Micro benchmark for loading configuration parameters to configuration items");
+    parser.addHelpOption();
+
+    const QCommandLineOption loadsOption(
+                "loads", "Number of loads in each iteration.", "count", "100000");
+    const QCommandLineOption extraMembersOption(
+                "extra-members", "Number of members that are not loaded.", "count", "8");
+    const QCommandLineOption iterationsOption(
+                "iterations", "Number of iterations for each stage.", "count", "10");
+    const QCommandLineOption outputOption(
+                "output", "Path to the results file (JSON format).", "path");
+
+    parser.addOptions({
+                          loadsOption,
+                          extraMembersOption,
+                          iterationsOption,
+                          outputOption
+                      });
+    parser.process(app);
+
+    const int loads = std::max(1, parser.value(loadsOption).toInt());
+    const int extraMembers = std::max(0, parser.value(extraMembersOption).toInt());
+    const int iterations = std::max(1, parser.value(iterationsOption).toInt());
+
+    const ConfigObjectNode config = createConfig(extraMembers);
+
+    // Run the benchmark
+    BenchmarkReport report(QStringLiteral("ParameterLoading"));
+    report.setParameter(QStringLiteral("loads"), loads);
+    report.setParameter(QStringLiteral("extra_members"), extraMembers);
+    report.setParameter(QStringLiteral("iterations"), iterations);
+
+    // Reference: hand-written chain of loadRequiredConfigParameter() calls
+    int handWrittenFailures = 0;
+
+    report.addStage(QStringLiteral("hand_written"), measure(iterations, [&]()
+    {
+        for (int i = 0; i < loads; i++)
+        {
+            HandWrittenConfig item;
+
+            if (!item.loadConfig(config))
+            {
+                handWrittenFailures++;
+            }
+        }
+    }));
+
+    // Parameter batch
+    int batchFailures = 0;
+
+    report.addStage(QStringLiteral("parameter_batch"), measure(iterations, [&]()
+    {
+        for (int i = 0; i < loads; i++)
+        {
+            BatchConfig item;
+
+            if (!item.loadConfig(config))
+            {
+                batchFailures++;
+            }
+        }
+    }));
+
+    // Parameter table
+    int tableFailures = 0;
+
+    report.addStage(QStringLiteral("parameter_table"), measure(iterations, [&]()
+    {
+        for (int i = 0; i < loads; i++)
+        {
+            TableConfig item;
+
+            if (!item.loadConfig(config))
+            {
+                tableFailures++;
+            }
+        }
+    }));
+
+    if ((handWrittenFailures != 0) || (batchFailures != 0) || (tableFailures != 0))
+    {
+        QTextStream(stderr) << "Loading failed: " << handWrittenFailures << " hand-written, "
+                            << batchFailures << " parameter batch, "
+                            << tableFailures << " parameter table\n";
+        return 1;
+    }
+
+    return report.write(parser.value(outputOption)) ? 0 : 1;
+}
@@ -0,0 +1,237 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a benchmark for reading a configuration snapshot from many threads while it is replaced
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/ConfigSnapshotHolder.hpp>
+#include <CppConfigFramework/ConfigValueNode.hpp>
+#include "BenchmarkCommon.hpp"
+
+// Qt includes
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QMutex>
+#include <QtCore/QMutexLocker>
+
+// System includes
+#include <atomic>
+#include <thread>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+using namespace CppConfigFramework::Benchmark;
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Creates a configuration snapshot
+ *
+ * \param   members     Number of members
+ * \param   version     Version stored in the members
+ *
+ * \return  Configuration snapshot
+ */
+static std::unique_ptr<ConfigObjectNode> createSnapshot(const int members, const int version)
+{
+    auto snapshot = std::make_unique<ConfigObjectNode>();
+
+    for (int i = 0; i < members; i++)
+    {
+        snapshot->setMember(QString("member%1").arg(i), ConfigValueNode(version));
+    }
+
+    return snapshot;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Runs the reader threads while the snapshot is replaced by a writer thread
+ *
+ * \param   threads     Number of reader threads
+ * \param   reads       Number of reads in each reader thread
+ * \param   publishes   Number of snapshots published while the readers are running
+ * \param   members     Number of members in each snapshot
+ * \param   read        Functor that reads the current snapshot (returns a value from it)
+ * \param   publish     Functor that publishes a new snapshot
+ */
+static void runReaders(const int threads,
+                       const int reads,
+                       const int publishes,
+                       const int members,
+                       const std::function<int()> &read,
+                       const std::function<void(std::unique_ptr<ConfigObjectNode>)> &publish)
+{
+    std::atomic<int> finishedReaders(0);
+    std::atomic<int> checksum(0);
+    std::vector<std::thread> readers;
+    readers.reserve(static_cast<size_t>(threads));
+
+    for (int i = 0; i < threads; i++)
+    {
+        readers.emplace_back([&]()
+        {
+            int sum = 0;
+
+            for (int j = 0; j < reads; j++)
+            {
+                sum += read();
+            }
+
+            checksum += sum;
+            finishedReaders++;
+        });
+    }
+
+    // Publish new snapshots while the readers are running
+    for (int i = 1; (i <= publishes) && (finishedReaders.load() < threads); i++)
+    {
+        publish(createSnapshot(members, i));
+        std::this_thread::yield();
+    }
+
+    for (auto &reader : readers)
+    {
+        reader.join();
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    // Parse command line
+    QCommandLineParser parser;
+    parser.setApplicationDescription(
+                "Benchmark for reading a configuration snapshot from many threads while it is "
+                "replaced");
+    parser.addHelpOption();
+
+    const QCommandLineOption threadsOption(
+                "threads", "Number of reader threads.", "count", "64");
+    const QCommandLineOption readsOption(
+                "reads", "Number of reads in each reader thread.", "count", "100000");
+    const QCommandLineOption publishesOption(
+                "publishes", "Number of snapshots published during each iteration.", "count",
+                "100");
+    const QCommandLineOption membersOption(
+                "members", "Number of members in each snapshot.", "count", "100");
+    const QCommandLineOption iterationsOption(
+                "iterations", "Number of iterations for each stage.", "count", "5");
+    const QCommandLineOption outputOption(
+                "output", "Path to the results file (JSON format).", "path");
+
+    parser.addOptions({
+                          threadsOption,
+                          readsOption,
+                          publishesOption,
+                          membersOption,
+                          iterationsOption,
+                          outputOption
+                      });
+    parser.process(app);
+
+    const int threads = std::max(1, parser.value(threadsOption).toInt());
+    const int reads = std::max(1, parser.value(readsOption).toInt());
+    const int publishes = std::max(0, parser.value(publishesOption).toInt());
+    const int members = std::max(1, parser.value(membersOption).toInt());
+    const int iterations = std::max(1, parser.value(iterationsOption).toInt());
+
+    const QString memberName = QStringLiteral("member0");
+
+    // Run the benchmark
+    BenchmarkReport report(QStringLiteral("SnapshotContention"));
+    report.setParameter(QStringLiteral("threads"), threads);
+    report.setParameter(QStringLiteral("reads"), reads);
+    report.setParameter(QStringLiteral("publishes"), publishes);
+    report.setParameter(QStringLiteral("members"), members);
+    report.setParameter(QStringLiteral("iterations"), iterations);
+
+    // Baseline: shared pointer guarded by a mutex
+    {
+        QMutex mutex;
+        std::shared_ptr<const ConfigObjectNode> snapshot = createSnapshot(members, 0);
+
+        report.addStage(QStringLiteral("mutex_shared_ptr"), measure(iterations, [&]()
+        {
+            runReaders(threads, reads, publishes, members, [&]()
+            {
+                std::shared_ptr<const ConfigObjectNode> current;
+
+                {
+                    QMutexLocker locker(&mutex);
+                    current = snapshot;
+                }
+
+                return current->member(memberName)->toValue().value().toInt();
+            },
+            [&](std::unique_ptr<ConfigObjectNode> newSnapshot)
+            {
+                std::shared_ptr<const ConfigObjectNode> sharedSnapshot(std::move(newSnapshot));
+                QMutexLocker locker(&mutex);
+                snapshot.swap(sharedSnapshot);
+            });
+        }));
+    }
+
+    // Snapshot holder: shared pointer copies
+    {
+        ConfigSnapshotHolder holder(createSnapshot(members, 0));
+
+        report.addStage(QStringLiteral("holder_load"), measure(iterations, [&]()
+        {
+            runReaders(threads, reads, publishes, members, [&]()
+            {
+                return holder.load()->member(memberName)->toValue().value().toInt();
+            },
+            [&](std::unique_ptr<ConfigObjectNode> newSnapshot)
+            {
+                holder.publish(std::move(newSnapshot));
+            });
+        }));
+    }
+
+    // Snapshot holder: pins
+    {
+        ConfigSnapshotHolder holder(createSnapshot(members, 0));
+
+        report.addStage(QStringLiteral("holder_pin"), measure(iterations, [&]()
+        {
+            runReaders(threads, reads, publishes, members, [&]()
+            {
+                auto pin = holder.pin();
+                return pin->member(memberName)->toValue().value().toInt();
+            },
+            [&](std::unique_ptr<ConfigObjectNode> newSnapshot)
+            {
+                holder.publish(std::move(newSnapshot));
+            });
+        }));
+    }
+
+    return report.write(parser.value(outputOption)) ? 0 : 1;
+}
@@ -0,0 +1,300 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a benchmark for loading a resolved configuration (JSON configuration vs. snapshot)
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/ConfigReader.hpp>
+#include <CppConfigFramework/ConfigSnapshotReader.hpp>
+#include <CppConfigFramework/ConfigWriter.hpp>
+#include "BenchmarkCommon.hpp"
+
+// Qt includes
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QTemporaryDir>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+using namespace CppConfigFramework::Benchmark;
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Generates a configuration tree with values, NodeReference nodes and environment variables
+ *
+ * \param   depth           Depth of the tree
+ * \param   fanOut          Number of members in each Object node
+ * \param   referencePath   Node path used by the NodeReference nodes
+ *
+ * \return  Generated configuration
+ */
+static QJsonObject generateConfig(const int depth, const int fanOut, const QString &referencePath)
+{
+    QJsonObject object;
+
+    for (int i = 0; i < fanOut; i++)
+    {
+        const QString name = QString("member%1").arg(i);
+
+        if (depth > 1)
+        {
+            object.insert(name, generateConfig(depth - 1, fanOut, referencePath));
+            continue;
+        }
+
+        switch (i % 4)
+        {
+            case 0:
+                object.insert(name, i);
+                break;
+
+            case 1:
+                object.insert(QStringLiteral("$") + name,
+                              QString("${BENCHMARK_VALUE} of the member %1").arg(i));
+                break;
+
+            case 2:
+                object.insert(name, QJsonArray { i, 0.5 * i, (i % 3) == 0, QJsonValue() });
+                break;
+
+            default:
+                object.insert(QStringLiteral("&") + name, referencePath);
+                break;
+        }
+    }
+
+    return object;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Writes the file
+ *
+ * \param   filePath    Path to the file
+ * \param   contents    File contents
+ *
+ * \return  Size of the written file or -1 in case of failure
+ */
+static qint64 writeFile(const QString &filePath, const QByteArray &contents)
+{
+    QFile file(filePath);
+
+    if (!file.open(QIODevice::WriteOnly))
+    {
+        return -1;
+    }
+
+    return file.write(contents);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    // Parse command line
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Benchmark for loading a resolved configuration");
+    parser.addHelpOption();
+
+    const QCommandLineOption depthOption(
+                "depth", "Depth of the configuration tree.", "count", "4");
+    const QCommandLineOption fanOutOption(
+                "fan-out", "Number of members in each Object node.", "count", "20");
+    const QCommandLineOption iterationsOption(
+                "iterations", "Number of iterations for each stage.", "count", "5");
+    const QCommandLineOption outputOption(
+                "output", "Path to the results file (JSON format).", "path");
+
+    parser.addOptions({
+                          depthOption,
+                          fanOutOption,
+                          iterationsOption,
+                          outputOption
+                      });
+    parser.process(app);
+
+    const int depth = std::max(1, parser.value(depthOption).toInt());
+    const int fanOut = std::max(1, parser.value(fanOutOption).toInt());
+    const int iterations = std::max(1, parser.value(iterationsOption).toInt());
+
+    // Generate the configuration file
+    QTemporaryDir directory;
+
+    if (!directory.isValid())
+    {
+        QTextStream(stderr) << "Failed to create a temporary directory\n";
+        return 1;
+    }
+
+    const QString configFilePath = QDir(directory.path()).absoluteFilePath("config.json");
+    const QString snapshotFilePath = QDir(directory.path()).absoluteFilePath("config.ccfs");
+
+    // All NodeReference nodes reference the first leaf node (an integer Value node)
+    const QString referencePath = QStringLiteral("/member0").repeated(depth);
+    const QJsonObject root
+    {
+        {
+            QStringLiteral("environment_variables"),
+            QJsonObject { { QStringLiteral("BENCHMARK_VALUE"), QStringLiteral("value") } }
+        },
+        { QStringLiteral("config"), generateConfig(depth, fanOut, referencePath) }
+    };
+
+    const qint64 configFileSize =
+            writeFile(configFilePath, QJsonDocument(root).toJson(QJsonDocument::Indented));
+
+    if (configFileSize < 0)
+    {
+        QTextStream(stderr) << "Failed to write the configuration file\n";
+        return 1;
+    }
+
+    // Run the benchmark
+    BenchmarkReport report(QStringLiteral("SnapshotReading"));
+    report.setParameter(QStringLiteral("depth"), depth);
+    report.setParameter(QStringLiteral("fan_out"), fanOut);
+    report.setParameter(QStringLiteral("iterations"), iterations);
+    report.setMetric(QStringLiteral("json_file_size_bytes"), static_cast<double>(configFileSize));
+
+    const auto processEnvironmentVariables = EnvironmentVariables::loadFromProcess();
+    EnvironmentVariables environmentVariables;
+    ConfigReader reader;
+    ConfigSnapshotReader snapshotReader;
+    std::unique_ptr<ConfigObjectNode> tree;
+    bool success = true;
+
+    // Read, expand and resolve the JSON configuration
+    report.addStage(QStringLiteral("json_read"), measure(iterations, [&]()
+    {
+        tree.reset();
+        environmentVariables = processEnvironmentVariables;
+    },
+    [&]()
+    {
+        tree = reader.read(configFilePath,
+                           QDir::current(),
+                           ConfigNodePath::ROOT_PATH,
+                           ConfigNodePath::ROOT_PATH,
+                           {},
+                           &environmentVariables);
+        success = success && static_cast<bool>(tree);
+    }));
+
+    if (!success)
+    {
+        QTextStream(stderr) << "Failed to read the generated configuration file\n";
+        return 1;
+    }
+
+    // Write the resolved configuration to a snapshot
+    const auto resolvedTree = std::move(tree);
+
+    report.addStage(QStringLiteral("snapshot_write"), measure(iterations, []() {}, [&]()
+    {
+        success = success && ConfigWriter::writeToSnapshotFile(*resolvedTree, snapshotFilePath);
+    }));
+
+    if (!success)
+    {
+        QTextStream(stderr) << "Failed to write the snapshot file\n";
+        return 1;
+    }
+
+    report.setMetric(QStringLiteral("snapshot_file_size_bytes"),
+                     static_cast<double>(QFileInfo(snapshotFilePath).size()));
+
+    // Load the snapshot
+    report.addStage(QStringLiteral("snapshot_read"), measure(iterations, [&]()
+    {
+        tree.reset();
+        environmentVariables = processEnvironmentVariables;
+    },
+    [&]()
+    {
+        tree = snapshotReader.read(snapshotFilePath,
+                                   QDir::current(),
+                                   ConfigNodePath::ROOT_PATH,
+                                   ConfigNodePath::ROOT_PATH,
+                                   &environmentVariables);
+        success = success && static_cast<bool>(tree);
+    }));
+
+    if ((!success) || (!(*tree == *resolvedTree)))
+    {
+        QTextStream(stderr) << "Failed to read the snapshot file\n";
+        return 1;
+    }
+
+    // Read the JSON configuration with a cache directory (as a restarted process would)
+    ConfigReader cachingReader;
+    cachingReader.setCacheDirectory(QDir(directory.path()).absoluteFilePath("cache"));
+
+    environmentVariables = processEnvironmentVariables;
+    tree = cachingReader.read(configFilePath,
+                              QDir::current(),
+                              ConfigNodePath::ROOT_PATH,
+                              ConfigNodePath::ROOT_PATH,
+                              {},
+                              &environmentVariables);
+
+    report.addStage(QStringLiteral("cache_directory_read"), measure(iterations, [&]()
+    {
+        tree.reset();
+        environmentVariables = processEnvironmentVariables;
+    },
+    [&]()
+    {
+        tree = cachingReader.read(configFilePath,
+                                  QDir::current(),
+                                  ConfigNodePath::ROOT_PATH,
+                                  ConfigNodePath::ROOT_PATH,
+                                  {},
+                                  &environmentVariables);
+        success = success && static_cast<bool>(tree);
+    }));
+
+    if ((!success) || (!(*tree == *resolvedTree)))
+    {
+        QTextStream(stderr) << "Failed to read the configuration with a cache directory\n";
+        return 1;
+    }
+
+    const qint64 peakRss = readProcessMemory(QStringLiteral("VmHWM"));
+
+    if (peakRss >= 0)
+    {
+        report.setMetric(QStringLiteral("peak_rss_kb"), static_cast<double>(peakRss));
+    }
+
+    return report.write(parser.value(outputOption)) ? 0 : 1;
+}
@@ -0,0 +1,305 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a benchmark for the allocation of whole configuration trees (heap vs. arena)
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigNodeArena.hpp>
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/ConfigReader.hpp>
+#include "BenchmarkCommon.hpp"
+
+// Qt includes
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QCoreApplication>
+
+// System includes
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+using namespace CppConfigFramework::Benchmark;
+
+//! Holds the number of heap allocations made by the process
+static std::atomic<qint64> s_allocationCount(0);
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Global allocation function that counts the heap allocations
+ *
+ * \param   size    Size of the memory block
+ *
+ * \return  Allocated memory
+ */
+void *operator new(size_t size)
+{
+    s_allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+    void *pointer = std::malloc((size == 0U) ? 1U : size);
+
+    if (pointer == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    return pointer;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Global deallocation function matching the counting allocation function
+ *
+ * \param   pointer     Memory block
+ */
+void operator delete(void *pointer) noexcept
+{
+    std::free(pointer);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Global sized deallocation function matching the counting allocation function
+ *
+ * \param   pointer     Memory block
+ */
+void operator delete(void *pointer, size_t) noexcept
+{
+    std::free(pointer);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Generates a configuration tree
+ *
+ * \param   depth   Depth of the tree
+ * \param   fanOut  Number of members in each Object node
+ *
+ * \return  Generated configuration
+ */
+static QJsonObject generateConfig(const int depth, const int fanOut)
+{
+    QJsonObject object;
+
+    for (int i = 0; i < fanOut; i++)
+    {
+        const QString name = QString("member%1").arg(i);
+
+        if (depth > 1)
+        {
+            object.insert(name, generateConfig(depth - 1, fanOut));
+        }
+        else if ((i % 2) == 0)
+        {
+            object.insert(name, i);
+        }
+        else
+        {
+            object.insert(name, QJsonArray { QString("item%1").arg(i), i, (i % 3) == 0 });
+        }
+    }
+
+    return object;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Runs all stages for the specified allocation mode
+ *
+ * \param   prefix      Prefix for the names of the stages and metrics
+ * \param   arena       Flag for enabling the arena allocation
+ * \param   config      Configuration to read
+ * \param   iterations  Number of iterations for each stage
+ *
+ * \param[out]  report  Benchmark report
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+static bool runStages(const QString &prefix,
+                      const bool arena,
+                      const QJsonObject &config,
+                      const int iterations,
+                      BenchmarkReport *report)
+{
+    ConfigReader reader;
+    reader.setArenaAllocationEnabled(arena);
+
+    const auto processEnvironmentVariables = EnvironmentVariables::loadFromProcess();
+    EnvironmentVariables environmentVariables;
+    std::unique_ptr<ConfigObjectNode> tree;
+    bool success = true;
+
+    // Build
+    qint64 allocationCount = 0;
+
+    report->addStage(prefix + QStringLiteral("_build"), measure(iterations, [&]()
+    {
+        tree.reset();
+        environmentVariables = processEnvironmentVariables;
+    },
+    [&]()
+    {
+        const qint64 allocationsBefore = s_allocationCount.load(std::memory_order_relaxed);
+
+        tree = reader.read(config,
+                           QDir::current(),
+                           ConfigNodePath::ROOT_PATH,
+                           ConfigNodePath::ROOT_PATH,
+                           {},
+                           &environmentVariables);
+
+        allocationCount = s_allocationCount.load(std::memory_order_relaxed) - allocationsBefore;
+        success = success && static_cast<bool>(tree);
+    }));
+
+    if (!success)
+    {
+        QTextStream(stderr) << "Failed to read the generated configuration\n";
+        return false;
+    }
+
+    // Memory usage of the last tree (RSS delta is only indicative as freed memory may be reused)
+    const qint64 rssBefore = readProcessMemory(QStringLiteral("VmRSS"));
+    tree.reset();
+    environmentVariables = processEnvironmentVariables;
+
+    tree = reader.read(config,
+                       QDir::current(),
+                       ConfigNodePath::ROOT_PATH,
+                       ConfigNodePath::ROOT_PATH,
+                       {},
+                       &environmentVariables);
+    const qint64 rssAfter = readProcessMemory(QStringLiteral("VmRSS"));
+
+    report->setMetric(prefix + QStringLiteral("_allocations_per_tree"),
+                      static_cast<double>(allocationCount));
+
+    if ((rssBefore >= 0) && (rssAfter >= 0))
+    {
+        report->setMetric(prefix + QStringLiteral("_rss_delta_kb"),
+                          static_cast<double>(rssAfter - rssBefore));
+    }
+
+    // Teardown
+    report->addStage(prefix + QStringLiteral("_teardown"), measure(iterations, [&]()
+    {
+        environmentVariables = processEnvironmentVariables;
+        tree = reader.read(config,
+                           QDir::current(),
+                           ConfigNodePath::ROOT_PATH,
+                           ConfigNodePath::ROOT_PATH,
+                           {},
+                           &environmentVariables);
+    },
+    [&]()
+    {
+        tree.reset();
+    }));
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    // Parse command line
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Benchmark for the allocation of whole configuration trees");
+    parser.addHelpOption();
+
+    const QCommandLineOption depthOption(
+                "depth", "Depth of the configuration tree.", "count", "4");
+    const QCommandLineOption fanOutOption(
+                "fan-out", "Number of members in each Object node.", "count", "16");
+    const QCommandLineOption modeOption(
+                "mode",
+                "Allocation mode: 'heap', 'arena' or 'both' (a single mode isolates its peak RSS).",
+                "mode",
+                "both");
+    const QCommandLineOption iterationsOption(
+                "iterations", "Number of iterations for each stage.", "count", "5");
+    const QCommandLineOption outputOption(
+                "output", "Path to the results file (JSON format).", "path");
+
+    parser.addOptions({
+                          depthOption,
+                          fanOutOption,
+                          modeOption,
+                          iterationsOption,
+                          outputOption
+                      });
+    parser.process(app);
+
+    const int depth = std::max(1, parser.value(depthOption).toInt());
+    const int fanOut = std::max(1, parser.value(fanOutOption).toInt());
+    const QString mode = parser.value(modeOption);
+    const int iterations = std::max(1, parser.value(iterationsOption).toInt());
+
+    if ((mode != QStringLiteral("heap")) &&
+        (mode != QStringLiteral("arena")) &&
+        (mode != QStringLiteral("both")))
+    {
+        QTextStream(stderr) << "Invalid mode: " << mode << '\n';
+        return 1;
+    }
+
+    // Run the benchmark
+    BenchmarkReport report(QStringLiteral("TreeAllocation"));
+    report.setParameter(QStringLiteral("depth"), depth);
+    report.setParameter(QStringLiteral("fan_out"), fanOut);
+    report.setParameter(QStringLiteral("mode"), mode);
+    report.setParameter(QStringLiteral("iterations"), iterations);
+
+    const QJsonObject config { { QStringLiteral("config"), generateConfig(depth, fanOut) } };
+
+    if ((mode != QStringLiteral("arena")) &&
+        (!runStages(QStringLiteral("heap"), false, config, iterations, &report)))
+    {
+        return 1;
+    }
+
+    if ((mode != QStringLiteral("heap")) &&
+        (!runStages(QStringLiteral("arena"), true, config, iterations, &report)))
+    {
+        return 1;
+    }
+
+    const qint64 peakRss = readProcessMemory(QStringLiteral("VmHWM"));
+
+    if (peakRss >= 0)
+    {
+        report.setMetric(QStringLiteral("peak_rss_kb"), static_cast<double>(peakRss));
+    }
+
+    return report.write(parser.value(outputOption)) ? 0 : 1;
+}
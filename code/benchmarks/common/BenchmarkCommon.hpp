@@ -0,0 +1,291 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains helpers shared by all benchmarks (timing and machine-readable result reporting)
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+
+// Qt includes
+#include <QtCore/QDateTime>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QStringList>
+#include <QtCore/QSysInfo>
+#include <QtCore/QTextStream>
+
+// System includes
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+// Forward declarations
+
+// Macros
+#ifndef CPPCONFIGFRAMEWORK_VERSION
+#define CPPCONFIGFRAMEWORK_VERSION "unknown"
+#endif
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+namespace Benchmark
+{
+
+/*!
+ * Measures the execution time of a benchmark stage
+ *
+ * \param   iterations  Number of iterations
+ * \param   setup       Functor that prepares the input for an iteration (not measured)
+ * \param   run         Functor that executes the measured stage
+ *
+ * \return  Execution time of each of the iterations in nanoseconds
+ */
+inline std::vector<qint64> measure(const int iterations,
+                                   const std::function<void()> &setup,
+                                   const std::function<void()> &run)
+{
+    std::vector<qint64> samples;
+    samples.reserve(static_cast<size_t>(iterations));
+
+    for (int i = 0; i < iterations; i++)
+    {
+        if (setup)
+        {
+            setup();
+        }
+
+        QElapsedTimer timer;
+        timer.start();
+
+        run();
+
+        samples.push_back(timer.nsecsElapsed());
+    }
+
+    return samples;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+//! \copydoc    CppConfigFramework::Benchmark::measure()
+inline std::vector<qint64> measure(const int iterations, const std::function<void()> &run)
+{
+    return measure(iterations, {}, run);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Reads a memory usage value of the current process
+ *
+ * \param   key     Name of the value in "/proc/self/status" (for example "VmRSS" or "VmHWM")
+ *
+ * \return  Memory usage in kilobytes or -1 if it is not available on this platform
+ */
+inline qint64 readProcessMemory(const QString &key)
+{
+    QFile file(QStringLiteral("/proc/self/status"));
+
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        return -1;
+    }
+
+    const QString prefix = key + QChar(':');
+    const QStringList lines = QString::fromLatin1(file.readAll()).split(QChar('\n'));
+
+    for (const QString &line : lines)
+    {
+        if (line.startsWith(prefix))
+        {
+            // Format: "<key>:    <value> kB"
+            bool ok = false;
+            const qint64 value = line.mid(prefix.size()).trimmed().split(QChar(' ')).first()
+                                 .toLongLong(&ok);
+            return (ok ? value : -1);
+        }
+    }
+
+    return -1;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Converts the measured samples to statistics
+ *
+ * \param   samples     Execution time of each of the iterations in nanoseconds
+ *
+ * \return  JSON Object with min, max, mean and median execution time in nanoseconds
+ */
+inline QJsonObject toStatistics(std::vector<qint64> samples)
+{
+    QJsonObject statistics;
+
+    if (samples.empty())
+    {
+        return statistics;
+    }
+
+    std::sort(samples.begin(), samples.end());
+
+    const double sum = std::accumulate(samples.begin(), samples.end(), 0.0);
+    const size_t middle = samples.size() / 2U;
+    const double median = ((samples.size() % 2U) == 0U)
+                          ? ((static_cast<double>(samples.at(middle - 1U)) +
+                              static_cast<double>(samples.at(middle))) / 2.0)
+                          : static_cast<double>(samples.at(middle));
+
+    statistics.insert(QStringLiteral("iterations"), static_cast<int>(samples.size()));
+    statistics.insert(QStringLiteral("min_ns"), static_cast<double>(samples.front()));
+    statistics.insert(QStringLiteral("max_ns"), static_cast<double>(samples.back()));
+    statistics.insert(QStringLiteral("mean_ns"), sum / static_cast<double>(samples.size()));
+    statistics.insert(QStringLiteral("median_ns"), median);
+
+    return statistics;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+//! This class collects the benchmark results and writes them out in JSON format
+class BenchmarkReport
+{
+public:
+    /*!
+     * Constructor
+     *
+     * \param   benchmarkName   Name of the benchmark
+     */
+    explicit BenchmarkReport(const QString &benchmarkName)
+        : m_benchmarkName(benchmarkName)
+    {
+    }
+
+    /*!
+     * Sets a benchmark parameter
+     *
+     * \param   name    Parameter name
+     * \param   value   Parameter value
+     */
+    void setParameter(const QString &name, const QJsonValue &value)
+    {
+        m_parameters.insert(name, value);
+    }
+
+    /*!
+     * Sets an additional (non-timing) metric
+     *
+     * \param   name    Metric name
+     * \param   value   Metric value
+     */
+    void setMetric(const QString &name, const QJsonValue &value)
+    {
+        m_metrics.insert(name, value);
+    }
+
+    /*!
+     * Adds the results of a measured stage
+     *
+     * \param   name        Stage name
+     * \param   samples     Execution time of each of the iterations in nanoseconds
+     */
+    void addStage(const QString &name, const std::vector<qint64> &samples)
+    {
+        QJsonObject stage = toStatistics(samples);
+        stage.insert(QStringLiteral("name"), name);
+
+        m_stages.append(stage);
+    }
+
+    /*!
+     * Converts the report to JSON
+     *
+     * \return  JSON document
+     */
+    QJsonDocument toJson() const
+    {
+        const QJsonObject root
+        {
+            { QStringLiteral("benchmark"), m_benchmarkName },
+            { QStringLiteral("library_version"), QStringLiteral(CPPCONFIGFRAMEWORK_VERSION) },
+            { QStringLiteral("qt_version"), QString::fromLatin1(qVersion()) },
+            { QStringLiteral("cpu_architecture"), QSysInfo::currentCpuArchitecture() },
+            { QStringLiteral("timestamp"),
+              QDateTime::currentDateTimeUtc().toString(Qt::ISODate) },
+            { QStringLiteral("parameters"), m_parameters },
+            { QStringLiteral("metrics"), m_metrics },
+            { QStringLiteral("stages"), m_stages }
+        };
+
+        return QJsonDocument(root);
+    }
+
+    /*!
+     * Writes the report to the specified file or to the standard output if the file path is empty
+     *
+     * \param   filePath    Path to the output file
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool write(const QString &filePath) const
+    {
+        const QByteArray data = toJson().toJson(QJsonDocument::Indented);
+
+        if (filePath.isEmpty())
+        {
+            QTextStream(stdout) << data;
+            return true;
+        }
+
+        QFile file(filePath);
+
+        if (!file.open(QIODevice::WriteOnly))
+        {
+            QTextStream(stderr) << "Failed to open the output file: " << filePath << '\n';
+            return false;
+        }
+
+        return (file.write(data) == static_cast<qint64>(data.size()));
+    }
+
+private:
+    //! Holds the name of the benchmark
+    QString m_benchmarkName;
+
+    //! Holds the benchmark parameters
+    QJsonObject m_parameters;
+
+    //! Holds the additional metrics
+    QJsonObject m_metrics;
+
+    //! Holds the results of the measured stages
+    QJsonArray m_stages;
+};
+
+} // namespace Benchmark
+
+} // namespace CppConfigFramework
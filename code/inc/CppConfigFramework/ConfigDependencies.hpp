@@ -0,0 +1,268 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains classes for recording the dependencies of a read configuration
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/CppConfigFrameworkExport.hpp>
+
+// Qt includes
+#include <QtCore/QDateTime>
+#include <QtCore/QMap>
+#include <QtCore/QSet>
+#include <QtCore/QString>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+class ConfigObjectNode;
+
+/*!
+ * This class holds the dependencies of a read configuration: the files that were read, the
+ * environment variables that were used and the external configs that references were resolved from
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigDependencies
+{
+public:
+    //! Holds the fingerprint of a file
+    struct File
+    {
+        //! Size of the file
+        qint64 size = -1;
+
+        //! Time of the last modification of the file
+        QDateTime lastModified;
+    };
+
+public:
+    /*!
+     * Creates the fingerprint of a file
+     *
+     * \param   absoluteFilePath    Absolute path to the file
+     *
+     * \return  Fingerprint of the file
+     */
+    static File fileFingerprint(const QString &absoluteFilePath);
+
+    /*!
+     * Calculates the hash of the contents of a file
+     *
+     * \param   absoluteFilePath    Absolute path to the file
+     *
+     * \return  Hash of the file contents (SHA-1) or an empty byte array if the file can't be read
+     *
+     * The hash detects files that were rewritten with the same contents (for example when they
+     * are deployed again) which changes their modification time but not the configuration.
+     */
+    static QByteArray fileContentHash(const QString &absoluteFilePath);
+
+    /*!
+     * Gets the files that were read
+     *
+     * \return  Fingerprints of the files (absolute file path is used as the key)
+     */
+    const QMap<QString, File> &files() const;
+
+    /*!
+     * Gets the names of the environment variables that were used
+     *
+     * \return  Names of the environment variables
+     *
+     * \note    Environment variables that were set before they were used are not included as their
+     *          values don't depend on their initial values
+     */
+    const QSet<QString> &environmentVariables() const;
+
+    /*!
+     * Gets the names of the environment variables that were set
+     *
+     * \return  Names of the environment variables
+     */
+    const QSet<QString> &writtenEnvironmentVariables() const;
+
+    /*!
+     * Gets the external configs that references were resolved from
+     *
+     * \return  External configs
+     */
+    const QSet<const ConfigObjectNode *> &externalConfigs() const;
+
+    /*!
+     * Adds a file that was read
+     *
+     * \param   absoluteFilePath    Absolute path to the file
+     */
+    void addFile(const QString &absoluteFilePath);
+
+    /*!
+     * Adds an environment variable that was used
+     *
+     * \param   name    Environment variable name
+     */
+    void addEnvironmentVariable(const QString &name);
+
+    /*!
+     * Adds an environment variable that was set
+     *
+     * \param   name    Environment variable name
+     */
+    void addWrittenEnvironmentVariable(const QString &name);
+
+    /*!
+     * Adds an external config that a reference was resolved from
+     *
+     * \param   externalConfig  External config
+     */
+    void addExternalConfig(const ConfigObjectNode *externalConfig);
+
+    /*!
+     * Replaces an external config with another one
+     *
+     * \param   externalConfig  External config to replace
+     * \param   replacement     Replacement
+     *
+     * This is useful if the dependencies were recorded while reading with a copy of the external
+     * config.
+     */
+    void replaceExternalConfig(const ConfigObjectNode *externalConfig,
+                               const ConfigObjectNode *replacement);
+
+    //! Removes all external configs
+    void clearExternalConfigs();
+
+    /*!
+     * Merges the dependencies that were recorded after the dependencies in this instance
+     *
+     * \param   other   Other dependencies
+     */
+    void merge(const ConfigDependencies &other);
+
+private:
+    //! Files that were read
+    QMap<QString, File> m_files;
+
+    //! Environment variables that were used
+    QSet<QString> m_environmentVariables;
+
+    //! Environment variables that were set
+    QSet<QString> m_writtenEnvironmentVariables;
+
+    //! External configs that references were resolved from
+    QSet<const ConfigObjectNode *> m_externalConfigs;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * This class records the dependencies of the configuration that is read in the current thread for
+ * the lifetime of the scope
+ *
+ * Recorders can be nested. When a recorder goes out of scope its dependencies are merged to the
+ * recorder that was active before it.
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigDependencyRecorder
+{
+public:
+    //! Constructor
+    ConfigDependencyRecorder();
+
+    //! Copy constructor is disabled
+    ConfigDependencyRecorder(const ConfigDependencyRecorder &) = delete;
+
+    //! Move constructor is disabled
+    ConfigDependencyRecorder(ConfigDependencyRecorder &&) = delete;
+
+    //! Destructor
+    ~ConfigDependencyRecorder();
+
+    //! Copy assignment operator is disabled
+    ConfigDependencyRecorder &operator=(const ConfigDependencyRecorder &) = delete;
+
+    //! Move assignment operator is disabled
+    ConfigDependencyRecorder &operator=(ConfigDependencyRecorder &&) = delete;
+
+    /*!
+     * Gets the recorder that is active for the current thread
+     *
+     * \return  Active recorder or nullptr if no recorder is active
+     */
+    static ConfigDependencyRecorder *current();
+
+    /*!
+     * Records a file that was read (if a recorder is active for the current thread)
+     *
+     * \param   absoluteFilePath    Absolute path to the file
+     */
+    static void recordFile(const QString &absoluteFilePath);
+
+    /*!
+     * Records an environment variable that was used (if a recorder is active for the current
+     * thread)
+     *
+     * \param   name    Environment variable name
+     */
+    static void recordEnvironmentVariable(const QString &name);
+
+    /*!
+     * Records an environment variable that was set (if a recorder is active for the current thread)
+     *
+     * \param   name    Environment variable name
+     */
+    static void recordWrittenEnvironmentVariable(const QString &name);
+
+    /*!
+     * Records an external config that a reference was resolved from (if a recorder is active for
+     * the current thread)
+     *
+     * \param   externalConfig  External config
+     */
+    static void recordExternalConfig(const ConfigObjectNode *externalConfig);
+
+    /*!
+     * Gets the recorded dependencies
+     *
+     * \return  Recorded dependencies
+     */
+    const ConfigDependencies &dependencies() const;
+
+    /*!
+     * Gets the recorded dependencies
+     *
+     * \return  Recorded dependencies
+     */
+    ConfigDependencies &dependencies();
+
+private:
+    //! Recorded dependencies
+    ConfigDependencies m_dependencies;
+
+    //! Recorder that was active before this one
+    ConfigDependencyRecorder *m_previousRecorder;
+};
+
+} // namespace CppConfigFramework
@@ -0,0 +1,173 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a class that holds the structural differences between two configuration trees
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigNodePath.hpp>
+
+// Qt includes
+#include <QtCore/QStringList>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+class ConfigNode;
+class ConfigObjectNode;
+
+/*!
+ * This class holds the structural differences between two configuration trees
+ *
+ * The trees are walked in lockstep: the members of each pair of Object nodes are matched in a
+ * single merge pass over the atoms of their names. Node paths are only created for the nodes that
+ * differ and Object nodes that share their members (clones) are not walked at all.
+ *
+ * Differences are reported for the topmost nodes only: if a node was added, removed or its type was
+ * changed its descendants are not reported. Value, NodeReference and DerivedObject nodes are
+ * compared as a whole.
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigDiff
+{
+public:
+    //! Constructor (no differences)
+    ConfigDiff() = default;
+
+    /*!
+     * Compares two configuration trees
+     *
+     * \param   previous    Previous configuration
+     * \param   current     Current configuration
+     *
+     * \return  Differences between the configurations
+     *
+     * \note    The configurations are compared as root nodes regardless of their node paths
+     */
+    static ConfigDiff compare(const ConfigObjectNode &previous, const ConfigObjectNode &current);
+
+    /*!
+     * Checks if there are no differences
+     *
+     * \retval  true    Configurations are equal
+     * \retval  false   Configurations differ
+     */
+    bool isEmpty() const;
+
+    /*!
+     * Gets the node paths of the nodes that exist only in the current configuration
+     *
+     * \return  Sorted node paths
+     */
+    const QStringList &addedNodePaths() const;
+
+    /*!
+     * Gets the node paths of the nodes that exist only in the previous configuration
+     *
+     * \return  Sorted node paths
+     */
+    const QStringList &removedNodePaths() const;
+
+    /*!
+     * Gets the node paths of the nodes that exist in both configurations but differ
+     *
+     * \return  Sorted node paths
+     */
+    const QStringList &changedNodePaths() const;
+
+    /*!
+     * Gets the node paths of all added, removed and changed nodes
+     *
+     * \return  Sorted node paths
+     */
+    QStringList nodePaths() const;
+
+    /*!
+     * Checks if the node at the specified path is affected by the differences
+     *
+     * \param   nodePath    Absolute node path
+     *
+     * \retval  true    The node, one of its ancestors or one of its descendants differs
+     * \retval  false   The node and all of its ancestors and descendants are equal
+     *
+     * This can be used for deciding if a ConfigItem that was loaded from the node needs to be
+     * loaded again.
+     */
+    bool affects(const ConfigNodePath &nodePath) const;
+
+private:
+    /*!
+     * Compares the members of two Object nodes
+     *
+     * \param   previous    Node from the previous configuration
+     * \param   current     Node from the current configuration
+     * \param   path        Node path of the compared nodes (without the trailing separator)
+     */
+    void compareObjects(const ConfigObjectNode &previous,
+                        const ConfigObjectNode &current,
+                        QString *path);
+
+    /*!
+     * Compares two nodes
+     *
+     * \param   previous    Node from the previous configuration
+     * \param   current     Node from the current configuration
+     * \param   path        Node path of the compared nodes (without the trailing separator)
+     */
+    void compareNodes(const ConfigNode &previous, const ConfigNode &current, QString *path);
+
+    /*!
+     * Checks if two nodes are equal regardless of their node paths
+     *
+     * \param   previous    Node from the previous configuration
+     * \param   current     Node from the current configuration
+     *
+     * \retval  true    Nodes are equal
+     * \retval  false   Nodes differ
+     */
+    static bool isEqual(const ConfigNode &previous, const ConfigNode &current);
+
+    /*!
+     * Converts the node path used during the comparison to an absolute node path
+     *
+     * \param   path    Node path without the trailing separator (empty for the root node)
+     *
+     * \return  Absolute node path
+     */
+    static QString toNodePath(const QString &path);
+
+private:
+    //! Node paths of the added nodes
+    QStringList m_addedNodePaths;
+
+    //! Node paths of the removed nodes
+    QStringList m_removedNodePaths;
+
+    //! Node paths of the changed nodes
+    QStringList m_changedNodePaths;
+};
+
+} // namespace CppConfigFramework
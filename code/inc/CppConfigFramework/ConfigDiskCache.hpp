@@ -0,0 +1,166 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a class that stores read configurations in a cache directory
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigDependencies.hpp>
+#include <CppConfigFramework/ConfigNodePath.hpp>
+#include <CppConfigFramework/EnvironmentVariables.hpp>
+
+// Qt includes
+#include <QtCore/QString>
+
+// System includes
+#include <memory>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+class ConfigObjectNode;
+
+/*!
+ * This class stores read configurations in a cache directory so that they can be reused by other
+ * processes (for example after a restart)
+ *
+ * Each entry consists of a binary snapshot of the read configuration (see ConfigSnapshotFormat)
+ * and a manifest (JSON format) with the fingerprints of its dependencies:
+ *
+ * - size, time of the last modification and the content hash of each file that was read
+ * - hash of the values of the environment variables that were used
+ * - environment variables that were set while reading the configuration
+ *
+ * An entry is used only if all of its fingerprints match. Files are compared by their size and
+ * time of the last modification and only if the time of the last modification differs then also
+ * by their content hash.
+ *
+ * Both files of an entry are replaced atomically and the manifest is bound to the snapshot by its
+ * checksum so multiple processes can share the same cache directory.
+ *
+ * \note    Values of the environment variables that were used are not stored in the manifest, only
+ *          their hash
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigDiskCache
+{
+public:
+    //! Current version of the manifest format
+    static constexpr int MANIFEST_VERSION = 1;
+
+public:
+    /*!
+     * Constructor
+     *
+     * \param   directoryPath   Path to the cache directory
+     */
+    explicit ConfigDiskCache(const QString &directoryPath);
+
+    //! Copy constructor
+    ConfigDiskCache(const ConfigDiskCache &) = default;
+
+    //! Move constructor
+    ConfigDiskCache(ConfigDiskCache &&) noexcept = default;
+
+    //! Destructor
+    ~ConfigDiskCache() = default;
+
+    //! Copy assignment operator
+    ConfigDiskCache &operator=(const ConfigDiskCache &) = default;
+
+    //! Move assignment operator
+    ConfigDiskCache &operator=(ConfigDiskCache &&) noexcept = default;
+
+    /*!
+     * Gets the path to the cache directory
+     *
+     * \return  Path to the cache directory
+     */
+    QString directoryPath() const;
+
+    /*!
+     * Loads the configuration from the cache directory
+     *
+     * \param   absoluteFilePath    Absolute path to the configuration file
+     * \param   sourceNodePath      Source node path
+     * \param   destinationNodePath Destination node path
+     *
+     * \param[in,out]   environmentVariables    Environment variables
+     *
+     * \return  Cached configuration or null if the configuration is not in the cache or if any of
+     *          its dependencies were changed
+     *
+     * Environment variables that were set while reading the cached configuration are also set in
+     * the environmentVariables parameter and the dependencies are recorded to the active
+     * ConfigDependencyRecorder.
+     */
+    std::unique_ptr<ConfigObjectNode> load(const QString &absoluteFilePath,
+                                           const ConfigNodePath &sourceNodePath,
+                                           const ConfigNodePath &destinationNodePath,
+                                           EnvironmentVariables *environmentVariables) const;
+
+    /*!
+     * Stores the read configuration in the cache directory
+     *
+     * \param   absoluteFilePath            Absolute path to the configuration file
+     * \param   sourceNodePath              Source node path
+     * \param   destinationNodePath         Destination node path
+     * \param   config                      Read configuration
+     * \param   dependencies                Dependencies of the read configuration
+     * \param   initialEnvironmentVariables Environment variables before the configuration was read
+     * \param   environmentVariables        Environment variables after the configuration was read
+     *
+     * \retval  true    Success
+     * \retval  false   Failure (for example if one of the files was changed after it was read)
+     *
+     * \note    Only configurations that were read without external configs can be stored as the
+     *          external configs are not a part of the fingerprints
+     */
+    bool store(const QString &absoluteFilePath,
+               const ConfigNodePath &sourceNodePath,
+               const ConfigNodePath &destinationNodePath,
+               const ConfigObjectNode &config,
+               const ConfigDependencies &dependencies,
+               const EnvironmentVariables &initialEnvironmentVariables,
+               const EnvironmentVariables &environmentVariables) const;
+
+    /*!
+     * Creates the base name of the files of an entry
+     *
+     * \param   absoluteFilePath    Absolute path to the configuration file
+     * \param   sourceNodePath      Source node path
+     * \param   destinationNodePath Destination node path
+     *
+     * \return  Base name of the files
+     */
+    static QString entryName(const QString &absoluteFilePath,
+                             const ConfigNodePath &sourceNodePath,
+                             const ConfigNodePath &destinationNodePath);
+
+private:
+    //! Path to the cache directory
+    QString m_directoryPath;
+};
+
+} // namespace CppConfigFramework
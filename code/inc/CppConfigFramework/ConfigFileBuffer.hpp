@@ -0,0 +1,148 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a class that provides read-only access to the contents of a configuration file
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/CppConfigFrameworkExport.hpp>
+
+// Qt includes
+#include <QtCore/QByteArray>
+#include <QtCore/QFile>
+
+// System includes
+#include <cstddef>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+/*!
+ * This class provides read-only access to the contents of a configuration file
+ *
+ * Regular files are memory mapped so that their contents can be parsed straight from the page cache
+ * without copying them to the heap. Files that cannot be mapped (Qt resources, pipes, character
+ * devices, empty files or if the mapping fails) are read to the heap instead. The same is done if
+ * the file changes while it is being opened or if mapping is disabled.
+ *
+ * \warning If a mapped file is truncated while it is open, accessing its contents raises SIGBUS.
+ *          Mapping should therefore be disabled for files that can be rewritten in place while
+ *          they are being read (for example files that are watched for changes).
+ *
+ * The contents are accessible until the buffer is closed or destroyed.
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigFileBuffer
+{
+public:
+    //! Constructor
+    ConfigFileBuffer() = default;
+
+    //! Copy constructor is disabled
+    ConfigFileBuffer(const ConfigFileBuffer &) = delete;
+
+    //! Move constructor is disabled
+    ConfigFileBuffer(ConfigFileBuffer &&) = delete;
+
+    //! Destructor
+    ~ConfigFileBuffer();
+
+    //! Copy assignment operator is disabled
+    ConfigFileBuffer &operator=(const ConfigFileBuffer &) = delete;
+
+    //! Move assignment operator is disabled
+    ConfigFileBuffer &operator=(ConfigFileBuffer &&) = delete;
+
+    /*!
+     * Opens the file and provides access to its contents
+     *
+     * \param   filePath        Path to the file
+     * \param   mappingEnabled  Flag that allows memory mapping of the file
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool open(const QString &filePath, const bool mappingEnabled = true);
+
+    //! Closes the file and releases its contents
+    void close();
+
+    /*!
+     * Checks if the file is open
+     *
+     * \retval  true    File is open
+     * \retval  false   File is not open
+     */
+    bool isOpen() const;
+
+    /*!
+     * Checks if the contents of the file are memory mapped
+     *
+     * \retval  true    Contents are memory mapped
+     * \retval  false   Contents were read to the heap (or the file is not open)
+     */
+    bool isMapped() const;
+
+    /*!
+     * Gets the contents of the file
+     *
+     * \return  Contents of the file (not null-terminated)
+     */
+    const char *data() const;
+
+    /*!
+     * Gets the size of the contents of the file
+     *
+     * \return  Size of the contents
+     */
+    size_t size() const;
+
+    /*!
+     * Gets a part of the contents of the file
+     *
+     * \param   position    Offset from the start of the contents
+     * \param   length      Max length of the part
+     *
+     * \return  Copy of the part of the contents
+     */
+    QByteArray mid(const size_t position, const size_t length) const;
+
+private:
+    //! File
+    QFile m_file;
+
+    //! Memory mapped contents (null if the contents were read to the heap)
+    uchar *m_mappedData = nullptr;
+
+    //! Size of the memory mapped contents
+    size_t m_mappedSize = 0U;
+
+    //! Contents read to the heap
+    QByteArray m_contents;
+
+    //! Flag indicating that the file is open
+    bool m_open = false;
+};
+
+} // namespace CppConfigFramework
@@ -0,0 +1,298 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a cache for configuration files that were already read
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigDependencies.hpp>
+#include <CppConfigFramework/ConfigNodePath.hpp>
+#include <CppConfigFramework/EnvironmentVariables.hpp>
+
+// Qt includes
+#include <QtCore/QMutex>
+#include <QtCore/QStringList>
+
+// System includes
+#include <atomic>
+#include <map>
+#include <memory>
+#include <vector>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+class ConfigObjectNode;
+
+/*!
+ * This class holds configuration files that were already read and resolved
+ *
+ * Each entry is identified by the absolute path to the configuration file and its source and
+ * destination node paths. An entry is used only if:
+ *
+ * - none of the files that were read for it (the configuration file and its includes) were changed
+ *   since then (same size and time of the last modification)
+ * - the environment variables that were used for it have the same values (their hash matches)
+ *
+ * Configurations that resolved any of their references from the external configs are not cached as
+ * their result depends on the external configs.
+ *
+ * The environment variables that were set while reading the configuration file are set again when
+ * an entry is used.
+ *
+ * \note    This class is thread-safe
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigIncludeCache
+{
+public:
+    //! Constructor
+    ConfigIncludeCache();
+
+    //! Copy constructor is disabled
+    ConfigIncludeCache(const ConfigIncludeCache &) = delete;
+
+    //! Move constructor is disabled
+    ConfigIncludeCache(ConfigIncludeCache &&) = delete;
+
+    //! Destructor
+    ~ConfigIncludeCache();
+
+    //! Copy assignment operator is disabled
+    ConfigIncludeCache &operator=(const ConfigIncludeCache &) = delete;
+
+    //! Move assignment operator is disabled
+    ConfigIncludeCache &operator=(ConfigIncludeCache &&) = delete;
+
+    /*!
+     * Checks if the cache is enabled
+     *
+     * \retval  true    Cache is enabled
+     * \retval  false   Cache is disabled
+     */
+    bool isEnabled() const;
+
+    /*!
+     * Enables or disables the cache
+     *
+     * \param   enabled     New value
+     *
+     * \note    Disabling the cache doesn't remove its entries (see clear())
+     */
+    void setEnabled(const bool enabled);
+
+    /*!
+     * Gets the number of configuration files that were taken from the cache
+     *
+     * \return  Number of cache hits
+     */
+    quint64 hitCount() const;
+
+    /*!
+     * Gets the number of configuration files that were not found in the cache
+     *
+     * \return  Number of cache misses
+     */
+    quint64 missCount() const;
+
+    /*!
+     * Gets the number of entries in the cache
+     *
+     * \return  Number of entries
+     */
+    size_t entryCount() const;
+
+    //! Removes all entries from the cache and resets the hit and miss counters
+    void clear();
+
+    /*!
+     * Removes the entries that depend on any of the files
+     *
+     * \param   absoluteFilePaths   Absolute paths to the files that were changed
+     *
+     * \return  Number of removed entries
+     *
+     * This is used when the changes of the files are reported by other means (for example by a
+     * file system watcher) as a change is not always visible in the size and the time of the last
+     * modification of a file.
+     */
+    size_t invalidate(const QStringList &absoluteFilePaths);
+
+    /*!
+     * Finds a configuration in the cache
+     *
+     * \param   absoluteFilePath    Absolute path to the configuration file
+     * \param   sourceNodePath      Source node path
+     * \param   destinationNodePath Destination node path
+     *
+     * \param[in,out]   environmentVariables    Environment variables
+     *
+     * \return  Copy of the cached configuration or a null pointer if it was not found
+     *
+     * On success the environment variables that were set while reading the configuration are set.
+     */
+    std::unique_ptr<ConfigObjectNode> find(const QString &absoluteFilePath,
+                                           const ConfigNodePath &sourceNodePath,
+                                           const ConfigNodePath &destinationNodePath,
+                                           EnvironmentVariables *environmentVariables);
+
+    /*!
+     * Adds a configuration to the cache
+     *
+     * \param   absoluteFilePath            Absolute path to the configuration file
+     * \param   sourceNodePath              Source node path
+     * \param   destinationNodePath         Destination node path
+     * \param   config                      Read configuration
+     * \param   dependencies                Dependencies of the read configuration
+     * \param   externalConfigs             External configs used for reading the configuration
+     * \param   initialEnvironmentVariables Environment variables before reading the configuration
+     * \param   environmentVariables        Environment variables after reading the configuration
+     *
+     * \retval  true    Configuration was added to the cache
+     * \retval  false   Configuration depends on the external configs and it was not added
+     */
+    bool insert(const QString &absoluteFilePath,
+                const ConfigNodePath &sourceNodePath,
+                const ConfigNodePath &destinationNodePath,
+                const ConfigObjectNode &config,
+                const ConfigDependencies &dependencies,
+                const std::vector<const ConfigObjectNode *> &externalConfigs,
+                const EnvironmentVariables &initialEnvironmentVariables,
+                const EnvironmentVariables &environmentVariables);
+
+    /*!
+     * Calculates the hash of the environment variables
+     *
+     * \param   names       Names of the environment variables
+     * \param   variables   Environment variable values
+     *
+     * \return  Hash of the environment variables (also takes into account the undefined ones)
+     */
+    static QByteArray environmentHash(const QStringList &names,
+                                      const QHash<QString, QString> &variables);
+
+    /*!
+     * Checks if the files in the dependencies are unchanged
+     *
+     * \param   dependencies    Dependencies
+     *
+     * \retval  true    All files are unchanged
+     * \retval  false   At least one of the files was changed
+     */
+    static bool filesUnchanged(const ConfigDependencies &dependencies);
+
+    /*!
+     * Gets the environment variables that were set while reading a configuration
+     *
+     * \param   initialEnvironmentVariables Environment variables before the configuration was read
+     * \param   environmentVariables        Environment variables after the configuration was read
+     *
+     * \return  Environment variables that were added or changed
+     */
+    static QHash<QString, QString> environmentChanges(
+            const EnvironmentVariables &initialEnvironmentVariables,
+            const EnvironmentVariables &environmentVariables);
+
+private:
+    //! Holds a cached configuration
+    struct Entry;
+
+    /*!
+     * Creates the key of an entry
+     *
+     * \param   absoluteFilePath    Absolute path to the configuration file
+     * \param   sourceNodePath      Source node path
+     * \param   destinationNodePath Destination node path
+     *
+     * \return  Entry key
+     */
+    static QString entryKey(const QString &absoluteFilePath,
+                            const ConfigNodePath &sourceNodePath,
+                            const ConfigNodePath &destinationNodePath);
+
+private:
+    //! Flag that enables the cache
+    std::atomic<bool> m_enabled;
+
+    //! Mutex that protects the entries and the counters
+    mutable QMutex m_mutex;
+
+    //! Entries (for each file and node paths there is an entry for each environment hash)
+    std::map<QString, std::vector<std::unique_ptr<Entry>>> m_entries;
+
+    //! Number of cache hits
+    quint64 m_hitCount;
+
+    //! Number of cache misses
+    quint64 m_missCount;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * This class makes an include cache the active one for the current thread for the lifetime of the
+ * scope
+ *
+ * Configuration files read in this scope use the scoped include cache instead of the one from the
+ * ConfigReaderRegistry. This is useful for caches that must not be shared with the rest of the
+ * process (for example the cache of a ConfigReaderSession).
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigIncludeCacheScope
+{
+public:
+    /*!
+     * Constructor
+     *
+     * \param   includeCache    Include cache
+     */
+    explicit ConfigIncludeCacheScope(ConfigIncludeCache *includeCache);
+
+    //! Copy constructor is disabled
+    ConfigIncludeCacheScope(const ConfigIncludeCacheScope &) = delete;
+
+    //! Move constructor is disabled
+    ConfigIncludeCacheScope(ConfigIncludeCacheScope &&) = delete;
+
+    //! Destructor
+    ~ConfigIncludeCacheScope();
+
+    //! Copy assignment operator is disabled
+    ConfigIncludeCacheScope &operator=(const ConfigIncludeCacheScope &) = delete;
+
+    //! Move assignment operator is disabled
+    ConfigIncludeCacheScope &operator=(ConfigIncludeCacheScope &&) = delete;
+
+    /*!
+     * Gets the include cache that is active for the current thread
+     *
+     * \return  Scoped include cache or nullptr if no include cache is scoped for the current thread
+     */
+    static ConfigIncludeCache *current();
+
+private:
+    //! Include cache that was active before this scope
+    ConfigIncludeCache *m_previousIncludeCache;
+};
+
+} // namespace CppConfigFramework
@@ -23,6 +23,10 @@
 
 // C++ Config Framework includes
 #include <CppConfigFramework/ConfigContainerHelper.hpp>
+#include <CppConfigFramework/ConfigItemError.hpp>
+#include <CppConfigFramework/ConfigNodeDeserialization.hpp>
+#include <CppConfigFramework/ConfigParameterBatch.hpp>
+#include <CppConfigFramework/ConfigParameterTable.hpp>
 #include <CppConfigFramework/ConfigParameterValidator.hpp>
 #include <CppConfigFramework/ConfigObjectNode.hpp>
 #include <CppConfigFramework/ConfigValueNode.hpp>
@@ -199,7 +203,50 @@ public:
     //! \copydoc    ConfigItem::storeConfigAtPath()
     bool storeConfigAtPath(const QString &path, ConfigObjectNode *config);
 
+    /*!
+     * Checks if errors are logged
+     *
+     * \retval  true    Errors are logged
+     * \retval  false   Errors are only passed to handleError()
+     */
+    bool isErrorLoggingEnabled() const;
+
+    /*!
+     * Enables or disables logging of errors
+     *
+     * \param   enabled     New value
+     *
+     * Disabling the logging is useful when many configurations are probed and failures are
+     * expected, because the error messages are then not formatted at all (unless handleError()
+     * formats them or the deprecated handleError(const QString &) is enabled with
+     * setLegacyErrorHandlerEnabled()). The setting is passed on to the items of the loaded
+     * configuration containers.
+     *
+     * \note    Errors are logged by default (if the ConfigItem logging category is enabled)
+     */
+    void setErrorLoggingEnabled(const bool enabled);
+
 protected:
+    /*!
+     * Checks if errors are passed to the deprecated handleError(const QString &)
+     *
+     * \retval  true    Errors are passed to the deprecated handler
+     * \retval  false   Errors are only passed to handleError(const ConfigItemError &)
+     */
+    bool isLegacyErrorHandlerEnabled() const;
+
+    /*!
+     * Enables or disables passing of errors to the deprecated handleError(const QString &)
+     *
+     * \param   enabled     New value
+     *
+     * Configuration classes that still override the deprecated method need to enable it (for
+     * example in their constructor). The error message is then formatted for each error.
+     *
+     * \note    The deprecated handler is disabled by default
+     */
+    void setLegacyErrorHandlerEnabled(const bool enabled);
+
     /*!
      * Loads the required configuration parameter from the configuration node without validation
      *
@@ -240,6 +287,32 @@ protected:
                                      const ConfigObjectNode &config,
                                      ConfigParameterValidator<T> validator);
 
+    /*!
+     * Loads the required configuration parameter from the configuration node with validation
+     *
+     * \tparam  T           Data type of the parameter to load
+     * \tparam  Validator   Data type of the validator (any callable that takes the loaded value
+     *                      and returns a result that is convertible to bool)
+     *
+     * \param[out]  parameterValue  Output for the configuration parameter value
+     *
+     * \param   parameterName   Name of the parameter (member name in the configuration node)
+     * \param   config          Configuration node from which this configuration structure should be
+     *                          loaded
+     * \param   validator       Validator for the loaded parameter value
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     *
+     * \note    The validator is called directly instead of through a type-erased
+     *          ConfigParameterValidator so that the call can be inlined
+     */
+    template<typename T, typename Validator, IsConfigParameterValidator<Validator, T> = true>
+    bool loadRequiredConfigParameter(T *parameterValue,
+                                     const QString &parameterName,
+                                     const ConfigObjectNode &config,
+                                     Validator validator);
+
     /*!
      * Loads the optional configuration parameter from the configuration node without validation
      *
@@ -286,6 +359,174 @@ protected:
                                      ConfigParameterValidator<T> validator,
                                      bool *loaded = nullptr);
 
+    /*!
+     * Loads the optional configuration parameter from the configuration node with validation
+     *
+     * \tparam  T           Data type of the parameter to load
+     * \tparam  Validator   Data type of the validator (any callable that takes the loaded value
+     *                      and returns a result that is convertible to bool)
+     *
+     * \param[out]  parameterValue  Output for the configuration parameter value
+     *
+     * \param   parameterName   Name of the parameter (member name in the configuration node)
+     * \param   config          Configuration node from which this configuration structure should be
+     *                          loaded
+     * \param   validator       Validator for the loaded parameter value
+     *
+     * \param[out]  loaded  Optional output for the loading result
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     *
+     * \note    The validator is called directly instead of through a type-erased
+     *          ConfigParameterValidator so that the call can be inlined
+     */
+    template<typename T, typename Validator, IsConfigParameterValidator<Validator, T> = true>
+    bool loadOptionalConfigParameter(T *parameterValue,
+                                     const QString &parameterName,
+                                     const ConfigObjectNode &config,
+                                     Validator validator,
+                                     bool *loaded = nullptr);
+
+    /*!
+     * Loads the required configuration parameter from a node found by the parameter batch
+     *
+     * \tparam  T   Data type of the parameter to load
+     *
+     * \param[out]  parameterValue  Output for the configuration parameter value
+     *
+     * \param   batch   Parameter batch
+     * \param   index   Index of the parameter in the batch's parameter names
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    template<typename T>
+    bool loadRequiredConfigParameter(T *parameterValue,
+                                     const ConfigParameterBatch &batch,
+                                     const size_t index);
+
+    /*!
+     * Loads the required configuration parameter from a node found by the parameter batch with
+     * validation
+     *
+     * \tparam  T   Data type of the parameter to load
+     *
+     * \param[out]  parameterValue  Output for the configuration parameter value
+     *
+     * \param   batch       Parameter batch
+     * \param   index       Index of the parameter in the batch's parameter names
+     * \param   validator   Validator for the loaded parameter value
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    template<typename T>
+    bool loadRequiredConfigParameter(T *parameterValue,
+                                     const ConfigParameterBatch &batch,
+                                     const size_t index,
+                                     ConfigParameterValidator<T> validator);
+
+    /*!
+     * Loads the required configuration parameter from a node found by the parameter batch with
+     * validation
+     *
+     * \tparam  T           Data type of the parameter to load
+     * \tparam  Validator   Data type of the validator (any callable that takes the loaded value
+     *                      and returns a result that is convertible to bool)
+     *
+     * \param[out]  parameterValue  Output for the configuration parameter value
+     *
+     * \param   batch       Parameter batch
+     * \param   index       Index of the parameter in the batch's parameter names
+     * \param   validator   Validator for the loaded parameter value
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     *
+     * \note    The validator is called directly instead of through a type-erased
+     *          ConfigParameterValidator so that the call can be inlined
+     */
+    template<typename T, typename Validator, IsConfigParameterValidator<Validator, T> = true>
+    bool loadRequiredConfigParameter(T *parameterValue,
+                                     const ConfigParameterBatch &batch,
+                                     const size_t index,
+                                     Validator validator);
+
+    /*!
+     * Loads the optional configuration parameter from a node found by the parameter batch
+     *
+     * \tparam  T   Data type of the parameter to load
+     *
+     * \param[out]  parameterValue  Output for the configuration parameter value
+     *
+     * \param   batch   Parameter batch
+     * \param   index   Index of the parameter in the batch's parameter names
+     *
+     * \param[out]  loaded  Optional output for the loading result
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    template<typename T>
+    bool loadOptionalConfigParameter(T *parameterValue,
+                                     const ConfigParameterBatch &batch,
+                                     const size_t index,
+                                     bool *loaded = nullptr);
+
+    /*!
+     * Loads the optional configuration parameter from a node found by the parameter batch with
+     * validation
+     *
+     * \tparam  T   Data type of the parameter to load
+     *
+     * \param[out]  parameterValue  Output for the configuration parameter value
+     *
+     * \param   batch       Parameter batch
+     * \param   index       Index of the parameter in the batch's parameter names
+     * \param   validator   Validator for the loaded parameter value
+     *
+     * \param[out]  loaded  Optional output for the loading result
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    template<typename T>
+    bool loadOptionalConfigParameter(T *parameterValue,
+                                     const ConfigParameterBatch &batch,
+                                     const size_t index,
+                                     ConfigParameterValidator<T> validator,
+                                     bool *loaded = nullptr);
+
+    /*!
+     * Loads the optional configuration parameter from a node found by the parameter batch with
+     * validation
+     *
+     * \tparam  T           Data type of the parameter to load
+     * \tparam  Validator   Data type of the validator (any callable that takes the loaded value
+     *                      and returns a result that is convertible to bool)
+     *
+     * \param[out]  parameterValue  Output for the configuration parameter value
+     *
+     * \param   batch       Parameter batch
+     * \param   index       Index of the parameter in the batch's parameter names
+     * \param   validator   Validator for the loaded parameter value
+     *
+     * \param[out]  loaded  Optional output for the loading result
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     *
+     * \note    The validator is called directly instead of through a type-erased
+     *          ConfigParameterValidator so that the call can be inlined
+     */
+    template<typename T, typename Validator, IsConfigParameterValidator<Validator, T> = true>
+    bool loadOptionalConfigParameter(T *parameterValue,
+                                     const ConfigParameterBatch &batch,
+                                     const size_t index,
+                                     Validator validator,
+                                     bool *loaded = nullptr);
+
     /*!
      * Loads the required configuration container from the configuration node
      *
@@ -417,6 +658,60 @@ protected:
                               const QString &parameterName,
                               ConfigObjectNode *config);
 
+    /*!
+     * Loads all configuration parameters described by the parameter table
+     *
+     * \tparam  Item        Data type of the configuration item
+     * \tparam  Parameters  Data types of the parameter descriptors
+     *
+     * \param[out]  item    Configuration item that holds the parameter values
+     *
+     * \param   table   Parameter table
+     * \param   config  Configuration node from which the configuration parameters should be loaded
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     *
+     * The parameter nodes are found in a single pass over the members of the configuration node
+     * and the parameters are then loaded in the order of their declaration in the table. Loading
+     * stops at the first parameter that fails. Members of the configuration node that are not
+     * described by the table are reported with reportUnknownConfigParameters().
+     */
+    template<typename Item, typename... Parameters>
+    bool loadConfigParameterTable(Item *item,
+                                  const ConfigParameterTable<Item, Parameters...> &table,
+                                  const ConfigObjectNode &config);
+
+    /*!
+     * Stores all configuration parameters described by the parameter table
+     *
+     * \tparam  Item        Data type of the configuration item
+     * \tparam  Parameters  Data types of the parameter descriptors
+     *
+     * \param   item    Configuration item that holds the parameter values
+     * \param   table   Parameter table
+     *
+     * \param[out]  config  Configuration node to which the configuration parameters should be
+     *                      stored to
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    template<typename Item, typename... Parameters>
+    bool storeConfigParameterTable(const Item &item,
+                                   const ConfigParameterTable<Item, Parameters...> &table,
+                                   ConfigObjectNode *config);
+
+    /*!
+     * Reports the members of the configuration node that don't match any of the parameters
+     *
+     * \param   batch   Parameter batch
+     *
+     * The unknown members are logged (debug level) and passed to handleUnknownConfigParameters().
+     * Nothing is done if there are no unknown members.
+     */
+    void reportUnknownConfigParameters(const ConfigParameterBatch &batch);
+
     /*!
      * Converts a JSON value to a string in JSON format
      *
@@ -427,10 +722,21 @@ protected:
     static QString jsonToString(const QJsonValue &value);
 
 private:
+    /*!
+     * Reports the error
+     *
+     * \param   error   Error
+     *
+     * The error is logged (if enabled) and passed to handleError(). The error message is formatted
+     * only for logging if the ConfigItem logging category is enabled.
+     */
+    void reportError(const ConfigItemError &error);
+
     /*!
      * Loads the configuration parameter from the configuration node with validation
      *
-     * \tparam  T   Data type of the parameter to load
+     * \tparam  T           Data type of the parameter to load
+     * \tparam  Validator   Data type of the validator
      *
      * \param[out]  parameterValue  Output for the configuration parameter value
      *
@@ -440,10 +746,10 @@ private:
      *
      * \return  Configuration parameter loading result
      */
-    template<typename T>
+    template<typename T, typename Validator>
     bool loadConfigParameterFromNode(T *parameterValue,
                                      const ConfigNode &node,
-                                     ConfigParameterValidator<T> validator);
+                                     const Validator &validator);
 
     /*!
      * Validates the configuration parameter
@@ -533,15 +839,55 @@ private:
     /*!
      * Handle error
      *
-     * \param   error   Error string
+     * \param   error   Error
      *
      * This method shall be called when an error occurs during loading of the configuration
      * structure or a configuration parameter. The configuration class can then react on the error,
      * for example the error could be written in a log or the application could be stopped.
      *
+     * \note    Default implementation passes the error message to handleError(const QString &)
+     *          only if it was enabled with setLegacyErrorHandlerEnabled()
+     * \note    The error message is not formatted until ConfigItemError::message() is called
+     */
+    virtual void handleError(const ConfigItemError &error);
+
+    /*!
+     * Handle error
+     *
+     * \param   error   Error string
+     *
+     * \deprecated  Override handleError(const ConfigItemError &) instead. This method is only
+     *              called by its default implementation (with the formatted error message) and
+     *              only if it was enabled with setLegacyErrorHandlerEnabled().
+     *
      * \note    Default implementation does not do anything!
      */
     virtual void handleError(const QString &error);
+
+    /*!
+     * Handle unknown configuration parameters
+     *
+     * \param   config  Configuration node
+     * \param   names   Names of the members that don't match any of the parameters (sorted
+     *                  alphabetically)
+     *
+     * This method is called by reportUnknownConfigParameters(). The configuration class can then
+     * react on the unknown parameters, for example by treating them as an error.
+     *
+     * \note    Default implementation does not do anything!
+     */
+    virtual void handleUnknownConfigParameters(const ConfigObjectNode &config,
+                                               const QStringList &names);
+
+private:
+    // Needs jsonToString() for formatting of the error messages
+    friend class ConfigItemError;
+
+    //! Holds the flag that enables logging of errors
+    bool m_errorLoggingEnabled = true;
+
+    //! Holds the flag that enables passing of errors to the deprecated handleError()
+    bool m_legacyErrorHandlerEnabled = false;
 };
 
 // -------------------------------------------------------------------------------------------------
@@ -554,7 +900,7 @@ bool ConfigItem::loadRequiredConfigParameter(T *parameterValue,
     return loadRequiredConfigParameter(parameterValue,
                                        parameterName,
                                        config,
-                                       { defaultConfigParameterValidator<T> });
+                                       ConfigParameterDefaultValidator<T>());
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -564,17 +910,29 @@ bool ConfigItem::loadRequiredConfigParameter(T *parameterValue,
                                              const QString &parameterName,
                                              const ConfigObjectNode &config,
                                              ConfigParameterValidator<T> validator)
+{
+    return loadRequiredConfigParameter<T, ConfigParameterValidator<T>>(parameterValue,
+                                                                       parameterName,
+                                                                       config,
+                                                                       std::move(validator));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T, typename Validator, IsConfigParameterValidator<Validator, T>>
+bool ConfigItem::loadRequiredConfigParameter(T *parameterValue,
+                                             const QString &parameterName,
+                                             const ConfigObjectNode &config,
+                                             Validator validator)
 {
     // Validate parameters
     Q_ASSERT(parameterValue != nullptr);
 
     if (!ConfigNodePath::validateNodeName(parameterName))
     {
-        const QString errorString = QString("Configuration parameter name [%1] is not valid "
-                                            "(configuration node [%2])!")
-                                    .arg(parameterName, config.nodePath().path());
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
-        handleError(errorString);
+        reportError(ConfigItemError(ConfigItemError::Code::InvalidParameterName,
+                                    &config,
+                                    parameterName));
         return false;
     }
 
@@ -583,11 +941,9 @@ bool ConfigItem::loadRequiredConfigParameter(T *parameterValue,
 
     if (node == nullptr)
     {
-        const QString errorString = QString("Configuration parameter node with name [%1] was not "
-                                            "found in configuration node [%2]!")
-                                    .arg(parameterName, config.nodePath().path());
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
-        handleError(errorString);
+        reportError(ConfigItemError(ConfigItemError::Code::ParameterNotFound,
+                                    &config,
+                                    parameterName));
         return false;
     }
 
@@ -606,7 +962,7 @@ bool ConfigItem::loadOptionalConfigParameter(T *parameterValue,
     return loadOptionalConfigParameter(parameterValue,
                                        parameterName,
                                        config,
-                                       { defaultConfigParameterValidator<T> },
+                                       ConfigParameterDefaultValidator<T>(),
                                        loaded);
 }
 
@@ -618,17 +974,31 @@ bool ConfigItem::loadOptionalConfigParameter(T *parameterValue,
                                              const ConfigObjectNode &config,
                                              ConfigParameterValidator<T> validator,
                                              bool *loaded)
+{
+    return loadOptionalConfigParameter<T, ConfigParameterValidator<T>>(parameterValue,
+                                                                       parameterName,
+                                                                       config,
+                                                                       std::move(validator),
+                                                                       loaded);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T, typename Validator, IsConfigParameterValidator<Validator, T>>
+bool ConfigItem::loadOptionalConfigParameter(T *parameterValue,
+                                             const QString &parameterName,
+                                             const ConfigObjectNode &config,
+                                             Validator validator,
+                                             bool *loaded)
 {
     // Validate parameters
     Q_ASSERT(parameterValue != nullptr);
 
     if (!ConfigNodePath::validateNodeName(parameterName))
     {
-        const QString errorString = QString("Configuration parameter name [%1] is not valid "
-                                            "(configuration node [%2])!")
-                                    .arg(parameterName, config.nodePath().path());
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
-        handleError(errorString);
+        reportError(ConfigItemError(ConfigItemError::Code::InvalidParameterName,
+                                    &config,
+                                    parameterName));
 
         if (loaded != nullptr)
         {
@@ -662,6 +1032,150 @@ bool ConfigItem::loadOptionalConfigParameter(T *parameterValue,
 
 // -------------------------------------------------------------------------------------------------
 
+template<typename T>
+bool ConfigItem::loadRequiredConfigParameter(T *parameterValue,
+                                             const ConfigParameterBatch &batch,
+                                             const size_t index)
+{
+    return loadRequiredConfigParameter(parameterValue,
+                                       batch,
+                                       index,
+                                       ConfigParameterDefaultValidator<T>());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T>
+bool ConfigItem::loadRequiredConfigParameter(T *parameterValue,
+                                             const ConfigParameterBatch &batch,
+                                             const size_t index,
+                                             ConfigParameterValidator<T> validator)
+{
+    return loadRequiredConfigParameter<T, ConfigParameterValidator<T>>(parameterValue,
+                                                                       batch,
+                                                                       index,
+                                                                       std::move(validator));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T, typename Validator, IsConfigParameterValidator<Validator, T>>
+bool ConfigItem::loadRequiredConfigParameter(T *parameterValue,
+                                             const ConfigParameterBatch &batch,
+                                             const size_t index,
+                                             Validator validator)
+{
+    // Validate parameters
+    Q_ASSERT(parameterValue != nullptr);
+    Q_ASSERT(index < batch.names().count());
+
+    const QString &parameterName = batch.names().name(index);
+
+    if (batch.names().atom(index) == ConfigNameTable::INVALID_ATOM)
+    {
+        reportError(ConfigItemError(ConfigItemError::Code::InvalidParameterName,
+                                    &batch.config(),
+                                    parameterName));
+        return false;
+    }
+
+    // Get parameter's configuration node
+    const auto *node = batch.member(index);
+
+    if (node == nullptr)
+    {
+        reportError(ConfigItemError(ConfigItemError::Code::ParameterNotFound,
+                                    &batch.config(),
+                                    parameterName));
+        return false;
+    }
+
+    // Load configuration parameter from the configuration node
+    return loadConfigParameterFromNode(parameterValue, *node, validator);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T>
+bool ConfigItem::loadOptionalConfigParameter(T *parameterValue,
+                                             const ConfigParameterBatch &batch,
+                                             const size_t index,
+                                             bool *loaded)
+{
+    return loadOptionalConfigParameter(parameterValue,
+                                       batch,
+                                       index,
+                                       ConfigParameterDefaultValidator<T>(),
+                                       loaded);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T>
+bool ConfigItem::loadOptionalConfigParameter(T *parameterValue,
+                                             const ConfigParameterBatch &batch,
+                                             const size_t index,
+                                             ConfigParameterValidator<T> validator,
+                                             bool *loaded)
+{
+    return loadOptionalConfigParameter<T, ConfigParameterValidator<T>>(parameterValue,
+                                                                       batch,
+                                                                       index,
+                                                                       std::move(validator),
+                                                                       loaded);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T, typename Validator, IsConfigParameterValidator<Validator, T>>
+bool ConfigItem::loadOptionalConfigParameter(T *parameterValue,
+                                             const ConfigParameterBatch &batch,
+                                             const size_t index,
+                                             Validator validator,
+                                             bool *loaded)
+{
+    // Validate parameters
+    Q_ASSERT(parameterValue != nullptr);
+    Q_ASSERT(index < batch.names().count());
+
+    if (batch.names().atom(index) == ConfigNameTable::INVALID_ATOM)
+    {
+        reportError(ConfigItemError(ConfigItemError::Code::InvalidParameterName,
+                                    &batch.config(),
+                                    batch.names().name(index)));
+
+        if (loaded != nullptr)
+        {
+            *loaded = false;
+        }
+        return false;
+    }
+
+    // Get parameter's configuration node
+    const auto *node = batch.member(index);
+
+    if (node == nullptr)
+    {
+        // Node was not found, skip it
+        if (loaded != nullptr)
+        {
+            *loaded = false;
+        }
+        return true;
+    }
+
+    // Load configuration parameter from the configuration node
+    const bool result = loadConfigParameterFromNode(parameterValue, *node, validator);
+
+    if (loaded != nullptr)
+    {
+        *loaded = result;
+    }
+    return result;
+}
+
+// -------------------------------------------------------------------------------------------------
+
 template<typename T>
 bool ConfigItem::loadRequiredConfigContainer(T *container,
                                              const QString &parameterName,
@@ -691,11 +1205,9 @@ bool ConfigItem::loadRequiredConfigContainer(
 
     if (!ConfigNodePath::validateNodeName(parameterName))
     {
-        const QString errorString = QString("Configuration parameter name [%1] is not valid "
-                                            "(configuration node [%2])!")
-                                    .arg(parameterName, config.nodePath().path());
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
-        handleError(errorString);
+        reportError(ConfigItemError(ConfigItemError::Code::InvalidParameterName,
+                                    &config,
+                                    parameterName));
         return false;
     }
 
@@ -704,11 +1216,9 @@ bool ConfigItem::loadRequiredConfigContainer(
 
     if (node == nullptr)
     {
-        const QString errorString = QString("Configuration parameter node with name [%1] was not "
-                                            "found in configuration node [%2]!")
-                                    .arg(parameterName, config.nodePath().path());
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
-        handleError(errorString);
+        reportError(ConfigItemError(ConfigItemError::Code::ParameterNotFound,
+                                    &config,
+                                    parameterName));
         return false;
     }
 
@@ -750,11 +1260,9 @@ bool ConfigItem::loadOptionalConfigContainer(
 
     if (!ConfigNodePath::validateNodeName(parameterName))
     {
-        const QString errorString = QString("Configuration parameter name [%1] is not valid "
-                                            "(configuration node [%2])!")
-                                    .arg(parameterName, config.nodePath().path());
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
-        handleError(errorString);
+        reportError(ConfigItemError(ConfigItemError::Code::InvalidParameterName,
+                                    &config,
+                                    parameterName));
         return false;
     }
 
@@ -793,11 +1301,9 @@ bool ConfigItem::storeConfigParameter(const T &parameterValue,
 
     if (!ConfigNodePath::validateNodeName(parameterName))
     {
-        const QString errorString = QString("Configuration parameter name [%1] is not valid "
-                                            "(configuration node [%2])!")
-                                    .arg(parameterName, config->nodePath().path());
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
-        handleError(errorString);
+        reportError(ConfigItemError(ConfigItemError::Code::InvalidParameterName,
+                                    config,
+                                    parameterName));
         return false;
     }
 
@@ -807,11 +1313,11 @@ bool ConfigItem::storeConfigParameter(const T &parameterValue,
     // Store configuration parameter to the configuration node
     if (!config->setMember(parameterName, std::make_unique<ConfigValueNode>(jsonValue)))
     {
-        const QString errorString = QString("Failed to store configuration parameter with name "
-                                            "[%1] and value: [%2]")
-                                    .arg(parameterName, jsonToString(jsonValue));
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
-        handleError(errorString);
+        reportError(ConfigItemError(ConfigItemError::Code::StoreParameterFailed,
+                                    config,
+                                    parameterName,
+                                    QString(),
+                                    jsonValue));
         return false;
     }
 
@@ -830,11 +1336,9 @@ bool ConfigItem::storeConfigContainer(T &container,
 
     if (!ConfigNodePath::validateNodeName(parameterName))
     {
-        const QString errorString = QString("Configuration parameter name [%1] is not valid "
-                                            "(configuration node [%2])!")
-                                    .arg(parameterName, config->nodePath().path());
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
-        handleError(errorString);
+        reportError(ConfigItemError(ConfigItemError::Code::InvalidParameterName,
+                                    config,
+                                    parameterName));
         return false;
     }
 
@@ -855,33 +1359,111 @@ bool ConfigItem::storeConfigContainer(T &container,
 
 // -------------------------------------------------------------------------------------------------
 
-template<typename T>
+template<typename Item, typename... Parameters>
+bool ConfigItem::loadConfigParameterTable(Item *item,
+                                          const ConfigParameterTable<Item, Parameters...> &table,
+                                          const ConfigObjectNode &config)
+{
+    // Validate parameters
+    Q_ASSERT(item != nullptr);
+
+    if (!table.names().isValid())
+    {
+        reportError(ConfigItemError(ConfigItemError::Code::InvalidParameterTable,
+                                    &config,
+                                    table.names().invalidName()));
+        return false;
+    }
+
+    // Get the configuration nodes of all parameters
+    const ConfigParameterBatch batch(table.names(), config);
+    reportUnknownConfigParameters(batch);
+
+    // Load the configuration parameters from their configuration nodes
+    return table.forEach([&](const auto &parameter, const size_t parameterIndex)
+    {
+        const ConfigNode *node = batch.member(parameterIndex);
+
+        if (node == nullptr)
+        {
+            if (!parameter.isRequired())
+            {
+                // Node was not found, skip it
+                return true;
+            }
+
+            this->reportError(ConfigItemError(ConfigItemError::Code::ParameterNotFound,
+                                              &config,
+                                              parameter.name()));
+            return false;
+        }
+
+        return this->loadConfigParameterFromNode(&(item->*parameter.member()),
+                                                 *node,
+                                                 parameter.validator());
+    });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename Item, typename... Parameters>
+bool ConfigItem::storeConfigParameterTable(const Item &item,
+                                           const ConfigParameterTable<Item, Parameters...> &table,
+                                           ConfigObjectNode *config)
+{
+    // Validate parameters
+    Q_ASSERT(config != nullptr);
+
+    const auto &names = table.names();
+
+    if (!names.isValid())
+    {
+        reportError(ConfigItemError(ConfigItemError::Code::InvalidParameterTable,
+                                    config,
+                                    names.invalidName()));
+        return false;
+    }
+
+    // Store configuration parameters to the configuration node (names were already interned)
+    return table.forEach([&](const auto &parameter, const size_t parameterIndex)
+    {
+        const auto jsonValue = CedarFramework::serialize(item.*parameter.member());
+
+        if (!config->setMember(names.atom(parameterIndex),
+                               std::make_unique<ConfigValueNode>(jsonValue)))
+        {
+            this->reportError(ConfigItemError(ConfigItemError::Code::StoreParameterFailed,
+                                              config,
+                                              parameter.name(),
+                                              QString(),
+                                              jsonValue));
+            return false;
+        }
+
+        return true;
+    });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T, typename Validator>
 bool ConfigItem::loadConfigParameterFromNode(T *parameterValue,
                                              const ConfigNode &node,
-                                             ConfigParameterValidator<T> validator)
+                                             const Validator &validator)
 {
-    // Load the node value to the parameter
-    QJsonValue nodeJsonValue;
-
+    // Check the node type
     switch (node.type())
     {
         case ConfigNode::Type::Value:
         {
-            nodeJsonValue = node.toValue().value();
             break;
         }
 
         case ConfigNode::Type::Object:
         {
-            nodeJsonValue = ConfigWriter::convertToJsonValue(node.toObject());
-
-            if (nodeJsonValue.isUndefined())
+            if (node.toObject().unresolvedReferenceCount() > 0)
             {
-                const QString errorString = QString("Configuration parameter node [%1] has "
-                                                    "unresolved references!")
-                                            .arg(node.nodePath().path());
-                qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
-                handleError(errorString);
+                reportError(ConfigItemError(ConfigItemError::Code::UnresolvedReferences, &node));
                 return false;
             }
             break;
@@ -889,31 +1471,23 @@ bool ConfigItem::loadConfigParameterFromNode(T *parameterValue,
 
         default:
         {
-            const QString errorString = QString("Configuration parameter node [%1] is neither a "
-                                                "Value nor an Object node!")
-                                        .arg(node.nodePath().path());
-            qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
-            handleError(errorString);
+            reportError(ConfigItemError(ConfigItemError::Code::InvalidParameterNode, &node));
             return false;
         }
     }
 
-    if (!CedarFramework::deserialize(nodeJsonValue, parameterValue))
+    // Load the node value to the parameter directly from the node (unqualified call so that the
+    // overloads for the parameter type are also found in its namespace)
+    if (!deserialize(node, parameterValue))
     {
-        const QString errorString = QString("Failed to load configuration parameter's value at "
-                                            "node path [%1]").arg(node.nodePath().path());
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
-        handleError(errorString);
+        reportError(ConfigItemError(ConfigItemError::Code::DeserializationFailed, &node));
         return false;
     }
 
     // Validate the value
     if (!validator(*parameterValue))
     {
-        const QString errorString = QString("Configuration parameter's value [%1] is not valid")
-                                    .arg(node.nodePath().path());
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
-        handleError(errorString);
+        reportError(ConfigItemError(ConfigItemError::Code::InvalidParameterValue, &node));
         return false;
     }
 
@@ -931,10 +1505,7 @@ bool ConfigItem::loadConfigContainerFromNode(
 {
     if (!node.isObject())
     {
-        const QString errorString = QString("Configuration container node [%1] is not an Object"
-                                            "node!").arg(node.nodePath().path());
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
-        handleError(errorString);
+        reportError(ConfigItemError(ConfigItemError::Code::InvalidContainerNode, &node));
         return false;
     }
 
@@ -945,15 +1516,13 @@ bool ConfigItem::loadConfigContainerFromNode(
     {
         // Load item's node
         auto item = itemCreator(itemName);
+        item.setErrorLoggingEnabled(m_errorLoggingEnabled);
         const auto *itemNode = nodeObject.member(itemName);
         Q_ASSERT(itemNode != nullptr);
 
         if (!itemNode->isObject())
         {
-            const QString errorString = QString("Configuration node [%1] is not an Object node!")
-                                        .arg(itemNode->nodePath().path());
-            qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
-            handleError(errorString);
+            reportError(ConfigItemError(ConfigItemError::Code::NotObjectNode, itemNode));
             return false;
         }
 
@@ -0,0 +1,218 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a class that describes an error that occurred while loading or storing a configuration
+ * item
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/CppConfigFrameworkExport.hpp>
+
+// Qt includes
+#include <QtCore/QJsonValue>
+#include <QtCore/QString>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+class ConfigNode;
+
+/*!
+ * This class describes an error that occurred while loading or storing a configuration item
+ *
+ * The error only holds the data that is already at hand where the error occurs (error code, the
+ * configuration node and the parameter name). The error message is formatted only when message()
+ * is called, so errors that are neither logged nor formatted by ConfigItem::handleError() are
+ * cheap.
+ *
+ * \note    The configuration node is only guaranteed to be valid while the error is being handled.
+ *          A copy of the error captures the path of the node, so the copy can be formatted after
+ *          the node is gone (but its node() must not be dereferenced).
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigItemError
+{
+public:
+    //! Error code
+    enum class Code
+    {
+        //! Configuration node is a null pointer
+        NullNode,
+
+        //! Configuration node path is not valid (the name holds the path)
+        InvalidNodePath,
+
+        //! Configuration node was not found (the name holds the path relative to the node)
+        NodeNotFound,
+
+        /*!
+         * Configuration node is not an Object node (the name optionally holds the name of the
+         * child node that was requested from it)
+         */
+        NotObjectNode,
+
+        //! Parameter name is not valid
+        InvalidParameterName,
+
+        //! Parameter name in a parameter table is either not valid or not unique
+        InvalidParameterTable,
+
+        //! Required configuration parameter was not found in the node
+        ParameterNotFound,
+
+        //! Configuration parameter node is neither a Value nor an Object node
+        InvalidParameterNode,
+
+        //! Configuration parameter node has unresolved references
+        UnresolvedReferences,
+
+        //! Configuration parameter's value could not be loaded from the node
+        DeserializationFailed,
+
+        //! Configuration parameter's value was rejected by its validator
+        InvalidParameterValue,
+
+        //! Configuration container node is not an Object node
+        InvalidContainerNode,
+
+        //! Configuration parameters could not be loaded
+        LoadParametersFailed,
+
+        //! Loaded configuration is not valid (the detail holds the validation error)
+        InvalidConfig,
+
+        //! Configuration parameters could not be stored
+        StoreParametersFailed,
+
+        //! Configuration parameter could not be stored (the value holds the parameter value)
+        StoreParameterFailed
+    };
+
+    /*!
+     * Constructor
+     *
+     * \param   code    Error code
+     * \param   node    Configuration node related to the error (or nullptr)
+     * \param   name    Parameter name (or other name, depending on the error code)
+     * \param   detail  Additional details (depending on the error code)
+     * \param   value   Parameter value (depending on the error code)
+     */
+    ConfigItemError(const Code code,
+                    const ConfigNode *node,
+                    const QString &name = QString(),
+                    const QString &detail = QString(),
+                    const QJsonValue &value = QJsonValue());
+
+    /*!
+     * Copy constructor
+     *
+     * \param   other   Error to copy
+     *
+     * The copy captures the path of the configuration node.
+     */
+    ConfigItemError(const ConfigItemError &other);
+
+    /*!
+     * Copy assignment operator
+     *
+     * \param   other   Error to copy
+     *
+     * \return  Reference to this error
+     *
+     * The copy captures the path of the configuration node.
+     */
+    ConfigItemError &operator=(const ConfigItemError &other);
+
+    /*!
+     * Gets the error code
+     *
+     * \return  Error code
+     */
+    Code code() const;
+
+    /*!
+     * Gets the configuration node related to the error
+     *
+     * \return  Configuration node or nullptr
+     */
+    const ConfigNode *node() const;
+
+    /*!
+     * Gets the path of the configuration node related to the error
+     *
+     * \return  Node path or an empty string if there is no configuration node
+     */
+    QString nodePath() const;
+
+    /*!
+     * Gets the parameter name
+     *
+     * \return  Parameter name
+     */
+    const QString &name() const;
+
+    /*!
+     * Gets the additional details
+     *
+     * \return  Additional details
+     */
+    const QString &detail() const;
+
+    /*!
+     * Gets the parameter value
+     *
+     * \return  Parameter value
+     */
+    const QJsonValue &value() const;
+
+    /*!
+     * Formats the error message
+     *
+     * \return  Error message
+     */
+    QString message() const;
+
+private:
+    //! Error code
+    Code m_code;
+
+    //! Configuration node related to the error
+    const ConfigNode *m_node;
+
+    //! Captured path of the configuration node (null string if it was not captured)
+    QString m_nodePath;
+
+    //! Parameter name
+    QString m_name;
+
+    //! Additional details
+    QString m_detail;
+
+    //! Parameter value
+    QJsonValue m_value;
+};
+
+} // namespace CppConfigFramework
@@ -0,0 +1,335 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a streaming (pull) parser for JSON documents
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/CppConfigFrameworkExport.hpp>
+
+// Qt includes
+#include <QtCore/QJsonValue>
+#include <QtCore/QString>
+
+// System includes
+#include <cstddef>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+/*!
+ * This class parses a JSON document (UTF-8 encoded) directly from a memory buffer
+ *
+ * The parser doesn't build an intermediate representation of the document. Instead the caller pulls
+ * the values one by one and can either read them (as a whole or member by member) or skip them. The
+ * buffer is not copied so it must outlive the parser.
+ *
+ * Example for reading an Object:
+ *
+ * \code
+ * if (!parser.beginObject())
+ * {
+ *     // Handle error
+ * }
+ *
+ * QString name;
+ *
+ * while (parser.nextMember(&name))
+ * {
+ *     // Read or skip the member's value
+ * }
+ *
+ * if (parser.hasError())
+ * {
+ *     // Handle error
+ * }
+ * \endcode
+ *
+ * \note    Numbers are read as double precision floating-point values (same as QJsonDocument)
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigJsonStreamParser
+{
+public:
+    //! Enumerates the types of the JSON values
+    enum class ValueType
+    {
+        //! Null value
+        Null,
+
+        //! Boolean value
+        Bool,
+
+        //! Number value
+        Number,
+
+        //! String value
+        String,
+
+        //! Array value
+        Array,
+
+        //! Object value
+        Object,
+
+        //! Invalid value (parse error or end of the document)
+        Invalid
+    };
+
+    //! Maximum nesting depth of Arrays and Objects
+    static constexpr int MAX_DEPTH = 1024;
+
+public:
+    /*!
+     * Constructor
+     *
+     * \param   data    JSON document
+     * \param   size    Size of the JSON document
+     */
+    ConfigJsonStreamParser(const char *data, const size_t size);
+
+    //! Copy constructor is disabled
+    ConfigJsonStreamParser(const ConfigJsonStreamParser &) = delete;
+
+    //! Move constructor
+    ConfigJsonStreamParser(ConfigJsonStreamParser &&) noexcept = default;
+
+    //! Destructor
+    ~ConfigJsonStreamParser() = default;
+
+    //! Copy assignment operator is disabled
+    ConfigJsonStreamParser &operator=(const ConfigJsonStreamParser &) = delete;
+
+    //! Move assignment operator
+    ConfigJsonStreamParser &operator=(ConfigJsonStreamParser &&) noexcept = default;
+
+    /*!
+     * Gets the current position in the JSON document
+     *
+     * \return  Offset from the start of the JSON document
+     */
+    size_t position() const;
+
+    /*!
+     * Moves to the specified position in the JSON document
+     *
+     * \param   position    Offset from the start of the JSON document (it must point to a value
+     *                      previously returned by position())
+     *
+     * \note    The error and nesting depth are reset
+     */
+    void seek(const size_t position);
+
+    /*!
+     * Checks if the parser encountered an error
+     *
+     * \retval  true    Error
+     * \retval  false   No error
+     */
+    bool hasError() const;
+
+    /*!
+     * Gets the error description
+     *
+     * \return  Error description or an empty string if there is no error
+     */
+    QString errorString() const;
+
+    /*!
+     * Gets the position of the error
+     *
+     * \return  Offset of the error from the start of the JSON document
+     */
+    size_t errorPosition() const;
+
+    /*!
+     * Checks the type of the next value without consuming it
+     *
+     * \return  Type of the next value
+     */
+    ValueType peekValueType();
+
+    /*!
+     * Starts reading an Object
+     *
+     * \retval  true    Success
+     * \retval  false   Failure (next value is not an Object)
+     */
+    bool beginObject();
+
+    /*!
+     * Moves to the next member of the Object
+     *
+     * \param[out]  name    Name of the member
+     *
+     * \retval  true    Next member was found and the parser is positioned at its value
+     * \retval  false   End of the Object was reached or an error occurred (see hasError())
+     *
+     * \note    The value of the previous member must be either read or skipped before this method
+     *          is called
+     */
+    bool nextMember(QString *name);
+
+    /*!
+     * Starts reading an Array
+     *
+     * \retval  true    Success
+     * \retval  false   Failure (next value is not an Array)
+     */
+    bool beginArray();
+
+    /*!
+     * Moves to the next item of the Array
+     *
+     * \retval  true    Next item was found and the parser is positioned at it
+     * \retval  false   End of the Array was reached or an error occurred (see hasError())
+     *
+     * \note    The previous item must be either read or skipped before this method is called
+     */
+    bool nextItem();
+
+    /*!
+     * Reads a String value
+     *
+     * \param[out]  value   String value
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool readString(QString *value);
+
+    /*!
+     * Reads the next value (including all of its members or items)
+     *
+     * \param[out]  value   JSON value
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool readValue(QJsonValue *value);
+
+    /*!
+     * Skips the next value (including all of its members or items)
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     *
+     * \note    The skipped value is fully validated
+     */
+    bool skipValue();
+
+    /*!
+     * Checks that only whitespace is left in the JSON document
+     *
+     * \retval  true    End of the JSON document was reached
+     * \retval  false   Failure
+     */
+    bool atEnd();
+
+private:
+    /*!
+     * Sets the error
+     *
+     * \param   errorString     Error description
+     *
+     * \return  Always false
+     */
+    bool setError(const QString &errorString);
+
+    //! Skips the whitespace characters
+    void skipWhitespace();
+
+    /*!
+     * Consumes the expected character (after skipping the whitespace)
+     *
+     * \param   character   Expected character
+     *
+     * \retval  true    Character was consumed
+     * \retval  false   Next character is different
+     */
+    bool consume(const char character);
+
+    /*!
+     * Consumes the expected literal (true, false, null)
+     *
+     * \param   literal     Expected literal
+     * \param   length      Length of the literal
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool consumeLiteral(const char *literal, const size_t length);
+
+    /*!
+     * Scans a Number value
+     *
+     * \param[out]  value   Number value (optional)
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool scanNumber(double *value);
+
+    /*!
+     * Scans a String value
+     *
+     * \param[out]  value   String value (optional)
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool scanString(QString *value);
+
+    /*!
+     * Increases the nesting depth
+     *
+     * \retval  true    Success
+     * \retval  false   Maximum nesting depth was exceeded
+     */
+    bool enterContainer();
+
+private:
+    //! JSON document
+    const char *m_data;
+
+    //! Size of the JSON document
+    size_t m_size;
+
+    //! Current position in the JSON document
+    size_t m_position;
+
+    //! Current nesting depth
+    int m_depth;
+
+    //! Flag indicating that the first member or item of the current container is expected
+    bool m_firstEntry;
+
+    //! Error description
+    QString m_errorString;
+
+    //! Position of the error
+    size_t m_errorPosition;
+};
+
+} // namespace CppConfigFramework
@@ -0,0 +1,227 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a container for the members of an Object configuration node
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigNameTable.hpp>
+#include <CppConfigFramework/ConfigNode.hpp>
+
+// Qt includes
+
+// System includes
+#include <memory>
+#include <vector>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+/*!
+ * This class holds the members of an Object configuration node
+ *
+ * Members are stored in a contiguous container. The storage policy is selected automatically based
+ * on the number of members:
+ *
+ * - Small objects: members are sorted by the atoms of their names and looked up with a binary
+ *   search
+ * - Large objects: members are kept in insertion order and looked up through an open-addressing
+ *   hash index (linear probing)
+ *
+ * \note    Order of the members is an implementation detail. Names need to be sorted to get a
+ *          deterministic order.
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigMemberStorage
+{
+public:
+    //! Holds a single member
+    struct Member
+    {
+        //! Atom of the member's name
+        ConfigNameTable::Atom name;
+
+        //! Member node
+        std::unique_ptr<ConfigNode> node;
+    };
+
+    //! Constant iterator
+    using const_iterator = std::vector<Member>::const_iterator;
+
+    //! Number of members above which the hash index is used
+    static constexpr int HASH_INDEX_THRESHOLD = 32;
+
+public:
+    //! Constructor
+    ConfigMemberStorage() = default;
+
+    //! Copy constructor is disabled
+    ConfigMemberStorage(const ConfigMemberStorage &) = delete;
+
+    //! Move constructor
+    ConfigMemberStorage(ConfigMemberStorage &&) noexcept = default;
+
+    //! Destructor
+    ~ConfigMemberStorage() = default;
+
+    //! Copy assignment operator is disabled
+    ConfigMemberStorage &operator=(const ConfigMemberStorage &) = delete;
+
+    //! Move assignment operator
+    ConfigMemberStorage &operator=(ConfigMemberStorage &&) noexcept = default;
+
+    /*!
+     * Gets the number of members
+     *
+     * \return  Number of members
+     */
+    int count() const;
+
+    /*!
+     * Checks if the hash index is used for lookups
+     *
+     * \retval  true    Hash index is used
+     * \retval  false   Binary search is used
+     */
+    bool hasHashIndex() const;
+
+    /*!
+     * Finds the member with the specified name
+     *
+     * \param   name    Atom of the member's name
+     *
+     * \return  Member node or nullptr if the member was not found
+     */
+    const ConfigNode *find(const ConfigNameTable::Atom name) const;
+
+    //! \copydoc    ConfigMemberStorage::find()
+    ConfigNode *find(const ConfigNameTable::Atom name);
+
+    /*!
+     * Inserts a new member or replaces an existing member with the same name
+     *
+     * \param   name    Atom of the member's name
+     * \param   node    Member node
+     *
+     * \return  Replaced member node or nullptr if a new member was inserted
+     */
+    std::unique_ptr<ConfigNode> insert(const ConfigNameTable::Atom name,
+                                       std::unique_ptr<ConfigNode> node);
+
+    /*!
+     * Removes the member with the specified name
+     *
+     * \param   name    Atom of the member's name
+     *
+     * \return  Removed member node or nullptr if the member was not found
+     */
+    std::unique_ptr<ConfigNode> remove(const ConfigNameTable::Atom name);
+
+    //! Removes all members
+    void clear();
+
+    //! Gets the iterator to the first member
+    const_iterator begin() const;
+
+    //! Gets the iterator after the last member
+    const_iterator end() const;
+
+private:
+    /*!
+     * Finds the index of the member with the specified name
+     *
+     * \param   name    Atom of the member's name
+     *
+     * \return  Index of the member or -1 if the member was not found
+     */
+    int indexOf(const ConfigNameTable::Atom name) const;
+
+    /*!
+     * Calculates the slot in the hash index for the specified name
+     *
+     * \param   name    Atom of the member's name
+     *
+     * \return  Slot in the hash index
+     */
+    size_t hashSlot(const ConfigNameTable::Atom name) const;
+
+    //! Rebuilds the hash index from the members
+    void rebuildHashIndex();
+
+private:
+    //! Members
+    std::vector<Member> m_members;
+
+    //! Hash index (each slot holds the index of the member incremented by 1 or 0 if it is empty)
+    std::vector<quint32> m_hashIndex;
+};
+
+/*!
+ * This class gives access to the members of an Object configuration node ordered by the atoms of
+ * their names
+ *
+ * Members without a hash index are already sorted in the storage so they are accessed directly.
+ * Only the members with a hash index are sorted (as pointers to the members).
+ *
+ * \note    Order of the atoms is not alphabetical, but it is stable for as long as the process runs
+ * \note    The storage must not be modified while this object is used
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigSortedMembers
+{
+public:
+    /*!
+     * Constructor
+     *
+     * \param   members     Member storage
+     */
+    explicit ConfigSortedMembers(const ConfigMemberStorage &members);
+
+    /*!
+     * Gets the number of members
+     *
+     * \return  Number of members
+     */
+    size_t count() const;
+
+    /*!
+     * Gets the member at the specified index
+     *
+     * \param   index   Index of the member
+     *
+     * \return  Member
+     */
+    const ConfigMemberStorage::Member &at(const size_t index) const;
+
+private:
+    //! Members if they are sorted in the storage (otherwise nullptr)
+    const ConfigMemberStorage::Member *m_members;
+
+    //! Sorted members if they are not sorted in the storage
+    std::vector<const ConfigMemberStorage::Member *> m_sortedMembers;
+
+    //! Number of members
+    size_t m_count;
+};
+
+} // namespace CppConfigFramework
@@ -0,0 +1,236 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a process-wide table of interned configuration node names
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/CppConfigFrameworkExport.hpp>
+
+// Qt includes
+#include <QtCore/QMutex>
+#include <QtCore/QString>
+
+// System includes
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+/*!
+ * This is a process-wide table of interned configuration node names
+ *
+ * Each unique node name is stored only once and it is identified by a small integer (atom) so that
+ * node names can be compared and looked up without comparing the strings. Interned names are never
+ * removed from the table.
+ *
+ * Since the table only grows, every distinct node name that was ever read stays in memory until the
+ * process exits. This is negligible for configurations with a fixed set of member names, but a
+ * long-running process that keeps reading configurations with changing member names (for example a
+ * ConfigWatcher rereading files whose keys are generated) grows the table with every new name. Such
+ * processes can monitor the growth with count() and memoryUsage().
+ *
+ * Lookups of already interned node names (find(), name() and intern() of an existing name) are
+ * lock-free so that they can be used from many threads without contention. Only interning of a new
+ * node name takes a lock.
+ *
+ * \note    All methods are thread-safe
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigNameTable
+{
+public:
+    //! Identifier of an interned node name
+    using Atom = quint32;
+
+    //! Identifier that doesn't represent any node name
+    static constexpr Atom INVALID_ATOM = 0U;
+
+public:
+    //! Copy constructor is disabled
+    ConfigNameTable(const ConfigNameTable &) = delete;
+
+    //! Move constructor is disabled
+    ConfigNameTable(ConfigNameTable &&) = delete;
+
+    //! Destructor
+    ~ConfigNameTable();
+
+    //! Copy assignment operator is disabled
+    ConfigNameTable &operator=(const ConfigNameTable &) = delete;
+
+    //! Move assignment operator is disabled
+    ConfigNameTable &operator=(ConfigNameTable &&) = delete;
+
+    /*!
+     * Gets the table instance
+     *
+     * \return  Table instance
+     */
+    static ConfigNameTable *instance();
+
+    /*!
+     * Interns the specified node name
+     *
+     * \param   name    Node name
+     *
+     * \return  Atom of the node name or INVALID_ATOM if the node name is not valid
+     *
+     * \note    The node name is added to the table only if it is not already in it
+     *
+     * \see     ConfigNodePath::validateNodeName()
+     */
+    Atom intern(const QString &name);
+
+    /*!
+     * Finds the specified node name without adding it to the table
+     *
+     * \param   name    Node name
+     *
+     * \return  Atom of the node name or INVALID_ATOM if the node name is not in the table
+     */
+    Atom find(const QString &name) const;
+
+    /*!
+     * Gets the node name for the specified atom
+     *
+     * \param   atom    Atom of the node name
+     *
+     * \return  Node name or an empty string if the atom is not valid
+     *
+     * \note    The returned reference stays valid for the lifetime of the process
+     */
+    const QString &name(const Atom atom) const;
+
+    /*!
+     * Gets the number of interned node names
+     *
+     * \return  Number of interned node names
+     */
+    int count() const;
+
+    /*!
+     * Gets the approximate amount of memory used by the table
+     *
+     * \return  Number of bytes used by the interned node names and the hash indexes
+     *
+     * \note    The memory is only released when the process exits
+     */
+    size_t memoryUsage() const;
+
+private:
+    //! Number of node names in the first chunk of the node name storage
+    static constexpr quint32 FIRST_CHUNK_SIZE = 64U;
+
+    //! Maximum number of chunks in the node name storage (each chunk is twice as big as previous)
+    static constexpr size_t MAX_CHUNK_COUNT = 26U;
+
+    //! Initial number of slots in the hash index
+    static constexpr quint32 INITIAL_INDEX_CAPACITY = 256U;
+
+    /*!
+     * Hash index of the interned node names (open addressing with linear probing)
+     *
+     * Each slot holds an atom or INVALID_ATOM if the slot is empty. Slots are only ever set once so
+     * readers can probe the index without a lock. When the index needs to grow a new index is built
+     * and published in its place.
+     */
+    struct Index
+    {
+        /*!
+         * Constructor
+         *
+         * \param   capacity    Number of slots (must be a power of two)
+         */
+        explicit Index(const quint32 capacity);
+
+        //! Mask for converting a hash value to a slot index
+        quint32 mask;
+
+        //! Slots
+        std::unique_ptr<std::atomic<Atom>[]> slots;
+    };
+
+private:
+    //! Constructor
+    ConfigNameTable();
+
+    /*!
+     * Gets the node name for the specified atom without checking it
+     *
+     * \param   atom    Atom of an interned node name
+     *
+     * \return  Node name
+     */
+    const QString &storedName(const Atom atom) const;
+
+    /*!
+     * Finds the specified node name in the index
+     *
+     * \param   index   Hash index
+     * \param   name    Node name
+     *
+     * \return  Atom of the node name or INVALID_ATOM if the node name is not in the index
+     */
+    Atom findInIndex(const Index &index, const QString &name) const;
+
+    /*!
+     * Inserts the specified node name to the index
+     *
+     * \param   name    Node name
+     * \param   atom    Atom of the node name
+     *
+     * \param[in,out]   index   Hash index
+     */
+    static void insertToIndex(const QString &name, const Atom atom, Index *index);
+
+private:
+    //! Serializes interning of new node names
+    mutable QMutex m_mutex;
+
+    //! Number of interned node names
+    std::atomic<quint32> m_count;
+
+    //! Total number of characters in the interned node names
+    std::atomic<quint64> m_nameLength;
+
+    //! Chunks of the interned node names (index of the name is the atom decremented by 1)
+    std::array<std::atomic<QString *>, MAX_CHUNK_COUNT> m_chunks;
+
+    //! Currently published hash index
+    std::atomic<const Index *> m_index;
+
+    /*!
+     * All hash indexes that were ever published
+     *
+     * Replaced indexes are kept until the table is destroyed since lock-free readers could still be
+     * probing them. Their total size is less than the size of the current index.
+     */
+    std::vector<std::unique_ptr<Index>> m_indexes;
+};
+
+} // namespace CppConfigFramework
@@ -21,6 +21,7 @@
 #pragma once
 
 // C++ Config Framework includes
+#include <CppConfigFramework/ConfigNameTable.hpp>
 #include <CppConfigFramework/ConfigNodePath.hpp>
 
 // Qt includes
@@ -77,22 +78,58 @@ public:
     //! Copy constructor is disabled
     ConfigNode(const ConfigNode &) = delete;
 
-    //! Move constructor
-    ConfigNode(ConfigNode &&) noexcept = default;
+    /*!
+     * Move constructor
+     *
+     * \param   other   Configuration node to move
+     */
+    ConfigNode(ConfigNode &&other) noexcept;
 
     //! Destructor
-    virtual ~ConfigNode() = default;
+    virtual ~ConfigNode();
 
     //! Copy assignment operator is disabled
     ConfigNode &operator=(const ConfigNode &) = delete;
 
-    //! Move assignment operator
-    ConfigNode &operator=(ConfigNode &&) noexcept = default;
+    /*!
+     * Move assignment operator
+     *
+     * \param   other   Configuration node to move
+     *
+     * \return  This configuration node
+     *
+     * \note    The node keeps its own memory, only the contents are moved
+     */
+    ConfigNode &operator=(ConfigNode &&other) noexcept;
+
+    /*!
+     * Allocates memory for a configuration node
+     *
+     * \param   size    Size of the configuration node
+     *
+     * \return  Allocated memory
+     *
+     * \note    Memory is allocated from the arena that is active for the current thread (if any)
+     *
+     * \see     ConfigNodeArena
+     */
+    static void *operator new(size_t size);
+
+    /*!
+     * Frees memory of a configuration node
+     *
+     * \param   pointer     Memory of the configuration node
+     */
+    static void operator delete(void *pointer);
 
     /*!
      * Clones just the configuration node contents and not the parent
      *
      * \return  Cloned configuration node
+     *
+     * \note    Members of an Object node that belongs to the active sharing scope are not copied
+     *          until either of the nodes is modified or accessed through the non-const API (see
+     *          ConfigNodeSharingScope). Nodes outside of a sharing scope are always copied.
      */
     virtual std::unique_ptr<ConfigNode> clone() const = 0;
 
@@ -157,9 +194,27 @@ public:
      * Sets the parent of this configuration node
      *
      * \param   parent  New parent of this configuration node
+     *
+     * \note    The member name atom is reset
      */
     void setParent(ConfigObjectNode *parent);
 
+    /*!
+     * Sets the parent of this configuration node and the name under which this node is stored in
+     * the parent
+     *
+     * \param   parent          New parent of this configuration node
+     * \param   memberNameAtom  Atom of the member name
+     */
+    void setParent(ConfigObjectNode *parent, const ConfigNameTable::Atom memberNameAtom);
+
+    /*!
+     * Gets the atom of the name under which this node is stored in its parent
+     *
+     * \return  Atom of the member name or ConfigNameTable::INVALID_ATOM if it is not known
+     */
+    ConfigNameTable::Atom memberNameAtom() const;
+
     /*!
      * Gets the root node
      *
@@ -252,9 +307,26 @@ public:
      */
     static QString typeToString(const Type type);
 
+protected:
+    /*!
+     * Prepares the ancestors of this node (and this node if it is an Object node) for modification
+     *
+     * Clones that still share their members with any of these nodes are detached so that the
+     * modification is not visible through them.
+     *
+     * \note    This method must be called before the contents of a node are modified
+     */
+    void prepareForModification();
+
 private:
     //! Holds a reference to the parent of this node or null if this is a root node
     ConfigObjectNode *m_parent;
+
+    //! Holds the atom of the name under which this node is stored in its parent
+    ConfigNameTable::Atom m_memberNameAtom;
+
+    //! Holds the flag that tells if the memory of this node was allocated from an arena
+    bool m_arenaAllocated;
 };
 
 } // namespace CppConfigFramework
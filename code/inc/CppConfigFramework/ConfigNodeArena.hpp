@@ -0,0 +1,271 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains an arena (monotonic buffer) allocator for configuration nodes
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/CppConfigFrameworkExport.hpp>
+
+// Qt includes
+
+// System includes
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+/*!
+ * This class holds an arena (monotonic buffer) for allocation of configuration nodes
+ *
+ * While an arena is active for the current thread (see ConfigNodeArenaScope) all configuration
+ * nodes created in that thread are allocated from the arena's memory chunks instead of separately
+ * from the heap. Freeing a node allocated from an arena doesn't release its memory. All chunks of
+ * the arena are released at once when the arena is no longer active and all of the nodes allocated
+ * from it were destroyed.
+ *
+ * Each node that is allocated from an arena holds a reference to it, so a single node that outlives
+ * the configuration tree it was created with pins the whole arena: none of the arena's memory is
+ * released until that node is destroyed too. Nodes that need to be kept for longer than the rest of
+ * the tree (for example cached nodes) should therefore be created in a ConfigNodeHeapScope or be
+ * cloned after the arena is no longer active.
+ *
+ * Nodes that are created while no arena is active are allocated directly from the heap, without
+ * the block header and without a reference to an arena.
+ *
+ * \note    Only the nodes themselves are allocated from the arena. Their values, member containers
+ *          and strings still use the heap.
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigNodeArena
+{
+public:
+    //! Default size of a memory chunk
+    static constexpr size_t DEFAULT_CHUNK_SIZE = 64U * 1024U;
+
+public:
+    //! Copy constructor is disabled
+    ConfigNodeArena(const ConfigNodeArena &) = delete;
+
+    //! Move constructor is disabled
+    ConfigNodeArena(ConfigNodeArena &&) = delete;
+
+    //! Copy assignment operator is disabled
+    ConfigNodeArena &operator=(const ConfigNodeArena &) = delete;
+
+    //! Move assignment operator is disabled
+    ConfigNodeArena &operator=(ConfigNodeArena &&) = delete;
+
+    /*!
+     * Gets the arena that is active for the current thread
+     *
+     * \return  Active arena or nullptr if no arena is active
+     */
+    static ConfigNodeArena *current();
+
+    /*!
+     * Allocates memory for a configuration node
+     *
+     * \param   size    Size of the configuration node
+     *
+     * \return  Allocated memory
+     *
+     * \note    Memory is allocated from the active arena or from the heap if no arena is active
+     */
+    static void *allocate(const size_t size);
+
+    /*!
+     * Checks if the memory of a configuration node was allocated from an arena
+     *
+     * \param   pointer     Memory of the configuration node
+     *
+     * \retval  true    Memory was allocated from an arena
+     * \retval  false   Memory was allocated from the heap or not with allocate() at all
+     *
+     * \note    This method must be called once from the constructor of the configuration node
+     */
+    static bool claim(const void *pointer);
+
+    /*!
+     * Prepares the deallocation of the memory of the configuration node that is being destroyed
+     *
+     * \param   arenaAllocated  Result of claim() for the configuration node
+     *
+     * \note    This method must be called from the destructor of the configuration node
+     */
+    static void prepareDeallocation(const bool arenaAllocated);
+
+    /*!
+     * Frees memory of a configuration node
+     *
+     * \param   pointer     Memory allocated with allocate()
+     */
+    static void deallocate(void *pointer);
+
+    /*!
+     * Gets the number of memory chunks allocated by this arena
+     *
+     * \return  Number of memory chunks
+     */
+    size_t chunkCount() const;
+
+    /*!
+     * Gets the number of configuration nodes allocated from this arena
+     *
+     * \return  Number of allocations
+     */
+    size_t allocationCount() const;
+
+private:
+    /*!
+     * Constructor
+     *
+     * \param   chunkSize   Size of a memory chunk
+     */
+    explicit ConfigNodeArena(const size_t chunkSize);
+
+    //! Destructor
+    ~ConfigNodeArena() = default;
+
+    /*!
+     * Allocates memory from the arena's memory chunks
+     *
+     * \param   size    Size of the memory block (including the header)
+     *
+     * \return  Allocated memory
+     */
+    void *allocateBlock(const size_t size);
+
+    //! Adds a reference to this arena
+    void addReference();
+
+    //! Releases a reference to this arena (the arena is destroyed with the last reference)
+    void releaseReference();
+
+private:
+    //! Size of a memory chunk
+    size_t m_chunkSize;
+
+    //! Memory chunks
+    std::vector<std::unique_ptr<char[]>> m_chunks;
+
+    //! Position of the next allocation in the last memory chunk
+    size_t m_chunkPosition;
+
+    //! Number of allocations
+    size_t m_allocationCount;
+
+    //! Number of references (active scopes and live allocations)
+    std::atomic<size_t> m_references;
+
+    friend class ConfigNodeArenaScope;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * This class activates an arena for the current thread for the lifetime of the scope
+ *
+ * If an arena is already active for the current thread then it stays active and it is shared with
+ * this scope, otherwise a new arena is created.
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigNodeArenaScope
+{
+public:
+    /*!
+     * Constructor
+     *
+     * \param   chunkSize   Size of a memory chunk (only used if a new arena is created)
+     */
+    explicit ConfigNodeArenaScope(const size_t chunkSize = ConfigNodeArena::DEFAULT_CHUNK_SIZE);
+
+    //! Copy constructor is disabled
+    ConfigNodeArenaScope(const ConfigNodeArenaScope &) = delete;
+
+    //! Move constructor is disabled
+    ConfigNodeArenaScope(ConfigNodeArenaScope &&) = delete;
+
+    //! Destructor
+    ~ConfigNodeArenaScope();
+
+    //! Copy assignment operator is disabled
+    ConfigNodeArenaScope &operator=(const ConfigNodeArenaScope &) = delete;
+
+    //! Move assignment operator is disabled
+    ConfigNodeArenaScope &operator=(ConfigNodeArenaScope &&) = delete;
+
+    /*!
+     * Gets the arena of this scope
+     *
+     * \return  Arena
+     */
+    const ConfigNodeArena *arena() const;
+
+private:
+    //! Arena of this scope
+    ConfigNodeArena *m_arena;
+
+    //! Arena that was active before this scope
+    ConfigNodeArena *m_previousArena;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * This class deactivates the arena of the current thread for the lifetime of the scope
+ *
+ * Configuration nodes created in this scope are allocated from the heap. This is useful for nodes
+ * that outlive the configuration tree that is being read (for example cached nodes) as they would
+ * otherwise keep the memory of the whole arena alive.
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigNodeHeapScope
+{
+public:
+    //! Constructor
+    ConfigNodeHeapScope();
+
+    //! Copy constructor is disabled
+    ConfigNodeHeapScope(const ConfigNodeHeapScope &) = delete;
+
+    //! Move constructor is disabled
+    ConfigNodeHeapScope(ConfigNodeHeapScope &&) = delete;
+
+    //! Destructor
+    ~ConfigNodeHeapScope();
+
+    //! Copy assignment operator is disabled
+    ConfigNodeHeapScope &operator=(const ConfigNodeHeapScope &) = delete;
+
+    //! Move assignment operator is disabled
+    ConfigNodeHeapScope &operator=(ConfigNodeHeapScope &&) = delete;
+
+private:
+    //! Arena that was active before this scope
+    ConfigNodeArena *m_previousArena;
+};
+
+} // namespace CppConfigFramework
@@ -0,0 +1,235 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains functions for deserializing configuration nodes directly to native values
+ *
+ * The deserialize() functions are a customization point: support for additional types can be added
+ * with an overload (in the namespace of the type or in this namespace) or with an explicit
+ * specialization of the generic function template. Types without direct support are deserialized
+ * from the JSON representation of the node with CedarFramework::deserialize().
+ *
+ * \note   Cedar Framework describes structures with deserialization functions that take a
+ *          QJsonValue, so there is no node-driven path for them: a structure that is loaded from an
+ *          Object node is always converted to JSON first (including all of its nested members).
+ *          Structures that are loaded often should get their own overload that deserializes the
+ *          members directly from the node (or be loaded with a ConfigItem).
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/ConfigValueNode.hpp>
+#include <CppConfigFramework/ConfigWriter.hpp>
+
+// Cedar Framework includes
+#include <CedarFramework/Deserialization.hpp>
+
+// Qt includes
+#include <QtCore/QHash>
+#include <QtCore/QMap>
+
+// System includes
+#include <map>
+#include <unordered_map>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+/*!
+ * Deserializes the configuration node
+ *
+ * \tparam  T   Data type of the value
+ *
+ * \param   node    Configuration node (Value node or Object node with fully resolved references)
+ *
+ * \param[out]  value   Output for the deserialized value
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ *
+ * Value nodes are deserialized from their values. Object nodes are converted to JSON first with
+ * ConfigWriter::convertToJsonValue() (this includes structures described for Cedar Framework), so
+ * types that are loaded from Object nodes often should get their own overload.
+ */
+template<typename T>
+bool deserialize(const ConfigNode &node, T *value);
+
+/*!
+ * Deserializes the Object configuration node to a map (each member is deserialized to an item)
+ *
+ * \tparam  T   Data type of the items
+ *
+ * \param   node    Configuration node
+ *
+ * \param[out]  value   Output for the deserialized value
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+template<typename T>
+bool deserialize(const ConfigNode &node, QMap<QString, T> *value);
+
+//! \copydoc    CppConfigFramework::deserialize(const ConfigNode &, QMap<QString, T> *)
+template<typename T>
+bool deserialize(const ConfigNode &node, QHash<QString, T> *value);
+
+//! \copydoc    CppConfigFramework::deserialize(const ConfigNode &, QMap<QString, T> *)
+template<typename T>
+bool deserialize(const ConfigNode &node, std::map<QString, T> *value);
+
+//! \copydoc    CppConfigFramework::deserialize(const ConfigNode &, QMap<QString, T> *)
+template<typename T>
+bool deserialize(const ConfigNode &node, std::unordered_map<QString, T> *value);
+
+// -------------------------------------------------------------------------------------------------
+
+namespace Internal
+{
+
+/*!
+ * Deserializes the Object configuration node to a map
+ *
+ * \tparam  MapType         Data type of the map
+ * \tparam  ItemType        Data type of the items
+ * \tparam  InsertFunction  Data type of the insert functor
+ *
+ * \param   node    Configuration node
+ * \param   insert  Functor that inserts an item into the map
+ *
+ * \param[out]  value   Output for the deserialized value
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+template<typename MapType, typename ItemType, typename InsertFunction>
+bool deserializeMap(const ConfigNode &node, MapType *value, InsertFunction insert)
+{
+    if (!node.isObject())
+    {
+        // Maps can only be deserialized from Object nodes, let Cedar Framework handle the rest
+        return (node.isValue() && CedarFramework::deserialize(node.toValue().value(), value));
+    }
+
+    const auto &object = node.toObject();
+    MapType map;
+
+    for (const QString &name : object.names())
+    {
+        ItemType item {};
+
+        // Unqualified call so that overloads for the item type are also found in its namespace
+        if (!deserialize(*object.member(name), &item))
+        {
+            return false;
+        }
+
+        insert(&map, name, std::move(item));
+    }
+
+    *value = std::move(map);
+    return true;
+}
+
+} // namespace Internal
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T>
+bool deserialize(const ConfigNode &node, T *value)
+{
+    switch (node.type())
+    {
+        case ConfigNode::Type::Value:
+        {
+            return CedarFramework::deserialize(node.toValue().value(), value);
+        }
+
+        case ConfigNode::Type::Object:
+        {
+            const QJsonValue jsonValue = ConfigWriter::convertToJsonValue(node.toObject());
+
+            if (jsonValue.isUndefined())
+            {
+                return false;
+            }
+
+            return CedarFramework::deserialize(jsonValue, value);
+        }
+
+        default:
+        {
+            return false;
+        }
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T>
+bool deserialize(const ConfigNode &node, QMap<QString, T> *value)
+{
+    return Internal::deserializeMap<QMap<QString, T>, T>(
+                node, value, [](QMap<QString, T> *map, const QString &name, T &&item)
+    {
+        map->insert(name, std::move(item));
+    });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T>
+bool deserialize(const ConfigNode &node, QHash<QString, T> *value)
+{
+    return Internal::deserializeMap<QHash<QString, T>, T>(
+                node, value, [](QHash<QString, T> *map, const QString &name, T &&item)
+    {
+        map->insert(name, std::move(item));
+    });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T>
+bool deserialize(const ConfigNode &node, std::map<QString, T> *value)
+{
+    return Internal::deserializeMap<std::map<QString, T>, T>(
+                node, value, [](std::map<QString, T> *map, const QString &name, T &&item)
+    {
+        map->emplace(name, std::move(item));
+    });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename T>
+bool deserialize(const ConfigNode &node, std::unordered_map<QString, T> *value)
+{
+    return Internal::deserializeMap<std::unordered_map<QString, T>, T>(
+                node, value, [](std::unordered_map<QString, T> *map, const QString &name, T &&item)
+    {
+        map->emplace(name, std::move(item));
+    });
+}
+
+} // namespace CppConfigFramework
@@ -31,11 +31,27 @@
 
 // System includes
 #include <memory>
+#include <vector>
 
 // Forward declarations
 
 // Macros
 
+/*!
+ * Creates a node name from a string literal which is validated at compile time
+ *
+ * \param   NAME    Node name (string literal)
+ *
+ * \return  Node name as a QString
+ */
+#define CPPCONFIGFRAMEWORK_NODE_NAME(NAME)                                                         \
+    ([]() -> QString                                                                               \
+    {                                                                                              \
+        static_assert(CppConfigFramework::ConfigNodePath::validateNodeName(NAME),                  \
+                      "Invalid node name: " NAME);                                                 \
+        return QStringLiteral(NAME);                                                               \
+    }())
+
 // -------------------------------------------------------------------------------------------------
 
 namespace CppConfigFramework
@@ -44,6 +60,25 @@ namespace CppConfigFramework
 //! This class holds the configuration node path
 class CPPCONFIGFRAMEWORK_EXPORT ConfigNodePath
 {
+public:
+    //! Enumerates the types of node path segments
+    enum class SegmentType
+    {
+        NodeName,       //!< Valid node name
+        Parent,         //!< Reference to the parent node ("..")
+        Invalid         //!< Invalid node name
+    };
+
+    //! Holds a single node path segment
+    struct Segment
+    {
+        //! Segment type
+        SegmentType type;
+
+        //! Segment value
+        QString name;
+    };
+
 public:
     //! Constructor
     ConfigNodePath() = default;
@@ -146,6 +181,16 @@ public:
      */
     QStringList nodeNames() const;
 
+    /*!
+     * Gets the individual segments of the node path
+     *
+     * \return  Node path segments
+     *
+     * \note    The node path is split to segments and the segments are validated only when the node
+     *          path's value is set so this method doesn't need to do any parsing
+     */
+    const std::vector<Segment> &segments() const;
+
     /*!
      * Creates a new path from this path and (if needed) the working path
      *
@@ -203,6 +248,35 @@ public:
      */
     static bool validateNodeName(const QString &name);
 
+    /*!
+     * Validates the configuration node name
+     *
+     * \param   name    Node name to validate (string literal)
+     *
+     * \return  true    Valid node name
+     * \return  false   Invalid node name
+     *
+     * \note    This method can also be evaluated at compile time
+     *
+     * \see     CPPCONFIGFRAMEWORK_NODE_NAME
+     */
+    template<size_t N>
+    static constexpr bool validateNodeName(const char (&name)[N]);
+
+    /*!
+     * Validates the configuration node name
+     *
+     * \param   name    Node name to validate (ASCII, Latin-1 or UTF-16 characters)
+     * \param   size    Number of characters in the node name
+     *
+     * \return  true    Valid node name
+     * \return  false   Invalid node name
+     *
+     * \note    This method can also be evaluated at compile time
+     */
+    template<typename CharType>
+    static constexpr bool validateNodeName(const CharType *name, const size_t size);
+
 public:
     //! Root node path value
     static const QString ROOT_PATH_VALUE;
@@ -216,11 +290,114 @@ public:
     //! Parent node path
     static const ConfigNodePath PARENT_PATH;
 
+private:
+    /*!
+     * Checks if the character is allowed as the first character of a node name
+     *
+     * \param   character   Character code
+     *
+     * \retval  true    Allowed
+     * \retval  false   Not allowed
+     */
+    static constexpr bool isNodeNameStartCharacter(const unsigned int character);
+
+    /*!
+     * Checks if the character is allowed in a node name (after the first character)
+     *
+     * \param   character   Character code
+     *
+     * \retval  true    Allowed
+     * \retval  false   Not allowed
+     */
+    static constexpr bool isNodeNameCharacter(const unsigned int character);
+
+    //! Splits the node path's value to segments and validates it
+    void parse();
+
+    //! Updates the node path's value from its segments
+    void updateValue();
+
+    //! Invalidates the node path
+    void invalidate();
+
+    /*!
+     * Checks if the node path is valid by using its segments
+     *
+     * \retval  true    Node path is valid
+     * \retval  false   Node path is invalid
+     */
+    bool checkValidity() const;
+
 private:
     //! Node path's value
     QString m_path;
+
+    //! Node path's segments
+    std::vector<Segment> m_segments;
+
+    //! Flag that indicates that this is an absolute node path
+    bool m_absolute = false;
+
+    //! Flag that indicates that this is a valid node path
+    bool m_valid = false;
 };
 
+// -------------------------------------------------------------------------------------------------
+
+template<size_t N>
+constexpr bool ConfigNodePath::validateNodeName(const char (&name)[N])
+{
+    // Ignore the null terminator of the string literal
+    return validateNodeName(name, N - 1U);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+template<typename CharType>
+constexpr bool ConfigNodePath::validateNodeName(const CharType *name, const size_t size)
+{
+    if (size == 0U)
+    {
+        // Error, empty node name
+        return false;
+    }
+
+    if (!isNodeNameStartCharacter(static_cast<unsigned int>(name[0])))
+    {
+        // Error, node name must start with a letter
+        return false;
+    }
+
+    // Check the remaining characters without an early exit so that the loop can be vectorized
+    bool valid = true;
+
+    for (size_t i = 1U; i < size; i++)
+    {
+        valid &= isNodeNameCharacter(static_cast<unsigned int>(name[i]));
+    }
+
+    return valid;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+constexpr bool ConfigNodePath::isNodeNameStartCharacter(const unsigned int character)
+{
+    // Map lowercase letters to uppercase letters
+    return (((character | 0x20U) >= static_cast<unsigned int>('a')) &&
+            ((character | 0x20U) <= static_cast<unsigned int>('z')));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+constexpr bool ConfigNodePath::isNodeNameCharacter(const unsigned int character)
+{
+    return (isNodeNameStartCharacter(character) ||
+            ((character >= static_cast<unsigned int>('0')) &&
+             (character <= static_cast<unsigned int>('9'))) ||
+            (character == static_cast<unsigned int>('_')));
+}
+
 } // namespace CppConfigFramework
 
 // -------------------------------------------------------------------------------------------------
@@ -0,0 +1,128 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a scope that enables sharing of members between cloned Object nodes
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/CppConfigFrameworkExport.hpp>
+
+// Qt includes
+#include <QtCore/QtGlobal>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+/*!
+ * This class enables sharing of members between cloned Object nodes for the current thread for the
+ * lifetime of the scope
+ *
+ * Object nodes that are created while a sharing scope is active belong to that scope. Only such
+ * nodes share their members with their clones (copy-on-write, see ConfigObjectNode) and only when
+ * they are cloned while the same scope is active. All other nodes are copied completely when they
+ * are cloned, so reading a node that doesn't belong to the active scope never modifies it.
+ *
+ * If a scope is already active for the current thread then it stays active and it is shared with
+ * this scope, otherwise a new scope is started.
+ *
+ * \note    Nodes that belong to a scope must only be accessed by the threads of that scope and only
+ *          by one thread at a time. ConfigObjectNode::detach() removes a tree from its scope.
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigNodeSharingScope
+{
+public:
+    //! Identifier of a sharing scope
+    using Id = quint64;
+
+    //! Identifier that doesn't represent any sharing scope
+    static constexpr Id NO_SCOPE = 0U;
+
+public:
+    //! Constructor
+    ConfigNodeSharingScope();
+
+    /*!
+     * Constructor
+     *
+     * \param   id  Identifier of a sharing scope that is active in another thread
+     *
+     * This makes the specified sharing scope active also for the current thread. This is useful
+     * for worker threads that create nodes for the thread that started the scope while that thread
+     * is waiting for them.
+     */
+    explicit ConfigNodeSharingScope(const Id id);
+
+    //! Copy constructor is disabled
+    ConfigNodeSharingScope(const ConfigNodeSharingScope &) = delete;
+
+    //! Move constructor is disabled
+    ConfigNodeSharingScope(ConfigNodeSharingScope &&) = delete;
+
+    //! Destructor
+    ~ConfigNodeSharingScope();
+
+    //! Copy assignment operator is disabled
+    ConfigNodeSharingScope &operator=(const ConfigNodeSharingScope &) = delete;
+
+    //! Move assignment operator is disabled
+    ConfigNodeSharingScope &operator=(ConfigNodeSharingScope &&) = delete;
+
+    /*!
+     * Gets the identifier of the sharing scope that is active for the current thread
+     *
+     * \return  Identifier of the active sharing scope or NO_SCOPE if no sharing scope is active
+     */
+    static Id current();
+
+    /*!
+     * Gets the identifier of this scope
+     *
+     * \return  Identifier of this scope
+     */
+    Id id() const;
+
+    /*!
+     * Checks if this scope started the sharing scope
+     *
+     * \retval  true    This scope started the sharing scope
+     * \retval  false   This scope shares the sharing scope with an outer scope or with a scope in
+     *                  another thread
+     */
+    bool isOutermost() const;
+
+private:
+    //! Identifier of this scope
+    Id m_id;
+
+    //! Identifier of the scope that was active before this scope
+    Id m_previousId;
+
+    //! Flag that indicates that this scope started the sharing scope
+    bool m_outermost;
+};
+
+} // namespace CppConfigFramework
@@ -21,12 +21,13 @@
 #pragma once
 
 // C++ Config Framework includes
-#include <CppConfigFramework/ConfigNode.hpp>
+#include <CppConfigFramework/ConfigMemberStorage.hpp>
+#include <CppConfigFramework/ConfigNodeSharingScope.hpp>
 
 // Qt includes
 
 // System includes
-#include <map>
+#include <vector>
 
 // Forward declarations
 
@@ -37,7 +38,24 @@
 namespace CppConfigFramework
 {
 
-//! This class holds the Object configuration node
+/*!
+ * This class holds the Object configuration node
+ *
+ * Cloning an Object node that belongs to the active sharing scope (see ConfigNodeSharingScope), for
+ * example while a configuration is being read, is a constant time operation. The clone shares the
+ * members of the cloned node (copy-on-write) until either of them is modified or until the members
+ * of the clone are accessed through the non-const API. At that point only the direct members are
+ * copied and they again share their own members with the original nodes. Modification of any node
+ * (also through a pointer to a nested member) first detaches all clones that share that node or any
+ * of its ancestors.
+ *
+ * The const API never modifies a node. It reads the members of a clone that is not detached
+ * directly from the shared node, so the parent() and nodePath() of such a member belong to the
+ * shared node and not to the clone.
+ *
+ * All other nodes are copied completely when they are cloned. A tree is removed from its sharing
+ * scope with detach(). Configurations returned by ConfigReader are always detached.
+ */
 class CPPCONFIGFRAMEWORK_EXPORT ConfigObjectNode : public ConfigNode
 {
 public:
@@ -63,7 +81,7 @@ public:
     ConfigObjectNode(ConfigObjectNode &&) noexcept;
 
     //! Destructor
-    ~ConfigObjectNode() override = default;
+    ~ConfigObjectNode() override;
 
     //! Copy assignment operator is disabled
     ConfigObjectNode &operator=(const ConfigObjectNode &) = delete;
@@ -94,13 +112,34 @@ public:
      */
     bool contains(const QString &name) const;
 
+    /*!
+     * Checks if the node contains a member with the specified name
+     *
+     * \param   name    Atom of the member node's name
+     *
+     * \retval  true    Member with the specified name was found
+     * \retval  false   Member with the specified name was not found
+     */
+    bool contains(const ConfigNameTable::Atom name) const;
+
     /*!
      * Gets the names of all member nodes in this node
      *
-     * \return  Member names
+     * \return  Member names (sorted alphabetically)
      */
     QStringList names() const;
 
+    /*!
+     * Gets the members of this node ordered by the atoms of their names
+     *
+     * \return  Sorted members
+     *
+     * \note    This is cheaper than names() followed by a member() lookup for each name, so it
+     *          should be used to walk over all of the members when their order doesn't need to be
+     *          alphabetical. The returned object must not be used after this node is modified.
+     */
+    ConfigSortedMembers sortedMembers() const;
+
     /*!
      * Gets the name of the specified node
      *
@@ -122,6 +161,41 @@ public:
     //! \copydoc    ConfigObjectNode::member()
     ConfigNode *member(const QString &name);
 
+    /*!
+     * Gets the member with the specified name
+     *
+     * \param   name    Atom of the member node's name
+     *
+     * \return  Configuration node or nullptr if the member was not found
+     *
+     * \note    The const version returns the member of the shared node if this node is not detached
+     *          while the non-const version first copies the direct members to this node
+     */
+    const ConfigNode *member(const ConfigNameTable::Atom name) const;
+
+    //! \copydoc    ConfigObjectNode::member(const ConfigNameTable::Atom) const
+    ConfigNode *member(const ConfigNameTable::Atom name);
+
+    /*!
+     * Gets the members with the specified names
+     *
+     * \param   names   Atoms of the member nodes' names (sorted in ascending order)
+     * \param   count   Number of names
+     *
+     * \param[out]  members         Output for the member nodes (nullptr for each member that was
+     *                              not found)
+     * \param[out]  unknownNames    Optional output for the names of the members that don't match
+     *                              any of the specified names (sorted alphabetically)
+     *
+     * \note    Members of a node without a hash index are kept sorted by the atoms of their names so
+     *          they are matched with the names in a single merge pass. This is cheaper than looking
+     *          up each member separately when many members are needed at once.
+     */
+    void findMembers(const ConfigNameTable::Atom *names,
+                     const size_t count,
+                     const ConfigNode **members,
+                     QStringList *unknownNames = nullptr) const;
+
     /*!
      * Inserts a new member node or replaces an existing member node with the same name
      *
@@ -138,6 +212,19 @@ public:
     //! \copydoc    ConfigObjectNode::setMember()
     bool setMember(const QString &name, const ConfigNode &node);
 
+    /*!
+     * Inserts a new member node or replaces an existing member node with the same name
+     *
+     * \param   name    Atom of the member node's name
+     * \param   node    Member node value
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     *
+     * \note    When the node is stored its parent is updated to point to this node
+     */
+    bool setMember(const ConfigNameTable::Atom name, std::unique_ptr<ConfigNode> node);
+
     /*!
      * Removes a member with the specified name
      *
@@ -162,9 +249,97 @@ public:
      */
     void apply(const ConfigObjectNode &other);
 
+    /*!
+     * Gets the number of unresolved references (NodeReference and DerivedObject nodes) in the
+     * members of this node and all of their descendants
+     *
+     * \return  Number of unresolved references
+     *
+     * \note    The value is updated incrementally whenever a member is added, replaced or removed
+     *          (also in any of the descendants) so getting it doesn't require traversal of the
+     *          node's members. Changes are propagated to the ancestors through the parent links so
+     *          a node must not have a parent unless it is a member of that parent node.
+     */
+    int unresolvedReferenceCount() const;
+
+    /*!
+     * Checks if this node owns its members
+     *
+     * \retval  true    This node owns its members
+     * \retval  false   This node is a clone that still shares the members of the cloned node
+     */
+    bool isDetached() const;
+
+    /*!
+     * Detaches this node and all of its descendants from the nodes that they were cloned from and
+     * removes them from their sharing scope
+     *
+     * After this the nodes never share their members again: their clones are complete copies and
+     * reading them doesn't modify them.
+     *
+     * \note    Nodes cloned from this node or its descendants are detached too
+     */
+    void detach();
+
+private:
+    /*!
+     * Updates the number of unresolved references of this node and all of its ancestors
+     *
+     * \param   delta   Difference to the current number of unresolved references
+     */
+    void updateUnresolvedReferenceCount(const int delta);
+
+    /*!
+     * Gets the members of this node or the members of the shared node if this node is not detached
+     *
+     * \return  Member storage
+     */
+    const ConfigMemberStorage &memberStorage() const;
+
+    /*!
+     * Sets the node whose members are shared by this node
+     *
+     * \param   source  Shared node or nullptr to stop sharing
+     *
+     * \note    This method doesn't update the members of this node
+     */
+    void setSharedSource(const ConfigObjectNode *source);
+
+    //! Copies the direct members of the shared node to this node (if it is not detached)
+    void copySharedMembers();
+
+    //! Copies the members of this node to all of the clones that still share them
+    void detachSharedClones();
+
+    /*!
+     * Hands over the members of this node to the clones that still share them
+     *
+     * \note    This node is left without members so this method must only be called when this node
+     *          is about to be destroyed or overwritten.
+     */
+    void releaseSharedClones();
+
 private:
-    //! Configuration node members
-    std::map<QString, std::unique_ptr<ConfigNode>> m_members;
+    //! Configuration node members (keyed by the atoms of their names)
+    ConfigMemberStorage m_members;
+
+    //! Number of unresolved references in the members of this node and all of their descendants
+    int m_unresolvedReferenceCount;
+
+    //! Node whose members are shared by this node or nullptr if this node is detached
+    const ConfigObjectNode *m_sharedSource;
+
+    //! Index of this node in the shared node's list of clones
+    size_t m_sharedCloneIndex;
+
+    //! Clones that still share the members of this node
+    mutable std::vector<ConfigObjectNode *> m_sharedClones;
+
+    //! Sharing scope that this node belongs to (NO_SCOPE if its members are never shared)
+    ConfigNodeSharingScope::Id m_sharingScope;
+
+    friend class ConfigNode;
+    friend class ConfigDiff;
 };
 
 } // namespace CppConfigFramework
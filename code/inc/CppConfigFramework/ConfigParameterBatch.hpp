@@ -0,0 +1,222 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains classes for finding the nodes of many configuration parameters in a single pass
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigNameTable.hpp>
+
+// Qt includes
+#include <QtCore/QStringList>
+#include <QtCore/QVarLengthArray>
+
+// System includes
+#include <initializer_list>
+#include <vector>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+class ConfigNode;
+class ConfigObjectNode;
+
+/*!
+ * This class holds the names of the configuration parameters of a configuration item
+ *
+ * The names are interned and ordered by their atoms only once, when the object is created, so the
+ * object is meant to be created once for each configuration item type (for example as a static
+ * variable).
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigParameterNames
+{
+public:
+    /*!
+     * Constructor
+     *
+     * \param   names   Parameter names
+     */
+    explicit ConfigParameterNames(const QStringList &names);
+
+    //! \copydoc    ConfigParameterNames::ConfigParameterNames()
+    ConfigParameterNames(std::initializer_list<QString> names);
+
+    /*!
+     * Gets the number of parameters
+     *
+     * \return  Number of parameters
+     */
+    size_t count() const;
+
+    /*!
+     * Gets the parameter's name
+     *
+     * \param   index   Index of the parameter
+     *
+     * \return  Parameter name
+     */
+    const QString &name(const size_t index) const;
+
+    /*!
+     * Gets the atom of the parameter's name
+     *
+     * \param   index   Index of the parameter
+     *
+     * \return  Atom of the parameter's name
+     */
+    ConfigNameTable::Atom atom(const size_t index) const;
+
+    /*!
+     * Checks if all parameter names are valid and unique
+     *
+     * \retval  true    All names are valid
+     * \retval  false   At least one name is not valid
+     */
+    bool isValid() const;
+
+    /*!
+     * Gets the first parameter name that is either not valid or not unique
+     *
+     * \return  Parameter name or an empty string if all names are valid
+     */
+    const QString &invalidName() const;
+
+    /*!
+     * Finds the configuration nodes of all parameters in a single pass over the members of the
+     * configuration node
+     *
+     * \param   config  Configuration node
+     *
+     * \param[out]  members         Output for the parameter nodes (one for each parameter in the
+     *                              same order as the parameter names, nullptr if a member was not
+     *                              found)
+     * \param[out]  unknownNames    Optional output for the names of the members that don't match
+     *                              any of the parameters
+     */
+    void findMembers(const ConfigObjectNode &config,
+                     const ConfigNode **members,
+                     QStringList *unknownNames = nullptr) const;
+
+private:
+    //! Initializes the atoms from the names
+    void initialize();
+
+private:
+    //! Parameter names
+    QStringList m_names;
+
+    //! Atoms of the parameter names
+    std::vector<ConfigNameTable::Atom> m_atoms;
+
+    //! Atoms of the parameter names (sorted in ascending order)
+    std::vector<ConfigNameTable::Atom> m_sortedAtoms;
+
+    //! Index of the parameter for each one of the sorted atoms
+    std::vector<size_t> m_sortedIndexes;
+
+    //! First parameter name that is either not valid or not unique
+    QString m_invalidName;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * This class holds the configuration nodes of the parameters of a configuration item
+ *
+ * All parameter nodes are found in a single merge pass over the members of the configuration node
+ * when the object is created. Members that don't match any of the parameters are collected in the
+ * same pass.
+ *
+ * \code
+ * bool ExampleConfig::loadConfigParameters(const ConfigObjectNode &config)
+ * {
+ *     static const ConfigParameterNames s_names { "count", "label" };
+ *     const ConfigParameterBatch batch(s_names, config);
+ *
+ *     reportUnknownConfigParameters(batch);
+ *
+ *     return loadRequiredConfigParameter(&count, batch, 0) &&
+ *             loadOptionalConfigParameter(&label, batch, 1);
+ * }
+ * \endcode
+ *
+ * \note    The names and the configuration node must outlive the batch
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigParameterBatch
+{
+public:
+    /*!
+     * Constructor
+     *
+     * \param   names   Parameter names
+     * \param   config  Configuration node
+     */
+    ConfigParameterBatch(const ConfigParameterNames &names, const ConfigObjectNode &config);
+
+    /*!
+     * Gets the parameter names
+     *
+     * \return  Parameter names
+     */
+    const ConfigParameterNames &names() const;
+
+    /*!
+     * Gets the configuration node
+     *
+     * \return  Configuration node
+     */
+    const ConfigObjectNode &config() const;
+
+    /*!
+     * Gets the parameter's configuration node
+     *
+     * \param   index   Index of the parameter
+     *
+     * \return  Configuration node or nullptr if the member was not found
+     */
+    const ConfigNode *member(const size_t index) const;
+
+    /*!
+     * Gets the names of the members that don't match any of the parameters
+     *
+     * \return  Member names (sorted alphabetically)
+     */
+    const QStringList &unknownNames() const;
+
+private:
+    //! Parameter names
+    const ConfigParameterNames *m_names;
+
+    //! Configuration node
+    const ConfigObjectNode *m_config;
+
+    //! Parameter nodes
+    QVarLengthArray<const ConfigNode *, 32> m_members;
+
+    //! Names of the members that don't match any of the parameters
+    QStringList m_unknownNames;
+};
+
+} // namespace CppConfigFramework
@@ -0,0 +1,403 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains classes that describe the configuration parameters of a configuration item
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigNodePath.hpp>
+#include <CppConfigFramework/ConfigParameterBatch.hpp>
+#include <CppConfigFramework/ConfigParameterValidator.hpp>
+
+// Qt includes
+#include <QtCore/QStringList>
+
+// System includes
+#include <initializer_list>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// Forward declarations
+
+// Macros
+
+/*!
+ * Describes a required configuration parameter with a name that is validated at compile time
+ *
+ * \param   NAME    Parameter name (string literal)
+ * \param   ...     Member pointer to the parameter and optionally its validator
+ *
+ * \see     CppConfigFramework::requiredConfigParameter()
+ */
+#define CPPCONFIGFRAMEWORK_REQUIRED_PARAMETER(NAME, ...)                                           \
+    CppConfigFramework::requiredConfigParameter(CPPCONFIGFRAMEWORK_NODE_NAME(NAME), __VA_ARGS__)
+
+/*!
+ * Describes an optional configuration parameter with a name that is validated at compile time
+ *
+ * \param   NAME    Parameter name (string literal)
+ * \param   ...     Member pointer to the parameter and optionally its validator
+ *
+ * \see     CppConfigFramework::optionalConfigParameter()
+ */
+#define CPPCONFIGFRAMEWORK_OPTIONAL_PARAMETER(NAME, ...)                                           \
+    CppConfigFramework::optionalConfigParameter(CPPCONFIGFRAMEWORK_NODE_NAME(NAME), __VA_ARGS__)
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+namespace Internal
+{
+
+/*!
+ * Calls the function for each one of the parameters until it fails
+ *
+ * \tparam  Parameters  Data type of the parameter tuple
+ * \tparam  Function    Data type of the function
+ * \tparam  Indexes     Indexes of the parameters
+ *
+ * \param   parameters  Parameters
+ * \param   function    Function that takes a parameter and its index
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+template<typename Parameters, typename Function, size_t... Indexes>
+bool forEachConfigParameter(const Parameters &parameters,
+                            Function &function,
+                            std::index_sequence<Indexes...>)
+{
+    bool result = true;
+
+    // The function is not called for the remaining parameters once it fails
+    static_cast<void>(std::initializer_list<int> {
+                          (result = result && function(std::get<Indexes>(parameters), Indexes),
+                           0)...
+                      });
+
+    return result;
+}
+
+} // namespace Internal
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * This class describes a single configuration parameter of a configuration item
+ *
+ * \tparam  Item        Data type of the configuration item
+ * \tparam  T           Data type of the configuration parameter
+ * \tparam  Validator   Data type of the validator for the loaded parameter value
+ */
+template<typename Item, typename T, typename Validator = ConfigParameterValidator<T>>
+class ConfigParameterDescriptor
+{
+public:
+    //! Data type of the configuration item
+    using ItemType = Item;
+
+    //! Data type of the configuration parameter
+    using ValueType = T;
+
+    //! Data type of the validator
+    using ValidatorType = Validator;
+
+    /*!
+     * Constructor
+     *
+     * \param   name        Parameter name (member name in the configuration node)
+     * \param   member      Member of the configuration item that holds the parameter value
+     * \param   required    Marks the parameter as required
+     * \param   validator   Validator for the loaded parameter value
+     */
+    ConfigParameterDescriptor(const QString &name,
+                              T Item::*member,
+                              const bool required,
+                              Validator validator)
+        : m_name(name),
+          m_member(member),
+          m_required(required),
+          m_validator(std::move(validator))
+    {
+    }
+
+    /*!
+     * Gets the parameter name
+     *
+     * \return  Parameter name
+     */
+    const QString &name() const
+    {
+        return m_name;
+    }
+
+    /*!
+     * Gets the member of the configuration item that holds the parameter value
+     *
+     * \return  Member pointer
+     */
+    T Item::*member() const
+    {
+        return m_member;
+    }
+
+    /*!
+     * Checks if the parameter is required
+     *
+     * \retval  true    Parameter is required
+     * \retval  false   Parameter is optional
+     */
+    bool isRequired() const
+    {
+        return m_required;
+    }
+
+    /*!
+     * Gets the validator for the loaded parameter value
+     *
+     * \return  Validator
+     */
+    const Validator &validator() const
+    {
+        return m_validator;
+    }
+
+private:
+    //! Parameter name
+    QString m_name;
+
+    //! Member of the configuration item that holds the parameter value
+    T Item::*m_member;
+
+    //! Marks the parameter as required
+    bool m_required;
+
+    //! Validator for the loaded parameter value
+    Validator m_validator;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * This class holds the descriptors of all configuration parameters of a configuration item
+ *
+ * \tparam  Item        Data type of the configuration item
+ * \tparam  Parameters  Data types of the parameter descriptors (ConfigParameterDescriptor)
+ *
+ * The parameter names are interned and ordered by their atoms when the table is created, so
+ * loading the parameters only needs a single pass over the members of the configuration node. A
+ * table is meant to be created once for each configuration item type.
+ *
+ * \see     makeConfigParameterTable(), ConfigTableItem
+ */
+template<typename Item, typename... Parameters>
+class ConfigParameterTable
+{
+public:
+    //! Data type of the configuration item
+    using ItemType = Item;
+
+    //! Data type of the parameter descriptors
+    using ParameterTuple = std::tuple<Parameters...>;
+
+    //! Number of parameters
+    static constexpr size_t COUNT = sizeof...(Parameters);
+
+    /*!
+     * Constructor
+     *
+     * \param   parameters  Parameter descriptors
+     */
+    explicit ConfigParameterTable(Parameters... parameters)
+        : m_names(QStringList { parameters.name()... }),
+          m_parameters(std::move(parameters)...)
+    {
+    }
+
+    /*!
+     * Gets the parameter descriptors
+     *
+     * \return  Parameter descriptors
+     */
+    const ParameterTuple &parameters() const
+    {
+        return m_parameters;
+    }
+
+    /*!
+     * Gets the parameter names
+     *
+     * \return  Parameter names
+     */
+    const ConfigParameterNames &names() const
+    {
+        return m_names;
+    }
+
+    /*!
+     * Calls the function for each one of the parameters (in the order of their declaration) until
+     * it fails
+     *
+     * \tparam  Function    Data type of the function
+     *
+     * \param   function    Function that takes a parameter descriptor and its index and returns
+     *                      true on success
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    template<typename Function>
+    bool forEach(Function function) const
+    {
+        return Internal::forEachConfigParameter(m_parameters,
+                                                function,
+                                                std::index_sequence_for<Parameters...>());
+    }
+
+private:
+    //! Parameter names
+    ConfigParameterNames m_names;
+
+    //! Parameter descriptors
+    ParameterTuple m_parameters;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Describes a required configuration parameter without validation
+ *
+ * \tparam  Item    Data type of the configuration item
+ * \tparam  T       Data type of the configuration parameter
+ *
+ * \param   name    Parameter name (member name in the configuration node)
+ * \param   member  Member of the configuration item that holds the parameter value
+ *
+ * \return  Parameter descriptor
+ *
+ * \note    Use CPPCONFIGFRAMEWORK_REQUIRED_PARAMETER to validate the name at compile time
+ */
+template<typename Item, typename T>
+ConfigParameterDescriptor<Item, T, ConfigParameterDefaultValidator<T>> requiredConfigParameter(
+        const QString &name, T Item::*member)
+{
+    return ConfigParameterDescriptor<Item, T, ConfigParameterDefaultValidator<T>>(
+                name, member, true, ConfigParameterDefaultValidator<T>());
+}
+
+/*!
+ * Describes a required configuration parameter with validation
+ *
+ * \tparam  Item        Data type of the configuration item
+ * \tparam  T           Data type of the configuration parameter
+ * \tparam  Validator   Data type of the validator (any callable that takes the loaded value and
+ *                      returns a result that is convertible to bool)
+ *
+ * \param   name        Parameter name (member name in the configuration node)
+ * \param   member      Member of the configuration item that holds the parameter value
+ * \param   validator   Validator for the loaded parameter value
+ *
+ * \return  Parameter descriptor
+ *
+ * \note    Use CPPCONFIGFRAMEWORK_REQUIRED_PARAMETER to validate the name at compile time
+ */
+template<typename Item,
+         typename T,
+         typename Validator,
+         IsConfigParameterValidator<Validator, T> = true>
+ConfigParameterDescriptor<Item, T, Validator> requiredConfigParameter(const QString &name,
+                                                                      T Item::*member,
+                                                                      Validator validator)
+{
+    return ConfigParameterDescriptor<Item, T, Validator>(name, member, true, std::move(validator));
+}
+
+/*!
+ * Describes an optional configuration parameter without validation
+ *
+ * \tparam  Item    Data type of the configuration item
+ * \tparam  T       Data type of the configuration parameter
+ *
+ * \param   name    Parameter name (member name in the configuration node)
+ * \param   member  Member of the configuration item that holds the parameter value
+ *
+ * \return  Parameter descriptor
+ *
+ * \note    The member keeps its value if the parameter is not found in the configuration node
+ * \note    Use CPPCONFIGFRAMEWORK_OPTIONAL_PARAMETER to validate the name at compile time
+ */
+template<typename Item, typename T>
+ConfigParameterDescriptor<Item, T, ConfigParameterDefaultValidator<T>> optionalConfigParameter(
+        const QString &name, T Item::*member)
+{
+    return ConfigParameterDescriptor<Item, T, ConfigParameterDefaultValidator<T>>(
+                name, member, false, ConfigParameterDefaultValidator<T>());
+}
+
+/*!
+ * Describes an optional configuration parameter with validation
+ *
+ * \tparam  Item        Data type of the configuration item
+ * \tparam  T           Data type of the configuration parameter
+ * \tparam  Validator   Data type of the validator (any callable that takes the loaded value and
+ *                      returns a result that is convertible to bool)
+ *
+ * \param   name        Parameter name (member name in the configuration node)
+ * \param   member      Member of the configuration item that holds the parameter value
+ * \param   validator   Validator for the loaded parameter value
+ *
+ * \return  Parameter descriptor
+ *
+ * \note    The member keeps its value if the parameter is not found in the configuration node
+ * \note    Use CPPCONFIGFRAMEWORK_OPTIONAL_PARAMETER to validate the name at compile time
+ */
+template<typename Item,
+         typename T,
+         typename Validator,
+         IsConfigParameterValidator<Validator, T> = true>
+ConfigParameterDescriptor<Item, T, Validator> optionalConfigParameter(const QString &name,
+                                                                      T Item::*member,
+                                                                      Validator validator)
+{
+    return ConfigParameterDescriptor<Item, T, Validator>(name, member, false, std::move(validator));
+}
+
+/*!
+ * Creates a parameter table from the parameter descriptors
+ *
+ * \tparam  Item        Data type of the configuration item
+ * \tparam  T           Data types of the configuration parameters
+ * \tparam  Validator   Data types of the validators
+ *
+ * \param   parameters  Parameter descriptors
+ *
+ * \return  Parameter table
+ */
+template<typename Item, typename... T, typename... Validator>
+ConfigParameterTable<Item, ConfigParameterDescriptor<Item, T, Validator>...>
+makeConfigParameterTable(ConfigParameterDescriptor<Item, T, Validator>... parameters)
+{
+    return ConfigParameterTable<Item, ConfigParameterDescriptor<Item, T, Validator>...>(
+                std::move(parameters)...);
+}
+
+} // namespace CppConfigFramework
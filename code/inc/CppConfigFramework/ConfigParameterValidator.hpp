@@ -28,6 +28,8 @@
 
 // System includes
 #include <functional>
+#include <type_traits>
+#include <utility>
 
 // Forward declarations
 
@@ -53,6 +55,20 @@ using ConfigParameterValidator = std::function<bool(const T &value)>;
 
 // -------------------------------------------------------------------------------------------------
 
+/*!
+ * Type alias for checking if a data type can be used as a configuration parameter validator
+ *
+ * \tparam  Validator   Data type of the validator (any callable that takes the value to validate
+ *                      and returns a result that is convertible to bool)
+ * \tparam  T           Data type of the value to validate
+ */
+template<typename Validator, typename T>
+using IsConfigParameterValidator = std::enable_if_t<
+    std::is_convertible<decltype(std::declval<const Validator &>()(std::declval<const T &>())),
+                        bool>::value,
+    bool>;
+// -------------------------------------------------------------------------------------------------
+
 /*!
  * This configuration parameter validator does not do any validation, but just returns "true"
  *
@@ -72,6 +88,34 @@ bool defaultConfigParameterValidator(const T &value)
 
 // -------------------------------------------------------------------------------------------------
 
+/*!
+ * This configuration parameter validator does not do any validation, but just returns "true"
+ *
+ * \tparam  T   Data type of the value to validate
+ *
+ * \note    Unlike defaultConfigParameterValidator() this validator is not called through a function
+ *          pointer so it is optimized away when it is passed to the validator templates.
+ */
+template<typename T>
+class ConfigParameterDefaultValidator
+{
+public:
+    /*!
+     * Validates the value
+     *
+     * \param   value   Value to validate
+     *
+     * \retval  true    Value is valid
+     */
+    bool operator()(const T &value) const
+    {
+        Q_UNUSED(value)
+        return true;
+    }
+};
+
+// -------------------------------------------------------------------------------------------------
+
 /*!
  * This configuration parameter validator checks if the value is in the defined range using the
  * algorithm: minValue ≤ value ≤ maxValue
@@ -220,4 +264,245 @@ ConfigParameterValidator<T> makeConfigParameterListValidator(const QList<T> &val
     return ConfigParameterValidator<T>(ConfigParameterListValidator<T>(validValues));
 }
 
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * This configuration parameter validator checks if the value is either in the defined range or
+ * matches any one from the "valid values" list
+ *
+ * \tparam  T   Data type of the value to validate
+ *
+ * This is useful for values with a valid range and a few special values outside of it (for
+ * example -1 for "unlimited").
+ */
+template<typename T>
+class ConfigParameterRangeListValidator
+{
+public:
+    /*!
+     * Constructor
+     *
+     * \param   minValue        Min value
+     * \param   maxValue        Max value
+     * \param   validValues     List of valid values outside of the range
+     */
+    ConfigParameterRangeListValidator(const T &minValue,
+                                      const T &maxValue,
+                                      const QList<T> &validValues)
+        : m_minValue(minValue),
+          m_maxValue(maxValue),
+          m_validValues(validValues)
+    {
+    }
+
+    /*!
+     * Validates the value
+     *
+     * \param   value   Value to validate
+     *
+     * \retval  true    Value is valid
+     * \retval  false   Value is not valid
+     */
+    bool operator()(const T &value) const
+    {
+        if (((m_minValue <= value) && (value <= m_maxValue)) || m_validValues.contains(value))
+        {
+            return true;
+        }
+
+        QStringList allowedValuesPrintable;
+
+        for (const T &item : m_validValues)
+        {
+            allowedValuesPrintable.append(QString("'%1'").arg(item));
+        }
+
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigParameterValidator)
+                << QString("Value [%1] is neither in the range [%2, %3] nor does it match any of "
+                           "the allowed values [%4]!")
+                   .arg(value)
+                   .arg(m_minValue)
+                   .arg(m_maxValue)
+                   .arg(allowedValuesPrintable.join(", "));
+        return false;
+    }
+
+private:
+    //! Holds the min value
+    const T m_minValue;
+
+    //! Holds the max value
+    const T m_maxValue;
+
+    //! Holds the list of valid values outside of the range
+    const QList<T> m_validValues;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Helper method for creation of a ConfigParameterRangeListValidator
+ *
+ * \tparam  T   Data type of the value to validate
+ *
+ * \param   minValue        Min value
+ * \param   maxValue        Max value
+ * \param   validValues     List of valid values outside of the range
+ *
+ * \note    The validator is returned by value instead of being wrapped in a
+ *          ConfigParameterValidator so that it can be inlined
+ */
+template<typename T>
+ConfigParameterRangeListValidator<T> makeConfigParameterRangeListValidator(
+        const T &minValue, const T &maxValue, const QList<T> &validValues)
+{
+    return ConfigParameterRangeListValidator<T>(minValue, maxValue, validValues);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * This configuration parameter validator accepts the value only if both validators accept it
+ *
+ * \tparam  First   Data type of the first validator
+ * \tparam  Second  Data type of the second validator
+ *
+ * The second validator is not called if the first one rejects the value.
+ */
+template<typename First, typename Second>
+class ConfigParameterAndValidator
+{
+public:
+    /*!
+     * Constructor
+     *
+     * \param   first   First validator
+     * \param   second  Second validator
+     */
+    ConfigParameterAndValidator(First first, Second second)
+        : m_first(std::move(first)),
+          m_second(std::move(second))
+    {
+    }
+
+    /*!
+     * Validates the value
+     *
+     * \tparam  T   Data type of the value to validate
+     *
+     * \param   value   Value to validate
+     *
+     * \retval  true    Value is valid
+     * \retval  false   Value is not valid
+     */
+    template<typename T>
+    bool operator()(const T &value) const
+    {
+        return m_first(value) && m_second(value);
+    }
+
+private:
+    //! Holds the first validator
+    First m_first;
+
+    //! Holds the second validator
+    Second m_second;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * This configuration parameter validator accepts the value if any one of the validators accepts it
+ *
+ * \tparam  First   Data type of the first validator
+ * \tparam  Second  Data type of the second validator
+ *
+ * The second validator is not called if the first one accepts the value.
+ *
+ * \note    The validators log their own failures so the failure of the first validator is logged
+ *          even if the second one accepts the value. Use ConfigParameterRangeListValidator for the
+ *          common case of a range with a few additional valid values.
+ */
+template<typename First, typename Second>
+class ConfigParameterOrValidator
+{
+public:
+    /*!
+     * Constructor
+     *
+     * \param   first   First validator
+     * \param   second  Second validator
+     */
+    ConfigParameterOrValidator(First first, Second second)
+        : m_first(std::move(first)),
+          m_second(std::move(second))
+    {
+    }
+
+    /*!
+     * Validates the value
+     *
+     * \tparam  T   Data type of the value to validate
+     *
+     * \param   value   Value to validate
+     *
+     * \retval  true    Value is valid
+     * \retval  false   Value is not valid
+     */
+    template<typename T>
+    bool operator()(const T &value) const
+    {
+        return m_first(value) || m_second(value);
+    }
+
+private:
+    //! Holds the first validator
+    First m_first;
+
+    //! Holds the second validator
+    Second m_second;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Helper method for creation of a ConfigParameterAndValidator
+ *
+ * \tparam  First   Data type of the first validator
+ * \tparam  Second  Data type of the second validator
+ *
+ * \param   first   First validator
+ * \param   second  Second validator
+ *
+ * \note    The validator is returned by value instead of being wrapped in a
+ *          ConfigParameterValidator so that it can be inlined
+ */
+template<typename First, typename Second>
+ConfigParameterAndValidator<First, Second> makeConfigParameterAndValidator(First first,
+                                                                           Second second)
+{
+    return ConfigParameterAndValidator<First, Second>(std::move(first), std::move(second));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Helper method for creation of a ConfigParameterOrValidator
+ *
+ * \tparam  First   Data type of the first validator
+ * \tparam  Second  Data type of the second validator
+ *
+ * \param   first   First validator
+ * \param   second  Second validator
+ *
+ * \note    The validator is returned by value instead of being wrapped in a
+ *          ConfigParameterValidator so that it can be inlined
+ */
+template<typename First, typename Second>
+ConfigParameterOrValidator<First, Second> makeConfigParameterOrValidator(First first,
+                                                                         Second second)
+{
+    return ConfigParameterOrValidator<First, Second>(std::move(first), std::move(second));
+}
+
 } // namespace CppConfigFramework
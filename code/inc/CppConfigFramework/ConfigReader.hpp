@@ -21,9 +21,12 @@
 #pragma once
 
 // C++ Config Framework includes
+#include <CppConfigFramework/ConfigJsonStreamParser.hpp>
 #include <CppConfigFramework/ConfigReaderBase.hpp>
 
 // Qt includes
+#include <QtCore/QStringList>
+#include <QtCore/QVector>
 
 // System includes
 
@@ -36,6 +39,11 @@
 namespace CppConfigFramework
 {
 
+namespace Benchmark
+{
+class ConfigReaderStages;
+}
+
 //! This class reads the configuration
 class CPPCONFIGFRAMEWORK_EXPORT ConfigReader : public ConfigReaderBase
 {
@@ -58,6 +66,28 @@ public:
     //! Move assignment operator
     ConfigReader &operator=(ConfigReader &&) noexcept = default;
 
+    /*!
+     * Gets the path to the cache directory
+     *
+     * \return  Path to the cache directory or an empty string if the cache directory is not used
+     */
+    QString cacheDirectory() const;
+
+    /*!
+     * Sets the path to the cache directory
+     *
+     * \param   directoryPath   Path to the cache directory or an empty string to disable it
+     *
+     * If the cache directory is set then configuration files that are read with this reader are
+     * stored in the cache directory (see ConfigDiskCache) and the next time they are read (for
+     * example by a restarted process) they are loaded from it as long as none of their
+     * dependencies were changed.
+     *
+     * \note    Configuration files that are read with external configs are not cached. Includes are
+     *          only cached as a part of the configuration file that includes them.
+     */
+    void setCacheDirectory(const QString &directoryPath);
+
     /*!
      * Read the specified config file
      *
@@ -76,6 +106,13 @@ public:
      * The externalConfigs items are used to provide an additional source for reference resolution.
      * This is mostly useful for includes so that they can declare references to externally defined
      * nodes in its own config file or its includes.
+     *
+     * If the cache directory is set (see setCacheDirectory()) or the include cache is enabled (see
+     * ConfigReaderRegistry::includeCache()) then the configuration is taken from the cache if
+     * possible and otherwise it is added to the cache.
+     *
+     * The returned configuration is detached (see ConfigObjectNode::detach()) so it can be read
+     * from multiple threads.
      */
     std::unique_ptr<ConfigObjectNode> read(
             const QString &filePath,
@@ -103,6 +140,9 @@ public:
      * The externalConfigs items are used to provide an additional source for reference resolution.
      * This is mostly useful for includes so that they can declare references to externally defined
      * nodes in its own config file or its includes.
+     *
+     * The returned configuration is detached (see ConfigObjectNode::detach()) so it can be read
+     * from multiple threads.
      */
     std::unique_ptr<ConfigObjectNode> read(
             const QJsonObject &configObject,
@@ -121,6 +161,74 @@ public:
             EnvironmentVariables *environmentVariables) const override;
 
 private:
+    //! Gives the benchmarks access to the individual stages of the reading procedure
+    friend class Benchmark::ConfigReaderStages;
+
+    /*!
+     * Reads the specified config file using the include cache (if it is enabled)
+     *
+     * \param   absoluteFilePath        Absolute path to the configuration file
+     * \param   sourceNodePath          Node path to the node that needs to be extracted
+     * \param   destinationNodePath     Node path to the node where the read configuration needs to
+     *                                  be stored
+     * \param   externalConfigs         Configuration nodes provided by an external source
+     *
+     * \param[in,out]   environmentVariables    Environment variables
+     *
+     * \return  Configuration node instance or null in case of failure
+     */
+    std::unique_ptr<ConfigObjectNode> readFileWithIncludeCache(
+            const QString &absoluteFilePath,
+            const ConfigNodePath &sourceNodePath,
+            const ConfigNodePath &destinationNodePath,
+            const std::vector<const ConfigObjectNode *> &externalConfigs,
+            EnvironmentVariables *environmentVariables) const;
+
+    /*!
+     * Reads the specified config file (without using the include cache)
+     *
+     * \param   absoluteFilePath        Absolute path to the configuration file
+     * \param   sourceNodePath          Node path to the node that needs to be extracted
+     * \param   destinationNodePath     Node path to the node where the read configuration needs to
+     *                                  be stored
+     * \param   externalConfigs         Configuration nodes provided by an external source
+     *
+     * \param[in,out]   environmentVariables    Environment variables
+     *
+     * \return  Configuration node instance or null in case of failure
+     */
+    std::unique_ptr<ConfigObjectNode> readFile(
+            const QString &absoluteFilePath,
+            const ConfigNodePath &sourceNodePath,
+            const ConfigNodePath &destinationNodePath,
+            const std::vector<const ConfigObjectNode *> &externalConfigs,
+            EnvironmentVariables *environmentVariables) const;
+
+    /*!
+     * Reads the configuration from the root JSON Object
+     *
+     * \param   rootObject              Root JSON Object
+     * \param   configParser            Parser positioned at the value of the 'config' member or
+     *                                  nullptr if the 'config' member is in the root JSON Object
+     * \param   workingDir              Path to the working directory
+     * \param   sourceNodePath          Node path to the node that needs to be extracted
+     * \param   destinationNodePath     Node path to the node where the read configuration needs to
+     *                                  be stored
+     * \param   externalConfigs         Configuration nodes provided by an external source
+     *
+     * \param[in,out]   environmentVariables    Environment variables
+     *
+     * \return  Configuration node instance or null in case of failure
+     */
+    std::unique_ptr<ConfigObjectNode> readRootObject(
+            const QJsonObject &rootObject,
+            ConfigJsonStreamParser *configParser,
+            const QDir &workingDir,
+            const ConfigNodePath &sourceNodePath,
+            const ConfigNodePath &destinationNodePath,
+            const std::vector<const ConfigObjectNode *> &externalConfigs,
+            EnvironmentVariables *environmentVariables) const;
+
     /*!
      * Reads the 'environment_variables' member of the configuration file
      *
@@ -155,6 +263,39 @@ private:
             const std::vector<const ConfigObjectNode *> &externalConfigs,
             EnvironmentVariables *environmentVariables) const;
 
+    /*!
+     * Reads the includes concurrently and applies them in their declaration order
+     *
+     * \param   includes                Parameters of the includes
+     * \param   types                   Configuration types of the includes
+     * \param   destinationNodePaths    Destination node paths of the includes
+     * \param   workingDir              Path to the working directory
+     * \param   externalConfigs         Configuration nodes provided by an external source
+     *
+     * \param[in,out]   environmentVariables    Environment variables
+     * \param[in,out]   includesConfig          Configuration node loaded from includes
+     *
+     * \retval  true    Success
+     * \retval  false   Includes need to be read one after another (includesConfig and
+     *                  environmentVariables are left unchanged)
+     *
+     * Each include is read with its own copy of the environment variables and external configs.
+     * The environment variables that were added by the includes are merged back in the declaration
+     * order of the includes.
+     *
+     * The includes need to be read one after another if any of them depends on the includes that
+     * are declared before it: it can't be read on its own (for example it references their nodes)
+     * or it uses an environment variable that one of them added.
+     */
+    bool readIncludesConcurrently(
+            const QVector<QJsonObject> &includes,
+            const QStringList &types,
+            const QVector<ConfigNodePath> &destinationNodePaths,
+            const QDir &workingDir,
+            const std::vector<const ConfigObjectNode *> &externalConfigs,
+            EnvironmentVariables *environmentVariables,
+            ConfigObjectNode *includesConfig) const;
+
     /*!
      * Reads the 'config' member of the configuration file
      *
@@ -171,6 +312,36 @@ private:
             const ConfigObjectNode &includesConfig,
             const EnvironmentVariables &environmentVariables) const;
 
+    /*!
+     * Reads the 'config' member of the configuration file directly from the JSON document
+     *
+     * \param   parser                  Parser positioned at the value of the 'config' member
+     * \param   externalConfigs         Configuration nodes provided by an external source
+     * \param   includesConfig          Configuration node loaded from includes
+     * \param   environmentVariables    Environment variables
+     *
+     * \return  Configuration node instance or null in case of failure
+     */
+    std::unique_ptr<ConfigObjectNode> readConfigMember(
+            ConfigJsonStreamParser *parser,
+            const std::vector<const ConfigObjectNode *> &externalConfigs,
+            const ConfigObjectNode &includesConfig,
+            const EnvironmentVariables &environmentVariables) const;
+
+    /*!
+     * Resolves the references in the read 'config' member
+     *
+     * \param   config          Configuration node read from the 'config' member
+     * \param   externalConfigs Configuration nodes provided by an external source
+     * \param   includesConfig  Configuration node loaded from includes
+     *
+     * \return  Configuration node instance or null in case of failure
+     */
+    std::unique_ptr<ConfigObjectNode> resolveConfigMember(
+            std::unique_ptr<ConfigObjectNode> config,
+            const std::vector<const ConfigObjectNode *> &externalConfigs,
+            const ConfigObjectNode &includesConfig) const;
+
     /*!
      * Reads a Value node from the JSON Value
      *
@@ -196,6 +367,53 @@ private:
             const ConfigNodePath &currentNodePath,
             const EnvironmentVariables &environmentVariables);
 
+    /*!
+     * Reads an Object node directly from the JSON document
+     *
+     * \param   parser                  Parser positioned at the JSON Object
+     * \param   currentNodePath         Current node path
+     * \param   environmentVariables    Environment variables
+     *
+     * \return  Configuration node instance or null in case of failure
+     */
+    static std::unique_ptr<ConfigObjectNode> readObjectNode(
+            ConfigJsonStreamParser *parser,
+            const ConfigNodePath &currentNodePath,
+            const EnvironmentVariables &environmentVariables);
+
+    /*!
+     * Reads a member node from the JSON Value
+     *
+     * \param   decorator               Decorator of the member name (null if it has no decorator)
+     * \param   jsonValue               JSON Value
+     * \param   memberNodePath          Node path of the member
+     * \param   environmentVariables    Environment variables
+     *
+     * \return  Configuration node instance or null in case of failure
+     */
+    static std::unique_ptr<ConfigNode> readMemberNode(
+            const QChar decorator,
+            const QJsonValue &jsonValue,
+            const ConfigNodePath &memberNodePath,
+            const EnvironmentVariables &environmentVariables);
+
+    /*!
+     * Splits the member name into the decorator and the node name and validates the node name
+     *
+     * \param   key             Key of the member in the JSON Object
+     * \param   currentNodePath Current node path
+     *
+     * \param[out]  memberName  Node name
+     * \param[out]  decorator   Decorator (null if the member name has no decorator)
+     *
+     * \retval  true    Success
+     * \retval  false   Failure (invalid node name)
+     */
+    static bool splitMemberName(const QString &key,
+                                const ConfigNodePath &currentNodePath,
+                                QString *memberName,
+                                QChar *decorator);
+
     /*!
      * Reads a NodeReference node from the JSON String
      *
@@ -222,6 +440,35 @@ private:
             const ConfigNodePath &currentNodePath,
             const EnvironmentVariables &environmentVariables);
 
+    /*!
+     * Reads a DerivedObject node directly from the JSON document
+     *
+     * \param   parser                  Parser positioned at the JSON Object
+     * \param   currentNodePath         Current node path
+     * \param   environmentVariables    Environment variables
+     *
+     * \return  Configuration node instance or null in case of failure
+     */
+    static std::unique_ptr<ConfigDerivedObjectNode> readDerivedObjectNode(
+            ConfigJsonStreamParser *parser,
+            const ConfigNodePath &currentNodePath,
+            const EnvironmentVariables &environmentVariables);
+
+    /*!
+     * Reads the bases of a DerivedObject node from the value of the 'base' member
+     *
+     * \param   baseValue       Value of the 'base' member
+     * \param   currentNodePath Current node path
+     *
+     * \param[out]  bases   Bases
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    static bool readDerivedObjectBases(const QJsonValue &baseValue,
+                                       const ConfigNodePath &currentNodePath,
+                                       QList<ConfigNodePath> *bases);
+
     /*!
      * Resolves references to environment variables in a JSON Value
      *
@@ -269,6 +516,18 @@ private:
      */
     static bool hasDecorator(const QString &memberName);
 
+    /*!
+     * Validates the environment variable name
+     *
+     * \param   name    Environment variable name
+     *
+     * \retval  true    Valid environment variable name
+     * \retval  false   Invalid environment variable name
+     *
+     * The environment variable name must match the regular expression "^[a-zA-Z0-9_]+$".
+     */
+    static bool validateEnvironmentVariableName(const QString &name);
+
     /*!
      * Sets the current directory environment variable (CPPCONFIGFRAMEWORK_CURRENT_DIR)
      *
@@ -278,6 +537,9 @@ private:
      */
     static void setCurrentDirectory(const QDir &currentDir,
                                     EnvironmentVariables *environmentVariables);
+
+    //! Holds the path to the cache directory (empty if the cache directory is not used)
+    QString m_cacheDirectory;
 };
 
 } // namespace CppConfigFramework
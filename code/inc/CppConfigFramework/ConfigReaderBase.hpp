@@ -64,6 +64,9 @@ public:
      * Gets the max number of cycles for reference resolution procedure
      *
      * \return  Max number of cycles
+     *
+     * \deprecated  References are resolved in a single pass so this value is ignored. It is kept
+     *              only for source compatibility and will be removed.
      */
     uint32_t referenceResolutionMaxCycles() const;
 
@@ -71,9 +74,77 @@ public:
      * Sets the max number of cycles for reference resolution procedure
      *
      * \param   referenceResolutionMaxCycles    New max number of cycles
+     *
+     * \deprecated  References are resolved in a single pass so this value is ignored. It is kept
+     *              only for source compatibility and will be removed.
      */
     void setReferenceResolutionMaxCycles(const uint32_t referenceResolutionMaxCycles);
 
+    /*!
+     * Checks if the nodes of the read configuration are allocated from an arena
+     *
+     * \retval  true    Nodes are allocated from an arena
+     * \retval  false   Nodes are allocated from the heap
+     *
+     * \see     ConfigNodeArena
+     */
+    bool arenaAllocationEnabled() const;
+
+    /*!
+     * Enables or disables allocation of the read configuration's nodes from an arena
+     *
+     * \param   arenaAllocationEnabled  New value
+     *
+     * With arena allocation the nodes of a configuration tree are allocated from a few large memory
+     * chunks and all of their memory is released at once when the last node of the tree is
+     * destroyed.
+     */
+    void setArenaAllocationEnabled(const bool arenaAllocationEnabled);
+
+    /*!
+     * Checks if the includes of a configuration are read concurrently
+     *
+     * \retval  true    Includes are read concurrently
+     * \retval  false   Includes are read one after another
+     */
+    bool parallelIncludesEnabled() const;
+
+    /*!
+     * Enables or disables concurrent reading of the includes of a configuration
+     *
+     * \param   parallelIncludesEnabled     New value
+     *
+     * The includes are read on the global thread pool and then applied in their declaration order.
+     * If an include depends on the includes that are declared before it (it references their nodes
+     * or uses the environment variables that they added) then all of the includes are read again
+     * one after another, so the result is always the same as with sequential reading.
+     *
+     * \note    Warnings that are logged while an include that depends on other includes is read on
+     *          its own are not meaningful. Reading the includes concurrently only pays off if they
+     *          are independent of each other.
+     */
+    void setParallelIncludesEnabled(const bool parallelIncludesEnabled);
+
+    /*!
+     * Checks if the configuration files are memory mapped while they are read
+     *
+     * \retval  true    Files are memory mapped
+     * \retval  false   Files are read to the heap
+     *
+     * \see     ConfigFileBuffer
+     */
+    bool fileMappingEnabled() const;
+
+    /*!
+     * Enables or disables memory mapping of the configuration files while they are read
+     *
+     * \param   fileMappingEnabled  New value
+     *
+     * Mapping should be disabled if the files can be rewritten in place while they are being read,
+     * as truncating a mapped file raises SIGBUS when its contents are accessed.
+     */
+    void setFileMappingEnabled(const bool fileMappingEnabled);
+
     /*!
      * Read the specified configuration
      *
@@ -98,16 +169,6 @@ public:
             const std::vector<const ConfigObjectNode *> &externalConfigs,
             EnvironmentVariables *environmentVariables) const = 0;
 
-protected:
-    //! Enumerates the possible results of reference resolution procedure
-    enum class ReferenceResolutionResult
-    {
-        Resolved,           //!< There were either no references or they were all resolved
-        PartiallyResolved,  //!< At least one of the references was resolved, but not all of them
-        Unchanged,          //!< None of the references were resolved
-        Error               //!< An error occurred
-    };
-
 protected:
     /*!
      * Checks if the node is fully resolved (has no unresolved references)
@@ -129,65 +190,51 @@ protected:
     static QStringList unresolvedReferences(const ConfigObjectNode &node);
 
     /*!
-     * Tries to resolve all references in the specified configuration node
+     * Resolves all references in the specified configuration node
      *
      * \param   externalConfigs     Configuration nodes provided by an external source
      *
      * \param[in,out]   config  Configuration node
      *
-     * \return  Reference resolution result
+     * \retval  true    Success
+     * \retval  false   Failure
+     *
+     * All NodeReference and DerivedObject nodes are first collected and then each of them is
+     * resolved exactly once, but only after all of the reference nodes that it depends on were
+     * resolved. A reference node depends on all unresolved reference nodes that are either on the
+     * node path to its referenced node (or base node) or inside of that node. In case the
+     * dependencies contain a cycle the nodes that form the cycle are reported.
      */
     bool resolveReferences(const std::vector<const ConfigObjectNode *> &externalConfigs,
                            ConfigObjectNode *config) const;
 
     /*!
-     * Tries to resolve all references in the specified Object node
+     * Resolves the reference in the specified NodeReference node
      *
      * \param   externalConfigs     Configuration nodes provided by an external source
      *
      * \param[in,out]   node    Configuration node
      *
-     * \return  Reference resolution result
-     */
-    static ReferenceResolutionResult resolveObjectReferences(
-            const std::vector<const ConfigObjectNode *> &externalConfigs,
-            ConfigObjectNode *node);
-
-    /*!
-     * Updates the reference resolution result
-     *
-     * \param   currentResult   Current result
-     * \param   newResult       New result
+     * \return  Configuration node that replaced the NodeReference node or null in case of failure
      *
-     * \return  Updated result
+     * \note    The NodeReference node is destroyed on success!
      */
-    static ReferenceResolutionResult updateObjectResolutionResult(
-            const ReferenceResolutionResult currentResult,
-            const ReferenceResolutionResult newResult);
-
-    /*!
-     * Tries to resolve the reference in the specified NodeReference node
-     *
-     * \param   externalConfigs     Configuration nodes provided by an external source
-     *
-     * \param[in,out]   node    Configuration node
-     *
-     * \return  Reference resolution result
-     */
-    static ReferenceResolutionResult resolveNodeReference(
+    static ConfigNode *resolveNodeReference(
             const std::vector<const ConfigObjectNode *> &externalConfigs,
             ConfigNodeReference *node);
 
     /*!
-     * Tries to resolve all references in the specified DerivedObject node
+     * Resolves all references in the specified DerivedObject node
      *
      * \param   externalConfigs     Configuration nodes provided by an external source
      *
      * \param[in,out]   node    Configuration node
      *
-     * \return  Reference resolution result
+     * \return  Configuration node that replaced the DerivedObject node or null in case of failure
+     *
+     * \note    The DerivedObject node is destroyed on success!
      */
-    static ReferenceResolutionResult resolveDerivedObjectReferences(
+    static ConfigNode *resolveDerivedObjectReferences(
             const std::vector<const ConfigObjectNode *> &externalConfigs,
             ConfigDerivedObjectNode *node);
 
@@ -229,6 +276,15 @@ private:
 
     //! Holds the max number of cycles for reference resolution procedure
     uint32_t m_referenceResolutionMaxCycles = m_defaultReferenceResolutionMaxCycles;
+
+    //! Holds the flag that enables allocation of nodes from an arena
+    bool m_arenaAllocationEnabled = false;
+
+    //! Holds the flag that enables concurrent reading of includes
+    bool m_parallelIncludesEnabled = false;
+
+    //! Holds the flag that enables memory mapping of the configuration files
+    bool m_fileMappingEnabled = true;
 };
 
 } // namespace CppConfigFramework
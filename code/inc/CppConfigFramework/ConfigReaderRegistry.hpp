@@ -21,6 +21,7 @@
 #pragma once
 
 // C++ Config Framework includes
+#include <CppConfigFramework/ConfigIncludeCache.hpp>
 #include <CppConfigFramework/ConfigReaderBase.hpp>
 
 // Qt includes
@@ -75,6 +76,16 @@ public:
     bool registerConfigReader(const QString &type,
                               std::unique_ptr<ConfigReaderBase> configReader);
 
+    /*!
+     * Gets the cache for configuration files that were already read
+     *
+     * \return  Include cache (disabled by default)
+     *
+     * The cache is shared by all configuration readers so that a configuration file that is
+     * included multiple times (or read with multiple ConfigReader::read() calls) is read only once.
+     */
+    ConfigIncludeCache *includeCache();
+
     /*!
      * Read the specified configuration
      *
@@ -108,6 +119,9 @@ private:
 private:
     //! Holds the
     std::map<QString, std::unique_ptr<ConfigReaderBase>> m_configReaders;
+
+    //! Holds the cache for configuration files that were already read
+    ConfigIncludeCache m_includeCache;
 };
 
 } // namespace CppConfigFramework
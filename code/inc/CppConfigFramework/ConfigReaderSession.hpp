@@ -0,0 +1,212 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a class that reads a configuration file and rereads it when its files are changed
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigDependencies.hpp>
+#include <CppConfigFramework/ConfigIncludeCache.hpp>
+#include <CppConfigFramework/ConfigReader.hpp>
+
+// Qt includes
+#include <QtCore/QStringList>
+
+// System includes
+#include <memory>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+/*!
+ * This class reads a configuration file and rereads it when its files are changed
+ *
+ * The session keeps its own include cache. When the configuration is reread only the files that
+ * were changed since the previous read (and the files that include them) are parsed again while
+ * the includes whose files were not changed are taken from the include cache.
+ *
+ * After each reread the session reports the node paths of the topmost nodes that were added,
+ * removed or changed compared to the previous read.
+ *
+ * The files of a session are expected to change while they are being read so the session's reader
+ * never memory maps them (see ConfigReaderBase::setFileMappingEnabled()).
+ *
+ * \note    References in the includes that were not changed are not resolved again
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigReaderSession
+{
+public:
+    /*!
+     * Constructor
+     *
+     * \param   reader  Reader used for reading the configuration file (memory mapping of the files
+     *                  is disabled in the session's copy of the reader)
+     */
+    explicit ConfigReaderSession(const ConfigReader &reader = ConfigReader());
+
+    //! Copy constructor is disabled
+    ConfigReaderSession(const ConfigReaderSession &) = delete;
+
+    //! Move constructor is disabled
+    ConfigReaderSession(ConfigReaderSession &&) = delete;
+
+    //! Destructor
+    ~ConfigReaderSession();
+
+    //! Copy assignment operator is disabled
+    ConfigReaderSession &operator=(const ConfigReaderSession &) = delete;
+
+    //! Move assignment operator is disabled
+    ConfigReaderSession &operator=(ConfigReaderSession &&) = delete;
+
+    /*!
+     * Reads the configuration file and starts a new session
+     *
+     * \param   filePath                Path to the configuration file
+     * \param   workingDir              Path to the working directory
+     * \param   sourceNodePath          Node path to the node that needs to be extracted from this
+     *                                  configuration file (must be absolute node path)
+     * \param   destinationNodePath     Node path to the destination node where the result needs
+     *                                  to be stored (must be absolute node path)
+     * \param   environmentVariables    Environment variables before the configuration is read
+     *
+     * \return  Configuration node instance or in case of failure a null pointer
+     *
+     * The returned configuration doesn't share its members with the session so it can be used
+     * from any thread.
+     */
+    std::unique_ptr<ConfigObjectNode> read(const QString &filePath,
+                                           const QDir &workingDir,
+                                           const ConfigNodePath &sourceNodePath,
+                                           const ConfigNodePath &destinationNodePath,
+                                           const EnvironmentVariables &environmentVariables);
+
+    /*!
+     * Rereads the configuration file with the same parameters as the last read
+     *
+     * \param[out]  changedNodePaths    Optional output for the sorted node paths of the topmost
+     *                                  nodes that were added, removed or changed
+     *
+     * \return  Configuration node instance or in case of failure a null pointer
+     *
+     * In case of failure the session keeps the configuration from the last successful read.
+     */
+    std::unique_ptr<ConfigObjectNode> reread(QStringList *changedNodePaths = nullptr);
+
+    /*!
+     * Marks the files as changed
+     *
+     * \param   absoluteFilePaths   Absolute paths to the files that were changed
+     *
+     * The files (and the files that include them) are parsed again by the next reread even if their
+     * size and time of the last modification were not changed.
+     */
+    void invalidateFiles(const QStringList &absoluteFilePaths);
+
+    /*!
+     * Checks if the session has a configuration from a successful read
+     *
+     * \retval  true    Session has a configuration
+     * \retval  false   Session has no configuration
+     */
+    bool hasConfig() const;
+
+    /*!
+     * Gets the dependencies of the last successful read
+     *
+     * \return  Dependencies
+     */
+    const ConfigDependencies &dependencies() const;
+
+    /*!
+     * Gets the environment variables after the last successful read
+     *
+     * \return  Environment variables
+     */
+    const EnvironmentVariables &environmentVariables() const;
+
+    /*!
+     * Gets the include cache of the session
+     *
+     * \return  Include cache
+     */
+    const ConfigIncludeCache &includeCache() const;
+
+private:
+    /*!
+     * Reads the configuration file with the stored parameters
+     *
+     * \param[out]  dependencies            Dependencies of the configuration
+     * \param[out]  environmentVariables    Environment variables after the configuration was read
+     *
+     * \return  Configuration node instance or in case of failure a null pointer
+     */
+    std::unique_ptr<ConfigObjectNode> readConfig(ConfigDependencies *dependencies,
+                                                 EnvironmentVariables *environmentVariables);
+
+    /*!
+     * Replaces the state of the session with the read configuration
+     *
+     * \param   config                  Read configuration
+     * \param   dependencies            Dependencies of the read configuration
+     * \param   environmentVariables    Environment variables after the configuration was read
+     */
+    void update(const ConfigObjectNode &config,
+                const ConfigDependencies &dependencies,
+                const EnvironmentVariables &environmentVariables);
+
+private:
+    //! Reader used for reading the configuration file
+    ConfigReader m_reader;
+
+    //! Path to the configuration file
+    QString m_filePath;
+
+    //! Path to the working directory
+    QDir m_workingDir;
+
+    //! Source node path
+    ConfigNodePath m_sourceNodePath;
+
+    //! Destination node path
+    ConfigNodePath m_destinationNodePath;
+
+    //! Environment variables before the configuration is read
+    EnvironmentVariables m_initialEnvironmentVariables;
+
+    //! Environment variables after the last successful read
+    EnvironmentVariables m_environmentVariables;
+
+    //! Include cache of the session
+    ConfigIncludeCache m_includeCache;
+
+    //! Dependencies of the last successful read
+    ConfigDependencies m_dependencies;
+
+    //! Configuration from the last successful read (doesn't share its members with other nodes)
+    std::unique_ptr<ConfigObjectNode> m_config;
+};
+
+} // namespace CppConfigFramework
@@ -0,0 +1,141 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the definition of the binary snapshot format for fully resolved configurations
+ *
+ * All integers are stored in little endian byte order. A snapshot consists of:
+ *
+ * - Header (HEADER_SIZE bytes):
+ *   - magic bytes "CCFS" (4 bytes)
+ *   - format version (quint16)
+ *   - header size (quint16)
+ *   - number of entries (quint32)
+ *   - number of strings (quint32)
+ *   - number of UTF-16 code units in the string data (quint32)
+ *   - reserved (4 bytes, zero)
+ *   - size of the data that follows the header (quint64)
+ *   - checksum of the header (without the checksum itself) and of the data that follows it
+ *     (quint64)
+ * - Entry table (ENTRY_SIZE bytes for each entry):
+ *   - entry type (quint8, see EntryType)
+ *   - reserved (3 bytes, zero)
+ *   - index of the name in the string table or NO_NAME (quint32)
+ *   - data (quint64, depends on the entry type)
+ * - String table (STRING_TABLE_ENTRY_SIZE bytes for each string):
+ *   - offset of the string in the string data in UTF-16 code units (quint32)
+ *   - length of the string in UTF-16 code units (quint32)
+ * - String data (UTF-16 code units)
+ *
+ * The first entry is the root Object node. Members of Object nodes and items of JSON Arrays and
+ * JSON Objects are stored as consecutive entries that follow the entry of their parent.
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/CppConfigFrameworkExport.hpp>
+
+// Qt includes
+#include <QtCore/QtGlobal>
+
+// System includes
+#include <cstddef>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+namespace ConfigSnapshotFormat
+{
+
+//! Magic bytes at the start of a snapshot
+constexpr char MAGIC[] = "CCFS";
+
+//! Size of the magic bytes
+constexpr size_t MAGIC_SIZE = 4U;
+
+//! Current version of the format
+constexpr quint16 VERSION = 1U;
+
+//! Size of the header
+constexpr size_t HEADER_SIZE = 40U;
+
+//! Offset of the checksum in the header
+constexpr size_t CHECKSUM_OFFSET = 32U;
+
+//! Size of an entry in the entry table
+constexpr size_t ENTRY_SIZE = 16U;
+
+//! Size of an entry in the string table
+constexpr size_t STRING_TABLE_ENTRY_SIZE = 8U;
+
+//! Name index of the entries that don't have a name (root node and JSON Array items)
+constexpr quint32 NO_NAME = 0xFFFFFFFFU;
+
+//! Max nesting depth of the entries
+constexpr int MAX_DEPTH = 1024;
+
+//! Entry type
+enum class EntryType : quint8
+{
+    //! Object node (data: index of the first member and the number of members in the upper half)
+    ObjectNode = 1U,
+
+    //! Value node (data: index of the entry with the JSON value)
+    ValueNode = 2U,
+
+    //! JSON null value (data: not used)
+    Null = 3U,
+
+    //! JSON boolean value (data: 0 or 1)
+    Bool = 4U,
+
+    //! JSON number value (data: bit pattern of the IEEE 754 double)
+    Double = 5U,
+
+    //! JSON string value (data: index in the string table)
+    String = 6U,
+
+    //! JSON Array value (data: index of the first item and the number of items in the upper half)
+    Array = 7U,
+
+    //! JSON Object value (data: index of the first member and the number of members in the upper
+    //! half)
+    Object = 8U
+};
+
+/*!
+ * Calculates the checksum of the data
+ *
+ * \param   data    Data
+ * \param   size    Size of the data
+ * \param   seed    Checksum of the preceding data (to calculate the checksum in multiple steps)
+ *
+ * \return  Checksum (64-bit FNV-1a applied to 8 byte words)
+ */
+CPPCONFIGFRAMEWORK_EXPORT quint64 checksum(const char *data,
+                                           const size_t size,
+                                           const quint64 seed = 0xcbf29ce484222325ULL);
+
+} // namespace ConfigSnapshotFormat
+
+} // namespace CppConfigFramework
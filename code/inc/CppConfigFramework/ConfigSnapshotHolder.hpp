@@ -0,0 +1,247 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a class that publishes immutable configuration snapshots to multiple threads
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/CppConfigFrameworkExport.hpp>
+
+// Qt includes
+#include <QtCore/QMutex>
+
+// System includes
+#include <atomic>
+#include <memory>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+class ConfigObjectNode;
+
+namespace Internal
+{
+struct ConfigSnapshotCacheEntry;
+}
+
+/*!
+ * This class publishes immutable configuration snapshots to multiple threads
+ *
+ * The holder is meant for configurations that are read very often by many threads and replaced
+ * rarely. Each thread keeps the last snapshot it has pinned in a small thread-local cache together
+ * with the version of the holder at that time. As long as no new snapshot is published pinning a
+ * snapshot only loads the version of the holder and doesn't write to any memory shared between
+ * the threads. Only the first pin after a new snapshot was published takes a lock.
+ *
+ * Publishing a snapshot or destroying a holder makes the threads drop their cached snapshots that
+ * are not pinned the next time they pin any snapshot. A cached snapshot that is pinned while this
+ * happens is dropped when its last pin is released. An old snapshot is therefore destroyed once
+ * all of its pins and shared pointers are released (a thread that doesn't pin any snapshot anymore
+ * can only keep the snapshots that were still current when it pinned them for the last time).
+ *
+ * The holder takes the ownership of the published configurations and detaches them (see
+ * ConfigObjectNode::detach()) so reading and cloning a snapshot never modifies it and it can be
+ * read from multiple threads.
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigSnapshotHolder
+{
+public:
+    /*!
+     * This class keeps a configuration snapshot alive
+     *
+     * \warning A pin must be released in the thread that has created it and can't outlive that
+     *          thread. Use toSharedPointer() to hand the snapshot over to another thread.
+     */
+    class CPPCONFIGFRAMEWORK_EXPORT Pin
+    {
+    public:
+        //! Constructor
+        Pin();
+
+        //! Copy constructor is disabled
+        Pin(const Pin &) = delete;
+
+        //! Move constructor
+        Pin(Pin &&other) noexcept;
+
+        //! Destructor
+        ~Pin();
+
+        //! Copy assignment operator is disabled
+        Pin &operator=(const Pin &) = delete;
+
+        //! Move assignment operator
+        Pin &operator=(Pin &&other) noexcept;
+
+        /*!
+         * Gets the pinned snapshot
+         *
+         * \return  Pinned snapshot or nullptr if no snapshot was published
+         */
+        const ConfigObjectNode *get() const;
+
+        //! \copydoc    ConfigSnapshotHolder::Pin::get()
+        const ConfigObjectNode *operator->() const;
+
+        /*!
+         * Gets the pinned snapshot
+         *
+         * \return  Pinned snapshot
+         *
+         * \warning Snapshot must exist
+         */
+        const ConfigObjectNode &operator*() const;
+
+        /*!
+         * Checks if a snapshot is pinned
+         *
+         * \retval  true    Snapshot is pinned
+         * \retval  false   No snapshot is pinned
+         */
+        explicit operator bool() const;
+
+        /*!
+         * Gets the version of the holder that the snapshot was published in
+         *
+         * \return  Version
+         */
+        quint64 version() const;
+
+        /*!
+         * Converts the pin to a shared pointer
+         *
+         * \return  Pinned snapshot
+         */
+        std::shared_ptr<const ConfigObjectNode> toSharedPointer() const;
+
+    private:
+        friend class ConfigSnapshotHolder;
+
+        /*!
+         * Constructor for a snapshot from the thread-local cache
+         *
+         * \param   entry   Thread-local cache entry
+         */
+        explicit Pin(Internal::ConfigSnapshotCacheEntry *entry);
+
+        /*!
+         * Constructor for a snapshot that is not in the thread-local cache
+         *
+         * \param   snapshot    Snapshot
+         * \param   version     Version of the holder that the snapshot was published in
+         */
+        Pin(std::shared_ptr<const ConfigObjectNode> snapshot, const quint64 version);
+
+        //! Releases the pinned snapshot
+        void release();
+
+    private:
+        //! Thread-local cache entry of the snapshot (nullptr if it is not cached)
+        Internal::ConfigSnapshotCacheEntry *m_entry;
+
+        //! Snapshot if it is not cached
+        std::shared_ptr<const ConfigObjectNode> m_snapshot;
+
+        //! Pinned snapshot
+        const ConfigObjectNode *m_config;
+
+        //! Version of the holder that the snapshot was published in
+        quint64 m_version;
+    };
+
+public:
+    //! Constructor
+    ConfigSnapshotHolder();
+
+    /*!
+     * Constructor
+     *
+     * \param   config  Initial configuration (it is detached)
+     */
+    explicit ConfigSnapshotHolder(std::unique_ptr<ConfigObjectNode> config);
+
+    //! Copy constructor is disabled
+    ConfigSnapshotHolder(const ConfigSnapshotHolder &) = delete;
+
+    //! Move constructor is disabled
+    ConfigSnapshotHolder(ConfigSnapshotHolder &&) = delete;
+
+    //! Destructor
+    ~ConfigSnapshotHolder();
+
+    //! Copy assignment operator is disabled
+    ConfigSnapshotHolder &operator=(const ConfigSnapshotHolder &) = delete;
+
+    //! Move assignment operator is disabled
+    ConfigSnapshotHolder &operator=(ConfigSnapshotHolder &&) = delete;
+
+    /*!
+     * Publishes a new snapshot
+     *
+     * \param   config  Configuration (it is detached and it can't be changed after it is published)
+     *
+     * \note    The previous snapshot stays valid for the threads that are using it
+     */
+    void publish(std::unique_ptr<ConfigObjectNode> config);
+
+    /*!
+     * Pins the current snapshot
+     *
+     * \return  Pinned snapshot
+     */
+    Pin pin() const;
+
+    /*!
+     * Gets the current snapshot
+     *
+     * \return  Current snapshot or a null pointer if no snapshot was published
+     *
+     * \note    Copying the shared pointer writes to its reference count which is shared between
+     *          the threads. Use pin() on hot paths.
+     */
+    std::shared_ptr<const ConfigObjectNode> load() const;
+
+    /*!
+     * Gets the version of the current snapshot
+     *
+     * \return  Version (incremented with each publish)
+     */
+    quint64 version() const;
+
+private:
+    //! Unique identifier of the holder (also after the holder is destroyed)
+    const quint64 m_id;
+
+    //! Version of the current snapshot
+    std::atomic<quint64> m_version;
+
+    //! Mutex that guards the current snapshot
+    mutable QMutex m_mutex;
+
+    //! Current snapshot
+    std::shared_ptr<const ConfigObjectNode> m_snapshot;
+};
+
+} // namespace CppConfigFramework
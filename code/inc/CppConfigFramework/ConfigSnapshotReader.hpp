@@ -0,0 +1,128 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a class that reads the configuration from a binary snapshot
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigReaderBase.hpp>
+
+// Qt includes
+
+// System includes
+#include <cstddef>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+/*!
+ * This class reads the configuration from a binary snapshot
+ *
+ * A snapshot contains a fully resolved configuration (see ConfigWriter::writeToSnapshot()) so it is
+ * loaded without parsing any JSON and without resolving any references. Snapshot files are memory
+ * mapped and the nodes are created straight from the mapped tables.
+ *
+ * The reader is registered in the ConfigReaderRegistry with the "CppConfigFrameworkSnapshot" type
+ * so a snapshot can also be included from a configuration file:
+ *
+ * \code{.json}
+ * {
+ *     "includes": [
+ *         {
+ *             "type": "CppConfigFrameworkSnapshot",
+ *             "file_path": "${CPPCONFIGFRAMEWORK_CURRENT_DIR}/config.ccfs",
+ *             "source_node": "/node"
+ *         }
+ *     ]
+ * }
+ * \endcode
+ *
+ * \see ConfigSnapshotFormat
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigSnapshotReader : public ConfigReaderBase
+{
+public:
+    //! Constructor
+    ConfigSnapshotReader() = default;
+
+    //! Copy constructor
+    ConfigSnapshotReader(const ConfigSnapshotReader &) = default;
+
+    //! Move constructor
+    ConfigSnapshotReader(ConfigSnapshotReader &&) noexcept = default;
+
+    //! Destructor
+    ~ConfigSnapshotReader() = default;
+
+    //! Copy assignment operator
+    ConfigSnapshotReader &operator=(const ConfigSnapshotReader &) = default;
+
+    //! Move assignment operator
+    ConfigSnapshotReader &operator=(ConfigSnapshotReader &&) noexcept = default;
+
+    /*!
+     * Read the specified snapshot file
+     *
+     * \param   filePath            Path to the snapshot file
+     * \param   workingDir          Path to the working directory
+     * \param   sourceNodePath      Node path to the node that needs to be extracted from this
+     *                              snapshot (must be absolute node path)
+     * \param   destinationNodePath Node path to the destination node where the result needs to be
+     *                              stored (must be absolute node path)
+     *
+     * \param[in,out]   environmentVariables    Environment variables
+     *
+     * \return  Configuration node instance or in case of failure a null pointer
+     *
+     * \note    Environment variables are only used to expand the file path
+     */
+    std::unique_ptr<ConfigObjectNode> read(
+            const QString &filePath,
+            const QDir &workingDir,
+            const ConfigNodePath &sourceNodePath,
+            const ConfigNodePath &destinationNodePath,
+            EnvironmentVariables *environmentVariables) const;
+
+    //! \copydoc    ConfigReaderBase::read()
+    std::unique_ptr<ConfigObjectNode> read(
+            const QDir &workingDir,
+            const ConfigNodePath &destinationNodePath,
+            const QJsonObject &otherParameters,
+            const std::vector<const ConfigObjectNode *> &externalConfigs,
+            EnvironmentVariables *environmentVariables) const override;
+
+    /*!
+     * Reads the configuration from the snapshot data
+     *
+     * \param   data    Snapshot data
+     * \param   size    Size of the snapshot data
+     *
+     * \return  Configuration node instance or in case of failure (invalid or corrupted snapshot) a
+     *          null pointer
+     */
+    static std::unique_ptr<ConfigObjectNode> readSnapshot(const char *data, const size_t size);
+};
+
+} // namespace CppConfigFramework
@@ -0,0 +1,108 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a base class for configuration items whose parameters are described by a parameter
+ * table
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigItem.hpp>
+#include <CppConfigFramework/ConfigParameterTable.hpp>
+
+// Qt includes
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+/*!
+ * This class holds the base class for configuration items whose parameters are described by a
+ * parameter table
+ *
+ * \tparam  Derived     Data type of the derived configuration item
+ *
+ * The derived class needs to provide a static method configParameters() that returns its
+ * parameter table. The table is created only once and it is then used for both loading and storing
+ * of the parameters so the derived class doesn't need to implement loadConfigParameters() and
+ * storeConfigParameters():
+ *
+ * \code
+ * class ExampleConfig : public ConfigTableItem<ExampleConfig>
+ * {
+ * public:
+ *     static auto configParameters()
+ *     {
+ *         return makeConfigParameterTable(
+ *                     CPPCONFIGFRAMEWORK_REQUIRED_PARAMETER("count",
+ *                                                           &ExampleConfig::count,
+ *                                                           makeConfigParameterRangeValidator(0, 9)),
+ *                     CPPCONFIGFRAMEWORK_OPTIONAL_PARAMETER("label", &ExampleConfig::label));
+ *     }
+ *
+ *     int count = 0;
+ *     QString label;
+ * };
+ * \endcode
+ *
+ * \note    The derived class can still override loadConfigParameters() and storeConfigParameters()
+ *          for the parameters that can't be described by the table (for example containers) and
+ *          call the implementations from this class for the rest. Members of the configuration
+ *          node that are loaded this way are also passed to handleUnknownConfigParameters()
+ *          because they are not described by the table.
+ */
+template<typename Derived>
+class ConfigTableItem : public ConfigItem
+{
+protected:
+    /*!
+     * Gets the parameter table of the derived configuration item
+     *
+     * \return  Parameter table
+     */
+    static const auto &configParameterTable()
+    {
+        static const auto table = Derived::configParameters();
+        return table;
+    }
+
+    //! \copydoc    ConfigItem::loadConfigParameters()
+    bool loadConfigParameters(const ConfigObjectNode &config) override
+    {
+        return loadConfigParameterTable(static_cast<Derived *>(this),
+                                        configParameterTable(),
+                                        config);
+    }
+
+    //! \copydoc    ConfigItem::storeConfigParameters()
+    bool storeConfigParameters(ConfigObjectNode *config) override
+    {
+        return storeConfigParameterTable(*static_cast<const Derived *>(this),
+                                         configParameterTable(),
+                                         config);
+    }
+};
+
+} // namespace CppConfigFramework
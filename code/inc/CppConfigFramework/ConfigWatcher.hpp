@@ -0,0 +1,276 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a class that watches the files of a configuration and rereads it when they are changed
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigReaderSession.hpp>
+#include <CppConfigFramework/ConfigSnapshotHolder.hpp>
+
+// Qt includes
+#include <QtCore/QFileSystemWatcher>
+#include <QtCore/QMutex>
+#include <QtCore/QObject>
+#include <QtCore/QStringList>
+#include <QtCore/QThreadPool>
+#include <QtCore/QTimer>
+
+// System includes
+#include <memory>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+namespace Internal
+{
+class ConfigWatcherReload;
+}
+
+/*!
+ * This class watches the files of a configuration and rereads it when they are changed
+ *
+ * All files that were read (the configuration file and all of its includes) are watched. A burst
+ * of changes is merged into a single reread which is executed in a background thread with a
+ * ConfigReaderSession so only the changed files are parsed again. The files reported by the file
+ * system watcher are always parsed again, even if their size and time of the last modification
+ * were not changed.
+ *
+ * The directories of the files are watched too, so files that are replaced (for example by editors
+ * that write a temporary file and rename it) or removed and created again are watched again.
+ *
+ * After a successful reread the new configuration is published as an immutable snapshot and the
+ * configChanged() signal is emitted with the node paths that were changed. Snapshots are published
+ * through a ConfigSnapshotHolder so they can be pinned from any thread and stay valid for as long
+ * as they are held, even after newer snapshots are published.
+ *
+ * \note    Member names of the reread configurations are interned in the process-wide
+ *          ConfigNameTable and never released, so configurations whose member names keep changing
+ *          make the table grow for as long as the watcher runs (see ConfigNameTable::memoryUsage())
+ */
+class CPPCONFIGFRAMEWORK_EXPORT ConfigWatcher : public QObject
+{
+    Q_OBJECT
+
+public:
+    //! Default time to wait for more changes before the configuration is reread (in milliseconds)
+    static constexpr int DEFAULT_DEBOUNCE_INTERVAL = 100;
+
+public:
+    /*!
+     * Constructor
+     *
+     * \param   reader  Reader used for reading the configuration file
+     * \param   parent  Parent object
+     */
+    explicit ConfigWatcher(const ConfigReader &reader = ConfigReader(), QObject *parent = nullptr);
+
+    //! Copy constructor is disabled
+    ConfigWatcher(const ConfigWatcher &) = delete;
+
+    //! Move constructor is disabled
+    ConfigWatcher(ConfigWatcher &&) = delete;
+
+    //! Destructor
+    ~ConfigWatcher() override;
+
+    //! Copy assignment operator is disabled
+    ConfigWatcher &operator=(const ConfigWatcher &) = delete;
+
+    //! Move assignment operator is disabled
+    ConfigWatcher &operator=(ConfigWatcher &&) = delete;
+
+    /*!
+     * Reads the configuration file and starts watching its files
+     *
+     * \param   filePath                Path to the configuration file
+     * \param   workingDir              Path to the working directory
+     * \param   sourceNodePath          Node path to the node that needs to be extracted from this
+     *                                  configuration file (must be absolute node path)
+     * \param   destinationNodePath     Node path to the destination node where the result needs
+     *                                  to be stored (must be absolute node path)
+     * \param   environmentVariables    Environment variables before the configuration is read
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     *
+     * The configuration is read in the calling thread. If the watcher was already started it is
+     * stopped first.
+     */
+    bool start(const QString &filePath,
+               const QDir &workingDir,
+               const ConfigNodePath &sourceNodePath,
+               const ConfigNodePath &destinationNodePath,
+               const EnvironmentVariables &environmentVariables);
+
+    /*!
+     * Stops watching the files and waits for the pending reread to finish
+     *
+     * \note    The last published snapshot is kept
+     */
+    void stop();
+
+    /*!
+     * Checks if the watcher is watching the files
+     *
+     * \retval  true    Watcher is active
+     * \retval  false   Watcher is not active
+     */
+    bool isActive() const;
+
+    /*!
+     * Gets the time to wait for more changes before the configuration is reread
+     *
+     * \return  Debounce interval in milliseconds
+     */
+    int debounceInterval() const;
+
+    /*!
+     * Sets the time to wait for more changes before the configuration is reread
+     *
+     * \param   debounceInterval    Debounce interval in milliseconds
+     */
+    void setDebounceInterval(const int debounceInterval);
+
+    /*!
+     * Gets the files that are watched
+     *
+     * \return  Absolute paths to the watched files
+     */
+    QStringList watchedFiles() const;
+
+    /*!
+     * Gets the last published configuration snapshot
+     *
+     * \return  Configuration snapshot or a null pointer if no configuration was read
+     *
+     * \note    This method is thread-safe
+     */
+    std::shared_ptr<const ConfigObjectNode> snapshot() const;
+
+    /*!
+     * Gets the holder of the published configuration snapshots
+     *
+     * \return  Snapshot holder
+     *
+     * \note    Use ConfigSnapshotHolder::pin() for reading the configuration on hot paths
+     */
+    const ConfigSnapshotHolder &snapshotHolder() const;
+
+    /*!
+     * Rereads the configuration in a background thread immediately
+     *
+     * \note    If a reread is already running another one is executed after it finishes
+     */
+    void reload();
+
+signals:
+    /*!
+     * Emitted after a new configuration snapshot was published
+     *
+     * \param   changedNodePaths    Sorted node paths of the topmost nodes that were added, removed
+     *                              or changed compared to the previous snapshot
+     */
+    void configChanged(const QStringList &changedNodePaths);
+
+    /*!
+     * Emitted when the configuration could not be reread
+     *
+     * \note    The previous snapshot stays published
+     */
+    void reloadFailed();
+
+private slots:
+    /*!
+     * Handles a change of a watched file
+     *
+     * \param   filePath    Path to the changed file
+     */
+    void onFileChanged(const QString &filePath);
+
+    /*!
+     * Handles a change of a watched directory
+     *
+     * \param   directoryPath   Path to the changed directory
+     *
+     * Files that were created in the directory (again) are watched and handled as changed files.
+     */
+    void onDirectoryChanged(const QString &directoryPath);
+
+    //! Handles the end of a reread
+    void onReloadFinished();
+
+private:
+    /*!
+     * Publishes a configuration snapshot
+     *
+     * \param   config  Configuration
+     */
+    void publish(std::unique_ptr<ConfigObjectNode> config);
+
+    //! Watches the files that the current configuration depends on and their directories
+    void updateWatchedFiles();
+
+private:
+    friend class Internal::ConfigWatcherReload;
+
+    //! Session used for reading the configuration (only accessed by one thread at a time)
+    ConfigReaderSession m_session;
+
+    //! Watcher of the configuration files
+    QFileSystemWatcher m_fileSystemWatcher;
+
+    //! Timer used for merging bursts of changes into a single reread
+    QTimer m_debounceTimer;
+
+    //! Thread used for rereading the configuration
+    QThreadPool m_threadPool;
+
+    //! Flag for a running reread
+    bool m_reloadRunning;
+
+    //! Flag for a reread that was requested while another one was running
+    bool m_reloadPending;
+
+    //! Absolute paths to the files that were changed since the last reread was started
+    QStringList m_changedFiles;
+
+    //! Holder of the published configuration snapshots
+    ConfigSnapshotHolder m_snapshotHolder;
+
+    //! Mutex that guards the result of the last reread
+    mutable QMutex m_mutex;
+
+    //! Flag for a successful last reread
+    bool m_reloadSucceeded;
+
+    //! Node paths that were changed by the last reread
+    QStringList m_changedNodePaths;
+
+    //! Absolute paths to the files that the last read configuration depends on
+    QStringList m_dependencyFiles;
+};
+
+} // namespace CppConfigFramework
@@ -77,6 +77,37 @@ CPPCONFIGFRAMEWORK_EXPORT bool writeToJsonConfigFile(const ConfigObjectNode &nod
  */
 CPPCONFIGFRAMEWORK_EXPORT QJsonValue convertToJsonValue(const ConfigObjectNode &node);
 
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Writes the Object node (with fully resolved references) to the binary snapshot format
+ *
+ * \param   node    Configuration node
+ *
+ * \return  Binary snapshot or an empty byte array in case of failure
+ *
+ * Only Object and Value nodes can be stored in a snapshot.
+ *
+ * \see     ConfigSnapshotFormat, ConfigSnapshotReader
+ */
+CPPCONFIGFRAMEWORK_EXPORT QByteArray writeToSnapshot(const ConfigObjectNode &node);
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Writes the Object node (with fully resolved references) to the specified binary snapshot file
+ *
+ * \param   node        Configuration node
+ * \param   filePath    Path to the output snapshot file
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ *
+ * \note    The file is replaced atomically so that a reader never sees a partially written file
+ */
+CPPCONFIGFRAMEWORK_EXPORT bool writeToSnapshotFile(const ConfigObjectNode &node,
+                                                   const QString &filePath);
+
 } // namespace ConfigWriter
 
 } // namespace CppConfigFramework
@@ -49,6 +49,9 @@ namespace CppConfigFramework
  *
  * If an attempt is made to set an environment variable that does not exist then a new variable is
  * created.
+ *
+ * Access to the environment variables is recorded as a dependency of the configuration that is
+ * being read (see ConfigDependencyRecorder).
  */
 class CPPCONFIGFRAMEWORK_EXPORT EnvironmentVariables
 {
@@ -65,6 +68,15 @@ public:
      */
     QStringList names() const;
 
+    /*!
+     * Gets all stored environment variables
+     *
+     * \return  Environment variable values (environment variable name is used as the key)
+     *
+     * \note    Access through this method is not recorded as a dependency
+     */
+    const QHash<QString, QString> &variables() const;
+
     /*!
      * Checks if an environment variable with the specified name can be found
      *
@@ -0,0 +1,272 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains classes for recording the dependencies of a read configuration
+ */
+
+// Own header
+#include <CppConfigFramework/ConfigDependencies.hpp>
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigFileBuffer.hpp>
+
+// Qt includes
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QFileInfo>
+
+// System includes
+#include <algorithm>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+namespace Internal
+{
+
+//! Holds the recorder that is active for the current thread
+thread_local ConfigDependencyRecorder *currentRecorder = nullptr;
+
+} // namespace Internal
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigDependencies::File ConfigDependencies::fileFingerprint(const QString &absoluteFilePath)
+{
+    const QFileInfo fileInfo(absoluteFilePath);
+
+    File file;
+    file.size = fileInfo.size();
+    file.lastModified = fileInfo.lastModified();
+
+    return file;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QByteArray ConfigDependencies::fileContentHash(const QString &absoluteFilePath)
+{
+    // The file is not memory mapped as it can be rewritten in place while its hash is calculated
+    ConfigFileBuffer fileContents;
+
+    if (!fileContents.open(absoluteFilePath, false))
+    {
+        return {};
+    }
+
+    // Data is added in chunks as its size is limited to an int
+    constexpr size_t chunkSize = 1U << 30U;
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+
+    for (size_t position = 0U; position < fileContents.size(); position += chunkSize)
+    {
+        hash.addData(fileContents.data() + position,
+                     static_cast<int>(std::min(chunkSize, fileContents.size() - position)));
+    }
+
+    return hash.result();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const QMap<QString, ConfigDependencies::File> &ConfigDependencies::files() const
+{
+    return m_files;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const QSet<QString> &ConfigDependencies::environmentVariables() const
+{
+    return m_environmentVariables;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const QSet<QString> &ConfigDependencies::writtenEnvironmentVariables() const
+{
+    return m_writtenEnvironmentVariables;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const QSet<const ConfigObjectNode *> &ConfigDependencies::externalConfigs() const
+{
+    return m_externalConfigs;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigDependencies::addFile(const QString &absoluteFilePath)
+{
+    if (!m_files.contains(absoluteFilePath))
+    {
+        m_files.insert(absoluteFilePath, fileFingerprint(absoluteFilePath));
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigDependencies::addEnvironmentVariable(const QString &name)
+{
+    if (!m_writtenEnvironmentVariables.contains(name))
+    {
+        m_environmentVariables.insert(name);
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigDependencies::addWrittenEnvironmentVariable(const QString &name)
+{
+    m_writtenEnvironmentVariables.insert(name);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigDependencies::addExternalConfig(const ConfigObjectNode *externalConfig)
+{
+    m_externalConfigs.insert(externalConfig);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigDependencies::replaceExternalConfig(const ConfigObjectNode *externalConfig,
+                                               const ConfigObjectNode *replacement)
+{
+    if (m_externalConfigs.remove(externalConfig))
+    {
+        m_externalConfigs.insert(replacement);
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigDependencies::clearExternalConfigs()
+{
+    m_externalConfigs.clear();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigDependencies::merge(const ConfigDependencies &other)
+{
+    for (auto it = other.m_files.begin(); it != other.m_files.end(); it++)
+    {
+        if (!m_files.contains(it.key()))
+        {
+            m_files.insert(it.key(), it.value());
+        }
+    }
+
+    // Environment variables that were already set here don't depend on their initial values
+    for (const QString &name : other.m_environmentVariables)
+    {
+        addEnvironmentVariable(name);
+    }
+
+    m_writtenEnvironmentVariables.unite(other.m_writtenEnvironmentVariables);
+    m_externalConfigs.unite(other.m_externalConfigs);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigDependencyRecorder::ConfigDependencyRecorder()
+    : m_previousRecorder(Internal::currentRecorder)
+{
+    Internal::currentRecorder = this;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigDependencyRecorder::~ConfigDependencyRecorder()
+{
+    Internal::currentRecorder = m_previousRecorder;
+
+    if (m_previousRecorder != nullptr)
+    {
+        m_previousRecorder->m_dependencies.merge(m_dependencies);
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigDependencyRecorder *ConfigDependencyRecorder::current()
+{
+    return Internal::currentRecorder;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigDependencyRecorder::recordFile(const QString &absoluteFilePath)
+{
+    if (Internal::currentRecorder != nullptr)
+    {
+        Internal::currentRecorder->m_dependencies.addFile(absoluteFilePath);
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigDependencyRecorder::recordEnvironmentVariable(const QString &name)
+{
+    if (Internal::currentRecorder != nullptr)
+    {
+        Internal::currentRecorder->m_dependencies.addEnvironmentVariable(name);
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigDependencyRecorder::recordWrittenEnvironmentVariable(const QString &name)
+{
+    if (Internal::currentRecorder != nullptr)
+    {
+        Internal::currentRecorder->m_dependencies.addWrittenEnvironmentVariable(name);
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigDependencyRecorder::recordExternalConfig(const ConfigObjectNode *externalConfig)
+{
+    if (Internal::currentRecorder != nullptr)
+    {
+        Internal::currentRecorder->m_dependencies.addExternalConfig(externalConfig);
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const ConfigDependencies &ConfigDependencyRecorder::dependencies() const
+{
+    return m_dependencies;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigDependencies &ConfigDependencyRecorder::dependencies()
+{
+    return m_dependencies;
+}
+
+} // namespace CppConfigFramework
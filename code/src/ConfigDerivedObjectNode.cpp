@@ -72,6 +72,7 @@ QList<ConfigNodePath> ConfigDerivedObjectNode::bases() const
 
 void ConfigDerivedObjectNode::setBases(const QList<ConfigNodePath> &bases)
 {
+    prepareForModification();
     m_bases = bases;
 }
 
@@ -86,6 +87,7 @@ const ConfigObjectNode &ConfigDerivedObjectNode::config() const
 
 void ConfigDerivedObjectNode::setConfig(const ConfigObjectNode &config)
 {
+    prepareForModification();
     m_config = std::move(config.clone()->toObject());
 }
 
@@ -0,0 +1,325 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a class that holds the structural differences between two configuration trees
+ */
+
+// Own header
+#include <CppConfigFramework/ConfigDiff.hpp>
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigDerivedObjectNode.hpp>
+#include <CppConfigFramework/ConfigNodeReference.hpp>
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/ConfigValueNode.hpp>
+
+// Qt includes
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+namespace Internal
+{
+
+/*!
+ * Checks if a node path is equal to or a descendant of another node path
+ *
+ * \param   nodePath        Absolute node path
+ * \param   ancestorPath    Absolute node path of the ancestor
+ *
+ * \retval  true    Node path is equal to or a descendant of the ancestor node path
+ * \retval  false   Node path is not related to the ancestor node path
+ */
+bool isSameOrDescendant(const QString &nodePath, const QString &ancestorPath);
+
+} // namespace Internal
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigDiff ConfigDiff::compare(const ConfigObjectNode &previous, const ConfigObjectNode &current)
+{
+    ConfigDiff diff;
+    QString path;
+    diff.compareObjects(previous, current, &path);
+
+    diff.m_addedNodePaths.sort();
+    diff.m_removedNodePaths.sort();
+    diff.m_changedNodePaths.sort();
+    return diff;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigDiff::isEmpty() const
+{
+    return (m_addedNodePaths.isEmpty() &&
+            m_removedNodePaths.isEmpty() &&
+            m_changedNodePaths.isEmpty());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const QStringList &ConfigDiff::addedNodePaths() const
+{
+    return m_addedNodePaths;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const QStringList &ConfigDiff::removedNodePaths() const
+{
+    return m_removedNodePaths;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const QStringList &ConfigDiff::changedNodePaths() const
+{
+    return m_changedNodePaths;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QStringList ConfigDiff::nodePaths() const
+{
+    QStringList nodePaths;
+    nodePaths.reserve(m_addedNodePaths.size() +
+                      m_removedNodePaths.size() +
+                      m_changedNodePaths.size());
+
+    nodePaths.append(m_addedNodePaths);
+    nodePaths.append(m_removedNodePaths);
+    nodePaths.append(m_changedNodePaths);
+    nodePaths.sort();
+    return nodePaths;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigDiff::affects(const ConfigNodePath &nodePath) const
+{
+    const QString path = nodePath.path();
+
+    for (const QStringList *nodePaths : { &m_addedNodePaths,
+                                          &m_removedNodePaths,
+                                          &m_changedNodePaths })
+    {
+        for (const QString &differentPath : *nodePaths)
+        {
+            if (Internal::isSameOrDescendant(path, differentPath) ||
+                Internal::isSameOrDescendant(differentPath, path))
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigDiff::compareObjects(const ConfigObjectNode &previous,
+                                const ConfigObjectNode &current,
+                                QString *path)
+{
+    const auto &previousStorage = previous.memberStorage();
+    const auto &currentStorage = current.memberStorage();
+
+    // Nodes that share their members are equal
+    if (&previousStorage == &currentStorage)
+    {
+        return;
+    }
+
+    // Match the members in a single merge pass over the atoms of their names
+    const auto *nameTable = ConfigNameTable::instance();
+    const ConfigSortedMembers previousMembers(previousStorage);
+    const ConfigSortedMembers currentMembers(currentStorage);
+    const int pathLength = path->size();
+    size_t previousIndex = 0U;
+    size_t currentIndex = 0U;
+
+    while ((previousIndex < previousMembers.count()) || (currentIndex < currentMembers.count()))
+    {
+        const ConfigMemberStorage::Member *previousMember =
+                (previousIndex < previousMembers.count()) ? &previousMembers.at(previousIndex)
+                                                          : nullptr;
+        const ConfigMemberStorage::Member *currentMember =
+                (currentIndex < currentMembers.count()) ? &currentMembers.at(currentIndex)
+                                                        : nullptr;
+
+        if ((currentMember == nullptr) ||
+            ((previousMember != nullptr) && (previousMember->name < currentMember->name)))
+        {
+            path->append(QChar('/')).append(nameTable->name(previousMember->name));
+            m_removedNodePaths.append(*path);
+            path->truncate(pathLength);
+
+            previousIndex++;
+            continue;
+        }
+
+        if ((previousMember == nullptr) || (currentMember->name < previousMember->name))
+        {
+            path->append(QChar('/')).append(nameTable->name(currentMember->name));
+            m_addedNodePaths.append(*path);
+            path->truncate(pathLength);
+
+            currentIndex++;
+            continue;
+        }
+
+        // Member exists in both nodes (the node path is only extended, not copied)
+        path->append(QChar('/')).append(nameTable->name(currentMember->name));
+        compareNodes(*previousMember->node, *currentMember->node, path);
+        path->truncate(pathLength);
+
+        previousIndex++;
+        currentIndex++;
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigDiff::compareNodes(const ConfigNode &previous,
+                              const ConfigNode &current,
+                              QString *path)
+{
+    if (previous.type() != current.type())
+    {
+        m_changedNodePaths.append(toNodePath(*path));
+        return;
+    }
+
+    if (previous.type() == ConfigNode::Type::Object)
+    {
+        compareObjects(previous.toObject(), current.toObject(), path);
+        return;
+    }
+
+    if (!isEqual(previous, current))
+    {
+        m_changedNodePaths.append(toNodePath(*path));
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigDiff::isEqual(const ConfigNode &previous, const ConfigNode &current)
+{
+    if (previous.type() != current.type())
+    {
+        return false;
+    }
+
+    switch (previous.type())
+    {
+        case ConfigNode::Type::Value:
+        {
+            return (previous.toValue().value() == current.toValue().value());
+        }
+
+        case ConfigNode::Type::Object:
+        {
+            const auto &previousObject = previous.toObject();
+            const auto &currentObject = current.toObject();
+
+            if (previousObject.count() != currentObject.count())
+            {
+                return false;
+            }
+
+            // Members are looked up directly in the storage (the const access of the node would
+            // first make copies of its shared members)
+            const auto &previousStorage = previousObject.memberStorage();
+            const auto &currentStorage = currentObject.memberStorage();
+
+            // Nodes that share their members are equal
+            if (&previousStorage == &currentStorage)
+            {
+                return true;
+            }
+
+            for (const auto &member : previousStorage)
+            {
+                const auto *currentMember = currentStorage.find(member.name);
+
+                if ((currentMember == nullptr) || (!isEqual(*member.node, *currentMember)))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        case ConfigNode::Type::NodeReference:
+        {
+            return (previous.toNodeReference().reference() ==
+                    current.toNodeReference().reference());
+        }
+
+        case ConfigNode::Type::DerivedObject:
+        {
+            return ((previous.toDerivedObject().bases() == current.toDerivedObject().bases()) &&
+                    isEqual(previous.toDerivedObject().config(),
+                            current.toDerivedObject().config()));
+        }
+
+        default:
+        {
+            return false;
+        }
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QString ConfigDiff::toNodePath(const QString &path)
+{
+    return path.isEmpty() ? ConfigNodePath::ROOT_PATH_VALUE : path;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+namespace Internal
+{
+
+bool isSameOrDescendant(const QString &nodePath, const QString &ancestorPath)
+{
+    if (ancestorPath == ConfigNodePath::ROOT_PATH_VALUE)
+    {
+        return true;
+    }
+
+    return (nodePath.startsWith(ancestorPath) &&
+            ((nodePath.size() == ancestorPath.size()) ||
+             (nodePath.at(ancestorPath.size()) == QChar('/'))));
+}
+
+} // namespace Internal
+
+} // namespace CppConfigFramework
@@ -0,0 +1,383 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a class that stores read configurations in a cache directory
+ */
+
+// Own header
+#include <CppConfigFramework/ConfigDiskCache.hpp>
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigFileBuffer.hpp>
+#include <CppConfigFramework/ConfigIncludeCache.hpp>
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/ConfigSnapshotFormat.hpp>
+#include <CppConfigFramework/ConfigSnapshotReader.hpp>
+#include <CppConfigFramework/ConfigWriter.hpp>
+#include <CppConfigFramework/LoggingCategories.hpp>
+
+// Qt includes
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QSaveFile>
+
+// System includes
+#include <algorithm>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+namespace Internal
+{
+
+/*!
+ * Gets the checksum of the snapshot from its header
+ *
+ * \param   data    Snapshot data
+ * \param   size    Size of the snapshot data
+ *
+ * \return  Checksum in hexadecimal format or an empty string if the snapshot is too small
+ */
+QString snapshotChecksum(const char *data, const size_t size);
+
+/*!
+ * Replaces the contents of the file atomically
+ *
+ * \param   filePath    Path to the file
+ * \param   contents    New file contents
+ *
+ * \retval  true    Success
+ * \retval  false   Failure
+ */
+bool replaceFile(const QString &filePath, const QByteArray &contents);
+
+} // namespace Internal
+
+// -------------------------------------------------------------------------------------------------
+
+constexpr int ConfigDiskCache::MANIFEST_VERSION;
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigDiskCache::ConfigDiskCache(const QString &directoryPath)
+    : m_directoryPath(directoryPath)
+{
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QString ConfigDiskCache::directoryPath() const
+{
+    return m_directoryPath;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> ConfigDiskCache::load(
+        const QString &absoluteFilePath,
+        const ConfigNodePath &sourceNodePath,
+        const ConfigNodePath &destinationNodePath,
+        EnvironmentVariables *environmentVariables) const
+{
+    const QString basePath = QDir(m_directoryPath).absoluteFilePath(
+                                 entryName(absoluteFilePath, sourceNodePath, destinationNodePath));
+    const QString manifestPath = basePath + QStringLiteral(".json");
+    const QString snapshotPath = basePath + QStringLiteral(".ccfs");
+
+    // Read the manifest (a missing manifest just means that the configuration is not cached)
+    QFile manifestFile(manifestPath);
+
+    if ((!QFile::exists(manifestPath)) || (!QFile::exists(snapshotPath)) ||
+        (!manifestFile.open(QIODevice::ReadOnly)))
+    {
+        return {};
+    }
+
+    const QJsonDocument manifestDocument = QJsonDocument::fromJson(manifestFile.readAll());
+    const QJsonObject manifest = manifestDocument.object();
+
+    if ((!manifestDocument.isObject()) ||
+        (manifest.value(QStringLiteral("version")).toInt() != MANIFEST_VERSION) ||
+        (manifest.value(QStringLiteral("file_path")).toString() != absoluteFilePath) ||
+        (manifest.value(QStringLiteral("source_node")).toString() != sourceNodePath.path()) ||
+        (manifest.value(QStringLiteral("destination_node")).toString() !=
+         destinationNodePath.path()))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Ignoring an invalid manifest in the cache directory:" << manifestPath;
+        return {};
+    }
+
+    // Check the files (the content hash is only needed if the time of the last modification
+    // differs)
+    QStringList filePaths;
+
+    for (const auto &item : manifest.value(QStringLiteral("files")).toArray())
+    {
+        const QJsonObject file = item.toObject();
+        const QString filePath = file.value(QStringLiteral("path")).toString();
+        const auto fingerprint = ConfigDependencies::fileFingerprint(filePath);
+
+        if (fingerprint.size != static_cast<qint64>(file.value(QStringLiteral("size")).toDouble()))
+        {
+            return {};
+        }
+
+        if ((fingerprint.lastModified.toMSecsSinceEpoch() !=
+             static_cast<qint64>(file.value(QStringLiteral("last_modified")).toDouble())) &&
+            (QString::fromLatin1(ConfigDependencies::fileContentHash(filePath).toHex()) !=
+             file.value(QStringLiteral("content_hash")).toString()))
+        {
+            return {};
+        }
+
+        filePaths.append(filePath);
+    }
+
+    // Check the environment variables
+    QStringList environmentVariableNames;
+
+    for (const auto &item : manifest.value(QStringLiteral("environment_variables")).toArray())
+    {
+        environmentVariableNames.append(item.toString());
+    }
+
+    const QByteArray environmentHash =
+            ConfigIncludeCache::environmentHash(environmentVariableNames,
+                                                environmentVariables->variables());
+
+    if (QString::fromLatin1(environmentHash.toHex()) !=
+        manifest.value(QStringLiteral("environment_hash")).toString())
+    {
+        return {};
+    }
+
+    // Read the snapshot (it must be the one that the manifest was written for). Snapshots are only
+    // ever replaced atomically so they can safely be memory mapped.
+    ConfigFileBuffer snapshotContents;
+
+    if (!snapshotContents.open(snapshotPath))
+    {
+        return {};
+    }
+
+    if (Internal::snapshotChecksum(snapshotContents.data(), snapshotContents.size()) !=
+        manifest.value(QStringLiteral("snapshot_checksum")).toString())
+    {
+        return {};
+    }
+
+    auto config = ConfigSnapshotReader::readSnapshot(snapshotContents.data(),
+                                                     snapshotContents.size());
+
+    if (!config)
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Ignoring an invalid snapshot in the cache directory:" << snapshotPath;
+        return {};
+    }
+
+    // The cached configuration is now a part of the configuration that is being read
+    for (const QString &filePath : filePaths)
+    {
+        ConfigDependencyRecorder::recordFile(filePath);
+    }
+
+    for (const QString &name : environmentVariableNames)
+    {
+        ConfigDependencyRecorder::recordEnvironmentVariable(name);
+    }
+
+    const QJsonObject environmentChanges =
+            manifest.value(QStringLiteral("environment_changes")).toObject();
+
+    for (auto it = environmentChanges.begin(); it != environmentChanges.end(); it++)
+    {
+        environmentVariables->setValue(it.key(), it.value().toString());
+    }
+
+    return config;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigDiskCache::store(const QString &absoluteFilePath,
+                            const ConfigNodePath &sourceNodePath,
+                            const ConfigNodePath &destinationNodePath,
+                            const ConfigObjectNode &config,
+                            const ConfigDependencies &dependencies,
+                            const EnvironmentVariables &initialEnvironmentVariables,
+                            const EnvironmentVariables &environmentVariables) const
+{
+    // Fingerprints of the files (the files must not have been changed after they were read)
+    QJsonArray files;
+    const auto &dependencyFiles = dependencies.files();
+
+    for (auto it = dependencyFiles.begin(); it != dependencyFiles.end(); it++)
+    {
+        const QByteArray contentHash = ConfigDependencies::fileContentHash(it.key());
+        const auto fingerprint = ConfigDependencies::fileFingerprint(it.key());
+
+        if (contentHash.isEmpty() ||
+            (fingerprint.size != it.value().size) ||
+            (fingerprint.lastModified != it.value().lastModified))
+        {
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                    << "Configuration is not cached because a file was changed after it was read:"
+                    << it.key();
+            return false;
+        }
+
+        files.append(QJsonObject
+                     {
+                         { QStringLiteral("path"), it.key() },
+                         { QStringLiteral("size"), fingerprint.size },
+                         {
+                             QStringLiteral("last_modified"),
+                             fingerprint.lastModified.toMSecsSinceEpoch()
+                         },
+                         {
+                             QStringLiteral("content_hash"),
+                             QString::fromLatin1(contentHash.toHex())
+                         }
+                     });
+    }
+
+    // Environment variables
+    QStringList environmentVariableNames = dependencies.environmentVariables().values();
+    std::sort(environmentVariableNames.begin(), environmentVariableNames.end());
+
+    const QByteArray environmentHash =
+            ConfigIncludeCache::environmentHash(environmentVariableNames,
+                                                initialEnvironmentVariables.variables());
+
+    const auto changes = ConfigIncludeCache::environmentChanges(initialEnvironmentVariables,
+                                                                environmentVariables);
+    QJsonObject environmentChanges;
+
+    for (auto it = changes.begin(); it != changes.end(); it++)
+    {
+        environmentChanges.insert(it.key(), it.value());
+    }
+
+    // Snapshot
+    const QByteArray snapshot = ConfigWriter::writeToSnapshot(config);
+
+    if (snapshot.isEmpty())
+    {
+        return false;
+    }
+
+    const QJsonObject manifest
+    {
+        { QStringLiteral("version"), MANIFEST_VERSION },
+        { QStringLiteral("file_path"), absoluteFilePath },
+        { QStringLiteral("source_node"), sourceNodePath.path() },
+        { QStringLiteral("destination_node"), destinationNodePath.path() },
+        {
+            QStringLiteral("snapshot_checksum"),
+            Internal::snapshotChecksum(snapshot.constData(), static_cast<size_t>(snapshot.size()))
+        },
+        { QStringLiteral("files"), files },
+        {
+            QStringLiteral("environment_variables"),
+            QJsonArray::fromStringList(environmentVariableNames)
+        },
+        { QStringLiteral("environment_hash"), QString::fromLatin1(environmentHash.toHex()) },
+        { QStringLiteral("environment_changes"), environmentChanges }
+    };
+
+    // Write the snapshot before the manifest so that the manifest never references a snapshot
+    // that doesn't exist yet
+    if (!QDir().mkpath(m_directoryPath))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Failed to create the cache directory:" << m_directoryPath;
+        return false;
+    }
+
+    const QString basePath = QDir(m_directoryPath).absoluteFilePath(
+                                 entryName(absoluteFilePath, sourceNodePath, destinationNodePath));
+
+    return (Internal::replaceFile(basePath + QStringLiteral(".ccfs"), snapshot) &&
+            Internal::replaceFile(basePath + QStringLiteral(".json"),
+                                  QJsonDocument(manifest).toJson(QJsonDocument::Indented)));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QString ConfigDiskCache::entryName(const QString &absoluteFilePath,
+                                   const ConfigNodePath &sourceNodePath,
+                                   const ConfigNodePath &destinationNodePath)
+{
+    const QString key = absoluteFilePath + QChar('\n') + sourceNodePath.path() + QChar('\n') +
+                        destinationNodePath.path();
+
+    return QString::fromLatin1(
+                QCryptographicHash::hash(key.toUtf8(), QCryptographicHash::Sha1).toHex());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+namespace Internal
+{
+
+QString snapshotChecksum(const char *data, const size_t size)
+{
+    constexpr size_t checksumSize = 8U;
+
+    if (size < (ConfigSnapshotFormat::CHECKSUM_OFFSET + checksumSize))
+    {
+        return {};
+    }
+
+    return QString::fromLatin1(
+                QByteArray(data + ConfigSnapshotFormat::CHECKSUM_OFFSET,
+                           static_cast<int>(checksumSize)).toHex());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool replaceFile(const QString &filePath, const QByteArray &contents)
+{
+    QSaveFile file(filePath);
+
+    if ((!file.open(QIODevice::WriteOnly)) ||
+        (file.write(contents) != static_cast<qint64>(contents.size())) ||
+        (!file.commit()))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Failed to write the file to the cache directory:" << filePath;
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace Internal
+
+} // namespace CppConfigFramework
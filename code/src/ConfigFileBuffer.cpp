@@ -0,0 +1,169 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a class that provides read-only access to the contents of a configuration file
+ */
+
+// Own header
+#include <CppConfigFramework/ConfigFileBuffer.hpp>
+
+// C++ Config Framework includes
+#include <CppConfigFramework/LoggingCategories.hpp>
+
+// Qt includes
+#include <QtCore/QDateTime>
+#include <QtCore/QFileInfo>
+
+// System includes
+#include <algorithm>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+ConfigFileBuffer::~ConfigFileBuffer()
+{
+    close();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigFileBuffer::open(const QString &filePath, const bool mappingEnabled)
+{
+    close();
+
+    // File info is taken before the file is opened so that changes to the file made while it is
+    // being opened and mapped can be detected
+    const QFileInfo fileInfo(filePath);
+    const QDateTime lastModified = fileInfo.lastModified();
+
+    m_file.setFileName(filePath);
+
+    if (!m_file.open(QIODevice::ReadOnly))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Failed to open file at path:" << filePath;
+        return false;
+    }
+
+    // Only regular files on a file system are mapped (Qt resources are not mapped even if Qt could
+    // map them, as their data is already in memory anyway)
+    const qint64 fileSize = m_file.size();
+
+    if (mappingEnabled &&
+        (!filePath.startsWith(QStringLiteral(":"))) &&
+        (!filePath.startsWith(QStringLiteral("qrc:"))) &&
+        fileInfo.isFile() &&
+        (fileSize > 0) &&
+        (fileSize == fileInfo.size()))
+    {
+        m_mappedData = m_file.map(0, fileSize);
+
+        if (m_mappedData != nullptr)
+        {
+            // Keep the mapping only if the file was not changed in the meantime
+            const QFileInfo mappedFileInfo(filePath);
+
+            if ((mappedFileInfo.size() == fileSize) &&
+                (mappedFileInfo.lastModified() == lastModified))
+            {
+                m_mappedSize = static_cast<size_t>(fileSize);
+                m_open = true;
+                return true;
+            }
+
+            m_file.unmap(m_mappedData);
+            m_mappedData = nullptr;
+        }
+    }
+
+    // Fall back to reading the contents to the heap
+    m_contents = m_file.readAll();
+    m_open = true;
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigFileBuffer::close()
+{
+    if (m_mappedData != nullptr)
+    {
+        m_file.unmap(m_mappedData);
+        m_mappedData = nullptr;
+        m_mappedSize = 0U;
+    }
+
+    m_contents.clear();
+    m_file.close();
+    m_open = false;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigFileBuffer::isOpen() const
+{
+    return m_open;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigFileBuffer::isMapped() const
+{
+    return (m_mappedData != nullptr);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const char *ConfigFileBuffer::data() const
+{
+    if (m_mappedData != nullptr)
+    {
+        return reinterpret_cast<const char *>(m_mappedData);
+    }
+
+    return m_contents.constData();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+size_t ConfigFileBuffer::size() const
+{
+    if (m_mappedData != nullptr)
+    {
+        return m_mappedSize;
+    }
+
+    return static_cast<size_t>(m_contents.size());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QByteArray ConfigFileBuffer::mid(const size_t position, const size_t length) const
+{
+    const size_t start = std::min(position, size());
+    const size_t count = std::min(length, size() - start);
+
+    return QByteArray(data() + start, static_cast<int>(count));
+}
+
+} // namespace CppConfigFramework
@@ -0,0 +1,436 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a cache for configuration files that were already read
+ */
+
+// Own header
+#include <CppConfigFramework/ConfigIncludeCache.hpp>
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigNodeArena.hpp>
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+
+// Qt includes
+#include <QtCore/QCryptographicHash>
+
+// System includes
+#include <algorithm>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+struct ConfigIncludeCache::Entry
+{
+    //! Names of the environment variables that were used (sorted)
+    QStringList environmentVariableNames;
+
+    //! Hash of the environment variables that were used
+    QByteArray environmentHash;
+
+    //! Dependencies of the configuration
+    ConfigDependencies dependencies;
+
+    //! Environment variables that were set while reading the configuration
+    QHash<QString, QString> environmentChanges;
+
+    //! Read configuration (shared so that it can be cloned without holding the cache's mutex)
+    std::shared_ptr<const ConfigObjectNode> config;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+namespace Internal
+{
+
+//! Holds the include cache that is active for the current thread
+thread_local ConfigIncludeCache *currentIncludeCache = nullptr;
+
+/*!
+ * Creates a detached copy of the configuration node
+ *
+ * \param   config  Configuration node
+ *
+ * \return  Detached copy (it doesn't share its members with any other node, see
+ *          ConfigObjectNode::detach())
+ */
+std::unique_ptr<ConfigObjectNode> detachedCopy(const ConfigObjectNode &config);
+
+} // namespace Internal
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigIncludeCache::ConfigIncludeCache()
+    : m_enabled(false),
+      m_hitCount(0U),
+      m_missCount(0U)
+{
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigIncludeCache::~ConfigIncludeCache() = default;
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigIncludeCache::isEnabled() const
+{
+    return m_enabled.load();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigIncludeCache::setEnabled(const bool enabled)
+{
+    m_enabled.store(enabled);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+quint64 ConfigIncludeCache::hitCount() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_hitCount;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+quint64 ConfigIncludeCache::missCount() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_missCount;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+size_t ConfigIncludeCache::entryCount() const
+{
+    QMutexLocker locker(&m_mutex);
+    size_t count = 0U;
+
+    for (const auto &item : m_entries)
+    {
+        count += item.second.size();
+    }
+
+    return count;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigIncludeCache::clear()
+{
+    QMutexLocker locker(&m_mutex);
+
+    m_entries.clear();
+    m_hitCount = 0U;
+    m_missCount = 0U;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+size_t ConfigIncludeCache::invalidate(const QStringList &absoluteFilePaths)
+{
+    QMutexLocker locker(&m_mutex);
+    size_t count = 0U;
+
+    for (auto it = m_entries.begin(); it != m_entries.end(); )
+    {
+        auto &entries = it->second;
+
+        auto removedIt = std::remove_if(entries.begin(),
+                                        entries.end(),
+                                        [&absoluteFilePaths](const std::unique_ptr<Entry> &entry)
+        {
+            const auto &files = entry->dependencies.files();
+
+            return std::any_of(absoluteFilePaths.begin(),
+                               absoluteFilePaths.end(),
+                               [&files](const QString &filePath)
+            {
+                return files.contains(filePath);
+            });
+        });
+
+        count += static_cast<size_t>(std::distance(removedIt, entries.end()));
+        entries.erase(removedIt, entries.end());
+
+        if (entries.empty())
+        {
+            it = m_entries.erase(it);
+        }
+        else
+        {
+            it++;
+        }
+    }
+
+    return count;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> ConfigIncludeCache::find(
+        const QString &absoluteFilePath,
+        const ConfigNodePath &sourceNodePath,
+        const ConfigNodePath &destinationNodePath,
+        EnvironmentVariables *environmentVariables)
+{
+    QMutexLocker locker(&m_mutex);
+
+    std::shared_ptr<const ConfigObjectNode> cachedConfig;
+    ConfigDependencies dependencies;
+    QHash<QString, QString> environmentChanges;
+
+    auto it = m_entries.find(entryKey(absoluteFilePath, sourceNodePath, destinationNodePath));
+
+    if (it != m_entries.end())
+    {
+        for (const auto &entry : it->second)
+        {
+            if ((environmentHash(entry->environmentVariableNames,
+                                 environmentVariables->variables()) == entry->environmentHash) &&
+                filesUnchanged(entry->dependencies))
+            {
+                cachedConfig = entry->config;
+                dependencies = entry->dependencies;
+                environmentChanges = entry->environmentChanges;
+                break;
+            }
+        }
+    }
+
+    if (!cachedConfig)
+    {
+        m_missCount++;
+        return {};
+    }
+
+    m_hitCount++;
+    locker.unlock();
+
+    // Cached nodes are detached so cloning them makes a complete copy without modifying them. The
+    // clone is made without holding the mutex so that the other threads are not blocked by it (the
+    // cached configuration stays alive even if its entry is replaced in the meantime).
+    auto clone = cachedConfig->clone();
+    auto config = std::make_unique<ConfigObjectNode>(std::move(clone->toObject()));
+
+    // The cached configuration is now a part of the configuration that is being read
+    auto *recorder = ConfigDependencyRecorder::current();
+
+    if (recorder != nullptr)
+    {
+        recorder->dependencies().merge(dependencies);
+    }
+
+    for (auto changeIt = environmentChanges.begin();
+         changeIt != environmentChanges.end();
+         changeIt++)
+    {
+        environmentVariables->setValue(changeIt.key(), changeIt.value());
+    }
+
+    return config;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigIncludeCache::insert(const QString &absoluteFilePath,
+                                const ConfigNodePath &sourceNodePath,
+                                const ConfigNodePath &destinationNodePath,
+                                const ConfigObjectNode &config,
+                                const ConfigDependencies &dependencies,
+                                const std::vector<const ConfigObjectNode *> &externalConfigs,
+                                const EnvironmentVariables &initialEnvironmentVariables,
+                                const EnvironmentVariables &environmentVariables)
+{
+    // Configuration that depends on the external configs can't be reused
+    for (const auto *externalConfig : externalConfigs)
+    {
+        if (dependencies.externalConfigs().contains(externalConfig))
+        {
+            return false;
+        }
+    }
+
+    // Prepare the entry
+    auto entry = std::make_unique<Entry>();
+    entry->environmentVariableNames = dependencies.environmentVariables().values();
+    std::sort(entry->environmentVariableNames.begin(), entry->environmentVariableNames.end());
+    entry->environmentHash = environmentHash(entry->environmentVariableNames,
+                                             initialEnvironmentVariables.variables());
+    entry->dependencies = dependencies;
+    entry->dependencies.clearExternalConfigs();
+    entry->environmentChanges = environmentChanges(initialEnvironmentVariables,
+                                                   environmentVariables);
+
+    {
+        // Cached nodes must not keep the arena of the configuration that is being read alive
+        ConfigNodeHeapScope heapScope;
+        entry->config = Internal::detachedCopy(config);
+    }
+
+    // Replace the entry with the same environment hash
+    QMutexLocker locker(&m_mutex);
+    auto &entries = m_entries[entryKey(absoluteFilePath, sourceNodePath, destinationNodePath)];
+
+    auto it = std::find_if(entries.begin(),
+                           entries.end(),
+                           [&entry](const std::unique_ptr<Entry> &item)
+    {
+        return ((item->environmentVariableNames == entry->environmentVariableNames) &&
+                (item->environmentHash == entry->environmentHash));
+    });
+
+    if (it != entries.end())
+    {
+        *it = std::move(entry);
+    }
+    else
+    {
+        entries.push_back(std::move(entry));
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QByteArray ConfigIncludeCache::environmentHash(const QStringList &names,
+                                               const QHash<QString, QString> &variables)
+{
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+
+    for (const QString &name : names)
+    {
+        hash.addData(name.toUtf8());
+
+        auto it = variables.find(name);
+
+        if (it == variables.end())
+        {
+            hash.addData(QByteArray(1, '\0'));
+        }
+        else
+        {
+            hash.addData(QByteArray(1, '\1'));
+            hash.addData(it.value().toUtf8());
+        }
+
+        hash.addData(QByteArray(1, '\0'));
+    }
+
+    return hash.result();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigIncludeCache::filesUnchanged(const ConfigDependencies &dependencies)
+{
+    const auto &files = dependencies.files();
+
+    for (auto it = files.begin(); it != files.end(); it++)
+    {
+        const auto file = ConfigDependencies::fileFingerprint(it.key());
+
+        if ((file.size != it.value().size) || (file.lastModified != it.value().lastModified))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QHash<QString, QString> ConfigIncludeCache::environmentChanges(
+        const EnvironmentVariables &initialEnvironmentVariables,
+        const EnvironmentVariables &environmentVariables)
+{
+    QHash<QString, QString> changes;
+    const auto &initialVariables = initialEnvironmentVariables.variables();
+    const auto &variables = environmentVariables.variables();
+
+    for (auto it = variables.begin(); it != variables.end(); it++)
+    {
+        auto initialIt = initialVariables.find(it.key());
+
+        if ((initialIt == initialVariables.end()) || (initialIt.value() != it.value()))
+        {
+            changes.insert(it.key(), it.value());
+        }
+    }
+
+    return changes;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QString ConfigIncludeCache::entryKey(const QString &absoluteFilePath,
+                                     const ConfigNodePath &sourceNodePath,
+                                     const ConfigNodePath &destinationNodePath)
+{
+    return absoluteFilePath + QChar('\n') + sourceNodePath.path() + QChar('\n') +
+            destinationNodePath.path();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigIncludeCacheScope::ConfigIncludeCacheScope(ConfigIncludeCache *includeCache)
+    : m_previousIncludeCache(Internal::currentIncludeCache)
+{
+    Internal::currentIncludeCache = includeCache;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigIncludeCacheScope::~ConfigIncludeCacheScope()
+{
+    Internal::currentIncludeCache = m_previousIncludeCache;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigIncludeCache *ConfigIncludeCacheScope::current()
+{
+    return Internal::currentIncludeCache;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+namespace Internal
+{
+
+std::unique_ptr<ConfigObjectNode> detachedCopy(const ConfigObjectNode &config)
+{
+    auto clone = config.clone();
+    auto copy = std::make_unique<ConfigObjectNode>(std::move(clone->toObject()));
+    copy->detach();
+
+    return copy;
+}
+
+} // namespace Internal
+
+} // namespace CppConfigFramework
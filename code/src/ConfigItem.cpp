@@ -44,10 +44,7 @@ bool ConfigItem::loadConfig(const ConfigObjectNode &config)
 {
     if (!loadConfigParameters(config))
     {
-        const QString errorString = QString("Failed to load the configuration parameters [%1]!")
-                                    .arg(config.nodePath().path());
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
-        handleError(errorString);
+        reportError(ConfigItemError(ConfigItemError::Code::LoadParametersFailed, &config));
         return false;
     }
 
@@ -56,10 +53,10 @@ bool ConfigItem::loadConfig(const ConfigObjectNode &config)
 
     if (!validationError.isEmpty())
     {
-        const QString errorString = QString("Configuration [%1] is not valid! Error: [%2]")
-                                    .arg(config.nodePath().path(), validationError);
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
-        handleError(errorString);
+        reportError(ConfigItemError(ConfigItemError::Code::InvalidConfig,
+                                    &config,
+                                    QString(),
+                                    validationError));
         return false;
     }
 
@@ -72,9 +69,9 @@ bool ConfigItem::loadConfig(const QString &parameterName, const ConfigObjectNode
 {
     if (!ConfigNodePath::validateNodeName(parameterName))
     {
-        const QString errorString = QString("Parameter name [%1] is not valid!").arg(parameterName);
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
-        handleError(errorString);
+        reportError(ConfigItemError(ConfigItemError::Code::InvalidParameterName,
+                                    nullptr,
+                                    parameterName));
         return false;
     }
 
@@ -89,9 +86,9 @@ bool ConfigItem::loadOptionalConfig(const QString &parameterName,
 {
     if (!ConfigNodePath::validateNodeName(parameterName))
     {
-        const QString errorString = QString("Parameter name [%1] is not valid!").arg(parameterName);
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
-        handleError(errorString);
+        reportError(ConfigItemError(ConfigItemError::Code::InvalidParameterName,
+                                    nullptr,
+                                    parameterName));
         return false;
     }
 
@@ -105,10 +102,7 @@ bool ConfigItem::loadConfigAtPath(const ConfigNodePath &path, const ConfigObject
     // Validate node path
     if (!path.isValid())
     {
-        const QString errorString = QString("Configuration node path [%1] is not valid!")
-                                    .arg(path.path());
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
-        handleError(errorString);
+        reportError(ConfigItemError(ConfigItemError::Code::InvalidNodePath, nullptr, path.path()));
         return false;
     }
 
@@ -117,19 +111,13 @@ bool ConfigItem::loadConfigAtPath(const ConfigNodePath &path, const ConfigObject
 
     if (node == nullptr)
     {
-        const QString errorString = QString("Configuration node [%1] was not found!")
-                                    .arg(path.toAbsolute(config.nodePath()).path());
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
-        handleError(errorString);
+        reportError(ConfigItemError(ConfigItemError::Code::NodeNotFound, &config, path.path()));
         return false;
     }
 
     if (!node->isObject())
     {
-        const QString errorString = QString("Configuration node [%1] is not an Object node!")
-                                    .arg(node->nodePath().path());
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
-        handleError(errorString);
+        reportError(ConfigItemError(ConfigItemError::Code::NotObjectNode, node));
         return false;
     }
 
@@ -153,10 +141,7 @@ bool ConfigItem::loadOptionalConfigAtPath(const ConfigNodePath &path,
     // Validate node path
     if (!path.isValid())
     {
-        const QString errorString = QString("Configuration node path [%1] is not valid!")
-                                    .arg(path.path());
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
-        handleError(errorString);
+        reportError(ConfigItemError(ConfigItemError::Code::InvalidNodePath, nullptr, path.path()));
 
         if (loaded != nullptr)
         {
@@ -180,10 +165,7 @@ bool ConfigItem::loadOptionalConfigAtPath(const ConfigNodePath &path,
 
     if (!node->isObject())
     {
-        const QString errorString = QString("Configuration node [%1] is not an Object node!")
-                                    .arg(node->nodePath().path());
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
-        handleError(errorString);
+        reportError(ConfigItemError(ConfigItemError::Code::NotObjectNode, node));
         return false;
     }
 
@@ -212,18 +194,13 @@ bool ConfigItem::storeConfig(ConfigObjectNode *config)
 {
     if (config == nullptr)
     {
-        const QString errorString("Configuration node is a null pointer!");
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
-        handleError(errorString);
+        reportError(ConfigItemError(ConfigItemError::Code::NullNode, nullptr));
         return false;
     }
 
     if (!storeConfigParameters(config))
     {
-        const QString errorString = QString("Failed to store the configuration parameters [%1]!")
-                                    .arg(config->nodePath().path());
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
-        handleError(errorString);
+        reportError(ConfigItemError(ConfigItemError::Code::StoreParametersFailed, config));
         return false;
     }
 
@@ -236,9 +213,9 @@ bool ConfigItem::storeConfig(const QString &parameterName, ConfigObjectNode *con
 {
     if (!ConfigNodePath::validateNodeName(parameterName))
     {
-        const QString errorString = QString("Parameter name [%1] is not valid!").arg(parameterName);
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
-        handleError(errorString);
+        reportError(ConfigItemError(ConfigItemError::Code::InvalidParameterName,
+                                    nullptr,
+                                    parameterName));
         return false;
     }
 
@@ -251,30 +228,26 @@ bool ConfigItem::storeConfigAtPath(const ConfigNodePath &path, ConfigObjectNode
 {
     if (config == nullptr)
     {
-        const QString errorString("Configuration node is a null pointer!");
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
-        handleError(errorString);
+        reportError(ConfigItemError(ConfigItemError::Code::NullNode, nullptr));
         return false;
     }
 
     // Validate node path
     if (!path.isValid())
     {
-        const QString errorString = QString("Configuration node path [%1] is not valid!")
-                                    .arg(path.path());
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
-        handleError(errorString);
+        reportError(ConfigItemError(ConfigItemError::Code::InvalidNodePath, nullptr, path.path()));
         return false;
     }
 
     // Get or create the object node at path (create missing nodes as object nodes)
-    const auto nodeNameList = path.nodeNames();
     ConfigNode *node = path.isAbsolute() ? config->rootNode()
                                          : config;
 
-    for (const QString &nodeName : nodeNameList)
+    for (const auto &segment : path.segments())
     {
-        if (nodeName == ConfigNodePath::PARENT_PATH_VALUE)
+        const QString &nodeName = segment.name;
+
+        if (segment.type == ConfigNodePath::SegmentType::Parent)
         {
             node = node->parent();
         }
@@ -282,11 +255,7 @@ bool ConfigItem::storeConfigAtPath(const ConfigNodePath &path, ConfigObjectNode
         {
             if (!node->isObject())
             {
-                const QString errorString = QString("Cannot get the child node [%2] from a node at "
-                                                    "path [%2] which is not an object!")
-                                            .arg(nodeName, node->nodePath().path());
-                qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
-                handleError(errorString);
+                reportError(ConfigItemError(ConfigItemError::Code::NotObjectNode, node, nodeName));
                 return false;
             }
 
@@ -303,10 +272,7 @@ bool ConfigItem::storeConfigAtPath(const ConfigNodePath &path, ConfigObjectNode
 
     if (!node->isObject())
     {
-        const QString errorString = QString("Configuration node [%1] is not an Object node!")
-                                    .arg(node->nodePath().path());
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << errorString;
-        handleError(errorString);
+        reportError(ConfigItemError(ConfigItemError::Code::NotObjectNode, node));
         return false;
     }
 
@@ -323,6 +289,34 @@ bool ConfigItem::storeConfigAtPath(const QString &path, ConfigObjectNode *config
 
 // -------------------------------------------------------------------------------------------------
 
+bool ConfigItem::isErrorLoggingEnabled() const
+{
+    return m_errorLoggingEnabled;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigItem::setErrorLoggingEnabled(const bool enabled)
+{
+    m_errorLoggingEnabled = enabled;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigItem::isLegacyErrorHandlerEnabled() const
+{
+    return m_legacyErrorHandlerEnabled;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigItem::setLegacyErrorHandlerEnabled(const bool enabled)
+{
+    m_legacyErrorHandlerEnabled = enabled;
+}
+
+// -------------------------------------------------------------------------------------------------
+
 QString ConfigItem::jsonToString(const QJsonValue &value)
 {
     switch (value.type())
@@ -364,6 +358,23 @@ QString ConfigItem::jsonToString(const QJsonValue &value)
 
 // -------------------------------------------------------------------------------------------------
 
+void ConfigItem::reportUnknownConfigParameters(const ConfigParameterBatch &batch)
+{
+    const QStringList &unknownNames = batch.unknownNames();
+
+    if (unknownNames.isEmpty())
+    {
+        return;
+    }
+
+    qCDebug(CppConfigFramework::LoggingCategory::ConfigItem)
+            << "Unknown configuration parameters" << unknownNames
+            << "in configuration node" << batch.config().nodePath().path();
+    handleUnknownConfigParameters(batch.config(), unknownNames);
+}
+
+// -------------------------------------------------------------------------------------------------
+
 QString ConfigItem::validateConfig() const
 {
     return {};
@@ -371,9 +382,43 @@ QString ConfigItem::validateConfig() const
 
 // -------------------------------------------------------------------------------------------------
 
+void ConfigItem::reportError(const ConfigItemError &error)
+{
+    if (m_errorLoggingEnabled)
+    {
+        // The message is formatted only if the logging category is enabled
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigItem) << error.message();
+    }
+
+    handleError(error);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigItem::handleError(const ConfigItemError &error)
+{
+    // The message is formatted only for the configuration classes that still use the deprecated
+    // method
+    if (m_legacyErrorHandlerEnabled)
+    {
+        handleError(error.message());
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
 void ConfigItem::handleError(const QString &error)
 {
     Q_UNUSED(error);
 }
 
+// -------------------------------------------------------------------------------------------------
+
+void ConfigItem::handleUnknownConfigParameters(const ConfigObjectNode &config,
+                                               const QStringList &names)
+{
+    Q_UNUSED(config);
+    Q_UNUSED(names);
+}
+
 } // namespace CppConfigFramework
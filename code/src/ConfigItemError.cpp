@@ -0,0 +1,252 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a class that describes an error that occurred while loading or storing a configuration
+ * item
+ */
+
+// Own header
+#include <CppConfigFramework/ConfigItemError.hpp>
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigItem.hpp>
+#include <CppConfigFramework/ConfigNode.hpp>
+#include <CppConfigFramework/ConfigNodePath.hpp>
+
+// Qt includes
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+ConfigItemError::ConfigItemError(const Code code,
+                                 const ConfigNode *node,
+                                 const QString &name,
+                                 const QString &detail,
+                                 const QJsonValue &value)
+    : m_code(code),
+      m_node(node),
+      m_name(name),
+      m_detail(detail),
+      m_value(value)
+{
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigItemError::ConfigItemError(const ConfigItemError &other)
+    : m_code(other.m_code),
+      m_node(other.m_node),
+      m_nodePath(other.nodePath()),
+      m_name(other.m_name),
+      m_detail(other.m_detail),
+      m_value(other.m_value)
+{
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigItemError &ConfigItemError::operator=(const ConfigItemError &other)
+{
+    if (this != &other)
+    {
+        m_code = other.m_code;
+        m_node = other.m_node;
+        m_nodePath = other.nodePath();
+        m_name = other.m_name;
+        m_detail = other.m_detail;
+        m_value = other.m_value;
+    }
+
+    return *this;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigItemError::Code ConfigItemError::code() const
+{
+    return m_code;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const ConfigNode *ConfigItemError::node() const
+{
+    return m_node;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QString ConfigItemError::nodePath() const
+{
+    // Copies of the error must not access the node (it might not exist anymore)
+    if ((!m_nodePath.isNull()) || (m_node == nullptr))
+    {
+        return m_nodePath;
+    }
+
+    return m_node->nodePath().path();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const QString &ConfigItemError::name() const
+{
+    return m_name;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const QString &ConfigItemError::detail() const
+{
+    return m_detail;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const QJsonValue &ConfigItemError::value() const
+{
+    return m_value;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QString ConfigItemError::message() const
+{
+    switch (m_code)
+    {
+        case Code::NullNode:
+        {
+            return QStringLiteral("Configuration node is a null pointer!");
+        }
+
+        case Code::InvalidNodePath:
+        {
+            return QString("Configuration node path [%1] is not valid!").arg(m_name);
+        }
+
+        case Code::NodeNotFound:
+        {
+            const QString workingPath = nodePath();
+            const QString path =
+                    (!workingPath.isEmpty())
+                    ? ConfigNodePath(m_name).toAbsolute(ConfigNodePath(workingPath)).path()
+                    : m_name;
+            return QString("Configuration node [%1] was not found!").arg(path);
+        }
+
+        case Code::NotObjectNode:
+        {
+            if (!m_name.isEmpty())
+            {
+                return QString("Cannot get the child node [%1] from a node at path [%2] which is "
+                               "not an object!").arg(m_name, nodePath());
+            }
+
+            return QString("Configuration node [%1] is not an Object node!")
+                    .arg(nodePath());
+        }
+
+        case Code::InvalidParameterName:
+        {
+            if (m_node == nullptr)
+            {
+                return QString("Parameter name [%1] is not valid!").arg(m_name);
+            }
+
+            return QString("Configuration parameter name [%1] is not valid (configuration node "
+                           "[%2])!").arg(m_name, nodePath());
+        }
+
+        case Code::InvalidParameterTable:
+        {
+            return QString("Configuration parameter name [%1] is not valid or not unique "
+                           "(configuration node [%2])!").arg(m_name, nodePath());
+        }
+
+        case Code::ParameterNotFound:
+        {
+            return QString("Configuration parameter node with name [%1] was not found in "
+                           "configuration node [%2]!").arg(m_name, nodePath());
+        }
+
+        case Code::InvalidParameterNode:
+        {
+            return QString("Configuration parameter node [%1] is neither a Value nor an Object "
+                           "node!").arg(nodePath());
+        }
+
+        case Code::UnresolvedReferences:
+        {
+            return QString("Configuration parameter node [%1] has unresolved references!")
+                    .arg(nodePath());
+        }
+
+        case Code::DeserializationFailed:
+        {
+            return QString("Failed to load configuration parameter's value at node path [%1]")
+                    .arg(nodePath());
+        }
+
+        case Code::InvalidParameterValue:
+        {
+            return QString("Configuration parameter's value [%1] is not valid")
+                    .arg(nodePath());
+        }
+
+        case Code::InvalidContainerNode:
+        {
+            return QString("Configuration container node [%1] is not an Object node!")
+                    .arg(nodePath());
+        }
+
+        case Code::LoadParametersFailed:
+        {
+            return QString("Failed to load the configuration parameters [%1]!")
+                    .arg(nodePath());
+        }
+
+        case Code::InvalidConfig:
+        {
+            return QString("Configuration [%1] is not valid! Error: [%2]")
+                    .arg(nodePath(), m_detail);
+        }
+
+        case Code::StoreParametersFailed:
+        {
+            return QString("Failed to store the configuration parameters [%1]!")
+                    .arg(nodePath());
+        }
+
+        case Code::StoreParameterFailed:
+        {
+            return QString("Failed to store configuration parameter with name [%1] and value: "
+                           "[%2]").arg(m_name, ConfigItem::jsonToString(m_value));
+        }
+    }
+
+    return QString();
+}
+
+} // namespace CppConfigFramework
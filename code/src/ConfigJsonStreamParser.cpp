@@ -0,0 +1,936 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a streaming (pull) parser for JSON documents
+ */
+
+// Own header
+#include <CppConfigFramework/ConfigJsonStreamParser.hpp>
+
+// C++ Config Framework includes
+
+// Qt includes
+#include <QtCore/QByteArray>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonObject>
+
+// System includes
+#include <algorithm>
+#include <cstring>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+namespace Internal
+{
+
+bool isDigit(const char character);
+int hexDigitValue(const char character);
+void appendUtf8(const uint codePoint, QByteArray *output);
+
+} // namespace Internal
+
+// -------------------------------------------------------------------------------------------------
+
+constexpr int ConfigJsonStreamParser::MAX_DEPTH;
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigJsonStreamParser::ConfigJsonStreamParser(const char *data, const size_t size)
+    : m_data(data),
+      m_size(size),
+      m_position(0U),
+      m_depth(0),
+      m_firstEntry(false),
+      m_errorPosition(0U)
+{
+    // Skip the UTF-8 byte order mark
+    if ((m_size >= 3U) && (std::memcmp(m_data, "\xEF\xBB\xBF", 3U) == 0))
+    {
+        m_position = 3U;
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+size_t ConfigJsonStreamParser::position() const
+{
+    return m_position;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigJsonStreamParser::seek(const size_t position)
+{
+    m_position = std::min(position, m_size);
+    m_depth = 0;
+    m_firstEntry = false;
+    m_errorString.clear();
+    m_errorPosition = 0U;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigJsonStreamParser::hasError() const
+{
+    return (!m_errorString.isEmpty());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QString ConfigJsonStreamParser::errorString() const
+{
+    return m_errorString;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+size_t ConfigJsonStreamParser::errorPosition() const
+{
+    return m_errorPosition;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigJsonStreamParser::ValueType ConfigJsonStreamParser::peekValueType()
+{
+    if (hasError())
+    {
+        return ValueType::Invalid;
+    }
+
+    skipWhitespace();
+
+    if (m_position >= m_size)
+    {
+        return ValueType::Invalid;
+    }
+
+    switch (m_data[m_position])
+    {
+        case 'n':
+        {
+            return ValueType::Null;
+        }
+
+        case 't':
+        case 'f':
+        {
+            return ValueType::Bool;
+        }
+
+        case '"':
+        {
+            return ValueType::String;
+        }
+
+        case '[':
+        {
+            return ValueType::Array;
+        }
+
+        case '{':
+        {
+            return ValueType::Object;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+
+    if ((m_data[m_position] == '-') || Internal::isDigit(m_data[m_position]))
+    {
+        return ValueType::Number;
+    }
+
+    return ValueType::Invalid;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigJsonStreamParser::beginObject()
+{
+    if (hasError())
+    {
+        return false;
+    }
+
+    if (!consume('{'))
+    {
+        return setError(QStringLiteral("object expected"));
+    }
+
+    m_firstEntry = true;
+    return enterContainer();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigJsonStreamParser::nextMember(QString *name)
+{
+    if (hasError())
+    {
+        return false;
+    }
+
+    // Check for the end of the Object or for the member separator
+    if (consume('}'))
+    {
+        m_firstEntry = false;
+        m_depth--;
+        return false;
+    }
+
+    if (!m_firstEntry)
+    {
+        if (!consume(','))
+        {
+            return setError(QStringLiteral("unterminated object"));
+        }
+    }
+
+    m_firstEntry = false;
+
+    // Read the member name
+    skipWhitespace();
+
+    if ((m_position >= m_size) || (m_data[m_position] != '"'))
+    {
+        return setError(QStringLiteral("missing name in object member"));
+    }
+
+    if (!scanString(name))
+    {
+        return false;
+    }
+
+    if (!consume(':'))
+    {
+        return setError(QStringLiteral("missing name separator"));
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigJsonStreamParser::beginArray()
+{
+    if (hasError())
+    {
+        return false;
+    }
+
+    if (!consume('['))
+    {
+        return setError(QStringLiteral("array expected"));
+    }
+
+    m_firstEntry = true;
+    return enterContainer();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigJsonStreamParser::nextItem()
+{
+    if (hasError())
+    {
+        return false;
+    }
+
+    // Check for the end of the Array or for the item separator
+    if (consume(']'))
+    {
+        m_firstEntry = false;
+        m_depth--;
+        return false;
+    }
+
+    if (!m_firstEntry)
+    {
+        if (!consume(','))
+        {
+            return setError(QStringLiteral("unterminated array"));
+        }
+    }
+
+    m_firstEntry = false;
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigJsonStreamParser::readString(QString *value)
+{
+    if (peekValueType() != ValueType::String)
+    {
+        return setError(QStringLiteral("string expected"));
+    }
+
+    return scanString(value);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigJsonStreamParser::readValue(QJsonValue *value)
+{
+    switch (peekValueType())
+    {
+        case ValueType::Null:
+        {
+            *value = QJsonValue(QJsonValue::Null);
+            return consumeLiteral("null", 4U);
+        }
+
+        case ValueType::Bool:
+        {
+            const bool boolValue = (m_data[m_position] == 't');
+            *value = QJsonValue(boolValue);
+            return boolValue ? consumeLiteral("true", 4U)
+                             : consumeLiteral("false", 5U);
+        }
+
+        case ValueType::Number:
+        {
+            double numberValue = 0.0;
+
+            if (!scanNumber(&numberValue))
+            {
+                return false;
+            }
+
+            *value = QJsonValue(numberValue);
+            return true;
+        }
+
+        case ValueType::String:
+        {
+            QString stringValue;
+
+            if (!scanString(&stringValue))
+            {
+                return false;
+            }
+
+            *value = QJsonValue(stringValue);
+            return true;
+        }
+
+        case ValueType::Array:
+        {
+            QJsonArray array;
+
+            if (!beginArray())
+            {
+                return false;
+            }
+
+            while (nextItem())
+            {
+                QJsonValue item;
+
+                if (!readValue(&item))
+                {
+                    return false;
+                }
+
+                array.append(item);
+            }
+
+            if (hasError())
+            {
+                return false;
+            }
+
+            *value = array;
+            return true;
+        }
+
+        case ValueType::Object:
+        {
+            QJsonObject object;
+            QString name;
+
+            if (!beginObject())
+            {
+                return false;
+            }
+
+            while (nextMember(&name))
+            {
+                QJsonValue memberValue;
+
+                if (!readValue(&memberValue))
+                {
+                    return false;
+                }
+
+                object.insert(name, memberValue);
+            }
+
+            if (hasError())
+            {
+                return false;
+            }
+
+            *value = object;
+            return true;
+        }
+
+        case ValueType::Invalid:
+        {
+            break;
+        }
+    }
+
+    if (hasError())
+    {
+        return false;
+    }
+
+    return setError(QStringLiteral("illegal value"));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigJsonStreamParser::skipValue()
+{
+    switch (peekValueType())
+    {
+        case ValueType::Null:
+        {
+            return consumeLiteral("null", 4U);
+        }
+
+        case ValueType::Bool:
+        {
+            return (m_data[m_position] == 't') ? consumeLiteral("true", 4U)
+                                               : consumeLiteral("false", 5U);
+        }
+
+        case ValueType::Number:
+        {
+            return scanNumber(nullptr);
+        }
+
+        case ValueType::String:
+        {
+            return scanString(nullptr);
+        }
+
+        case ValueType::Array:
+        {
+            if (!beginArray())
+            {
+                return false;
+            }
+
+            while (nextItem())
+            {
+                if (!skipValue())
+                {
+                    return false;
+                }
+            }
+
+            return (!hasError());
+        }
+
+        case ValueType::Object:
+        {
+            if (!beginObject())
+            {
+                return false;
+            }
+
+            while (nextMember(nullptr))
+            {
+                if (!skipValue())
+                {
+                    return false;
+                }
+            }
+
+            return (!hasError());
+        }
+
+        case ValueType::Invalid:
+        {
+            break;
+        }
+    }
+
+    if (hasError())
+    {
+        return false;
+    }
+
+    return setError(QStringLiteral("illegal value"));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigJsonStreamParser::atEnd()
+{
+    if (hasError())
+    {
+        return false;
+    }
+
+    skipWhitespace();
+
+    if (m_position < m_size)
+    {
+        return setError(QStringLiteral("garbage at the end of the document"));
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigJsonStreamParser::setError(const QString &errorString)
+{
+    // Keep the first error
+    if (!hasError())
+    {
+        m_errorString = errorString;
+        m_errorPosition = m_position;
+    }
+
+    return false;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigJsonStreamParser::skipWhitespace()
+{
+    while (m_position < m_size)
+    {
+        const char character = m_data[m_position];
+
+        if ((character != ' ') && (character != '\t') && (character != '\n') && (character != '\r'))
+        {
+            return;
+        }
+
+        m_position++;
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigJsonStreamParser::consume(const char character)
+{
+    skipWhitespace();
+
+    if ((m_position >= m_size) || (m_data[m_position] != character))
+    {
+        return false;
+    }
+
+    m_position++;
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigJsonStreamParser::consumeLiteral(const char *literal, const size_t length)
+{
+    if (((m_size - m_position) < length) ||
+        (std::memcmp(m_data + m_position, literal, length) != 0))
+    {
+        return setError(QStringLiteral("illegal value"));
+    }
+
+    m_position += length;
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigJsonStreamParser::scanNumber(double *value)
+{
+    // Validate the number: -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?
+    const size_t start = m_position;
+    size_t position = m_position;
+
+    if ((position < m_size) && (m_data[position] == '-'))
+    {
+        position++;
+    }
+
+    if ((position < m_size) && (m_data[position] == '0'))
+    {
+        position++;
+    }
+    else if ((position < m_size) && Internal::isDigit(m_data[position]))
+    {
+        while ((position < m_size) && Internal::isDigit(m_data[position]))
+        {
+            position++;
+        }
+    }
+    else
+    {
+        return setError(QStringLiteral("illegal number"));
+    }
+
+    if ((position < m_size) && (m_data[position] == '.'))
+    {
+        position++;
+
+        if ((position >= m_size) || (!Internal::isDigit(m_data[position])))
+        {
+            m_position = position;
+            return setError(QStringLiteral("illegal number"));
+        }
+
+        while ((position < m_size) && Internal::isDigit(m_data[position]))
+        {
+            position++;
+        }
+    }
+
+    if ((position < m_size) && ((m_data[position] == 'e') || (m_data[position] == 'E')))
+    {
+        position++;
+
+        if ((position < m_size) && ((m_data[position] == '+') || (m_data[position] == '-')))
+        {
+            position++;
+        }
+
+        if ((position >= m_size) || (!Internal::isDigit(m_data[position])))
+        {
+            m_position = position;
+            return setError(QStringLiteral("illegal number"));
+        }
+
+        while ((position < m_size) && Internal::isDigit(m_data[position]))
+        {
+            position++;
+        }
+    }
+
+    m_position = position;
+
+    // Convert the number
+    if (value != nullptr)
+    {
+        bool ok = false;
+        *value = QByteArray::fromRawData(m_data + start, static_cast<int>(position - start))
+                 .toDouble(&ok);
+
+        if (!ok)
+        {
+            m_position = start;
+            return setError(QStringLiteral("illegal number"));
+        }
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigJsonStreamParser::scanString(QString *value)
+{
+    Q_ASSERT(m_data[m_position] == '"');
+    m_position++;
+
+    // Find the end of the string (fast path for strings without escape sequences)
+    const size_t start = m_position;
+    size_t position = m_position;
+
+    while ((position < m_size) && (m_data[position] != '"') && (m_data[position] != '\\'))
+    {
+        if (static_cast<uchar>(m_data[position]) < 0x20U)
+        {
+            m_position = position;
+            return setError(QStringLiteral("illegal value"));
+        }
+
+        position++;
+    }
+
+    if (position >= m_size)
+    {
+        m_position = position;
+        return setError(QStringLiteral("unterminated string"));
+    }
+
+    if (m_data[position] == '"')
+    {
+        if (value != nullptr)
+        {
+            *value = QString::fromUtf8(m_data + start, static_cast<int>(position - start));
+        }
+
+        m_position = position + 1U;
+        return true;
+    }
+
+    // Decode the escape sequences
+    QByteArray output;
+
+    if (value != nullptr)
+    {
+        output.append(m_data + start, static_cast<int>(position - start));
+    }
+
+    while (position < m_size)
+    {
+        const char character = m_data[position];
+
+        if (character == '"')
+        {
+            if (value != nullptr)
+            {
+                *value = QString::fromUtf8(output.constData(), output.size());
+            }
+
+            m_position = position + 1U;
+            return true;
+        }
+
+        if (static_cast<uchar>(character) < 0x20U)
+        {
+            m_position = position;
+            return setError(QStringLiteral("illegal value"));
+        }
+
+        if (character != '\\')
+        {
+            if (value != nullptr)
+            {
+                output.append(character);
+            }
+
+            position++;
+            continue;
+        }
+
+        // Escape sequence
+        position++;
+
+        if (position >= m_size)
+        {
+            break;
+        }
+
+        char decoded = 0;
+
+        switch (m_data[position])
+        {
+            case '"':
+            case '\\':
+            case '/':
+            {
+                decoded = m_data[position];
+                break;
+            }
+
+            case 'b':
+            {
+                decoded = '\b';
+                break;
+            }
+
+            case 'f':
+            {
+                decoded = '\f';
+                break;
+            }
+
+            case 'n':
+            {
+                decoded = '\n';
+                break;
+            }
+
+            case 'r':
+            {
+                decoded = '\r';
+                break;
+            }
+
+            case 't':
+            {
+                decoded = '\t';
+                break;
+            }
+
+            case 'u':
+            {
+                break;
+            }
+
+            default:
+            {
+                m_position = position;
+                return setError(QStringLiteral("illegal escape sequence"));
+            }
+        }
+
+        if (decoded != 0)
+        {
+            if (value != nullptr)
+            {
+                output.append(decoded);
+            }
+
+            position++;
+            continue;
+        }
+
+        // Unicode escape sequence (surrogate pairs are combined)
+        uint codePoint = 0U;
+
+        for (int i = 0; i < 4; i++)
+        {
+            position++;
+
+            if ((position >= m_size) || (Internal::hexDigitValue(m_data[position]) < 0))
+            {
+                m_position = position;
+                return setError(QStringLiteral("illegal escape sequence"));
+            }
+
+            codePoint = (codePoint << 4U) |
+                        static_cast<uint>(Internal::hexDigitValue(m_data[position]));
+        }
+
+        position++;
+
+        if ((codePoint >= 0xD800U) && (codePoint <= 0xDBFFU) &&
+            ((m_size - position) >= 6U) &&
+            (m_data[position] == '\\') && (m_data[position + 1U] == 'u'))
+        {
+            uint lowSurrogate = 0U;
+            bool valid = true;
+
+            for (size_t i = 2U; i < 6U; i++)
+            {
+                const int digit = Internal::hexDigitValue(m_data[position + i]);
+                valid = valid && (digit >= 0);
+                lowSurrogate = (lowSurrogate << 4U) | static_cast<uint>(digit);
+            }
+
+            if (valid && (lowSurrogate >= 0xDC00U) && (lowSurrogate <= 0xDFFFU))
+            {
+                codePoint = 0x10000U + ((codePoint - 0xD800U) << 10U) + (lowSurrogate - 0xDC00U);
+                position += 6U;
+            }
+        }
+
+        if (value != nullptr)
+        {
+            Internal::appendUtf8(codePoint, &output);
+        }
+    }
+
+    m_position = position;
+    return setError(QStringLiteral("unterminated string"));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigJsonStreamParser::enterContainer()
+{
+    m_depth++;
+
+    if (m_depth > MAX_DEPTH)
+    {
+        return setError(QStringLiteral("too deeply nested document"));
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+namespace Internal
+{
+
+bool isDigit(const char character)
+{
+    return ((character >= '0') && (character <= '9'));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int hexDigitValue(const char character)
+{
+    if ((character >= '0') && (character <= '9'))
+    {
+        return (character - '0');
+    }
+
+    if ((character >= 'a') && (character <= 'f'))
+    {
+        return (character - 'a' + 10);
+    }
+
+    if ((character >= 'A') && (character <= 'F'))
+    {
+        return (character - 'A' + 10);
+    }
+
+    return -1;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void appendUtf8(const uint codePoint, QByteArray *output)
+{
+    if (codePoint < 0x80U)
+    {
+        output->append(static_cast<char>(codePoint));
+    }
+    else if (codePoint < 0x800U)
+    {
+        output->append(static_cast<char>(0xC0U | (codePoint >> 6U)));
+        output->append(static_cast<char>(0x80U | (codePoint & 0x3FU)));
+    }
+    else if (codePoint < 0x10000U)
+    {
+        output->append(static_cast<char>(0xE0U | (codePoint >> 12U)));
+        output->append(static_cast<char>(0x80U | ((codePoint >> 6U) & 0x3FU)));
+        output->append(static_cast<char>(0x80U | (codePoint & 0x3FU)));
+    }
+    else
+    {
+        output->append(static_cast<char>(0xF0U | (codePoint >> 18U)));
+        output->append(static_cast<char>(0x80U | ((codePoint >> 12U) & 0x3FU)));
+        output->append(static_cast<char>(0x80U | ((codePoint >> 6U) & 0x3FU)));
+        output->append(static_cast<char>(0x80U | (codePoint & 0x3FU)));
+    }
+}
+
+} // namespace Internal
+
+} // namespace CppConfigFramework
@@ -0,0 +1,383 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a container for the members of an Object configuration node
+ */
+
+// Own header
+#include <CppConfigFramework/ConfigMemberStorage.hpp>
+
+// C++ Config Framework includes
+
+// Qt includes
+
+// System includes
+#include <algorithm>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+namespace Internal
+{
+
+bool memberNameLessThan(const ConfigMemberStorage::Member &member,
+                        const ConfigNameTable::Atom name);
+
+} // namespace Internal
+
+// -------------------------------------------------------------------------------------------------
+
+constexpr int ConfigMemberStorage::HASH_INDEX_THRESHOLD;
+
+// -------------------------------------------------------------------------------------------------
+
+int ConfigMemberStorage::count() const
+{
+    return static_cast<int>(m_members.size());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigMemberStorage::hasHashIndex() const
+{
+    return (!m_hashIndex.empty());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const ConfigNode *ConfigMemberStorage::find(const ConfigNameTable::Atom name) const
+{
+    const int index = indexOf(name);
+
+    if (index < 0)
+    {
+        return nullptr;
+    }
+
+    return m_members[static_cast<size_t>(index)].node.get();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNode *ConfigMemberStorage::find(const ConfigNameTable::Atom name)
+{
+    const auto *constThis = this;
+    return const_cast<ConfigNode *>(constThis->find(name));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigNode> ConfigMemberStorage::insert(const ConfigNameTable::Atom name,
+                                                        std::unique_ptr<ConfigNode> node)
+{
+    // Replace the existing member
+    const int index = indexOf(name);
+
+    if (index >= 0)
+    {
+        std::swap(m_members[static_cast<size_t>(index)].node, node);
+        return node;
+    }
+
+    // Insert a new member
+    if (m_hashIndex.empty())
+    {
+        // Keep the members sorted
+        auto it = std::lower_bound(m_members.begin(),
+                                   m_members.end(),
+                                   name,
+                                   Internal::memberNameLessThan);
+        m_members.insert(it, Member { name, std::move(node) });
+
+        if (count() > HASH_INDEX_THRESHOLD)
+        {
+            rebuildHashIndex();
+        }
+
+        return {};
+    }
+
+    m_members.push_back(Member { name, std::move(node) });
+
+    // Keep the load factor of the hash index at or below 50%
+    if ((m_members.size() * 2U) > m_hashIndex.size())
+    {
+        rebuildHashIndex();
+        return {};
+    }
+
+    const size_t mask = m_hashIndex.size() - 1U;
+    size_t slot = hashSlot(name);
+
+    while (m_hashIndex[slot] != 0U)
+    {
+        slot = (slot + 1U) & mask;
+    }
+
+    m_hashIndex[slot] = static_cast<quint32>(m_members.size());
+    return {};
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigNode> ConfigMemberStorage::remove(const ConfigNameTable::Atom name)
+{
+    const int index = indexOf(name);
+
+    if (index < 0)
+    {
+        return {};
+    }
+
+    auto node = std::move(m_members[static_cast<size_t>(index)].node);
+
+    if (m_hashIndex.empty())
+    {
+        m_members.erase(m_members.begin() + index);
+        return node;
+    }
+
+    // Switch back to sorted members when the number of members drops well below the threshold
+    if (count() <= (HASH_INDEX_THRESHOLD / 2))
+    {
+        m_members.erase(m_members.begin() + index);
+        m_hashIndex.clear();
+
+        std::sort(m_members.begin(),
+                  m_members.end(),
+                  [](const Member &left, const Member &right)
+                  {
+                      return (left.name < right.name);
+                  });
+        return node;
+    }
+
+    // Remove the member's slot from the hash index by shifting back the slots that follow it in
+    // the same probe sequence
+    const size_t mask = m_hashIndex.size() - 1U;
+    const quint32 removedEntry = static_cast<quint32>(index + 1);
+    size_t hole = hashSlot(name);
+
+    while (m_hashIndex[hole] != removedEntry)
+    {
+        hole = (hole + 1U) & mask;
+    }
+
+    m_hashIndex[hole] = 0U;
+
+    for (size_t slot = (hole + 1U) & mask; m_hashIndex[slot] != 0U; slot = (slot + 1U) & mask)
+    {
+        const size_t idealSlot = hashSlot(m_members[m_hashIndex[slot] - 1U].name);
+
+        if (((slot - idealSlot) & mask) >= ((slot - hole) & mask))
+        {
+            m_hashIndex[hole] = m_hashIndex[slot];
+            m_hashIndex[slot] = 0U;
+            hole = slot;
+        }
+    }
+
+    // Move the last member to the freed position and update its slot
+    const quint32 lastEntry = static_cast<quint32>(m_members.size());
+
+    if (removedEntry != lastEntry)
+    {
+        size_t slot = hashSlot(m_members.back().name);
+
+        while (m_hashIndex[slot] != lastEntry)
+        {
+            slot = (slot + 1U) & mask;
+        }
+
+        m_hashIndex[slot] = removedEntry;
+        m_members[static_cast<size_t>(index)] = std::move(m_members.back());
+    }
+
+    m_members.pop_back();
+    return node;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigMemberStorage::clear()
+{
+    m_members.clear();
+    m_hashIndex.clear();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigMemberStorage::const_iterator ConfigMemberStorage::begin() const
+{
+    return m_members.begin();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigMemberStorage::const_iterator ConfigMemberStorage::end() const
+{
+    return m_members.end();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int ConfigMemberStorage::indexOf(const ConfigNameTable::Atom name) const
+{
+    // Binary search in sorted members
+    if (m_hashIndex.empty())
+    {
+        auto it = std::lower_bound(m_members.begin(),
+                                   m_members.end(),
+                                   name,
+                                   Internal::memberNameLessThan);
+
+        if ((it == m_members.end()) || (it->name != name))
+        {
+            return -1;
+        }
+
+        return static_cast<int>(it - m_members.begin());
+    }
+
+    // Lookup through the hash index
+    const size_t mask = m_hashIndex.size() - 1U;
+
+    for (size_t slot = hashSlot(name); m_hashIndex[slot] != 0U; slot = (slot + 1U) & mask)
+    {
+        const quint32 index = m_hashIndex[slot] - 1U;
+
+        if (m_members[index].name == name)
+        {
+            return static_cast<int>(index);
+        }
+    }
+
+    return -1;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+size_t ConfigMemberStorage::hashSlot(const ConfigNameTable::Atom name) const
+{
+    // Fibonacci hashing with the upper bits mixed into the lower bits (hash index size is always a
+    // power of two)
+    quint32 hash = name * 0x9E3779B1U;
+    hash ^= (hash >> 16);
+
+    return (static_cast<size_t>(hash) & (m_hashIndex.size() - 1U));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigMemberStorage::rebuildHashIndex()
+{
+    size_t size = static_cast<size_t>(HASH_INDEX_THRESHOLD) * 2U;
+
+    while (size < (m_members.size() * 2U))
+    {
+        size *= 2U;
+    }
+
+    m_hashIndex.assign(size, 0U);
+
+    const size_t mask = size - 1U;
+
+    for (size_t i = 0; i < m_members.size(); i++)
+    {
+        size_t slot = hashSlot(m_members[i].name);
+
+        while (m_hashIndex[slot] != 0U)
+        {
+            slot = (slot + 1U) & mask;
+        }
+
+        m_hashIndex[slot] = static_cast<quint32>(i + 1U);
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+namespace Internal
+{
+
+bool memberNameLessThan(const ConfigMemberStorage::Member &member,
+                        const ConfigNameTable::Atom name)
+{
+    return (member.name < name);
+}
+
+} // namespace Internal
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigSortedMembers::ConfigSortedMembers(const ConfigMemberStorage &members)
+    : m_members(nullptr),
+      m_count(static_cast<size_t>(members.count()))
+{
+    if (m_count == 0U)
+    {
+        return;
+    }
+
+    if (!members.hasHashIndex())
+    {
+        // Members without a hash index are already sorted by the atoms of their names
+        m_members = &(*members.begin());
+        return;
+    }
+
+    m_sortedMembers.reserve(m_count);
+
+    for (const auto &member : members)
+    {
+        m_sortedMembers.push_back(&member);
+    }
+
+    std::sort(m_sortedMembers.begin(),
+              m_sortedMembers.end(),
+              [](const ConfigMemberStorage::Member *left, const ConfigMemberStorage::Member *right)
+              {
+                  return (left->name < right->name);
+              });
+}
+
+// -------------------------------------------------------------------------------------------------
+
+size_t ConfigSortedMembers::count() const
+{
+    return m_count;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const ConfigMemberStorage::Member &ConfigSortedMembers::at(const size_t index) const
+{
+    if (m_members != nullptr)
+    {
+        return m_members[index];
+    }
+
+    return *m_sortedMembers[index];
+}
+
+} // namespace CppConfigFramework
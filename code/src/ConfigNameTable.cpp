@@ -0,0 +1,302 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a process-wide table of interned configuration node names
+ */
+
+// Own header
+#include <CppConfigFramework/ConfigNameTable.hpp>
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigNodePath.hpp>
+
+// Qt includes
+#include <QtCore/QHash>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+constexpr ConfigNameTable::Atom ConfigNameTable::INVALID_ATOM;
+constexpr quint32 ConfigNameTable::FIRST_CHUNK_SIZE;
+constexpr size_t ConfigNameTable::MAX_CHUNK_COUNT;
+constexpr quint32 ConfigNameTable::INITIAL_INDEX_CAPACITY;
+
+// -------------------------------------------------------------------------------------------------
+
+/*!
+ * Gets the location of the node name in the chunked node name storage
+ *
+ * \param   nameIndex       Index of the node name (atom decremented by 1)
+ * \param   firstChunkSize  Number of node names in the first chunk
+ *
+ * \param[out]  chunk   Index of the chunk
+ * \param[out]  offset  Offset of the node name in the chunk
+ *
+ * Chunk N holds (FIRST_CHUNK_SIZE * 2^N) node names.
+ */
+static void chunkLocation(const quint32 nameIndex,
+                          const quint32 firstChunkSize,
+                          size_t *chunk,
+                          quint32 *offset)
+{
+    const quint64 blocks = (static_cast<quint64>(nameIndex) / firstChunkSize) + 1U;
+    size_t chunkIndex = 0U;
+
+    while ((blocks >> (chunkIndex + 1U)) != 0U)
+    {
+        chunkIndex++;
+    }
+
+    *chunk = chunkIndex;
+    *offset = nameIndex - (firstChunkSize * ((1U << chunkIndex) - 1U));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNameTable::Index::Index(const quint32 capacity)
+    : mask(capacity - 1U),
+      slots(new std::atomic<Atom>[capacity])
+{
+    for (quint32 i = 0U; i < capacity; i++)
+    {
+        slots[i].store(INVALID_ATOM, std::memory_order_relaxed);
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNameTable::ConfigNameTable()
+    : m_count(0U),
+      m_nameLength(0U),
+      m_index(nullptr)
+{
+    for (auto &chunk : m_chunks)
+    {
+        chunk.store(nullptr, std::memory_order_relaxed);
+    }
+
+    m_indexes.push_back(std::make_unique<Index>(INITIAL_INDEX_CAPACITY));
+    m_index.store(m_indexes.back().get(), std::memory_order_release);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNameTable::~ConfigNameTable()
+{
+    for (auto &chunk : m_chunks)
+    {
+        delete[] chunk.load(std::memory_order_relaxed);
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNameTable *ConfigNameTable::instance()
+{
+    static ConfigNameTable table;
+
+    return &table;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNameTable::Atom ConfigNameTable::intern(const QString &name)
+{
+    // Check if the node name is already interned (most common case)
+    const Atom existingAtom = find(name);
+
+    if (existingAtom != INVALID_ATOM)
+    {
+        return existingAtom;
+    }
+
+    // Only valid node names can be interned
+    if (!ConfigNodePath::validateNodeName(name))
+    {
+        return INVALID_ATOM;
+    }
+
+    // Intern the node name (check again since it could have been interned in the meantime)
+    QMutexLocker locker(&m_mutex);
+
+    const Index *index = m_index.load(std::memory_order_relaxed);
+    const Atom internedAtom = findInIndex(*index, name);
+
+    if (internedAtom != INVALID_ATOM)
+    {
+        return internedAtom;
+    }
+
+    const quint32 count = m_count.load(std::memory_order_relaxed);
+
+    size_t chunk = 0U;
+    quint32 offset = 0U;
+    chunkLocation(count, FIRST_CHUNK_SIZE, &chunk, &offset);
+
+    if (chunk >= MAX_CHUNK_COUNT)
+    {
+        // The node name storage is full
+        return INVALID_ATOM;
+    }
+
+    // Store the node name
+    QString *chunkNames = m_chunks[chunk].load(std::memory_order_relaxed);
+
+    if (chunkNames == nullptr)
+    {
+        chunkNames = new QString[FIRST_CHUNK_SIZE << chunk];
+        m_chunks[chunk].store(chunkNames, std::memory_order_release);
+    }
+
+    chunkNames[offset] = name;
+    m_nameLength.fetch_add(static_cast<quint64>(name.size()), std::memory_order_relaxed);
+
+    const Atom atom = count + 1U;
+    m_count.store(atom, std::memory_order_release);
+
+    // Add the node name to the index (keep the load factor at or below 1/2)
+    if ((static_cast<quint64>(atom) * 2U) > (static_cast<quint64>(index->mask) + 1U))
+    {
+        auto grownIndex = std::make_unique<Index>((index->mask + 1U) * 2U);
+
+        for (Atom i = 1U; i <= atom; i++)
+        {
+            insertToIndex(storedName(i), i, grownIndex.get());
+        }
+
+        m_index.store(grownIndex.get(), std::memory_order_release);
+        m_indexes.push_back(std::move(grownIndex));
+    }
+    else
+    {
+        insertToIndex(name, atom, m_indexes.back().get());
+    }
+
+    return atom;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNameTable::Atom ConfigNameTable::find(const QString &name) const
+{
+    return findInIndex(*m_index.load(std::memory_order_acquire), name);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const QString &ConfigNameTable::name(const Atom atom) const
+{
+    static const QString s_invalidName;
+
+    if ((atom == INVALID_ATOM) || (atom > m_count.load(std::memory_order_acquire)))
+    {
+        return s_invalidName;
+    }
+
+    return storedName(atom);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int ConfigNameTable::count() const
+{
+    return static_cast<int>(m_count.load(std::memory_order_acquire));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+size_t ConfigNameTable::memoryUsage() const
+{
+    QMutexLocker locker(&m_mutex);
+
+    size_t usage =
+            static_cast<size_t>(m_nameLength.load(std::memory_order_relaxed)) * sizeof(QChar);
+
+    for (size_t chunk = 0U; chunk < MAX_CHUNK_COUNT; chunk++)
+    {
+        if (m_chunks[chunk].load(std::memory_order_relaxed) != nullptr)
+        {
+            usage += (static_cast<size_t>(FIRST_CHUNK_SIZE) << chunk) * sizeof(QString);
+        }
+    }
+
+    for (const auto &index : m_indexes)
+    {
+        usage += (static_cast<size_t>(index->mask) + 1U) * sizeof(std::atomic<Atom>);
+    }
+
+    return usage;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const QString &ConfigNameTable::storedName(const Atom atom) const
+{
+    size_t chunk = 0U;
+    quint32 offset = 0U;
+    chunkLocation(atom - 1U, FIRST_CHUNK_SIZE, &chunk, &offset);
+
+    return m_chunks[chunk].load(std::memory_order_acquire)[offset];
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNameTable::Atom ConfigNameTable::findInIndex(const Index &index, const QString &name) const
+{
+    quint32 slot = static_cast<quint32>(qHash(name)) & index.mask;
+
+    while (true)
+    {
+        const Atom atom = index.slots[slot].load(std::memory_order_acquire);
+
+        if (atom == INVALID_ATOM)
+        {
+            return INVALID_ATOM;
+        }
+
+        if (storedName(atom) == name)
+        {
+            return atom;
+        }
+
+        slot = (slot + 1U) & index.mask;
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigNameTable::insertToIndex(const QString &name, const Atom atom, Index *index)
+{
+    quint32 slot = static_cast<quint32>(qHash(name)) & index->mask;
+
+    while (index->slots[slot].load(std::memory_order_relaxed) != INVALID_ATOM)
+    {
+        slot = (slot + 1U) & index->mask;
+    }
+
+    index->slots[slot].store(atom, std::memory_order_release);
+}
+
+} // namespace CppConfigFramework
@@ -23,6 +23,7 @@
 
 // C++ Config Framework includes
 #include <CppConfigFramework/ConfigDerivedObjectNode.hpp>
+#include <CppConfigFramework/ConfigNodeArena.hpp>
 #include <CppConfigFramework/ConfigNodeReference.hpp>
 #include <CppConfigFramework/ConfigObjectNode.hpp>
 #include <CppConfigFramework/ConfigValueNode.hpp>
@@ -30,6 +31,8 @@
 // Qt includes
 
 // System includes
+#include <algorithm>
+#include <vector>
 
 // Forward declarations
 
@@ -41,12 +44,55 @@ namespace CppConfigFramework
 {
 
 ConfigNode::ConfigNode(ConfigObjectNode *parent)
-    : m_parent(parent)
+    : m_parent(parent),
+      m_memberNameAtom(ConfigNameTable::INVALID_ATOM),
+      m_arenaAllocated(ConfigNodeArena::claim(this))
 {
 }
 
 // -------------------------------------------------------------------------------------------------
 
+ConfigNode::ConfigNode(ConfigNode &&other) noexcept
+    : m_parent(other.m_parent),
+      m_memberNameAtom(other.m_memberNameAtom),
+      m_arenaAllocated(ConfigNodeArena::claim(this))
+{
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNode::~ConfigNode()
+{
+    // The flag is read by operator delete right after the destructor (for nodes that were not
+    // allocated with operator new it is just overwritten by the next node that is destroyed)
+    ConfigNodeArena::prepareDeallocation(m_arenaAllocated);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNode &ConfigNode::operator=(ConfigNode &&other) noexcept
+{
+    m_parent = other.m_parent;
+    m_memberNameAtom = other.m_memberNameAtom;
+    return *this;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void *ConfigNode::operator new(size_t size)
+{
+    return ConfigNodeArena::allocate(size);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigNode::operator delete(void *pointer)
+{
+    ConfigNodeArena::deallocate(pointer);
+}
+
+// -------------------------------------------------------------------------------------------------
+
 bool ConfigNode::isValue() const
 {
     return (type() == Type::Value);
@@ -97,8 +143,23 @@ ConfigObjectNode *ConfigNode::parent()
 // -------------------------------------------------------------------------------------------------
 
 void ConfigNode::setParent(ConfigObjectNode *parent)
+{
+    setParent(parent, ConfigNameTable::INVALID_ATOM);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigNode::setParent(ConfigObjectNode *parent, const ConfigNameTable::Atom memberNameAtom)
 {
     m_parent = parent;
+    m_memberNameAtom = memberNameAtom;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNameTable::Atom ConfigNode::memberNameAtom() const
+{
+    return m_memberNameAtom;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -219,12 +280,24 @@ ConfigNodePath ConfigNode::nodePath() const
         return ConfigNodePath::ROOT_PATH;
     }
 
-    // Get the base path
-    auto basePath = parent()->isRoot() ? ConfigNodePath::ROOT_PATH
-                                       : parent()->nodePath();
+    // Collect all of the ancestors of this node (excluding the root node)
+    std::vector<const ConfigNode *> nodes;
+
+    for (const ConfigNode *node = this; !node->isRoot(); node = node->parent())
+    {
+        nodes.push_back(node);
+    }
+
+    // Append the names of the nodes to the path starting from the root node
+    ConfigNodePath path = ConfigNodePath::ROOT_PATH;
+
+    for (auto it = nodes.rbegin(); it != nodes.rend(); it++)
+    {
+        const ConfigNode *node = *it;
+        path.append(node->parent()->name(*node));
+    }
 
-    // Append the name of this node to the path
-    return basePath.append(parent()->name(*this));
+    return path;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -260,13 +333,31 @@ const ConfigNode *ConfigNode::nodeAtPath(const ConfigNodePath &nodePath) const
         currentNode = this;
     }
 
-    const auto nodeNameList = nodePath.nodeNames();
+    // Members of a clone that is not detached are read from the shared node so their parent is not
+    // the node they were reached from. The nodes visited on the way are therefore remembered when
+    // the path needs to return to them.
+    const auto &segments = nodePath.segments();
+    const bool hasParentSegments =
+            std::any_of(segments.begin(),
+                        segments.end(),
+                        [](const ConfigNodePath::Segment &segment)
+    {
+        return (segment.type == ConfigNodePath::SegmentType::Parent);
+    });
+    std::vector<const ConfigNode *> visitedNodes;
 
-    for (const QString &nodeName : nodeNameList)
+    for (const auto &segment : segments)
     {
         // Check if parent node is referenced
-        if (nodeName == ConfigNodePath::PARENT_PATH_VALUE)
+        if (segment.type == ConfigNodePath::SegmentType::Parent)
         {
+            if (!visitedNodes.empty())
+            {
+                currentNode = visitedNodes.back();
+                visitedNodes.pop_back();
+                continue;
+            }
+
             if (currentNode->isRoot())
             {
                 // Error: parent of the root node was requested
@@ -284,7 +375,12 @@ const ConfigNode *ConfigNode::nodeAtPath(const ConfigNodePath &nodePath) const
             return nullptr;
         }
 
-        currentNode = currentNode->toObject().member(nodeName);
+        if (hasParentSegments)
+        {
+            visitedNodes.push_back(currentNode);
+        }
+
+        currentNode = currentNode->toObject().member(segment.name);
 
         if (currentNode == nullptr)
         {
@@ -307,8 +403,67 @@ const ConfigNode *ConfigNode::nodeAtPath(const QString &nodePath) const
 
 ConfigNode *ConfigNode::nodeAtPath(const ConfigNodePath &nodePath)
 {
-    auto constThis = static_cast<const ConfigNode*>(this);
-    return const_cast<ConfigNode *>(constThis->nodeAtPath(nodePath));
+    // The non-const members are used so that the returned node really belongs to this tree (the
+    // members of clones on the way are copied) and can be modified
+    if (!nodePath.isValid())
+    {
+        return nullptr;
+    }
+
+    if (nodePath.isRoot())
+    {
+        return rootNode();
+    }
+
+    ConfigNode *currentNode = nullptr;
+
+    if (nodePath.isAbsolute())
+    {
+        currentNode = rootNode();
+
+        if (currentNode == nullptr)
+        {
+            // Error, the root node is not an Object
+            return nullptr;
+        }
+    }
+    else
+    {
+        currentNode = this;
+    }
+
+    for (const auto &segment : nodePath.segments())
+    {
+        // Check if parent node is referenced
+        if (segment.type == ConfigNodePath::SegmentType::Parent)
+        {
+            if (currentNode->isRoot())
+            {
+                // Error: parent of the root node was requested
+                return nullptr;
+            }
+
+            currentNode = currentNode->parent();
+            continue;
+        }
+
+        // Get the specified member node
+        if (!currentNode->isObject())
+        {
+            // Error, invalid node type
+            return nullptr;
+        }
+
+        currentNode = currentNode->toObject().member(segment.name);
+
+        if (currentNode == nullptr)
+        {
+            // Error, node was not found
+            return nullptr;
+        }
+    }
+
+    return currentNode;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -348,4 +503,43 @@ QString ConfigNode::typeToString(const ConfigNode::Type type)
     return {};
 }
 
+// -------------------------------------------------------------------------------------------------
+
+void ConfigNode::prepareForModification()
+{
+    // Check if any of the nodes has clones (common case is that none of them has)
+    bool hasSharedClones = false;
+
+    for (ConfigNode *node = this; node != nullptr; node = node->parent())
+    {
+        if (node->isObject() && (!node->toObject().m_sharedClones.empty()))
+        {
+            hasSharedClones = true;
+            break;
+        }
+    }
+
+    if (!hasSharedClones)
+    {
+        return;
+    }
+
+    // Detach the clones starting from the root node since detaching clones of an ancestor creates
+    // new clones of its descendants
+    std::vector<ConfigObjectNode *> nodes;
+
+    for (ConfigNode *node = this; node != nullptr; node = node->parent())
+    {
+        if (node->isObject())
+        {
+            nodes.push_back(&node->toObject());
+        }
+    }
+
+    for (auto it = nodes.rbegin(); it != nodes.rend(); it++)
+    {
+        (*it)->detachSharedClones();
+    }
+}
+
 } // namespace CppConfigFramework
@@ -0,0 +1,298 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains an arena (monotonic buffer) allocator for configuration nodes
+ */
+
+// Own header
+#include <CppConfigFramework/ConfigNodeArena.hpp>
+
+// C++ Config Framework includes
+
+// Qt includes
+
+// System includes
+#include <algorithm>
+#include <iterator>
+#include <new>
+#include <vector>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+namespace Internal
+{
+
+//! Holds the header of each memory block allocated from an arena
+struct BlockHeader
+{
+    //! Arena from which the block was allocated
+    ConfigNodeArena *arena;
+};
+
+//! Size of the memory block header (keeps the allocated memory suitably aligned for any type)
+constexpr size_t BLOCK_HEADER_SIZE =
+        ((sizeof(BlockHeader) + alignof(std::max_align_t) - 1U) / alignof(std::max_align_t)) *
+        alignof(std::max_align_t);
+
+//! Holds the arena that is active for the current thread
+thread_local ConfigNodeArena *currentArena = nullptr;
+
+//! Holds the blocks allocated from an arena in the current thread that were not claimed yet
+thread_local std::vector<void *> unclaimedBlocks;
+
+//! Holds the flag that tells if the node that is being destroyed was allocated from an arena
+thread_local bool deallocatingArenaBlock = false;
+
+size_t alignedSize(const size_t size);
+
+} // namespace Internal
+
+// -------------------------------------------------------------------------------------------------
+
+constexpr size_t ConfigNodeArena::DEFAULT_CHUNK_SIZE;
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNodeArena *ConfigNodeArena::current()
+{
+    return Internal::currentArena;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void *ConfigNodeArena::allocate(const size_t size)
+{
+    ConfigNodeArena *arena = current();
+
+    if (arena == nullptr)
+    {
+        // Nodes allocated from the heap don't need a header
+        return ::operator new(size);
+    }
+
+    const size_t blockSize = Internal::BLOCK_HEADER_SIZE + Internal::alignedSize(size);
+    char *block = static_cast<char *>(arena->allocateBlock(blockSize));
+    void *pointer = block + Internal::BLOCK_HEADER_SIZE;
+
+    // Remember the block until the constructor of the node claims it
+    Internal::unclaimedBlocks.push_back(pointer);
+
+    reinterpret_cast<Internal::BlockHeader *>(block)->arena = arena;
+    arena->addReference();
+    arena->m_allocationCount++;
+    return pointer;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigNodeArena::claim(const void *pointer)
+{
+    auto &blocks = Internal::unclaimedBlocks;
+
+    if (blocks.empty())
+    {
+        return false;
+    }
+
+    // The block is usually the last one that was allocated
+    auto it = std::find(blocks.rbegin(), blocks.rend(), pointer);
+
+    if (it == blocks.rend())
+    {
+        return false;
+    }
+
+    blocks.erase(std::next(it).base());
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigNodeArena::prepareDeallocation(const bool arenaAllocated)
+{
+    Internal::deallocatingArenaBlock = arenaAllocated;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigNodeArena::deallocate(void *pointer)
+{
+    if (pointer == nullptr)
+    {
+        return;
+    }
+
+    // Memory of a node whose constructor failed was never claimed, otherwise the destructor of the
+    // node has just told if the memory was allocated from an arena
+    bool arenaAllocated = claim(pointer);
+
+    if (!arenaAllocated)
+    {
+        arenaAllocated = Internal::deallocatingArenaBlock;
+    }
+
+    Internal::deallocatingArenaBlock = false;
+
+    if (!arenaAllocated)
+    {
+        ::operator delete(pointer);
+        return;
+    }
+
+    // Memory of the block is released together with the rest of the arena
+    char *block = static_cast<char *>(pointer) - Internal::BLOCK_HEADER_SIZE;
+    reinterpret_cast<Internal::BlockHeader *>(block)->arena->releaseReference();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+size_t ConfigNodeArena::chunkCount() const
+{
+    return m_chunks.size();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+size_t ConfigNodeArena::allocationCount() const
+{
+    return m_allocationCount;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNodeArena::ConfigNodeArena(const size_t chunkSize)
+    : m_chunkSize(Internal::alignedSize(chunkSize)),
+      m_chunkPosition(0U),
+      m_allocationCount(0U),
+      m_references(1U)
+{
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void *ConfigNodeArena::allocateBlock(const size_t size)
+{
+    // Blocks that don't fit in a chunk get their own chunk (it is put in front of the last chunk so
+    // that the remaining memory in the last chunk can still be used)
+    if (size > m_chunkSize)
+    {
+        std::unique_ptr<char[]> chunk(new char[size]);
+        char *block = chunk.get();
+
+        m_chunks.insert(m_chunks.empty() ? m_chunks.end() : (m_chunks.end() - 1),
+                        std::move(chunk));
+        return block;
+    }
+
+    // Allocate a new chunk if there is not enough memory left in the last chunk
+    if (m_chunks.empty() || ((m_chunkPosition + size) > m_chunkSize))
+    {
+        m_chunks.emplace_back(new char[m_chunkSize]);
+        m_chunkPosition = 0U;
+    }
+
+    char *block = m_chunks.back().get() + m_chunkPosition;
+    m_chunkPosition += size;
+    return block;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigNodeArena::addReference()
+{
+    m_references.fetch_add(1U, std::memory_order_relaxed);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigNodeArena::releaseReference()
+{
+    if (m_references.fetch_sub(1U, std::memory_order_acq_rel) == 1U)
+    {
+        // Release all of the memory chunks at once
+        delete this;
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNodeArenaScope::ConfigNodeArenaScope(const size_t chunkSize)
+    : m_arena(Internal::currentArena),
+      m_previousArena(Internal::currentArena)
+{
+    if (m_arena == nullptr)
+    {
+        m_arena = new ConfigNodeArena(chunkSize);
+        Internal::currentArena = m_arena;
+    }
+    else
+    {
+        m_arena->addReference();
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNodeArenaScope::~ConfigNodeArenaScope()
+{
+    Internal::currentArena = m_previousArena;
+    m_arena->releaseReference();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const ConfigNodeArena *ConfigNodeArenaScope::arena() const
+{
+    return m_arena;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNodeHeapScope::ConfigNodeHeapScope()
+    : m_previousArena(Internal::currentArena)
+{
+    Internal::currentArena = nullptr;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNodeHeapScope::~ConfigNodeHeapScope()
+{
+    Internal::currentArena = m_previousArena;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+namespace Internal
+{
+
+size_t alignedSize(const size_t size)
+{
+    return ((size + alignof(std::max_align_t) - 1U) / alignof(std::max_align_t)) *
+            alignof(std::max_align_t);
+}
+
+} // namespace Internal
+
+} // namespace CppConfigFramework
@@ -25,7 +25,6 @@
 #include <CppConfigFramework/LoggingCategories.hpp>
 
 // Qt includes
-#include <QtCore/QRegularExpression>
 #include <QtCore/QStringBuilder>
 
 // System includes
@@ -53,6 +52,7 @@ static const QChar NODE_PATH_SEPARATOR = QChar('/');
 ConfigNodePath::ConfigNodePath(const QString &path)
     : m_path(path)
 {
+    parse();
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -66,7 +66,7 @@ bool ConfigNodePath::isRoot() const
 
 bool ConfigNodePath::isAbsolute() const
 {
-    return m_path.startsWith(NODE_PATH_SEPARATOR);
+    return m_absolute;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -80,95 +80,31 @@ bool ConfigNodePath::isRelative() const
         return false;
     }
 
-    return (!isAbsolute());
+    return (!m_absolute);
 }
 
 // -------------------------------------------------------------------------------------------------
 
 bool ConfigNodePath::isValid() const
 {
-    // Check for an empty
-    if (m_path.isEmpty())
-    {
-        // Error, an empty path is not valid
-        return false;
-    }
-
-    // Check for "root" path
-    if (isRoot())
-    {
-        return true;
-    }
-
-    // Use different algorithms for absolute and relative path validation
-    const auto nodeNameList = nodeNames();
-
-    if (isAbsolute())
-    {
-        // Make sure that the individual node names are valid and that there is no attempt to access
-        // the parent node of the root node
-        unsigned int depth = 0;
-
-        for (const QString &nodeName : nodeNameList)
-        {
-            if (nodeName == PARENT_PATH_VALUE)
-            {
-                if (depth == 0)
-                {
-                    // Error, the root node does not have a parent node
-                    return false;
-                }
-
-                depth--;
-                continue;
-            }
-
-            if (!validateNodeName(nodeName))
-            {
-                // Error, invalid node name
-                return false;
-            }
-
-            depth++;
-        }
-    }
-    else
-    {
-        // Make sure that just the individual node names are valid
-        for (const QString &nodeName : nodeNameList)
-        {
-            if ((nodeName != PARENT_PATH_VALUE) && (!validateNodeName(nodeName)))
-            {
-                return false;
-            }
-        }
-    }
-
-    return true;
+    return m_valid;
 }
 
 // -------------------------------------------------------------------------------------------------
 
 bool ConfigNodePath::hasUnresolvedReferences() const
 {
-    // Check for an empty
-    if (m_path.isEmpty())
-    {
-        // Error, an empty path is not valid
-        return false;
-    }
-
-    // Check for "root" path
-    if (isRoot())
+    // Check if ".." is the only node, the first node, middle node or the last node (empty and "root"
+    // paths don't have any segments)
+    for (const auto &segment : m_segments)
     {
-        return false;
+        if (segment.type == SegmentType::Parent)
+        {
+            return true;
+        }
     }
 
-    // Check if ".." is the only node, the first node, middle node or the last node
-    static const QRegularExpression s_regex(QStringLiteral("(?>^|\\/)\\.\\.(?>\\/|$)"));
-
-    auto match = s_regex.match(m_path);
-    return match.hasMatch();
+    return false;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -183,81 +119,53 @@ bool ConfigNodePath::resolveReferences()
     }
 
     // Use different algorithms for absolute and relative path validation
-    const auto nodeNameList = nodeNames();
+    std::vector<Segment> workingSegments;
+    workingSegments.reserve(m_segments.size());
 
-    if (isAbsolute())
+    for (const auto &segment : m_segments)
     {
-        // Make sure that the individual node names are valid and that there is no attempt to access
-        // the parent node of the root node
-        QStringList workingNodeNames;
-
-        for (const QString &nodeName : nodeNameList)
+        if (segment.name.isEmpty())
         {
-            if (nodeName.isEmpty())
-            {
-                // Error, empty node name is not allowed
-                return false;
-            }
+            // Error, empty node name is not allowed
+            return false;
+        }
 
-            if (nodeName == PARENT_PATH_VALUE)
+        if (segment.type == SegmentType::Parent)
+        {
+            if (m_absolute)
             {
-                if (workingNodeNames.isEmpty())
+                // Make sure that there is no attempt to access the parent node of the root node
+                if (workingSegments.empty())
                 {
                     // Error, the root node does not have a parent node
                     return false;
                 }
 
-                workingNodeNames.removeLast();
+                workingSegments.pop_back();
                 continue;
             }
 
-            workingNodeNames.append(nodeName);
-        }
-
-        if (workingNodeNames.isEmpty())
-        {
-            m_path = ROOT_PATH_VALUE;
-        }
-        else
-        {
-            m_path = NODE_PATH_SEPARATOR % workingNodeNames.join(NODE_PATH_SEPARATOR);
-        }
-    }
-    else
-    {
-        // Make sure that just the individual node names are valid
-        QStringList workingNodeNames;
-
-        for (const QString &nodeName : nodeNameList)
-        {
-            if (nodeName.isEmpty())
-            {
-                // Error, empty node name is not allowed
-                return false;
-            }
-
-            if (nodeName == PARENT_PATH_VALUE)
+            // Only remove the node name if the last node in it is a non-parent node reference
+            if ((!workingSegments.empty()) &&
+                (workingSegments.back().type != SegmentType::Parent))
             {
-                // Only remove the node name if the last node in it is a non-parent node reference
-                if ((!workingNodeNames.isEmpty()) && (workingNodeNames.last() != PARENT_PATH_VALUE))
-                {
-                    workingNodeNames.removeLast();
-                    continue;
-                }
+                workingSegments.pop_back();
+                continue;
             }
-
-            workingNodeNames.append(nodeName);
         }
 
-        if (workingNodeNames.isEmpty())
-        {
-            // Error, empty result
-            return false;
-        }
+        workingSegments.push_back(segment);
+    }
 
-        m_path = workingNodeNames.join(NODE_PATH_SEPARATOR);
+    if ((!m_absolute) && workingSegments.empty())
+    {
+        // Error, empty result
+        return false;
     }
 
+    m_segments = std::move(workingSegments);
+    updateValue();
+    m_valid = checkValidity();
     return true;
 }
 
@@ -273,14 +181,29 @@ QString ConfigNodePath::path() const
 void ConfigNodePath::setPath(const QString &path)
 {
     m_path = path;
+    parse();
 }
 
 // -------------------------------------------------------------------------------------------------
 
 QStringList ConfigNodePath::nodeNames() const
 {
-    return (isAbsolute() ? m_path.mid(1).split(NODE_PATH_SEPARATOR)
-                         : m_path.split(NODE_PATH_SEPARATOR));
+    QStringList nodeNameList;
+    nodeNameList.reserve(static_cast<int>(m_segments.size()));
+
+    for (const auto &segment : m_segments)
+    {
+        nodeNameList.append(segment.name);
+    }
+
+    return nodeNameList;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const std::vector<ConfigNodePath::Segment> &ConfigNodePath::segments() const
+{
+    return m_segments;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -324,10 +247,10 @@ ConfigNodePath ConfigNodePath::append(const QString &nodeName) const
 ConfigNodePath &ConfigNodePath::append(const QString &nodeName)
 {
     // Make sure that this node path and the specified node name are valid
-    if ((!isValid()) || (!validateNodeName(nodeName)))
+    if ((!m_valid) || (!validateNodeName(nodeName)))
     {
         // Error, invalidate this path and return it
-        m_path.clear();
+        invalidate();
         return *this;
     }
 
@@ -341,6 +264,7 @@ ConfigNodePath &ConfigNodePath::append(const QString &nodeName)
         m_path.append(NODE_PATH_SEPARATOR % nodeName);
     }
 
+    m_segments.push_back({ SegmentType::NodeName, nodeName });
     return *this;
 }
 
@@ -356,10 +280,10 @@ ConfigNodePath ConfigNodePath::append(const ConfigNodePath &nodePath) const
 ConfigNodePath &ConfigNodePath::append(const ConfigNodePath &nodePath)
 {
     // Make sure that both paths are valid and that the specified node path is a relative path
-    if ((!isValid()) || nodePath.isAbsolute() || (!nodePath.isValid()))
+    if ((!m_valid) || nodePath.isAbsolute() || (!nodePath.isValid()))
     {
         // Error, invalidate this path and return it
-        m_path.clear();
+        invalidate();
         return *this;
     }
 
@@ -373,6 +297,14 @@ ConfigNodePath &ConfigNodePath::append(const ConfigNodePath &nodePath)
         m_path.append(NODE_PATH_SEPARATOR % nodePath.path());
     }
 
+    m_segments.insert(m_segments.end(), nodePath.m_segments.begin(), nodePath.m_segments.end());
+
+    // References to parent nodes could make an absolute node path invalid
+    if (m_absolute && nodePath.hasUnresolvedReferences())
+    {
+        m_valid = checkValidity();
+    }
+
     return *this;
 }
 
@@ -382,10 +314,143 @@ bool ConfigNodePath::validateNodeName(const QString &name)
 {
     // Check if the name starts with a letter and continues with an optional string of alphanumeric
     // and "_" characters
-    static const QRegularExpression s_regex(QStringLiteral("^[a-zA-Z][a-zA-Z0-9_]*$"));
+    return validateNodeName(name.utf16(), static_cast<size_t>(name.size()));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigNodePath::parse()
+{
+    m_segments.clear();
+    m_absolute = m_path.startsWith(NODE_PATH_SEPARATOR);
+
+    // Split the node path to segments ("root" and empty paths don't have any segments)
+    if ((!m_path.isEmpty()) && (!isRoot()))
+    {
+        int startIndex = m_absolute ? 1 : 0;
+
+        while (true)
+        {
+            const int endIndex = m_path.indexOf(NODE_PATH_SEPARATOR, startIndex);
+            const QString name = (endIndex < 0) ? m_path.mid(startIndex)
+                                                : m_path.mid(startIndex, endIndex - startIndex);
+
+            if (name == PARENT_PATH_VALUE)
+            {
+                m_segments.push_back({ SegmentType::Parent, name });
+            }
+            else if (validateNodeName(name))
+            {
+                m_segments.push_back({ SegmentType::NodeName, name });
+            }
+            else
+            {
+                m_segments.push_back({ SegmentType::Invalid, name });
+            }
+
+            if (endIndex < 0)
+            {
+                break;
+            }
+
+            startIndex = endIndex + 1;
+        }
+    }
+
+    m_valid = checkValidity();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigNodePath::updateValue()
+{
+    // Check for "root" path
+    if (m_segments.empty())
+    {
+        m_path = m_absolute ? ROOT_PATH_VALUE
+                            : QString();
+        return;
+    }
+
+    // Join the segments
+    m_path.clear();
+
+    for (size_t i = 0; i < m_segments.size(); i++)
+    {
+        if (m_absolute || (i > 0U))
+        {
+            m_path.append(NODE_PATH_SEPARATOR);
+        }
+
+        m_path.append(m_segments.at(i).name);
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigNodePath::invalidate()
+{
+    m_path.clear();
+    m_segments.clear();
+    m_absolute = false;
+    m_valid = false;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigNodePath::checkValidity() const
+{
+    // Check for an empty
+    if (m_path.isEmpty())
+    {
+        // Error, an empty path is not valid
+        return false;
+    }
+
+    // Check for "root" path
+    if (isRoot())
+    {
+        return true;
+    }
+
+    // Make sure that the individual node names are valid and that in an absolute path there is no
+    // attempt to access the parent node of the root node
+    unsigned int depth = 0;
+
+    for (const auto &segment : m_segments)
+    {
+        switch (segment.type)
+        {
+            case SegmentType::NodeName:
+            {
+                depth++;
+                break;
+            }
+
+            case SegmentType::Parent:
+            {
+                if (m_absolute)
+                {
+                    if (depth == 0)
+                    {
+                        // Error, the root node does not have a parent node
+                        return false;
+                    }
 
-    auto match = s_regex.match(name);
-    return match.hasMatch();
+                    depth--;
+                }
+                break;
+            }
+
+            default:
+            {
+                // Error, invalid node name
+                return false;
+            }
+        }
+    }
+
+    return true;
 }
 
 } // namespace CppConfigFramework
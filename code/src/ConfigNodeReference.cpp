@@ -67,6 +67,7 @@ ConfigNodePath ConfigNodeReference::reference() const
 
 void ConfigNodeReference::setReference(const ConfigNodePath &reference)
 {
+    prepareForModification();
     m_reference = reference;
 }
 
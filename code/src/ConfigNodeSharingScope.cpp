@@ -0,0 +1,108 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a scope that enables sharing of members between cloned Object nodes
+ */
+
+// Own header
+#include <CppConfigFramework/ConfigNodeSharingScope.hpp>
+
+// C++ Config Framework includes
+
+// Qt includes
+
+// System includes
+#include <atomic>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+namespace Internal
+{
+
+//! Holds the identifier of the sharing scope that is active for the current thread
+thread_local ConfigNodeSharingScope::Id currentSharingScope = ConfigNodeSharingScope::NO_SCOPE;
+
+//! Holds the identifier of the last started sharing scope
+std::atomic<ConfigNodeSharingScope::Id> lastSharingScope(ConfigNodeSharingScope::NO_SCOPE);
+
+} // namespace Internal
+
+// -------------------------------------------------------------------------------------------------
+
+constexpr ConfigNodeSharingScope::Id ConfigNodeSharingScope::NO_SCOPE;
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNodeSharingScope::ConfigNodeSharingScope()
+    : m_id(Internal::currentSharingScope),
+      m_previousId(Internal::currentSharingScope),
+      m_outermost(false)
+{
+    if (m_id == NO_SCOPE)
+    {
+        m_id = Internal::lastSharingScope.fetch_add(1U, std::memory_order_relaxed) + 1U;
+        m_outermost = true;
+        Internal::currentSharingScope = m_id;
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNodeSharingScope::ConfigNodeSharingScope(const Id id)
+    : m_id(id),
+      m_previousId(Internal::currentSharingScope),
+      m_outermost(false)
+{
+    Internal::currentSharingScope = m_id;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNodeSharingScope::~ConfigNodeSharingScope()
+{
+    Internal::currentSharingScope = m_previousId;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNodeSharingScope::Id ConfigNodeSharingScope::current()
+{
+    return Internal::currentSharingScope;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNodeSharingScope::Id ConfigNodeSharingScope::id() const
+{
+    return m_id;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigNodeSharingScope::isOutermost() const
+{
+    return m_outermost;
+}
+
+} // namespace CppConfigFramework
@@ -31,6 +31,7 @@
 #include <QtCore/QStringBuilder>
 
 // System includes
+#include <algorithm>
 
 // Forward declarations
 
@@ -41,15 +42,129 @@
 namespace CppConfigFramework
 {
 
+namespace Internal
+{
+
+int unresolvedReferenceCount(const ConfigNode &node);
+bool haveEqualContents(const ConfigNode &left, const ConfigNode &right);
+bool haveEqualMembers(const ConfigObjectNode &left, const ConfigObjectNode &right);
+
+// -------------------------------------------------------------------------------------------------
+
+int unresolvedReferenceCount(const ConfigNode &node)
+{
+    switch (node.type())
+    {
+        case ConfigNode::Type::Object:
+        {
+            return node.toObject().unresolvedReferenceCount();
+        }
+
+        case ConfigNode::Type::NodeReference:
+        case ConfigNode::Type::DerivedObject:
+        {
+            return 1;
+        }
+
+        default:
+        {
+            return 0;
+        }
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool haveEqualContents(const ConfigNode &left, const ConfigNode &right)
+{
+    if (left.type() != right.type())
+    {
+        return false;
+    }
+
+    switch (left.type())
+    {
+        case ConfigNode::Type::Value:
+        {
+            return (left.toValue().value() == right.toValue().value());
+        }
+
+        case ConfigNode::Type::Object:
+        {
+            return haveEqualMembers(left.toObject(), right.toObject());
+        }
+
+        case ConfigNode::Type::NodeReference:
+        {
+            return (left.toNodeReference().reference() == right.toNodeReference().reference());
+        }
+
+        case ConfigNode::Type::DerivedObject:
+        {
+            return ((left.toDerivedObject().bases() == right.toDerivedObject().bases()) &&
+                    haveEqualMembers(left.toDerivedObject().config(),
+                                     right.toDerivedObject().config()));
+        }
+
+        default:
+        {
+            return false;
+        }
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool haveEqualMembers(const ConfigObjectNode &left, const ConfigObjectNode &right)
+{
+    if (left.count() != right.count())
+    {
+        return false;
+    }
+
+    // Members of both nodes are ordered by the atoms of their names so they can be compared in a
+    // single pass. Only the contents of the members are compared since their node paths are equal
+    // if the node paths of their parents are equal (and the members of a clone that is not detached
+    // report the node paths of the shared node's members).
+    const ConfigSortedMembers leftMembers = left.sortedMembers();
+    const ConfigSortedMembers rightMembers = right.sortedMembers();
+
+    for (size_t i = 0U; i < leftMembers.count(); i++)
+    {
+        const auto &leftMember = leftMembers.at(i);
+        const auto &rightMember = rightMembers.at(i);
+
+        if ((leftMember.name != rightMember.name) ||
+            (!haveEqualContents(*leftMember.node, *rightMember.node)))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace Internal
+
+// -------------------------------------------------------------------------------------------------
+
 ConfigObjectNode::ConfigObjectNode(ConfigObjectNode *parent)
-    : ConfigNode(parent)
+    : ConfigNode(parent),
+      m_unresolvedReferenceCount(0),
+      m_sharedSource(nullptr),
+      m_sharedCloneIndex(0U),
+      m_sharingScope(ConfigNodeSharingScope::current())
 {
 }
 
 // -------------------------------------------------------------------------------------------------
 
 ConfigObjectNode::ConfigObjectNode(std::initializer_list<std::pair<QString, ConfigNode &&>> args)
-    : ConfigNode(nullptr)
+    : ConfigNode(nullptr),
+      m_unresolvedReferenceCount(0),
+      m_sharedSource(nullptr),
+      m_sharedCloneIndex(0U),
+      m_sharingScope(ConfigNodeSharingScope::current())
 {
     for (const auto &arg : args)
     {
@@ -61,12 +176,34 @@ ConfigObjectNode::ConfigObjectNode(std::initializer_list<std::pair<QString, Conf
 
 ConfigObjectNode::ConfigObjectNode(ConfigObjectNode &&other) noexcept
     : ConfigNode(other.parent()),
-      m_members(std::move(other.m_members))
+      m_unresolvedReferenceCount(other.m_unresolvedReferenceCount),
+      m_sharedSource(nullptr),
+      m_sharedCloneIndex(0U),
+      m_sharingScope(other.m_sharingScope)
 {
+    // The other node loses its members
+    other.prepareForModification();
+
+    m_members = std::move(other.m_members);
+
     for (const auto &member : m_members)
     {
-        member.second->setParent(this);
+        member.node->setParent(this, member.name);
     }
+
+    // Take over the shared members of the other node
+    setSharedSource(other.m_sharedSource);
+    other.setSharedSource(nullptr);
+
+    other.updateUnresolvedReferenceCount(-m_unresolvedReferenceCount);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigObjectNode::~ConfigObjectNode()
+{
+    releaseSharedClones();
+    setSharedSource(nullptr);
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -78,14 +215,29 @@ ConfigObjectNode &ConfigObjectNode::operator=(ConfigObjectNode &&other) noexcept
         return *this;
     }
 
-    setParent(other.parent());
+    // Both nodes lose their current members
+    prepareForModification();
+    setSharedSource(nullptr);
+    other.prepareForModification();
+
+    // Move the unresolved references from the other node's hierarchy to this node's hierarchy
+    const int unresolvedReferenceCount = other.m_unresolvedReferenceCount;
+    other.updateUnresolvedReferenceCount(-unresolvedReferenceCount);
+    updateUnresolvedReferenceCount(unresolvedReferenceCount - m_unresolvedReferenceCount);
+
+    setParent(other.parent(), other.memberNameAtom());
     m_members = std::move(other.m_members);
 
     for (const auto &member : m_members)
     {
-        member.second->setParent(this);
+        member.node->setParent(this, member.name);
     }
 
+    // Take over the shared members of the other node
+    setSharedSource(other.m_sharedSource);
+    other.setSharedSource(nullptr);
+    m_sharingScope = other.m_sharingScope;
+
     return *this;
 }
 
@@ -94,12 +246,29 @@ ConfigObjectNode &ConfigObjectNode::operator=(ConfigObjectNode &&other) noexcept
 std::unique_ptr<ConfigNode> ConfigObjectNode::clone() const
 {
     auto clonedNode = std::make_unique<ConfigObjectNode>(nullptr);
+    const auto &members = memberStorage();
 
-    for (const auto &member : m_members)
+    if (members.count() == 0)
+    {
+        return clonedNode;
+    }
+
+    // Nodes that don't belong to the active sharing scope are copied completely so that they are
+    // never modified by cloning them
+    if ((m_sharingScope == ConfigNodeSharingScope::NO_SCOPE) ||
+        (m_sharingScope != ConfigNodeSharingScope::current()))
     {
-        clonedNode->setMember(member.first, member.second->clone());
+        for (const auto &member : members)
+        {
+            clonedNode->setMember(member.name, member.node->clone());
+        }
+
+        return clonedNode;
     }
 
+    // Share the members with the clone (a clone of a clone shares the members of the same node)
+    clonedNode->m_unresolvedReferenceCount = m_unresolvedReferenceCount;
+    clonedNode->setSharedSource((m_sharedSource != nullptr) ? m_sharedSource : this);
     return clonedNode;
 }
 
@@ -114,39 +283,65 @@ ConfigNode::Type ConfigObjectNode::type() const
 
 int ConfigObjectNode::count() const
 {
-    return static_cast<int>(m_members.size());
+    return memberStorage().count();
 }
 
 // -------------------------------------------------------------------------------------------------
 
 bool ConfigObjectNode::contains(const QString &name) const
 {
-    return (m_members.find(name) != m_members.end());
+    return contains(ConfigNameTable::instance()->find(name));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigObjectNode::contains(const ConfigNameTable::Atom name) const
+{
+    return (memberStorage().find(name) != nullptr);
 }
 
 // -------------------------------------------------------------------------------------------------
 
 QStringList ConfigObjectNode::names() const
 {
+    const auto *nameTable = ConfigNameTable::instance();
+    const auto &members = memberStorage();
     QStringList nameList;
+    nameList.reserve(members.count());
 
-    for (auto &it : m_members)
+    for (const auto &member : members)
     {
-        nameList.append(it.first);
+        nameList.append(nameTable->name(member.name));
     }
 
+    // Members are ordered by their atoms so the names need to be sorted to keep the order stable
+    nameList.sort();
     return nameList;
 }
 
 // -------------------------------------------------------------------------------------------------
 
+ConfigSortedMembers ConfigObjectNode::sortedMembers() const
+{
+    return ConfigSortedMembers(memberStorage());
+}
+
+// -------------------------------------------------------------------------------------------------
+
 QString ConfigObjectNode::name(const ConfigNode &node) const
 {
-    for (auto &it : m_members)
+    // Use the member name stored in the node
+    if ((node.parent() == this) && (member(node.memberNameAtom()) == &node))
     {
-        if (it.second.get() == &node)
+        return ConfigNameTable::instance()->name(node.memberNameAtom());
+    }
+
+    // Fall back to searching for the node in the members
+    for (const auto &member : m_members)
+    {
+        if (member.node.get() == &node)
         {
-            return it.first;
+            return ConfigNameTable::instance()->name(member.name);
         }
     }
 
@@ -157,79 +352,174 @@ QString ConfigObjectNode::name(const ConfigNode &node) const
 
 const ConfigNode *ConfigObjectNode::member(const QString &name) const
 {
-    auto it = m_members.find(name);
+    return member(ConfigNameTable::instance()->find(name));
+}
 
-    if (it == m_members.end())
-    {
-        return nullptr;
-    }
+// -------------------------------------------------------------------------------------------------
 
-    return it->second.get();
+ConfigNode *ConfigObjectNode::member(const QString &name)
+{
+    return member(ConfigNameTable::instance()->find(name));
 }
 
 // -------------------------------------------------------------------------------------------------
 
-ConfigNode *ConfigObjectNode::member(const QString &name)
+const ConfigNode *ConfigObjectNode::member(const ConfigNameTable::Atom name) const
 {
-    auto it = m_members.find(name);
+    // Members of a clone are read directly from the shared node (they are copied only before the
+    // clone is modified)
+    return memberStorage().find(name);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNode *ConfigObjectNode::member(const ConfigNameTable::Atom name)
+{
+    copySharedMembers();
+    return m_members.find(name);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigObjectNode::findMembers(const ConfigNameTable::Atom *names,
+                                   const size_t count,
+                                   const ConfigNode **members,
+                                   QStringList *unknownNames) const
+{
+    const auto &storage = memberStorage();
+    const auto *nameTable = ConfigNameTable::instance();
+
+    if (storage.hasHashIndex())
+    {
+        // Members are not sorted but each one of them can be found with a single hash lookup
+        for (size_t i = 0U; i < count; i++)
+        {
+            members[i] = storage.find(names[i]);
+        }
 
-    if (it == m_members.end())
+        if (unknownNames != nullptr)
+        {
+            for (const auto &member : storage)
+            {
+                if (!std::binary_search(names, names + count, member.name))
+                {
+                    unknownNames->append(nameTable->name(member.name));
+                }
+            }
+        }
+    }
+    else
     {
-        return nullptr;
+        // Match the sorted members with the sorted names in a single merge pass
+        auto it = storage.begin();
+        const auto end = storage.end();
+
+        for (size_t i = 0U; i < count; i++)
+        {
+            // Skip the members that don't match any of the names
+            while ((it != end) && (it->name < names[i]))
+            {
+                if (unknownNames != nullptr)
+                {
+                    unknownNames->append(nameTable->name(it->name));
+                }
+
+                it++;
+            }
+
+            if ((it != end) && (it->name == names[i]))
+            {
+                members[i] = it->node.get();
+                it++;
+            }
+            else
+            {
+                members[i] = nullptr;
+            }
+        }
+
+        if (unknownNames != nullptr)
+        {
+            for (; it != end; it++)
+            {
+                unknownNames->append(nameTable->name(it->name));
+            }
+        }
     }
 
-    return it->second.get();
+    if ((unknownNames != nullptr) && (unknownNames->size() > 1))
+    {
+        unknownNames->sort();
+    }
 }
 
 // -------------------------------------------------------------------------------------------------
 
 bool ConfigObjectNode::setMember(const QString &name, std::unique_ptr<ConfigNode> node)
+{
+    // Interning also validates the name
+    return setMember(ConfigNameTable::instance()->intern(name), std::move(node));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigObjectNode::setMember(const QString &name, const ConfigNode &node)
+{
+    return setMember(name, node.clone());
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigObjectNode::setMember(const ConfigNameTable::Atom name, std::unique_ptr<ConfigNode> node)
 {
     // Make sure that name and node are both valid
-    if ((!ConfigNodePath::validateNodeName(name)) || (!node))
+    if ((name == ConfigNameTable::INVALID_ATOM) || (!node))
     {
         return false;
     }
 
+    // Make sure that the modification is not visible through any of the clones
+    prepareForModification();
+    copySharedMembers();
+
     // Set the parent to this node
-    node->setParent(this);
+    node->setParent(this, name);
 
     // Insert or replace the member
-    auto it = m_members.find(name);
+    int delta = Internal::unresolvedReferenceCount(*node);
+    const auto replacedNode = m_members.insert(name, std::move(node));
 
-    if (it == m_members.end())
-    {
-        // Insert a new item
-        m_members.emplace(name, std::move(node));
-    }
-    else
+    if (replacedNode)
     {
-        // Replace the existing item
-        it->second = std::move(node);
+        delta -= Internal::unresolvedReferenceCount(*replacedNode);
     }
 
+    updateUnresolvedReferenceCount(delta);
     return true;
 }
 
 // -------------------------------------------------------------------------------------------------
 
-bool ConfigObjectNode::setMember(const QString &name, const ConfigNode &node)
+bool ConfigObjectNode::remove(const QString &name)
 {
-    return setMember(name, node.clone());
-}
+    const ConfigNameTable::Atom atom = ConfigNameTable::instance()->find(name);
 
-// -------------------------------------------------------------------------------------------------
+    if (memberStorage().find(atom) == nullptr)
+    {
+        return false;
+    }
 
-bool ConfigObjectNode::remove(const QString &name)
-{
-    auto it = m_members.find(name);
+    prepareForModification();
+    copySharedMembers();
+
+    const auto removedNode = m_members.remove(atom);
 
-    if (it == m_members.end())
+    if (!removedNode)
     {
         return false;
     }
 
-    m_members.erase(it);
+    updateUnresolvedReferenceCount(-Internal::unresolvedReferenceCount(*removedNode));
     return true;
 }
 
@@ -237,7 +527,11 @@ bool ConfigObjectNode::remove(const QString &name)
 
 void ConfigObjectNode::removeAll()
 {
+    prepareForModification();
+    setSharedSource(nullptr);
+
     m_members.clear();
+    updateUnresolvedReferenceCount(-m_unresolvedReferenceCount);
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -245,9 +539,10 @@ void ConfigObjectNode::removeAll()
 void ConfigObjectNode::apply(const ConfigObjectNode &other)
 {
     // Merge nodes
-    for (const QString &name : other.names())
+    for (const auto &it : other.memberStorage())
     {
-        const ConfigNode *memberOther = other.member(name);
+        const ConfigNameTable::Atom name = it.name;
+        const ConfigNode *memberOther = it.node.get();
         Q_ASSERT(memberOther != nullptr);
 
         // Check if a member with the same name already exists
@@ -257,7 +552,7 @@ void ConfigObjectNode::apply(const ConfigObjectNode &other)
         {
             // A member with the same name doesn't exist, copy the item and add it to this node as
             // a new member
-            setMember(name, *memberOther);
+            setMember(name, memberOther->clone());
             continue;
         }
 
@@ -276,86 +571,164 @@ void ConfigObjectNode::apply(const ConfigObjectNode &other)
         {
             // For all other type combinations just overwrite this node's member with the other
             // node's member
-            setMember(name, *memberOther);
+            setMember(name, memberOther->clone());
         }
     }
 }
 
-} // namespace CppConfigFramework
+// -------------------------------------------------------------------------------------------------
+
+int ConfigObjectNode::unresolvedReferenceCount() const
+{
+    return m_unresolvedReferenceCount;
+}
 
 // -------------------------------------------------------------------------------------------------
 
-bool operator==(const CppConfigFramework::ConfigObjectNode &left,
-                const CppConfigFramework::ConfigObjectNode &right)
+void ConfigObjectNode::updateUnresolvedReferenceCount(const int delta)
 {
-    if ((left.nodePath() != right.nodePath()) ||
-        (left.count() != right.count()))
+    if (delta == 0)
     {
-        return false;
+        return;
     }
 
-    for (const QString &name : left.names())
+    // Propagate the change to all ancestors since their counts include this node's count
+    for (ConfigObjectNode *node = this; node != nullptr; node = node->parent())
     {
-        const auto *leftMemberNode = left.member(name);
-        const auto *rightMemberNode = right.member(name);
+        node->m_unresolvedReferenceCount += delta;
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigObjectNode::isDetached() const
+{
+    return (m_sharedSource == nullptr);
+}
 
-        if (rightMemberNode == nullptr)
+// -------------------------------------------------------------------------------------------------
+
+void ConfigObjectNode::detach()
+{
+    detachSharedClones();
+    copySharedMembers();
+    m_sharingScope = ConfigNodeSharingScope::NO_SCOPE;
+
+    for (const auto &member : m_members)
+    {
+        if (member.node->isObject())
         {
-            // Member with the specified name was not found
-            return false;
+            member.node->toObject().detach();
         }
-
-        if (leftMemberNode->type() != rightMemberNode->type())
+        else if (member.node->isDerivedObject())
         {
-            return false;
+            // Overrides of a DerivedObject node are also a clone of another node
+            auto &config = const_cast<ConfigObjectNode &>(member.node->toDerivedObject().config());
+            config.detach();
         }
+    }
+}
 
-        switch (leftMemberNode->type())
-        {
-            case CppConfigFramework::ConfigNode::Type::Value:
-            {
-                if (leftMemberNode->toValue() != rightMemberNode->toValue())
-                {
-                    return false;
-                }
-                break;
-            }
+// -------------------------------------------------------------------------------------------------
 
-            case CppConfigFramework::ConfigNode::Type::Object:
-            {
-                if (leftMemberNode->toObject() != rightMemberNode->toObject())
-                {
-                    return false;
-                }
-                break;
-            }
+const ConfigMemberStorage &ConfigObjectNode::memberStorage() const
+{
+    return (m_sharedSource != nullptr) ? m_sharedSource->m_members
+                                       : m_members;
+}
 
-            case CppConfigFramework::ConfigNode::Type::NodeReference:
-            {
-                if (leftMemberNode->toNodeReference() != rightMemberNode->toNodeReference())
-                {
-                    return false;
-                }
-                break;
-            }
+// -------------------------------------------------------------------------------------------------
 
-            case CppConfigFramework::ConfigNode::Type::DerivedObject:
-            {
-                if (leftMemberNode->toDerivedObject() != rightMemberNode->toDerivedObject())
-                {
-                    return false;
-                }
-                break;
-            }
+void ConfigObjectNode::setSharedSource(const ConfigObjectNode *source)
+{
+    // Remove this node from the current shared node's list of clones
+    if (m_sharedSource != nullptr)
+    {
+        auto &clones = m_sharedSource->m_sharedClones;
+        clones[m_sharedCloneIndex] = clones.back();
+        clones[m_sharedCloneIndex]->m_sharedCloneIndex = m_sharedCloneIndex;
+        clones.pop_back();
+    }
 
-            default:
-            {
-                return false;
-            }
-        }
+    // Add this node to the new shared node's list of clones
+    m_sharedSource = source;
+
+    if (m_sharedSource != nullptr)
+    {
+        m_sharedCloneIndex = m_sharedSource->m_sharedClones.size();
+        m_sharedSource->m_sharedClones.push_back(this);
     }
+}
 
-    return true;
+// -------------------------------------------------------------------------------------------------
+
+void ConfigObjectNode::copySharedMembers()
+{
+    if (m_sharedSource == nullptr)
+    {
+        return;
+    }
+
+    // Copy just the direct members (their members are shared with the shared node's members) and
+    // keep the unresolved reference count since the members are the same
+    for (const auto &member : m_sharedSource->m_members)
+    {
+        auto node = member.node->clone();
+        node->setParent(this, member.name);
+        m_members.insert(member.name, std::move(node));
+    }
+
+    setSharedSource(nullptr);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigObjectNode::detachSharedClones()
+{
+    while (!m_sharedClones.empty())
+    {
+        m_sharedClones.back()->copySharedMembers();
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigObjectNode::releaseSharedClones()
+{
+    if (m_sharedClones.empty())
+    {
+        return;
+    }
+
+    // The first clone takes over the members and the rest of the clones share them with it
+    ConfigObjectNode *heir = m_sharedClones.front();
+    heir->setSharedSource(nullptr);
+    heir->m_members = std::move(m_members);
+    m_members.clear();
+
+    for (const auto &member : heir->m_members)
+    {
+        member.node->setParent(heir, member.name);
+    }
+
+    for (auto *clone : m_sharedClones)
+    {
+        clone->m_sharedSource = heir;
+    }
+
+    heir->m_sharedClones = std::move(m_sharedClones);
+    m_sharedClones.clear();
+}
+
+} // namespace CppConfigFramework
+
+// -------------------------------------------------------------------------------------------------
+
+bool operator==(const CppConfigFramework::ConfigObjectNode &left,
+                const CppConfigFramework::ConfigObjectNode &right)
+{
+    return ((left.nodePath() == right.nodePath()) &&
+            CppConfigFramework::Internal::haveEqualMembers(left, right));
 }
 
 // -------------------------------------------------------------------------------------------------
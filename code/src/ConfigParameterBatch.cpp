@@ -0,0 +1,203 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains classes for finding the nodes of many configuration parameters in a single pass
+ */
+
+// Own header
+#include <CppConfigFramework/ConfigParameterBatch.hpp>
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+
+// Qt includes
+
+// System includes
+#include <algorithm>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+ConfigParameterNames::ConfigParameterNames(const QStringList &names)
+    : m_names(names)
+{
+    initialize();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigParameterNames::ConfigParameterNames(std::initializer_list<QString> names)
+    : m_names(names)
+{
+    initialize();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+size_t ConfigParameterNames::count() const
+{
+    return m_atoms.size();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const QString &ConfigParameterNames::name(const size_t index) const
+{
+    return m_names.at(static_cast<int>(index));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigNameTable::Atom ConfigParameterNames::atom(const size_t index) const
+{
+    return m_atoms.at(index);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigParameterNames::isValid() const
+{
+    return m_invalidName.isEmpty();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const QString &ConfigParameterNames::invalidName() const
+{
+    return m_invalidName;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigParameterNames::findMembers(const ConfigObjectNode &config,
+                                       const ConfigNode **members,
+                                       QStringList *unknownNames) const
+{
+    QVarLengthArray<const ConfigNode *, 32> sortedMembers(static_cast<int>(m_sortedAtoms.size()));
+    config.findMembers(m_sortedAtoms.data(),
+                       m_sortedAtoms.size(),
+                       sortedMembers.data(),
+                       unknownNames);
+
+    for (size_t i = 0U; i < m_sortedIndexes.size(); i++)
+    {
+        members[m_sortedIndexes[i]] = sortedMembers[static_cast<int>(i)];
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigParameterNames::initialize()
+{
+    const size_t count = static_cast<size_t>(m_names.size());
+    auto *nameTable = ConfigNameTable::instance();
+
+    // Interning also validates the names
+    m_atoms.reserve(count);
+
+    for (const QString &name : m_names)
+    {
+        const auto atom = nameTable->intern(name);
+
+        if ((atom == ConfigNameTable::INVALID_ATOM) && m_invalidName.isEmpty())
+        {
+            m_invalidName = name;
+        }
+
+        m_atoms.push_back(atom);
+    }
+
+    // Order the parameters by the atoms of their names
+    m_sortedIndexes.reserve(count);
+
+    for (size_t i = 0U; i < count; i++)
+    {
+        m_sortedIndexes.push_back(i);
+    }
+
+    std::sort(m_sortedIndexes.begin(),
+              m_sortedIndexes.end(),
+              [this](const size_t left, const size_t right)
+              {
+                  return (m_atoms[left] < m_atoms[right]);
+              });
+
+    m_sortedAtoms.reserve(count);
+
+    for (const size_t index : m_sortedIndexes)
+    {
+        const auto atom = m_atoms[index];
+
+        // Names must be unique
+        if ((!m_sortedAtoms.empty()) &&
+            (m_sortedAtoms.back() == atom) &&
+            (atom != ConfigNameTable::INVALID_ATOM) &&
+            m_invalidName.isEmpty())
+        {
+            m_invalidName = m_names.at(static_cast<int>(index));
+        }
+
+        m_sortedAtoms.push_back(atom);
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigParameterBatch::ConfigParameterBatch(const ConfigParameterNames &names,
+                                           const ConfigObjectNode &config)
+    : m_names(&names),
+      m_config(&config),
+      m_members(static_cast<int>(names.count()))
+{
+    names.findMembers(config, m_members.data(), &m_unknownNames);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const ConfigParameterNames &ConfigParameterBatch::names() const
+{
+    return *m_names;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const ConfigObjectNode &ConfigParameterBatch::config() const
+{
+    return *m_config;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const ConfigNode *ConfigParameterBatch::member(const size_t index) const
+{
+    return m_members.at(static_cast<int>(index));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const QStringList &ConfigParameterBatch::unknownNames() const
+{
+    return m_unknownNames;
+}
+
+} // namespace CppConfigFramework
@@ -22,8 +22,14 @@
 #include <CppConfigFramework/ConfigReader.hpp>
 
 // C++ Config Framework includes
+#include <CppConfigFramework/ConfigDependencies.hpp>
 #include <CppConfigFramework/ConfigDerivedObjectNode.hpp>
+#include <CppConfigFramework/ConfigDiskCache.hpp>
+#include <CppConfigFramework/ConfigFileBuffer.hpp>
+#include <CppConfigFramework/ConfigJsonStreamParser.hpp>
+#include <CppConfigFramework/ConfigNodeArena.hpp>
 #include <CppConfigFramework/ConfigNodeReference.hpp>
+#include <CppConfigFramework/ConfigNodeSharingScope.hpp>
 #include <CppConfigFramework/ConfigObjectNode.hpp>
 #include <CppConfigFramework/ConfigReaderRegistry.hpp>
 #include <CppConfigFramework/ConfigValueNode.hpp>
@@ -35,9 +41,13 @@
 #include <QtCore/QJsonDocument>
 #include <QtCore/QJsonObject>
 #include <QtCore/QJsonValue>
-#include <QtCore/QRegularExpression>
+#include <QtCore/QRunnable>
+#include <QtCore/QSet>
+#include <QtCore/QSemaphore>
+#include <QtCore/QThreadPool>
 
 // System includes
+#include <atomic>
 
 // Forward declarations
 
@@ -48,6 +58,140 @@
 namespace CppConfigFramework
 {
 
+namespace Internal
+{
+
+//! Holds the data of an include that is read concurrently with the other includes
+struct ConcurrentInclude
+{
+    //! Configuration type
+    QString type;
+
+    //! Destination node path
+    ConfigNodePath destinationNodePath;
+
+    //! Include parameters
+    QJsonObject parameters;
+
+    //! Copy of the environment variables
+    EnvironmentVariables environmentVariables;
+
+    //! Copies of the external configs (the external configs must not be shared between threads)
+    std::vector<std::unique_ptr<ConfigNode>> externalConfigCopies;
+
+    //! External configs
+    std::vector<const ConfigObjectNode *> externalConfigs;
+
+    //! Read configuration (null in case of failure)
+    std::unique_ptr<ConfigObjectNode> config;
+
+    //! Dependencies of the read configuration (they are always recorded)
+    ConfigDependencies dependencies;
+
+    //! Flag that is set by the thread that starts reading the include (shared with the pool task)
+    std::shared_ptr<std::atomic<bool>> started;
+};
+
+//! Holds the data that is shared by all of the includes that are read concurrently
+struct ConcurrentIncludeContext
+{
+    //! Path to the working directory
+    QDir workingDir;
+
+    //! Flag for allocating the nodes from an arena
+    bool arenaAllocation = false;
+
+    //! Sharing scope of the thread that reads the includes
+    ConfigNodeSharingScope::Id sharingScope = ConfigNodeSharingScope::NO_SCOPE;
+
+    //! Scoped include cache (nullptr if there is none)
+    ConfigIncludeCache *includeCache = nullptr;
+
+    //! Released once for each include that was read on the thread pool
+    QSemaphore includesReadOnThreadPool;
+};
+
+/*!
+ * Reads an include that is read concurrently with the other includes
+ *
+ * \param   context     Data shared by all of the includes
+ * \param   include     Include to read
+ */
+void readConcurrentInclude(const ConcurrentIncludeContext &context, ConcurrentInclude *include);
+
+//! This class reads an include on a thread pool (unless the include was already started elsewhere)
+class ConcurrentIncludeReader : public QRunnable
+{
+public:
+    /*!
+     * Constructor
+     *
+     * \param   context     Data shared by all of the includes
+     * \param   include     Include to read
+     */
+    ConcurrentIncludeReader(ConcurrentIncludeContext *context, ConcurrentInclude *include);
+
+    //! Reads the include
+    void run() override;
+
+private:
+    //! Data shared by all of the includes
+    ConcurrentIncludeContext *m_context;
+
+    //! Include to read
+    ConcurrentInclude *m_include;
+
+    //! Flag that is set by the thread that starts reading the include
+    std::shared_ptr<std::atomic<bool>> m_started;
+};
+
+/*!
+ * Finds an include that depends on the includes that are declared before it
+ *
+ * \param   includes                Includes that were read concurrently
+ * \param   environmentVariables    Environment variables that the includes were read with
+ *
+ * \return  Index of the include or -1 if the includes are independent
+ *
+ * An include depends on the includes declared before it if it failed to be read on its own (it can
+ * reference the nodes of those includes) or if it used an environment variable that one of them
+ * added.
+ */
+int findDependentInclude(const std::vector<ConcurrentInclude> &includes,
+                         const EnvironmentVariables &environmentVariables);
+
+/*!
+ * Prepares the read configuration for leaving the reader
+ *
+ * \param   config          Read configuration (null in case of failure)
+ * \param   sharingScope    Sharing scope of the read
+ *
+ * \return  Read configuration
+ *
+ * Configuration that is returned from the outermost read is detached so that it doesn't share any
+ * members and it can be read from multiple threads.
+ */
+std::unique_ptr<ConfigObjectNode> finishRead(std::unique_ptr<ConfigObjectNode> config,
+                                             const ConfigNodeSharingScope &sharingScope);
+
+} // namespace Internal
+
+// -------------------------------------------------------------------------------------------------
+
+QString ConfigReader::cacheDirectory() const
+{
+    return m_cacheDirectory;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigReader::setCacheDirectory(const QString &directoryPath)
+{
+    m_cacheDirectory = directoryPath;
+}
+
+// -------------------------------------------------------------------------------------------------
+
 std::unique_ptr<ConfigObjectNode> ConfigReader::read(
         const QString &filePath,
         const QDir &workingDir,
@@ -93,25 +237,189 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::read(
         return {};
     }
 
-    QFile file(absoluteFilePath);
+    // Read the file (using the cache directory if it is set) and share the members of the cloned
+    // nodes while it is being read
+    const ConfigNodeSharingScope sharingScope;
 
-    if (!file.open(QIODevice::ReadOnly))
+    if (m_cacheDirectory.isEmpty() || (!externalConfigs.empty()))
+    {
+        return Internal::finishRead(readFileWithIncludeCache(absoluteFilePath,
+                                                             sourceNodePath,
+                                                             destinationNodePath,
+                                                             externalConfigs,
+                                                             environmentVariables),
+                                    sharingScope);
+    }
+
+    const ConfigDiskCache diskCache(m_cacheDirectory);
+
+    {
+        std::unique_ptr<ConfigNodeArenaScope> arenaScope;
+
+        if (arenaAllocationEnabled())
+        {
+            arenaScope = std::make_unique<ConfigNodeArenaScope>();
+        }
+
+        auto config = diskCache.load(absoluteFilePath,
+                                     sourceNodePath,
+                                     destinationNodePath,
+                                     environmentVariables);
+
+        if (config)
+        {
+            return Internal::finishRead(std::move(config), sharingScope);
+        }
+    }
+
+    const EnvironmentVariables initialEnvironmentVariables = *environmentVariables;
+    ConfigDependencyRecorder recorder;
+
+    auto config = readFileWithIncludeCache(absoluteFilePath,
+                                           sourceNodePath,
+                                           destinationNodePath,
+                                           externalConfigs,
+                                           environmentVariables);
+
+    if (config)
+    {
+        diskCache.store(absoluteFilePath,
+                        sourceNodePath,
+                        destinationNodePath,
+                        *config,
+                        recorder.dependencies(),
+                        initialEnvironmentVariables,
+                        *environmentVariables);
+    }
+
+    return Internal::finishRead(std::move(config), sharingScope);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> ConfigReader::readFileWithIncludeCache(
+        const QString &absoluteFilePath,
+        const ConfigNodePath &sourceNodePath,
+        const ConfigNodePath &destinationNodePath,
+        const std::vector<const ConfigObjectNode *> &externalConfigs,
+        EnvironmentVariables *environmentVariables) const
+{
+    // Use the scoped include cache if there is one
+    auto *includeCache = ConfigIncludeCacheScope::current();
+
+    if (includeCache == nullptr)
+    {
+        includeCache = ConfigReaderRegistry::instance()->includeCache();
+    }
+
+    if (!includeCache->isEnabled())
+    {
+        return readFile(absoluteFilePath,
+                        sourceNodePath,
+                        destinationNodePath,
+                        externalConfigs,
+                        environmentVariables);
+    }
+
+    auto config = includeCache->find(absoluteFilePath,
+                                     sourceNodePath,
+                                     destinationNodePath,
+                                     environmentVariables);
+
+    if (config)
+    {
+        return config;
+    }
+
+    const EnvironmentVariables initialEnvironmentVariables = *environmentVariables;
+    ConfigDependencyRecorder recorder;
+
+    config = readFile(absoluteFilePath,
+                      sourceNodePath,
+                      destinationNodePath,
+                      externalConfigs,
+                      environmentVariables);
+
+    if (config)
+    {
+        includeCache->insert(absoluteFilePath,
+                             sourceNodePath,
+                             destinationNodePath,
+                             *config,
+                             recorder.dependencies(),
+                             externalConfigs,
+                             initialEnvironmentVariables,
+                             *environmentVariables);
+    }
+
+    return config;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> ConfigReader::readFile(
+        const QString &absoluteFilePath,
+        const ConfigNodePath &sourceNodePath,
+        const ConfigNodePath &destinationNodePath,
+        const std::vector<const ConfigObjectNode *> &externalConfigs,
+        EnvironmentVariables *environmentVariables) const
+{
+    ConfigDependencyRecorder::recordFile(absoluteFilePath);
+    ConfigFileBuffer fileContents;
+
+    if (!fileContents.open(absoluteFilePath, fileMappingEnabled()))
     {
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                << "Failed to open file at path:" << absoluteFilePath;
         return {};
     }
 
-    // Read the contents (JSON format)
-    QJsonParseError jsonParseError {};
-    const QByteArray fileContents = file.readAll();
-    const auto doc = QJsonDocument::fromJson(fileContents, &jsonParseError);
+    // Scan the contents (JSON format) and read the members of the root JSON Object except for the
+    // 'config' member which is only located here (its nodes are read directly from the file
+    // contents once the environment variables and includes are known)
+    ConfigJsonStreamParser parser(fileContents.data(), fileContents.size());
+    QJsonObject rootObject;
+    bool hasConfigMember = false;
+    size_t configMemberPosition = 0U;
+
+    if (parser.peekValueType() == ConfigJsonStreamParser::ValueType::Object)
+    {
+        parser.beginObject();
+        QString memberName;
+
+        while (parser.nextMember(&memberName))
+        {
+            if (memberName == QStringLiteral("config"))
+            {
+                hasConfigMember = true;
+                configMemberPosition = parser.position();
+                parser.skipValue();
+            }
+            else
+            {
+                QJsonValue memberValue;
+
+                if (parser.readValue(&memberValue))
+                {
+                    rootObject.insert(memberName, memberValue);
+                }
+            }
+        }
+
+        // Only whitespace is allowed after the root JSON Object
+        parser.atEnd();
+    }
+    else if (parser.skipValue() && parser.atEnd())
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Config file does not contain a JSON object:" << absoluteFilePath;
+        return {};
+    }
 
-    if (jsonParseError.error != QJsonParseError::NoError)
+    if (parser.hasError())
     {
-        constexpr int contextMaxLength = 20;
-        const int contextBeforeIndex = std::max(0, jsonParseError.offset - contextMaxLength);
-        const int contextBeforeLength = std::min(jsonParseError.offset, contextMaxLength);
+        constexpr size_t contextMaxLength = 20U;
+        const size_t errorOffset = parser.errorPosition();
+        const size_t contextBeforeLength = std::min(errorOffset, contextMaxLength);
+        const size_t contextBeforeIndex = errorOffset - contextBeforeLength;
 
         qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
                 << QString("Failed to parse the file contents:"
@@ -121,29 +429,30 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::read(
                            "\n    context before error: [%4]"
                            "\n    context at error: [%5]")
                    .arg(absoluteFilePath,
-                        QString::number(jsonParseError.offset),
-                        jsonParseError.errorString(),
+                        QString::number(errorOffset),
+                        parser.errorString(),
                         QString::fromUtf8(fileContents.mid(contextBeforeIndex,
                                                            contextBeforeLength)),
-                        QString::fromUtf8(fileContents.mid(jsonParseError.offset,
-                                                           contextMaxLength)));
+                        QString::fromUtf8(fileContents.mid(errorOffset, contextMaxLength)));
         return {};
     }
 
-    if (!doc.isObject())
+    // Read the config
+    ConfigJsonStreamParser *configParser = nullptr;
+
+    if (hasConfigMember)
     {
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                << "Config file does not contain a JSON object:" << absoluteFilePath;
-        return {};
+        parser.seek(configMemberPosition);
+        configParser = &parser;
     }
 
-    // Read the config
-    auto config = read(doc.object(),
-                       QFileInfo(absoluteFilePath).absoluteDir(),
-                       sourceNodePath,
-                       destinationNodePath,
-                       externalConfigs,
-                       environmentVariables);
+    auto config = readRootObject(rootObject,
+                                 configParser,
+                                 QFileInfo(absoluteFilePath).absoluteDir(),
+                                 sourceNodePath,
+                                 destinationNodePath,
+                                 externalConfigs,
+                                 environmentVariables);
 
     if (!config)
     {
@@ -164,6 +473,30 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::read(
         const ConfigNodePath &destinationNodePath,
         const std::vector<const ConfigObjectNode *> &externalConfigs,
         EnvironmentVariables *environmentVariables) const
+{
+    // Share the members of the cloned nodes while the configuration is being read
+    const ConfigNodeSharingScope sharingScope;
+
+    return Internal::finishRead(readRootObject(configObject,
+                                               nullptr,
+                                               workingDir,
+                                               sourceNodePath,
+                                               destinationNodePath,
+                                               externalConfigs,
+                                               environmentVariables),
+                                sharingScope);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> ConfigReader::readRootObject(
+        const QJsonObject &rootObject,
+        ConfigJsonStreamParser *configParser,
+        const QDir &workingDir,
+        const ConfigNodePath &sourceNodePath,
+        const ConfigNodePath &destinationNodePath,
+        const std::vector<const ConfigObjectNode *> &externalConfigs,
+        EnvironmentVariables *environmentVariables) const
 {
     // Validate source node path
     if ((!sourceNodePath.isAbsolute()) ||
@@ -202,8 +535,16 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::read(
         }
     }
 
+    // Allocate all nodes (also the ones from the includes) from an arena if needed
+    std::unique_ptr<ConfigNodeArenaScope> arenaScope;
+
+    if (arenaAllocationEnabled())
+    {
+        arenaScope = std::make_unique<ConfigNodeArenaScope>();
+    }
+
     // Read 'environment_variables' member
-    if (!readEnvironmentVariablesMember(configObject, environmentVariables))
+    if (!readEnvironmentVariablesMember(rootObject, environmentVariables))
     {
         qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
                 << "Failed to read the 'environment_variables' member";
@@ -211,7 +552,7 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::read(
     }
 
     // Read 'includes' member
-    auto completeConfig = readIncludesMember(configObject,
+    auto completeConfig = readIncludesMember(rootObject,
                                              workingDir,
                                              externalConfigs,
                                              environmentVariables);
@@ -235,11 +576,16 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::read(
     // (at this point the value could point to the last include's directory)
     setCurrentDirectory(workingDir, environmentVariables);
 
-    // Read 'config' member
-    auto configMember = readConfigMember(configObject,
-                                         externalConfigs,
-                                         *completeConfig,
-                                         *environmentVariables);
+    // Read 'config' member (directly from the JSON document if it is available)
+    auto configMember = (configParser != nullptr)
+                        ? readConfigMember(configParser,
+                                           externalConfigs,
+                                           *completeConfig,
+                                           *environmentVariables)
+                        : readConfigMember(rootObject,
+                                           externalConfigs,
+                                           *completeConfig,
+                                           *environmentVariables);
 
     if (!configMember)
     {
@@ -343,10 +689,9 @@ bool ConfigReader::readEnvironmentVariablesMember(const QJsonObject &rootObject,
     for (auto it = newEnvironmentVariables.begin(); it != newEnvironmentVariables.end(); it++)
     {
         // Extract the name
-        static const QRegularExpression regex("^\\w+$");
         const QString &name = it.key();
 
-        if (!regex.match(name).hasMatch())
+        if (!validateEnvironmentVariableName(name))
         {
             qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
                     << "Invalid environment variable name:" << name;
@@ -383,14 +728,9 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::readIncludesMember(
         return {};
     }
 
-    auto includesConfig = std::make_unique<ConfigObjectNode>();
-
-    std::vector<const ConfigObjectNode *> extendedExternalConfigs;
-    extendedExternalConfigs.reserve(externalConfigs.size() + 1U);
-    extendedExternalConfigs.push_back(includesConfig.get());
-    extendedExternalConfigs.insert(extendedExternalConfigs.end(),
-                                   externalConfigs.begin(),
-                                   externalConfigs.end());
+    // Extract the parameters of the includes
+    QStringList types;
+    QVector<ConfigNodePath> destinationNodePaths;
 
     for (int i = 0; i < includes.size(); i++)
     {
@@ -438,16 +778,45 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::readIncludesMember(
             return {};
         }
 
+        types.append(type);
+        destinationNodePaths.append(destinationNodePath);
+    }
+
+    auto includesConfig = std::make_unique<ConfigObjectNode>();
+
+    // Includes that depend on each other are read again one after another
+    if (parallelIncludesEnabled() &&
+        (includes.size() > 1) &&
+        readIncludesConcurrently(includes,
+                                 types,
+                                 destinationNodePaths,
+                                 workingDir,
+                                 externalConfigs,
+                                 environmentVariables,
+                                 includesConfig.get()))
+    {
+        return includesConfig;
+    }
+
+    std::vector<const ConfigObjectNode *> extendedExternalConfigs;
+    extendedExternalConfigs.reserve(externalConfigs.size() + 1U);
+    extendedExternalConfigs.push_back(includesConfig.get());
+    extendedExternalConfigs.insert(extendedExternalConfigs.end(),
+                                   externalConfigs.begin(),
+                                   externalConfigs.end());
+
+    for (int i = 0; i < includes.size(); i++)
+    {
         // Update current directory environment variable
         setCurrentDirectory(workingDir, environmentVariables);
 
         // Read config file
         // TODO: limit the includes depth to prevent an endless include loop?
         auto config = ConfigReaderRegistry::instance()->readConfig(
-                          type,
+                          types.at(i),
                           workingDir,
-                          destinationNodePath,
-                          includeObject,
+                          destinationNodePaths.at(i),
+                          includes.at(i),
                           extendedExternalConfigs,
                           environmentVariables);
 
@@ -467,6 +836,126 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::readIncludesMember(
 
 // -------------------------------------------------------------------------------------------------
 
+bool ConfigReader::readIncludesConcurrently(
+        const QVector<QJsonObject> &includes,
+        const QStringList &types,
+        const QVector<ConfigNodePath> &destinationNodePaths,
+        const QDir &workingDir,
+        const std::vector<const ConfigObjectNode *> &externalConfigs,
+        EnvironmentVariables *environmentVariables,
+        ConfigObjectNode *includesConfig) const
+{
+    // Prepare the data for each include (nodes of the external configs can share their members
+    // with other nodes which is not thread-safe, so each include gets its own detached copies)
+    std::vector<Internal::ConcurrentInclude> concurrentIncludes(
+                static_cast<size_t>(includes.size()));
+
+    for (int i = 0; i < includes.size(); i++)
+    {
+        auto &include = concurrentIncludes[static_cast<size_t>(i)];
+        include.type = types.at(i);
+        include.destinationNodePath = destinationNodePaths.at(i);
+        include.parameters = includes.at(i);
+        include.environmentVariables = *environmentVariables;
+        include.started = std::make_shared<std::atomic<bool>>(false);
+        setCurrentDirectory(workingDir, &include.environmentVariables);
+
+        for (const auto *externalConfig : externalConfigs)
+        {
+            auto copy = externalConfig->clone();
+            copy->toObject().detach();
+
+            include.externalConfigs.push_back(&copy->toObject());
+            include.externalConfigCopies.push_back(std::move(copy));
+        }
+    }
+
+    // Read the includes on the global thread pool (nodes read in other threads are allocated from
+    // their own arenas, their dependencies are recorded by their own recorders and they use the
+    // same scoped include cache). This thread reads the includes that were not started yet itself
+    // instead of just waiting for them, so nested includes can't run out of threads.
+    {
+        Internal::ConcurrentIncludeContext context;
+        context.workingDir = workingDir;
+        context.arenaAllocation = (ConfigNodeArena::current() != nullptr);
+        context.sharingScope = ConfigNodeSharingScope::current();
+        context.includeCache = ConfigIncludeCacheScope::current();
+
+        auto *threadPool = QThreadPool::globalInstance();
+
+        for (auto &include : concurrentIncludes)
+        {
+            threadPool->start(new Internal::ConcurrentIncludeReader(&context, &include));
+        }
+
+        int includesReadOnThreadPool = 0;
+
+        for (auto &include : concurrentIncludes)
+        {
+            if (include.started->exchange(true))
+            {
+                includesReadOnThreadPool++;
+            }
+            else
+            {
+                Internal::readConcurrentInclude(context, &include);
+            }
+        }
+
+        context.includesReadOnThreadPool.acquire(includesReadOnThreadPool);
+    }
+
+    // Nothing is applied if the includes depend on each other, they need to be read one after
+    // another to get the same result
+    const int dependentInclude = Internal::findDependentInclude(concurrentIncludes,
+                                                                *environmentVariables);
+
+    if (dependentInclude >= 0)
+    {
+        qCDebug(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Include at index" << dependentInclude
+                << "depends on the includes before it, the includes are read sequentially";
+        return false;
+    }
+
+    // Apply the read configs and the new environment variables in the declaration order
+    auto *recorder = ConfigDependencyRecorder::current();
+
+    for (size_t i = 0; i < concurrentIncludes.size(); i++)
+    {
+        const auto &include = concurrentIncludes.at(i);
+        includesConfig->apply(*include.config);
+
+        if (recorder != nullptr)
+        {
+            // References to the copies of the external configs are references to the originals
+            auto dependencies = include.dependencies;
+
+            for (size_t j = 0; j < externalConfigs.size(); j++)
+            {
+                dependencies.replaceExternalConfig(include.externalConfigs.at(j),
+                                                   externalConfigs.at(j));
+            }
+
+            recorder->dependencies().merge(dependencies);
+        }
+
+        const auto &variables = include.environmentVariables.variables();
+
+        for (auto it = variables.begin(); it != variables.end(); it++)
+        {
+            if (!environmentVariables->variables().contains(it.key()))
+            {
+                environmentVariables->setValue(it.key(), it.value());
+            }
+        }
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
 std::unique_ptr<ConfigObjectNode> ConfigReader::readConfigMember(
         const QJsonObject &rootObject,
         const std::vector<const ConfigObjectNode *> &externalConfigs,
@@ -501,33 +990,86 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::readConfigMember(
         return {};
     }
 
-    // Extend the external configs with the includesConfig
-    std::vector<const ConfigObjectNode *> extendedExternalConfigs;
-    extendedExternalConfigs.reserve(externalConfigs.size() + 1U);
-    extendedExternalConfigs.push_back(&includesConfig);
-    extendedExternalConfigs.insert(extendedExternalConfigs.end(),
-                                   externalConfigs.begin(),
-                                   externalConfigs.end());
-
-    // Resolve references
-    if (!resolveReferences(extendedExternalConfigs, config.get()))
-    {
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                << "Failed to resolve references!";
-        return {};
-    }
-
-    return config;
+    return resolveConfigMember(std::move(config), externalConfigs, includesConfig);
 }
 
 // -------------------------------------------------------------------------------------------------
 
-std::unique_ptr<ConfigValueNode> ConfigReader::readValueNode(const QJsonValue &jsonValue,
-                                                             const ConfigNodePath &currentNodePath)
+std::unique_ptr<ConfigObjectNode> ConfigReader::readConfigMember(
+        ConfigJsonStreamParser *parser,
+        const std::vector<const ConfigObjectNode *> &externalConfigs,
+        const ConfigObjectNode &includesConfig,
+        const EnvironmentVariables &environmentVariables) const
 {
-    Q_UNUSED(currentNodePath)
+    switch (parser->peekValueType())
+    {
+        case ConfigJsonStreamParser::ValueType::Null:
+        {
+            // No configuration
+            parser->skipValue();
+            return std::make_unique<ConfigObjectNode>();
+        }
 
-    return std::make_unique<ConfigValueNode>(jsonValue);
+        case ConfigJsonStreamParser::ValueType::Object:
+        {
+            break;
+        }
+
+        default:
+        {
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                    << "The 'config' member in the root JSON Object is not a JSON Object!";
+            return {};
+        }
+    }
+
+    // Read 'config' object
+    auto config = readObjectNode(parser, ConfigNodePath::ROOT_PATH, environmentVariables);
+
+    if (!config)
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Failed to read the 'config' member in the root JSON Object!";
+        return {};
+    }
+
+    return resolveConfigMember(std::move(config), externalConfigs, includesConfig);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> ConfigReader::resolveConfigMember(
+        std::unique_ptr<ConfigObjectNode> config,
+        const std::vector<const ConfigObjectNode *> &externalConfigs,
+        const ConfigObjectNode &includesConfig) const
+{
+    // Extend the external configs with the includesConfig
+    std::vector<const ConfigObjectNode *> extendedExternalConfigs;
+    extendedExternalConfigs.reserve(externalConfigs.size() + 1U);
+    extendedExternalConfigs.push_back(&includesConfig);
+    extendedExternalConfigs.insert(extendedExternalConfigs.end(),
+                                   externalConfigs.begin(),
+                                   externalConfigs.end());
+
+    // Resolve references
+    if (!resolveReferences(extendedExternalConfigs, config.get()))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Failed to resolve references!";
+        return {};
+    }
+
+    return config;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigValueNode> ConfigReader::readValueNode(const QJsonValue &jsonValue,
+                                                             const ConfigNodePath &currentNodePath)
+{
+    Q_UNUSED(currentNodePath)
+
+    return std::make_unique<ConfigValueNode>(jsonValue);
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -541,130 +1083,263 @@ std::unique_ptr<ConfigObjectNode> ConfigReader::readObjectNode(
 
     for (auto it = jsonObject.begin(); it != jsonObject.end(); it++)
     {
-        QString memberName = it.key();
-
         // Check for "decorators" in the member name (reference type or Value node)
+        QString memberName;
         QChar decorator;
 
-        if (hasDecorator(memberName))
+        if (!splitMemberName(it.key(), currentNodePath, &memberName, &decorator))
+        {
+            return {};
+        }
+
+        // Create a node based considering the decorator
+        const ConfigNodePath memberNodePath = currentNodePath.append(memberName);
+        auto memberNode = readMemberNode(decorator,
+                                         it.value(),
+                                         memberNodePath,
+                                         environmentVariables);
+
+        if (!memberNode)
         {
-            decorator = memberName.at(0);
-            memberName = memberName.mid(1);
+            return {};
         }
 
-        // Validate member name
-        if (!ConfigNodePath::validateNodeName(memberName))
+        // Add member to the object
+        objectNode->setMember(memberName, std::move(memberNode));
+    }
+
+    return objectNode;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> ConfigReader::readObjectNode(
+        ConfigJsonStreamParser *parser,
+        const ConfigNodePath &currentNodePath,
+        const EnvironmentVariables &environmentVariables)
+{
+    if (!parser->beginObject())
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << QString("Failed to parse a JSON Object at path [%1]: %2")
+                   .arg(currentNodePath.path(), parser->errorString());
+        return {};
+    }
+
+    auto objectNode = std::make_unique<ConfigObjectNode>();
+    QString key;
+
+    while (parser->nextMember(&key))
+    {
+        // Check for "decorators" in the member name (reference type or Value node)
+        QString memberName;
+        QChar decorator;
+
+        if (!splitMemberName(key, currentNodePath, &memberName, &decorator))
         {
-            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                    << QString("Invalid member name [%1] in path [%2]")
-                       .arg(memberName, currentNodePath.path());
             return {};
         }
 
-        // Create a node based considering the decorator
+        // Create a node based considering the decorator (Object and DerivedObject nodes are read
+        // member by member, all other nodes are created from their whole JSON Value)
         std::unique_ptr<ConfigNode> memberNode;
         const ConfigNodePath memberNodePath = currentNodePath.append(memberName);
+        const bool isObject =
+                (parser->peekValueType() == ConfigJsonStreamParser::ValueType::Object);
 
-        switch (decorator.toLatin1())
+        if (isObject && (decorator == QChar('&')))
         {
-            case '#':
+            memberNode = readDerivedObjectNode(parser, memberNodePath, environmentVariables);
+
+            if (!memberNode)
             {
-                // Explicit Value node (even if it is a JSON Object type)
-                memberNode = readValueNode(it.value(), memberNodePath);
-                Q_ASSERT(memberNode != nullptr);
-                break;
+                qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                        << "Failed to read the a NodeReference node member:"
+                           "\n    member node path:" << memberNodePath.path();
+                return {};
+            }
+        }
+        else if (isObject && decorator.isNull())
+        {
+            memberNode = readObjectNode(parser, memberNodePath, environmentVariables);
+
+            if (!memberNode)
+            {
+                qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                        << "Failed to read the an ordinary Object node member:"
+                           "\n    member node path:" << memberNodePath.path();
+                return {};
+            }
+        }
+        else
+        {
+            QJsonValue value;
+
+            if (!parser->readValue(&value))
+            {
+                qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                        << QString("Failed to parse a JSON Value at path [%1]: %2")
+                           .arg(memberNodePath.path(), parser->errorString());
+                return {};
+            }
+
+            memberNode = readMemberNode(decorator, value, memberNodePath, environmentVariables);
+
+            if (!memberNode)
+            {
+                return {};
             }
+        }
+
+        // Add member to the object
+        objectNode->setMember(memberName, std::move(memberNode));
+    }
+
+    if (parser->hasError())
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << QString("Failed to parse a JSON Object at path [%1]: %2")
+                   .arg(currentNodePath.path(), parser->errorString());
+        return {};
+    }
+
+    return objectNode;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigNode> ConfigReader::readMemberNode(
+        const QChar decorator,
+        const QJsonValue &jsonValue,
+        const ConfigNodePath &memberNodePath,
+        const EnvironmentVariables &environmentVariables)
+{
+    std::unique_ptr<ConfigNode> memberNode;
+
+    switch (decorator.toLatin1())
+    {
+        case '#':
+        {
+            // Explicit Value node (even if it is a JSON Object type)
+            memberNode = readValueNode(jsonValue, memberNodePath);
+            Q_ASSERT(memberNode != nullptr);
+            break;
+        }
 
-            case '$':
+        case '$':
+        {
+            // Explicit Value node (even if it is a JSON Array or Object type) where references
+            // to environment variables in the value are resolved
+            const QJsonValue resolvedValue = resolveJsonValue(jsonValue, environmentVariables);
+
+            if (resolvedValue.isUndefined())
             {
-                // Explicit Value node (even if it is a JSON Array or Object type) where references
-                // to environment variables in the value are resolved
-                const QJsonValue resolvedValue = resolveJsonValue(it.value(), environmentVariables);
+                qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                        << "Failed to resolve a Value node with references to "
+                           "environment variables:"
+                           "\n    member node path:" << memberNodePath.path();
+                return {};
+            }
+
+            memberNode = readValueNode(resolvedValue, memberNodePath);
+            Q_ASSERT(memberNode != nullptr);
+            break;
+        }
+
+        case '&':
+        {
+            // One of the reference types
+            if (jsonValue.isString())
+            {
+                memberNode = readNodeReferenceNode(jsonValue.toString(), memberNodePath);
 
-                if (resolvedValue.isUndefined())
+                if (!memberNode)
                 {
                     qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                            << "Failed to resolve a Value node with references to "
-                               "environment variables:"
+                            << "Failed to read the a NodeReference node member:"
                                "\n    member node path:" << memberNodePath.path();
                     return {};
                 }
-
-                memberNode = readValueNode(resolvedValue, memberNodePath);
-                Q_ASSERT(memberNode != nullptr);
-                break;
             }
-
-            case '&':
+            else if (jsonValue.isObject())
             {
-                // One of the reference types
-                if (it.value().isString())
-                {
-                    memberNode = readNodeReferenceNode(it.value().toString(), memberNodePath);
+                memberNode = readDerivedObjectNode(jsonValue.toObject(),
+                                                   memberNodePath,
+                                                   environmentVariables);
 
-                    if (!memberNode)
-                    {
-                        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                                << "Failed to read the a NodeReference node member:"
-                                   "\n    member node path:" << memberNodePath.path();
-                        return {};
-                    }
-                }
-                else if (it.value().isObject())
-                {
-                    memberNode = readDerivedObjectNode(it.value().toObject(),
-                                                       memberNodePath,
-                                                       environmentVariables);
-
-                    if (!memberNode)
-                    {
-                        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                                << "Failed to read the a NodeReference node member:"
-                                   "\n    member node path:" << memberNodePath.path();
-                        return {};
-                    }
-                }
-                else
+                if (!memberNode)
                 {
                     qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                            << "Unsupported reference type at path:" << memberNodePath.path();
+                            << "Failed to read the a NodeReference node member:"
+                               "\n    member node path:" << memberNodePath.path();
                     return {};
                 }
-                break;
             }
+            else
+            {
+                qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                        << "Unsupported reference type at path:" << memberNodePath.path();
+                return {};
+            }
+            break;
+        }
 
-            default:
+        default:
+        {
+            // No decorators, just an ordinary node
+            if (jsonValue.isObject())
             {
-                // No decorators, just an ordinary node
-                if (it.value().isObject())
-                {
-                    memberNode = readObjectNode(it.value().toObject(),
-                                                memberNodePath,
-                                                environmentVariables);
+                memberNode = readObjectNode(jsonValue.toObject(),
+                                            memberNodePath,
+                                            environmentVariables);
 
-                    if (!memberNode)
-                    {
-                        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                                << "Failed to read the an ordinary Object node member:"
-                                   "\n    member node path:" << memberNodePath.path();
-                        return {};
-                    }
-                }
-                else
+                if (!memberNode)
                 {
-                    memberNode = readValueNode(it.value(), memberNodePath);
-                    Q_ASSERT(memberNode != nullptr);
+                    qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                            << "Failed to read the an ordinary Object node member:"
+                               "\n    member node path:" << memberNodePath.path();
+                    return {};
                 }
-                break;
             }
+            else
+            {
+                memberNode = readValueNode(jsonValue, memberNodePath);
+                Q_ASSERT(memberNode != nullptr);
+            }
+            break;
         }
+    }
 
-        // Add member to the object
-        Q_ASSERT(memberNode != nullptr);
-        objectNode->setMember(memberName, std::move(memberNode));
+    Q_ASSERT(memberNode != nullptr);
+    return memberNode;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigReader::splitMemberName(const QString &key,
+                                   const ConfigNodePath &currentNodePath,
+                                   QString *memberName,
+                                   QChar *decorator)
+{
+    *memberName = key;
+    *decorator = QChar();
+
+    if (hasDecorator(key))
+    {
+        *decorator = key.at(0);
+        *memberName = key.mid(1);
     }
 
-    return objectNode;
+    // Validate member name
+    if (!ConfigNodePath::validateNodeName(*memberName))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << QString("Invalid member name [%1] in path [%2]")
+                   .arg(*memberName, currentNodePath.path());
+        return false;
+    }
+
+    return true;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -693,22 +1368,167 @@ std::unique_ptr<ConfigDerivedObjectNode> ConfigReader::readDerivedObjectNode(
         const EnvironmentVariables &environmentVariables)
 {
     // Extract bases
-    const auto baseValue = jsonObject.value(QStringLiteral("base"));
+    QList<ConfigNodePath> bases;
 
-    if (baseValue.isUndefined())
+    if (!readDerivedObjectBases(jsonObject.value(QStringLiteral("base")),
+                                currentNodePath,
+                                &bases))
+    {
+        return {};
+    }
+
+    // Extract config
+    auto config = std::make_unique<ConfigObjectNode>();
+    const auto configValue = jsonObject.value(QStringLiteral("config"));
+
+    switch (configValue.type())
+    {
+        case QJsonValue::Object:
+        {
+            // Read overrides for the object derived from bases
+            config = readObjectNode(configValue.toObject(), currentNodePath, environmentVariables);
+
+            if (!config)
+            {
+                qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                        << "Failed to read the overrides for the object derived from bases at path:"
+                           "\n    node path:" << currentNodePath.path();
+                return {};
+            }
+            break;
+        }
+
+        case QJsonValue::Null:
+        case QJsonValue::Undefined:
+        {
+            // No overrides for the object derived from bases
+            break;
+        }
+
+        default:
+        {
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                    << "Unsupported JSON type for the 'config' member at path:"
+                    << currentNodePath.path();
+            return {};
+        }
+    }
+
+    // Create derived object node
+    return std::make_unique<ConfigDerivedObjectNode>(bases, *config);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigDerivedObjectNode> ConfigReader::readDerivedObjectNode(
+        ConfigJsonStreamParser *parser,
+        const ConfigNodePath &currentNodePath,
+        const EnvironmentVariables &environmentVariables)
+{
+    if (!parser->beginObject())
     {
         qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                << "A derived object doesn't have the 'base' member at path:"
-                << currentNodePath.path();
+                << QString("Failed to parse a JSON Object at path [%1]: %2")
+                   .arg(currentNodePath.path(), parser->errorString());
+        return {};
+    }
+
+    // Extract the members
+    QJsonValue baseValue(QJsonValue::Undefined);
+    auto config = std::make_unique<ConfigObjectNode>();
+    QString key;
+
+    while (parser->nextMember(&key))
+    {
+        if (key == QStringLiteral("base"))
+        {
+            if (!parser->readValue(&baseValue))
+            {
+                break;
+            }
+        }
+        else if (key == QStringLiteral("config"))
+        {
+            switch (parser->peekValueType())
+            {
+                case ConfigJsonStreamParser::ValueType::Object:
+                {
+                    // Read overrides for the object derived from bases
+                    config = readObjectNode(parser, currentNodePath, environmentVariables);
+
+                    if (!config)
+                    {
+                        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                                << "Failed to read the overrides for the object derived from "
+                                   "bases at path:"
+                                   "\n    node path:" << currentNodePath.path();
+                        return {};
+                    }
+                    break;
+                }
+
+                case ConfigJsonStreamParser::ValueType::Null:
+                {
+                    // No overrides for the object derived from bases
+                    parser->skipValue();
+                    config = std::make_unique<ConfigObjectNode>();
+                    break;
+                }
+
+                default:
+                {
+                    qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                            << "Unsupported JSON type for the 'config' member at path:"
+                            << currentNodePath.path();
+                    return {};
+                }
+            }
+        }
+        else
+        {
+            // Other members are ignored
+            parser->skipValue();
+        }
+    }
+
+    if (parser->hasError())
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << QString("Failed to parse a JSON Object at path [%1]: %2")
+                   .arg(currentNodePath.path(), parser->errorString());
         return {};
     }
 
+    // Extract bases
     QList<ConfigNodePath> bases;
 
+    if (!readDerivedObjectBases(baseValue, currentNodePath, &bases))
+    {
+        return {};
+    }
+
+    // Create derived object node
+    return std::make_unique<ConfigDerivedObjectNode>(bases, *config);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigReader::readDerivedObjectBases(const QJsonValue &baseValue,
+                                          const ConfigNodePath &currentNodePath,
+                                          QList<ConfigNodePath> *bases)
+{
+    if (baseValue.isUndefined())
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "A derived object doesn't have the 'base' member at path:"
+                << currentNodePath.path();
+        return false;
+    }
+
     if (baseValue.isString())
     {
         // Single base
-        bases.append(ConfigNodePath(baseValue.toString()));
+        bases->append(ConfigNodePath(baseValue.toString()));
     }
     else if (baseValue.isArray())
     {
@@ -719,17 +1539,17 @@ std::unique_ptr<ConfigDerivedObjectNode> ConfigReader::readDerivedObjectNode(
                 qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
                         << "Unsupported JSON type for an item in the 'base' member at path:"
                         << currentNodePath.path();
-                return {};
+                return false;
             }
 
-            bases.append(ConfigNodePath(item.toString()));
+            bases->append(ConfigNodePath(item.toString()));
         }
 
-        if (bases.isEmpty())
+        if (bases->isEmpty())
         {
             qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
                     << "The 'base' member is empty at path:" << currentNodePath.path();
-            return {};
+            return false;
         }
     }
     else
@@ -737,10 +1557,10 @@ std::unique_ptr<ConfigDerivedObjectNode> ConfigReader::readDerivedObjectNode(
         qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
                 << "Unsupported JSON type for an item in the 'base' member at path:"
                 << currentNodePath.path();
-        return {};
+        return false;
     }
 
-    for (const auto &item : bases)
+    for (const auto &item : *bases)
     {
         if (!item.toAbsolute(currentNodePath).isValid())
         {
@@ -749,49 +1569,11 @@ std::unique_ptr<ConfigDerivedObjectNode> ConfigReader::readDerivedObjectNode(
                                "\n    base item's node path: %1"
                                "\n    node path: %2")
                        .arg(item.path(), currentNodePath.path());
-            return {};
-        }
-    }
-
-    // Extract config
-    auto config = std::make_unique<ConfigObjectNode>();
-    const auto configValue = jsonObject.value(QStringLiteral("config"));
-
-    switch (configValue.type())
-    {
-        case QJsonValue::Object:
-        {
-            // Read overrides for the object derived from bases
-            config = readObjectNode(configValue.toObject(), currentNodePath, environmentVariables);
-
-            if (!config)
-            {
-                qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                        << "Failed to read the overrides for the object derived from bases at path:"
-                           "\n    node path:" << currentNodePath.path();
-                return {};
-            }
-            break;
-        }
-
-        case QJsonValue::Null:
-        case QJsonValue::Undefined:
-        {
-            // No overrides for the object derived from bases
-            break;
-        }
-
-        default:
-        {
-            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                    << "Unsupported JSON type for the 'config' member at path:"
-                    << currentNodePath.path();
-            return {};
+            return false;
         }
     }
 
-    // Create derived object node
-    return std::make_unique<ConfigDerivedObjectNode>(bases, *config);
+    return true;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -927,9 +1709,40 @@ QJsonValue ConfigReader::resolveJsonObject(const QJsonObject &jsonObject,
 
 bool ConfigReader::hasDecorator(const QString &memberName)
 {
-    static QRegularExpression regex("^[&#$]");
+    if (memberName.isEmpty())
+    {
+        return false;
+    }
 
-    return regex.match(memberName).hasMatch();
+    const QChar decorator = memberName.at(0);
+
+    return ((decorator == QChar('&')) ||
+            (decorator == QChar('#')) ||
+            (decorator == QChar('$')));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigReader::validateEnvironmentVariableName(const QString &name)
+{
+    if (name.isEmpty())
+    {
+        return false;
+    }
+
+    for (const QChar character : name)
+    {
+        const ushort code = character.unicode();
+
+        if (!((((code | 0x20U) >= 'a') && ((code | 0x20U) <= 'z')) ||
+              ((code >= '0') && (code <= '9')) ||
+              (code == '_')))
+        {
+            return false;
+        }
+    }
+
+    return true;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -941,4 +1754,121 @@ void ConfigReader::setCurrentDirectory(const QDir &currentDir,
                                    currentDir.absolutePath());
 }
 
+// -------------------------------------------------------------------------------------------------
+
+namespace Internal
+{
+
+ConcurrentIncludeReader::ConcurrentIncludeReader(ConcurrentIncludeContext *context,
+                                                 ConcurrentInclude *include)
+    : m_context(context),
+      m_include(include),
+      m_started(include->started)
+{
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConcurrentIncludeReader::run()
+{
+    // The include could already be read by the thread that waits for the includes (in that case the
+    // context and the include must not be accessed anymore)
+    if (m_started->exchange(true))
+    {
+        return;
+    }
+
+    readConcurrentInclude(*m_context, m_include);
+    m_context->includesReadOnThreadPool.release();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void readConcurrentInclude(const ConcurrentIncludeContext &context, ConcurrentInclude *include)
+{
+    std::unique_ptr<ConfigNodeArenaScope> arenaScope;
+
+    if (context.arenaAllocation)
+    {
+        arenaScope = std::make_unique<ConfigNodeArenaScope>();
+    }
+
+    // Dependencies are needed to find out if the include depends on the includes before it
+    ConfigDependencyRecorder recorder;
+
+    // Nodes of the include share their members with the nodes of the thread that reads the includes
+    // (it waits for this thread to finish before it accesses them)
+    ConfigNodeSharingScope sharingScope(context.sharingScope);
+    ConfigIncludeCacheScope includeCacheScope(context.includeCache);
+
+    include->config = ConfigReaderRegistry::instance()->readConfig(
+                          include->type,
+                          context.workingDir,
+                          include->destinationNodePath,
+                          include->parameters,
+                          include->externalConfigs,
+                          &include->environmentVariables);
+
+    // Dependencies are taken from the recorder so that they are not merged to the recorder that is
+    // active for the thread that waits for the includes (only if the includes are applied)
+    include->dependencies = recorder.dependencies();
+    recorder.dependencies() = ConfigDependencies();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int findDependentInclude(const std::vector<ConcurrentInclude> &includes,
+                         const EnvironmentVariables &environmentVariables)
+{
+    // Every include gets its own current directory so it is not inherited from the other includes
+    const QString currentDirName = QStringLiteral("CPPCONFIGFRAMEWORK_CURRENT_DIR");
+    QSet<QString> addedNames;
+
+    for (size_t i = 0; i < includes.size(); i++)
+    {
+        const auto &include = includes.at(i);
+
+        if (!include.config)
+        {
+            return static_cast<int>(i);
+        }
+
+        for (const QString &name : include.dependencies.environmentVariables())
+        {
+            if (addedNames.contains(name))
+            {
+                return static_cast<int>(i);
+            }
+        }
+
+        const auto &variables = include.environmentVariables.variables();
+
+        for (auto it = variables.begin(); it != variables.end(); it++)
+        {
+            if ((it.key() != currentDirName) &&
+                (!environmentVariables.variables().contains(it.key())))
+            {
+                addedNames.insert(it.key());
+            }
+        }
+    }
+
+    return -1;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> finishRead(std::unique_ptr<ConfigObjectNode> config,
+                                             const ConfigNodeSharingScope &sharingScope)
+{
+    if (config && sharingScope.isOutermost())
+    {
+        config->detach();
+    }
+
+    return config;
+}
+
+} // namespace Internal
+
 } // namespace CppConfigFramework
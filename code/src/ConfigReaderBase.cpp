@@ -22,6 +22,7 @@
 #include <CppConfigFramework/ConfigReaderBase.hpp>
 
 // C++ Config Framework includes
+#include <CppConfigFramework/ConfigDependencies.hpp>
 #include <CppConfigFramework/ConfigDerivedObjectNode.hpp>
 #include <CppConfigFramework/ConfigNodeReference.hpp>
 #include <CppConfigFramework/ConfigObjectNode.hpp>
@@ -29,8 +30,11 @@
 #include <CppConfigFramework/LoggingCategories.hpp>
 
 // Qt includes
+#include <QtCore/QSet>
 
 // System includes
+#include <deque>
+#include <map>
 
 // Forward declarations
 
@@ -41,299 +45,404 @@
 namespace CppConfigFramework
 {
 
-uint32_t ConfigReaderBase::referenceResolutionMaxCycles() const
+namespace Internal
 {
-    return m_referenceResolutionMaxCycles;
-}
 
-// -------------------------------------------------------------------------------------------------
+//! Holds the unresolved reference nodes (NodeReference and DerivedObject nodes) by node path
+using PendingReferences = std::map<QString, ConfigNode *>;
 
-void ConfigReaderBase::setReferenceResolutionMaxCycles(const uint32_t referenceResolutionMaxCycles)
-{
-    m_referenceResolutionMaxCycles = referenceResolutionMaxCycles;
-}
+void collectPendingReferences(ConfigNode *node, PendingReferences *pendingReferences);
+QStringList dependencyNodePaths(const ConfigNode &node);
+QString findBlockingReference(const ConfigNode &node, const PendingReferences &pendingReferences);
+QStringList findDependencyCycle(const std::map<QString, QString> &blockedBy);
+void collectUnresolvedReferences(const ConfigObjectNode &node,
+                                 const ConfigNodePath &nodePath,
+                                 QStringList *references);
 
 // -------------------------------------------------------------------------------------------------
 
-bool ConfigReaderBase::isFullyResolved(const ConfigNode &node)
+void collectPendingReferences(ConfigNode *node, PendingReferences *pendingReferences)
 {
-    switch (node.type())
+    switch (node->type())
     {
         case ConfigNode::Type::Value:
         {
-            return true;
+            break;
         }
 
         case ConfigNode::Type::Object:
         {
-            const auto &objectNode = node.toObject();
+            auto &objectNode = node->toObject();
 
-            for (const auto &name : objectNode.names())
+            if (objectNode.unresolvedReferenceCount() == 0)
             {
-                if (!isFullyResolved(*objectNode.member(name)))
-                {
-                    return false;
-                }
+                break;
             }
 
-            return true;
+            // The pending references are modified later so they are taken through the non-const
+            // member() (the members of the shared node stay unchanged while they are copied)
+            const ConfigSortedMembers members = objectNode.sortedMembers();
+
+            for (size_t i = 0U; i < members.count(); i++)
+            {
+                collectPendingReferences(objectNode.member(members.at(i).name), pendingReferences);
+            }
+            break;
         }
 
-        default:
+        case ConfigNode::Type::NodeReference:
+        case ConfigNode::Type::DerivedObject:
         {
+            pendingReferences->emplace(node->nodePath().path(), node);
             break;
         }
     }
-
-    return false;
 }
 
 // -------------------------------------------------------------------------------------------------
 
-QStringList ConfigReaderBase::unresolvedReferences(const ConfigObjectNode &node)
+QStringList dependencyNodePaths(const ConfigNode &node)
 {
-    QStringList references;
+    // Absolute node paths (without parent node references) of all of the nodes that are referenced
+    // by the NodeReference node or used as bases by the DerivedObject node
+    const QList<ConfigNodePath> references =
+            node.isNodeReference() ? QList<ConfigNodePath> { node.toNodeReference().reference() }
+                                   : node.toDerivedObject().bases();
+    const ConfigNodePath parentNodePath = node.parent()->nodePath();
 
-    // Iterate over all members and add all nodes of a reference type to the list
-    for (const QString &name : node.names())
+    QStringList nodePaths;
+
+    for (const auto &reference : references)
     {
-        const auto *member = node.member(name);
+        ConfigNodePath absoluteNodePath = reference.toAbsolute(parentNodePath);
 
-        if (member->isNodeReference() || member->isDerivedObject())
+        if (absoluteNodePath.resolveReferences() && absoluteNodePath.isValid())
         {
-            references.append(member->nodePath().path());
+            nodePaths.append(absoluteNodePath.path());
         }
-        else if (member->isObject())
+    }
+
+    return nodePaths;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QString findBlockingReference(const ConfigNode &node, const PendingReferences &pendingReferences)
+{
+    // A referenced node is available only when none of the nodes in its node path is an unresolved
+    // reference node and it is fully resolved only when it doesn't contain unresolved reference
+    // nodes
+    for (const QString &nodePath : dependencyNodePaths(node))
+    {
+        if (nodePath != ConfigNodePath::ROOT_PATH_VALUE)
         {
-            references.append(unresolvedReferences(member->toObject()));
+            int index = 0;
+
+            while (index >= 0)
+            {
+                index = nodePath.indexOf(QChar('/'), index + 1);
+                const QString ancestorNodePath = (index < 0) ? nodePath : nodePath.left(index);
+
+                if (pendingReferences.find(ancestorNodePath) != pendingReferences.end())
+                {
+                    return ancestorNodePath;
+                }
+            }
         }
-        else
+
+        const QString prefix = (nodePath == ConfigNodePath::ROOT_PATH_VALUE) ? nodePath
+                                                                              : nodePath + '/';
+        const auto it = pendingReferences.lower_bound(prefix);
+
+        if ((it != pendingReferences.end()) && it->first.startsWith(prefix))
         {
-            // No unresolved references
+            return it->first;
         }
     }
 
-    return references;
+    return {};
 }
 
 // -------------------------------------------------------------------------------------------------
 
-bool ConfigReaderBase::resolveReferences(
-        const std::vector<const ConfigObjectNode *> &externalConfigs,
-        ConfigObjectNode *config) const
+QStringList findDependencyCycle(const std::map<QString, QString> &blockedBy)
 {
-    auto result = ReferenceResolutionResult::Unchanged;
-    uint32_t resolutionCycle;
+    Q_ASSERT(!blockedBy.empty());
+
+    // Every blocked reference node waits for another blocked reference node so following the
+    // dependencies from any of them has to lead to a cycle
+    QStringList visited;
+    QSet<QString> visitedSet;
+    QString current = blockedBy.begin()->first;
 
-    for (resolutionCycle = 0;
-         (resolutionCycle < m_referenceResolutionMaxCycles) &&
-         (result != ReferenceResolutionResult::Resolved);
-         resolutionCycle++)
+    while (!visitedSet.contains(current))
     {
-        // Try to resolve references without external configuration nodes
-        auto newResult = resolveObjectReferences({}, config);
+        visited.append(current);
+        visitedSet.insert(current);
 
-        switch (newResult)
+        const auto it = blockedBy.find(current);
+
+        if (it == blockedBy.end())
         {
-            case ReferenceResolutionResult::Resolved:
-            case ReferenceResolutionResult::PartiallyResolved:
-            {
-                result = newResult;
-                break;
-            }
+            return visited;
+        }
 
-            case ReferenceResolutionResult::Unchanged:
-            {
-                // Check if external configuration nodes are provided
-                if (externalConfigs.empty())
-                {
-                    result = ReferenceResolutionResult::Unchanged;
-                    break;
-                }
+        current = it->second;
+    }
 
-                // External configuration nodes are provided, try to resolve references with them
-                newResult = resolveObjectReferences(externalConfigs, config);
+    QStringList cycle = visited.mid(visited.indexOf(current));
+    cycle.append(current);
+    return cycle;
+}
 
-                switch (newResult)
-                {
-                    case ReferenceResolutionResult::Resolved:
-                    case ReferenceResolutionResult::PartiallyResolved:
-                    {
-                        result = newResult;
-                        break;
-                    }
+// -------------------------------------------------------------------------------------------------
 
-                    case ReferenceResolutionResult::Unchanged:
-                    {
-                        // Still unchanged
-                        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                                << QString("No references were resolved in the last cycle even "
-                                           "after using the external configuration nodes:"
-                                           "\n    cycle no.: %1"
-                                           "\n    unresolved references: [%2]")
-                                   .arg(resolutionCycle)
-                                   .arg(unresolvedReferences(*config).join("; "));
-                        return false;
-                    }
+void collectUnresolvedReferences(const ConfigObjectNode &node,
+                                 const ConfigNodePath &nodePath,
+                                 QStringList *references)
+{
+    if (node.unresolvedReferenceCount() == 0)
+    {
+        return;
+    }
 
-                    case ReferenceResolutionResult::Error:
-                    {
-                        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                                << QString("Failed to resolve references when using the external "
-                                           "configuration nodes:"
-                                           "\n    cycle no.: %1"
-                                           "\n    unresolved references: [%2]")
-                                   .arg(resolutionCycle)
-                                   .arg(unresolvedReferences(*config).join("; "));
-                        return false;
-                    }
-                }
-                break;
-            }
+    // Iterate over all members and add all nodes of a reference type to the list (members without
+    // unresolved references are skipped). Node paths are built from the names of the members since
+    // the members of a clone that is not detached belong to the shared node.
+    const auto *nameTable = ConfigNameTable::instance();
+    const ConfigSortedMembers members = node.sortedMembers();
 
-            case ReferenceResolutionResult::Error:
-            {
-                qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                        << QString("Failed to resolve references:"
-                                   "\n    cycle no.: %1"
-                                   "\n    unresolved references: [%2]")
-                           .arg(resolutionCycle)
-                           .arg(unresolvedReferences(*config).join("; "));
-                return false;
-            }
+    for (size_t i = 0U; i < members.count(); i++)
+    {
+        const auto &member = members.at(i);
+
+        if (member.node->isNodeReference() || member.node->isDerivedObject())
+        {
+            references->append(nodePath.append(nameTable->name(member.name)).path());
+        }
+        else if (member.node->isObject())
+        {
+            collectUnresolvedReferences(member.node->toObject(),
+                                        nodePath.append(nameTable->name(member.name)),
+                                        references);
+        }
+        else
+        {
+            // No unresolved references
         }
     }
+}
 
-    if (result != ReferenceResolutionResult::Resolved)
-    {
-        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
-                << QString("Failed to fully resolve references:"
-                           "\n    cycle no.: %1"
-                           "\n    unresolved references: [%2]")
-                   .arg(resolutionCycle)
-                   .arg(unresolvedReferences(*config).join("; "));
-        return false;
-    }
+} // namespace Internal
 
-    return true;
+// -------------------------------------------------------------------------------------------------
+
+uint32_t ConfigReaderBase::referenceResolutionMaxCycles() const
+{
+    return m_referenceResolutionMaxCycles;
 }
 
 // -------------------------------------------------------------------------------------------------
 
-ConfigReaderBase::ReferenceResolutionResult ConfigReaderBase::resolveObjectReferences(
-        const std::vector<const ConfigObjectNode *> &externalConfigs, ConfigObjectNode *node)
+void ConfigReaderBase::setReferenceResolutionMaxCycles(const uint32_t referenceResolutionMaxCycles)
 {
-    // Iterate over all members and try to resolve their references
-    auto result = ReferenceResolutionResult::Unchanged;
+    m_referenceResolutionMaxCycles = referenceResolutionMaxCycles;
+}
 
-    for (const QString &name : node->names())
-    {
-        // Try to resolve the member's references
-        auto *member = node->member(name);
+// -------------------------------------------------------------------------------------------------
 
-        switch (member->type())
-        {
-            case ConfigNode::Type::Value:
-            {
-                // Not a reference type, leave the result as is
-                break;
-            }
+bool ConfigReaderBase::arenaAllocationEnabled() const
+{
+    return m_arenaAllocationEnabled;
+}
 
-            case ConfigNode::Type::Object:
-            {
-                // Try to resolve the member's (Object node) references
-                auto newResult = resolveObjectReferences(externalConfigs, &member->toObject());
+// -------------------------------------------------------------------------------------------------
 
-                result = updateObjectResolutionResult(result, newResult);
-                break;
-            }
+void ConfigReaderBase::setArenaAllocationEnabled(const bool arenaAllocationEnabled)
+{
+    m_arenaAllocationEnabled = arenaAllocationEnabled;
+}
 
-            case ConfigNode::Type::NodeReference:
-            {
-                // Try to resolve the member's (NodeReference node) reference
-                auto newResult = resolveNodeReference(externalConfigs, &member->toNodeReference());
+// -------------------------------------------------------------------------------------------------
 
-                result = updateObjectResolutionResult(result, newResult);
-                break;
-            }
+bool ConfigReaderBase::parallelIncludesEnabled() const
+{
+    return m_parallelIncludesEnabled;
+}
 
-            case ConfigNode::Type::DerivedObject:
-            {
-                // Try to resolve the member's (DerivedObject node) references
-                auto newResult = resolveDerivedObjectReferences(externalConfigs,
-                                                                &member->toDerivedObject());
+// -------------------------------------------------------------------------------------------------
 
-                result = updateObjectResolutionResult(result, newResult);
-                break;
-            }
+void ConfigReaderBase::setParallelIncludesEnabled(const bool parallelIncludesEnabled)
+{
+    m_parallelIncludesEnabled = parallelIncludesEnabled;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigReaderBase::fileMappingEnabled() const
+{
+    return m_fileMappingEnabled;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigReaderBase::setFileMappingEnabled(const bool fileMappingEnabled)
+{
+    m_fileMappingEnabled = fileMappingEnabled;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigReaderBase::isFullyResolved(const ConfigNode &node)
+{
+    switch (node.type())
+    {
+        case ConfigNode::Type::Value:
+        {
+            return true;
         }
 
-        // Stop on error
-        if (result == ReferenceResolutionResult::Error)
+        case ConfigNode::Type::Object:
         {
-            return ReferenceResolutionResult::Error;
+            return (node.toObject().unresolvedReferenceCount() == 0);
         }
-    }
 
-    // Check if the object is fully resolved
-    if (isFullyResolved(*node))
-    {
-        return ReferenceResolutionResult::Resolved;
+        default:
+        {
+            break;
+        }
     }
 
-    return result;
+    return false;
 }
 
 // -------------------------------------------------------------------------------------------------
 
-ConfigReaderBase::ReferenceResolutionResult ConfigReaderBase::updateObjectResolutionResult(
-        const ConfigReaderBase::ReferenceResolutionResult currentResult,
-        const ConfigReaderBase::ReferenceResolutionResult newResult)
+QStringList ConfigReaderBase::unresolvedReferences(const ConfigObjectNode &node)
 {
-    auto result = currentResult;
+    QStringList references;
+    Internal::collectUnresolvedReferences(node, node.nodePath(), &references);
+    return references;
+}
 
-    switch (newResult)
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigReaderBase::resolveReferences(
+        const std::vector<const ConfigObjectNode *> &externalConfigs,
+        ConfigObjectNode *config) const
+{
+    Q_ASSERT(config != nullptr);
+
+    // Collect all of the reference nodes
+    Internal::PendingReferences pendingReferences;
+    Internal::collectPendingReferences(config, &pendingReferences);
+
+    if (pendingReferences.empty())
+    {
+        return true;
+    }
+
+    // Resolve the reference nodes in the order of their dependencies
+    std::deque<QString> candidates;
+
+    for (const auto &item : pendingReferences)
+    {
+        candidates.push_back(item.first);
+    }
+
+    std::map<QString, QString> blockedBy;
+    std::map<QString, QStringList> dependents;
+
+    while (!candidates.empty())
     {
-        case ReferenceResolutionResult::Resolved:
+        const QString nodePath = candidates.front();
+        candidates.pop_front();
+
+        auto it = pendingReferences.find(nodePath);
+        Q_ASSERT(it != pendingReferences.end());
+
+        // Check if the reference node still depends on an unresolved reference node
+        const QString blockingNodePath = Internal::findBlockingReference(*it->second,
+                                                                         pendingReferences);
+
+        if (!blockingNodePath.isEmpty())
         {
-            if (result == ReferenceResolutionResult::Unchanged)
-            {
-                result = ReferenceResolutionResult::PartiallyResolved;
-            }
-            break;
+            blockedBy[nodePath] = blockingNodePath;
+            dependents[blockingNodePath].append(nodePath);
+            continue;
         }
 
-        case ReferenceResolutionResult::Unchanged:
+        blockedBy.erase(nodePath);
+
+        // Resolve the reference node
+        ConfigNode *resolvedNode = nullptr;
+
+        if (it->second->isNodeReference())
         {
-            if (result == ReferenceResolutionResult::Resolved)
-            {
-                result = ReferenceResolutionResult::PartiallyResolved;
-            }
-            break;
+            resolvedNode = resolveNodeReference(externalConfigs, &it->second->toNodeReference());
+        }
+        else
+        {
+            resolvedNode = resolveDerivedObjectReferences(externalConfigs,
+                                                          &it->second->toDerivedObject());
         }
 
-        case ReferenceResolutionResult::PartiallyResolved:
+        if (resolvedNode == nullptr)
         {
-            if ((result == ReferenceResolutionResult::Resolved) ||
-                (result == ReferenceResolutionResult::Unchanged))
-            {
-                result = ReferenceResolutionResult::PartiallyResolved;
-            }
-            break;
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                    << QString("Failed to resolve references:"
+                               "\n    reference node: %1"
+                               "\n    unresolved references: [%2]")
+                       .arg(nodePath, unresolvedReferences(*config).join("; "));
+            return false;
         }
 
-        case ReferenceResolutionResult::Error:
+        pendingReferences.erase(it);
+
+        // The resolved node can contain new reference nodes (for example from the overrides in a
+        // DerivedObject node)
+        Internal::PendingReferences newReferences;
+        Internal::collectPendingReferences(resolvedNode, &newReferences);
+
+        for (auto &item : newReferences)
+        {
+            candidates.push_back(item.first);
+            pendingReferences.insert(std::move(item));
+        }
+
+        // Reevaluate all reference nodes that were waiting for this node to be resolved
+        auto dependentsIt = dependents.find(nodePath);
+
+        if (dependentsIt != dependents.end())
         {
-            result = ReferenceResolutionResult::Error;
+            for (const QString &dependentNodePath : dependentsIt->second)
+            {
+                candidates.push_back(dependentNodePath);
+            }
+
+            dependents.erase(dependentsIt);
         }
     }
 
-    return result;
+    // All the remaining reference nodes are waiting for each other
+    if (!blockedBy.empty())
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << QString("Failed to resolve references because of a cyclic dependency:"
+                           "\n    cycle: [%1]"
+                           "\n    unresolved references: [%2]")
+                   .arg(Internal::findDependencyCycle(blockedBy).join(" -> "),
+                        unresolvedReferences(*config).join("; "));
+        return false;
+    }
+
+    Q_ASSERT(pendingReferences.empty());
+    return true;
 }
 
 // -------------------------------------------------------------------------------------------------
 
-ConfigReaderBase::ReferenceResolutionResult ConfigReaderBase::resolveNodeReference(
+ConfigNode *ConfigReaderBase::resolveNodeReference(
         const std::vector<const ConfigObjectNode *> &externalConfigs, ConfigNodeReference *node)
 {
     // Try to get the referenced node
@@ -344,28 +453,30 @@ ConfigReaderBase::ReferenceResolutionResult ConfigReaderBase::resolveNodeReferen
 
     if (referencedNode == nullptr)
     {
-        return ReferenceResolutionResult::Unchanged;
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << QString("Node [%1] referenced by the NodeReference node [%2] was not found!")
+                   .arg(node->reference().path(), node->nodePath().path());
+        return nullptr;
     }
 
-    auto result = (isFullyResolved(*referencedNode) ? ReferenceResolutionResult::Resolved
-                                                    : ReferenceResolutionResult::PartiallyResolved);
-
     // Replace the current node with the referenced node
-    if (!parentNode->setMember(parentNode->name(*node), *referencedNode))
+    const QString name = parentNode->name(*node);
+
+    if (!parentNode->setMember(name, *referencedNode))
     {
         qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
                 << QString("Failed to store the resolved NodeReference node [%1] to the parent "
                            "object at node path [%2]")
                    .arg(node->reference().path(), parentNode->nodePath().path());
-        return ReferenceResolutionResult::Error;
+        return nullptr;
     }
 
-    return result;
+    return parentNode->member(name);
 }
 
 // -------------------------------------------------------------------------------------------------
 
-ConfigReaderBase::ReferenceResolutionResult ConfigReaderBase::resolveDerivedObjectReferences(
+ConfigNode *ConfigReaderBase::resolveDerivedObjectReferences(
         const std::vector<const ConfigObjectNode *> &externalConfigs, ConfigDerivedObjectNode *node)
 {
     // Derive the config node from the all of the base nodes
@@ -380,14 +491,20 @@ ConfigReaderBase::ReferenceResolutionResult ConfigReaderBase::resolveDerivedObje
 
         if (baseNode == nullptr)
         {
-            return ReferenceResolutionResult::Unchanged;
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                    << QString("Base node [%1] in a DerivedObject node [%2] was not found!")
+                       .arg(baseNodePath.path(), node->nodePath().path());
+            return nullptr;
         }
 
-        // Check if the base node is fully resolved
+        // Check if the base node is fully resolved (only an external node can be unresolved)
         if (!isFullyResolved(*baseNode))
         {
-            // Base node is not resolved (yet)
-            return ReferenceResolutionResult::Unchanged;
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                    << QString("Base node [%1] in a DerivedObject node [%2] is not fully "
+                               "resolved!")
+                       .arg(baseNodePath.path(), node->nodePath().path());
+            return nullptr;
         }
 
         // Check if the node is an object
@@ -397,7 +514,7 @@ ConfigReaderBase::ReferenceResolutionResult ConfigReaderBase::resolveDerivedObje
                     << QString("Base node [%1] in a DerivedObject node [%2] is referencing a "
                                "node that is not an Object node!")
                        .arg(baseNodePath.path(), node->nodePath().path());
-            return ReferenceResolutionResult::Error;
+            return nullptr;
         }
 
         // Store the base node to the temporary container
@@ -406,7 +523,7 @@ ConfigReaderBase::ReferenceResolutionResult ConfigReaderBase::resolveDerivedObje
 
     // All the bases are resolved so they can now be applied to an empty object in the listed order
     // to create a derived object node
-    ConfigObjectNode derivedObjectNode(parentNode);
+    ConfigObjectNode derivedObjectNode;
 
     for (const auto *baseNode : baseNodes)
     {
@@ -419,22 +536,19 @@ ConfigReaderBase::ReferenceResolutionResult ConfigReaderBase::resolveDerivedObje
         derivedObjectNode.apply(node->config());
     }
 
-    auto result = (isFullyResolved(derivedObjectNode)
-                   ? ReferenceResolutionResult::Resolved
-                   : ReferenceResolutionResult::PartiallyResolved);
-
-
     // Replace the current node with the referenced node
-    if (!parentNode->setMember(parentNode->name(*node), derivedObjectNode))
+    const QString name = parentNode->name(*node);
+
+    if (!parentNode->setMember(name, derivedObjectNode))
     {
         qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
                 << QString("Failed to store the resolved DerivedObject node [%1] to the parent "
                            "object at node path [%2]")
                    .arg(node->nodePath().path(), parentNode->nodePath().path());
-        return ReferenceResolutionResult::Error;
+        return nullptr;
     }
 
-    return result;
+    return parentNode->member(name);
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -459,6 +573,7 @@ const ConfigNode *ConfigReaderBase::findReferencedConfigNode(
                 if (foundNode != nullptr)
                 {
                     referencedNode = foundNode;
+                    ConfigDependencyRecorder::recordExternalConfig(externalConfig);
                 }
             }
             else
@@ -475,6 +590,7 @@ const ConfigNode *ConfigReaderBase::findReferencedConfigNode(
                     if (foundNode != nullptr)
                     {
                         referencedNode = foundNode;
+                        ConfigDependencyRecorder::recordExternalConfig(externalConfig);
                     }
                 }
             }
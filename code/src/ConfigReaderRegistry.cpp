@@ -24,6 +24,7 @@
 // C++ Config Framework includes
 #include <CppConfigFramework/ConfigObjectNode.hpp>
 #include <CppConfigFramework/ConfigReader.hpp>
+#include <CppConfigFramework/ConfigSnapshotReader.hpp>
 #include <CppConfigFramework/LoggingCategories.hpp>
 
 // Qt includes
@@ -62,6 +63,13 @@ bool ConfigReaderRegistry::registerConfigReader(const QString &type,
 
 // -------------------------------------------------------------------------------------------------
 
+ConfigIncludeCache *ConfigReaderRegistry::includeCache()
+{
+    return &m_includeCache;
+}
+
+// -------------------------------------------------------------------------------------------------
+
 std::unique_ptr<ConfigObjectNode> ConfigReaderRegistry::readConfig(
         const QString &type,
         const QDir &workingDir,
@@ -95,6 +103,8 @@ std::unique_ptr<ConfigObjectNode> ConfigReaderRegistry::readConfig(
 ConfigReaderRegistry::ConfigReaderRegistry()
 {
     registerConfigReader(QStringLiteral("CppConfigFramework"), std::make_unique<ConfigReader>());
+    registerConfigReader(QStringLiteral("CppConfigFrameworkSnapshot"),
+                         std::make_unique<ConfigSnapshotReader>());
 }
 
 } // namespace CppConfigFramework
@@ -0,0 +1,201 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a class that reads a configuration file and rereads it when its files are changed
+ */
+
+// Own header
+#include <CppConfigFramework/ConfigReaderSession.hpp>
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigDiff.hpp>
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/LoggingCategories.hpp>
+
+// Qt includes
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+ConfigReaderSession::ConfigReaderSession(const ConfigReader &reader)
+    : m_reader(reader)
+{
+    // Files can be rewritten in place while they are being read (truncating a mapped file would
+    // raise SIGBUS)
+    m_reader.setFileMappingEnabled(false);
+    m_includeCache.setEnabled(true);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigReaderSession::~ConfigReaderSession() = default;
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> ConfigReaderSession::read(
+        const QString &filePath,
+        const QDir &workingDir,
+        const ConfigNodePath &sourceNodePath,
+        const ConfigNodePath &destinationNodePath,
+        const EnvironmentVariables &environmentVariables)
+{
+    // Start a new session
+    m_filePath = filePath;
+    m_workingDir = workingDir;
+    m_sourceNodePath = sourceNodePath;
+    m_destinationNodePath = destinationNodePath;
+    m_initialEnvironmentVariables = environmentVariables;
+    m_environmentVariables = environmentVariables;
+    m_includeCache.clear();
+    m_dependencies = ConfigDependencies();
+    m_config.reset();
+
+    ConfigDependencies dependencies;
+    EnvironmentVariables newEnvironmentVariables;
+    auto config = readConfig(&dependencies, &newEnvironmentVariables);
+
+    if (!config)
+    {
+        return {};
+    }
+
+    update(*config, dependencies, newEnvironmentVariables);
+    return config;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> ConfigReaderSession::reread(QStringList *changedNodePaths)
+{
+    if (changedNodePaths != nullptr)
+    {
+        changedNodePaths->clear();
+    }
+
+    if (!m_config)
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Configuration can only be reread after a successful read";
+        return {};
+    }
+
+    ConfigDependencies dependencies;
+    EnvironmentVariables newEnvironmentVariables;
+    auto config = readConfig(&dependencies, &newEnvironmentVariables);
+
+    if (!config)
+    {
+        return {};
+    }
+
+    if (changedNodePaths != nullptr)
+    {
+        *changedNodePaths = ConfigDiff::compare(*m_config, *config).nodePaths();
+    }
+
+    update(*config, dependencies, newEnvironmentVariables);
+    return config;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigReaderSession::invalidateFiles(const QStringList &absoluteFilePaths)
+{
+    m_includeCache.invalidate(absoluteFilePaths);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigReaderSession::hasConfig() const
+{
+    return static_cast<bool>(m_config);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const ConfigDependencies &ConfigReaderSession::dependencies() const
+{
+    return m_dependencies;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const EnvironmentVariables &ConfigReaderSession::environmentVariables() const
+{
+    return m_environmentVariables;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const ConfigIncludeCache &ConfigReaderSession::includeCache() const
+{
+    return m_includeCache;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> ConfigReaderSession::readConfig(
+        ConfigDependencies *dependencies,
+        EnvironmentVariables *environmentVariables)
+{
+    // Files that were not changed since the previous read are taken from the session's include
+    // cache (including the configuration file itself if none of its files were changed)
+    *environmentVariables = m_initialEnvironmentVariables;
+
+    ConfigIncludeCacheScope includeCacheScope(&m_includeCache);
+    ConfigDependencyRecorder recorder;
+
+    auto config = m_reader.read(m_filePath,
+                                m_workingDir,
+                                m_sourceNodePath,
+                                m_destinationNodePath,
+                                {},
+                                environmentVariables);
+
+    if (!config)
+    {
+        return {};
+    }
+
+    *dependencies = recorder.dependencies();
+    return config;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigReaderSession::update(const ConfigObjectNode &config,
+                                 const ConfigDependencies &dependencies,
+                                 const EnvironmentVariables &environmentVariables)
+{
+    // Keep a copy of the configuration (configuration returned by the reader is detached so its
+    // clone is a complete copy)
+    auto clone = config.clone();
+    m_config = std::make_unique<ConfigObjectNode>(std::move(clone->toObject()));
+
+    m_dependencies = dependencies;
+    m_environmentVariables = environmentVariables;
+}
+
+} // namespace CppConfigFramework
@@ -0,0 +1,68 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains the definition of the binary snapshot format for fully resolved configurations
+ */
+
+// Own header
+#include <CppConfigFramework/ConfigSnapshotFormat.hpp>
+
+// C++ Config Framework includes
+
+// Qt includes
+#include <QtCore/QtEndian>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+namespace ConfigSnapshotFormat
+{
+
+quint64 checksum(const char *data, const size_t size, const quint64 seed)
+{
+    constexpr quint64 prime = 0x100000001b3ULL;
+    quint64 hash = seed;
+    size_t position = 0U;
+
+    // Whole words
+    for (; (position + sizeof(quint64)) <= size; position += sizeof(quint64))
+    {
+        hash ^= qFromLittleEndian<quint64>(data + position);
+        hash *= prime;
+    }
+
+    // Remaining bytes
+    for (; position < size; position++)
+    {
+        hash ^= static_cast<quint8>(data[position]);
+        hash *= prime;
+    }
+
+    return hash;
+}
+
+} // namespace ConfigSnapshotFormat
+
+} // namespace CppConfigFramework
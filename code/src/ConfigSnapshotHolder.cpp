@@ -0,0 +1,465 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a class that publishes immutable configuration snapshots to multiple threads
+ */
+
+// Own header
+#include <CppConfigFramework/ConfigSnapshotHolder.hpp>
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+
+// Qt includes
+#include <QtCore/QMutexLocker>
+
+// System includes
+#include <array>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+namespace Internal
+{
+
+//! Holds a snapshot pinned by the current thread
+struct ConfigSnapshotCacheEntry
+{
+    //! Identifier of the holder that published the snapshot (0 if the entry is not used)
+    quint64 holderId = 0U;
+
+    //! Version of the holder that the snapshot was published in
+    quint64 version = 0U;
+
+    //! Snapshot epoch at the time the entry was filled (see snapshotEpoch)
+    quint64 epoch = 0U;
+
+    //! Snapshot
+    std::shared_ptr<const ConfigObjectNode> snapshot;
+
+    //! Number of pins of the snapshot (the entry can only be replaced if it is not pinned)
+    int pinCount = 0;
+};
+
+//! Number of holders whose snapshots can be cached by a thread at the same time
+constexpr size_t SNAPSHOT_CACHE_SIZE = 4U;
+
+//! Holds the snapshots pinned by the current thread
+thread_local std::array<ConfigSnapshotCacheEntry, SNAPSHOT_CACHE_SIZE> snapshotCache;
+
+//! Holds the index of the next entry that gets replaced when the cache is full
+thread_local size_t snapshotCacheNextIndex = 0U;
+
+//! Holds the snapshot epoch at the time the current thread last released its stale entries
+thread_local quint64 snapshotCacheEpoch = 0U;
+
+//! Holds the snapshot epoch (incremented whenever any snapshot is replaced or any holder destroyed)
+std::atomic<quint64> snapshotEpoch(1U);
+
+//! Holds the identifier of the next holder
+std::atomic<quint64> nextHolderId(1U);
+
+/*!
+ * Finds the cache entry of the holder in the current thread
+ *
+ * \param   holderId    Identifier of the holder
+ *
+ * \return  Cache entry or nullptr if none of the entries belongs to the holder
+ */
+ConfigSnapshotCacheEntry *findSnapshotCacheEntry(const quint64 holderId);
+
+/*!
+ * Releases the snapshots that the current thread has cached but not pinned if any of the snapshots
+ * could have become stale since the last time
+ *
+ * \param   epoch   Current snapshot epoch
+ */
+void releaseStaleSnapshotCacheEntries(const quint64 epoch);
+
+/*!
+ * Releases the snapshot of the cache entry
+ *
+ * \param   entry   Cache entry
+ */
+void releaseSnapshotCacheEntry(ConfigSnapshotCacheEntry *entry);
+
+/*!
+ * Finds a cache entry of the current thread that can be replaced
+ *
+ * \return  Cache entry or nullptr if all of the entries are pinned
+ */
+ConfigSnapshotCacheEntry *findFreeSnapshotCacheEntry();
+
+/*!
+ * Makes an immutable snapshot from the configuration
+ *
+ * \param   config  Configuration
+ *
+ * \return  Snapshot (or a null pointer if the configuration is a null pointer)
+ *
+ * The configuration is detached so that it doesn't share its members with any other node and
+ * reading it from multiple threads doesn't modify it.
+ */
+std::shared_ptr<const ConfigObjectNode> makeSnapshot(std::unique_ptr<ConfigObjectNode> config);
+
+} // namespace Internal
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigSnapshotHolder::Pin::Pin()
+    : m_entry(nullptr),
+      m_config(nullptr),
+      m_version(0U)
+{
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigSnapshotHolder::Pin::Pin(Pin &&other) noexcept
+    : m_entry(other.m_entry),
+      m_snapshot(std::move(other.m_snapshot)),
+      m_config(other.m_config),
+      m_version(other.m_version)
+{
+    other.m_entry = nullptr;
+    other.m_config = nullptr;
+    other.m_version = 0U;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigSnapshotHolder::Pin::~Pin()
+{
+    release();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigSnapshotHolder::Pin &ConfigSnapshotHolder::Pin::operator=(Pin &&other) noexcept
+{
+    if (this != &other)
+    {
+        release();
+
+        m_entry = other.m_entry;
+        m_snapshot = std::move(other.m_snapshot);
+        m_config = other.m_config;
+        m_version = other.m_version;
+
+        other.m_entry = nullptr;
+        other.m_config = nullptr;
+        other.m_version = 0U;
+    }
+
+    return *this;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const ConfigObjectNode *ConfigSnapshotHolder::Pin::get() const
+{
+    return m_config;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const ConfigObjectNode *ConfigSnapshotHolder::Pin::operator->() const
+{
+    return m_config;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const ConfigObjectNode &ConfigSnapshotHolder::Pin::operator*() const
+{
+    return *m_config;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigSnapshotHolder::Pin::operator bool() const
+{
+    return (m_config != nullptr);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+quint64 ConfigSnapshotHolder::Pin::version() const
+{
+    return m_version;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::shared_ptr<const ConfigObjectNode> ConfigSnapshotHolder::Pin::toSharedPointer() const
+{
+    if (m_entry != nullptr)
+    {
+        return m_entry->snapshot;
+    }
+
+    return m_snapshot;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigSnapshotHolder::Pin::Pin(Internal::ConfigSnapshotCacheEntry *entry)
+    : m_entry(entry),
+      m_config(entry->snapshot.get()),
+      m_version(entry->version)
+{
+    m_entry->pinCount++;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigSnapshotHolder::Pin::Pin(std::shared_ptr<const ConfigObjectNode> snapshot,
+                               const quint64 version)
+    : m_entry(nullptr),
+      m_snapshot(std::move(snapshot)),
+      m_config(m_snapshot.get()),
+      m_version(version)
+{
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigSnapshotHolder::Pin::release()
+{
+    if (m_entry != nullptr)
+    {
+        m_entry->pinCount--;
+
+        // Cached snapshot that could have been replaced is not kept alive after its last pin
+        if ((m_entry->pinCount == 0) &&
+            (m_entry->epoch != Internal::snapshotEpoch.load(std::memory_order_relaxed)))
+        {
+            Internal::releaseSnapshotCacheEntry(m_entry);
+        }
+
+        m_entry = nullptr;
+    }
+
+    m_snapshot.reset();
+    m_config = nullptr;
+    m_version = 0U;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigSnapshotHolder::ConfigSnapshotHolder()
+    : m_id(Internal::nextHolderId.fetch_add(1U, std::memory_order_relaxed)),
+      m_version(1U)
+{
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigSnapshotHolder::ConfigSnapshotHolder(std::unique_ptr<ConfigObjectNode> config)
+    : m_id(Internal::nextHolderId.fetch_add(1U, std::memory_order_relaxed)),
+      m_version(1U),
+      m_snapshot(Internal::makeSnapshot(std::move(config)))
+{
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigSnapshotHolder::~ConfigSnapshotHolder()
+{
+    // Threads release their cached snapshots of this holder the next time they pin a snapshot
+    Internal::snapshotEpoch.fetch_add(1U, std::memory_order_release);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigSnapshotHolder::publish(std::unique_ptr<ConfigObjectNode> config)
+{
+    auto snapshot = Internal::makeSnapshot(std::move(config));
+
+    QMutexLocker locker(&m_mutex);
+    m_snapshot.swap(snapshot);
+
+    // Threads notice the new version the next time they pin a snapshot
+    m_version.fetch_add(1U, std::memory_order_release);
+    Internal::snapshotEpoch.fetch_add(1U, std::memory_order_release);
+    locker.unlock();
+
+    // Previous snapshot is released outside of the lock
+    snapshot.reset();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigSnapshotHolder::Pin ConfigSnapshotHolder::pin() const
+{
+    // Cached snapshots that are not pinned anymore are released if any of them could be stale
+    const quint64 epoch = Internal::snapshotEpoch.load(std::memory_order_acquire);
+    Internal::releaseStaleSnapshotCacheEntries(epoch);
+
+    // Fast path: the snapshot cached by the current thread is still the current one
+    const quint64 version = m_version.load(std::memory_order_acquire);
+    auto *entry = Internal::findSnapshotCacheEntry(m_id);
+
+    if ((entry != nullptr) && (entry->version == version))
+    {
+        // Snapshot is still the current one so it is not released together with its last pin
+        entry->epoch = epoch;
+        return Pin(entry);
+    }
+
+    // Slow path: take the current snapshot
+    std::shared_ptr<const ConfigObjectNode> snapshot;
+    quint64 snapshotVersion = 0U;
+
+    {
+        QMutexLocker locker(&m_mutex);
+        snapshot = m_snapshot;
+        snapshotVersion = m_version.load(std::memory_order_relaxed);
+    }
+
+    if (entry == nullptr)
+    {
+        entry = Internal::findFreeSnapshotCacheEntry();
+    }
+
+    if ((entry == nullptr) || (entry->pinCount > 0))
+    {
+        // Previous snapshot is still pinned in this thread so the new one can't be cached
+        return Pin(std::move(snapshot), snapshotVersion);
+    }
+
+    entry->holderId = m_id;
+    entry->version = snapshotVersion;
+    entry->epoch = epoch;
+    entry->snapshot = std::move(snapshot);
+
+    return Pin(entry);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::shared_ptr<const ConfigObjectNode> ConfigSnapshotHolder::load() const
+{
+    return pin().toSharedPointer();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+quint64 ConfigSnapshotHolder::version() const
+{
+    return m_version.load(std::memory_order_acquire);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+namespace Internal
+{
+
+ConfigSnapshotCacheEntry *findSnapshotCacheEntry(const quint64 holderId)
+{
+    for (auto &entry : snapshotCache)
+    {
+        if (entry.holderId == holderId)
+        {
+            return &entry;
+        }
+    }
+
+    return nullptr;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void releaseStaleSnapshotCacheEntries(const quint64 epoch)
+{
+    if (snapshotCacheEpoch == epoch)
+    {
+        return;
+    }
+
+    // It is not known which of the snapshots were replaced so all of the entries that are not
+    // pinned are released (pinned entries are released together with their last pin)
+    for (auto &entry : snapshotCache)
+    {
+        if ((entry.holderId != 0U) && (entry.pinCount == 0) && (entry.epoch != epoch))
+        {
+            releaseSnapshotCacheEntry(&entry);
+        }
+    }
+
+    snapshotCacheEpoch = epoch;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void releaseSnapshotCacheEntry(ConfigSnapshotCacheEntry *entry)
+{
+    entry->holderId = 0U;
+    entry->version = 0U;
+    entry->epoch = 0U;
+    entry->snapshot.reset();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigSnapshotCacheEntry *findFreeSnapshotCacheEntry()
+{
+    // Prefer unused entries
+    for (auto &entry : snapshotCache)
+    {
+        if (entry.holderId == 0U)
+        {
+            return &entry;
+        }
+    }
+
+    // Otherwise replace the entries that are not pinned in turn
+    for (size_t i = 0U; i < SNAPSHOT_CACHE_SIZE; i++)
+    {
+        auto &entry = snapshotCache[snapshotCacheNextIndex];
+        snapshotCacheNextIndex = (snapshotCacheNextIndex + 1U) % SNAPSHOT_CACHE_SIZE;
+
+        if (entry.pinCount == 0)
+        {
+            return &entry;
+        }
+    }
+
+    return nullptr;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::shared_ptr<const ConfigObjectNode> makeSnapshot(std::unique_ptr<ConfigObjectNode> config)
+{
+    if (config)
+    {
+        config->detach();
+    }
+
+    return std::shared_ptr<const ConfigObjectNode>(std::move(config));
+}
+
+} // namespace Internal
+
+} // namespace CppConfigFramework
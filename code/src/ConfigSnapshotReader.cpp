@@ -0,0 +1,784 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a class that reads the configuration from a binary snapshot
+ */
+
+// Own header
+#include <CppConfigFramework/ConfigSnapshotReader.hpp>
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigDependencies.hpp>
+#include <CppConfigFramework/ConfigFileBuffer.hpp>
+#include <CppConfigFramework/ConfigNameTable.hpp>
+#include <CppConfigFramework/ConfigNodeArena.hpp>
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/ConfigSnapshotFormat.hpp>
+#include <CppConfigFramework/ConfigValueNode.hpp>
+#include <CppConfigFramework/LoggingCategories.hpp>
+
+// Qt includes
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonObject>
+#include <QtCore/QtEndian>
+
+// System includes
+#include <cstring>
+#include <vector>
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+namespace Internal
+{
+
+//! This class validates a binary snapshot and creates the configuration nodes from it
+class SnapshotDecoder
+{
+public:
+    /*!
+     * Constructor
+     *
+     * \param   data    Snapshot data
+     * \param   size    Size of the snapshot data
+     */
+    SnapshotDecoder(const char *data, const size_t size);
+
+    /*!
+     * Validates the header and the checksum of the snapshot
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool validate();
+
+    /*!
+     * Creates the configuration nodes from the validated snapshot
+     *
+     * \return  Configuration node instance or null in case of failure
+     */
+    std::unique_ptr<ConfigObjectNode> decode();
+
+private:
+    /*!
+     * Gets the type of the entry
+     *
+     * \param   index   Index of the entry
+     *
+     * \return  Entry type
+     */
+    ConfigSnapshotFormat::EntryType entryType(const quint32 index) const;
+
+    /*!
+     * Gets the name index of the entry
+     *
+     * \param   index   Index of the entry
+     *
+     * \return  Index of the name in the string table
+     */
+    quint32 entryName(const quint32 index) const;
+
+    /*!
+     * Gets the data of the entry
+     *
+     * \param   index   Index of the entry
+     *
+     * \return  Entry data
+     */
+    quint64 entryData(const quint32 index) const;
+
+    /*!
+     * Claims the consecutive entries referenced by a container entry
+     *
+     * \param   parentIndex Index of the container entry
+     * \param   data        Data of the container entry
+     *
+     * \param[out]  first   Index of the first entry
+     * \param[out]  count   Number of entries
+     *
+     * \retval  true    Success
+     * \retval  false   Failure (entries are out of range or they were already claimed)
+     *
+     * Each entry can be claimed only once which guarantees that the entries form a tree.
+     */
+    bool claimEntries(const quint32 parentIndex,
+                      const quint64 data,
+                      quint32 *first,
+                      quint32 *count);
+
+    /*!
+     * Reads a string from the string table
+     *
+     * \param   stringIndex Index of the string
+     *
+     * \param[out]  text    String
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool readString(const quint32 stringIndex, QString *text) const;
+
+    /*!
+     * Reads a node name from the string table
+     *
+     * \param   stringIndex Index of the string
+     *
+     * \param[out]  name    Atom of the node name
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool readNodeName(const quint32 stringIndex, ConfigNameTable::Atom *name);
+
+    /*!
+     * Creates an Object node from the entry
+     *
+     * \param   index   Index of the entry
+     * \param   depth   Nesting depth of the entry
+     *
+     * \return  Configuration node instance or null in case of failure
+     */
+    std::unique_ptr<ConfigObjectNode> decodeObjectNode(const quint32 index, const int depth);
+
+    /*!
+     * Creates a JSON value from the entry
+     *
+     * \param   index   Index of the entry
+     * \param   depth   Nesting depth of the entry
+     *
+     * \param[out]  value   JSON value
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool decodeValue(const quint32 index, const int depth, QJsonValue *value);
+
+private:
+    //! Snapshot data
+    const char *m_data;
+
+    //! Size of the snapshot data
+    size_t m_size;
+
+    //! Entry table
+    const char *m_entries = nullptr;
+
+    //! Number of entries
+    quint32 m_entryCount = 0U;
+
+    //! String table
+    const char *m_strings = nullptr;
+
+    //! Number of strings
+    quint32 m_stringCount = 0U;
+
+    //! String data
+    const char *m_stringData = nullptr;
+
+    //! Number of UTF-16 code units in the string data
+    quint32 m_stringDataLength = 0U;
+
+    //! Flags for the entries that were already claimed
+    std::vector<bool> m_claimedEntries;
+
+    //! Atoms of the node names (INVALID_ATOM for the strings that were not yet interned)
+    std::vector<ConfigNameTable::Atom> m_nodeNames;
+};
+
+} // namespace Internal
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> ConfigSnapshotReader::read(
+        const QString &filePath,
+        const QDir &workingDir,
+        const ConfigNodePath &sourceNodePath,
+        const ConfigNodePath &destinationNodePath,
+        EnvironmentVariables *environmentVariables) const
+{
+    // Make sure that file path is not empty
+    if (filePath.isEmpty())
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader) << "File path is empty!";
+        return {};
+    }
+
+    // Expand references to environment variables in the file path
+    const QString expandedFilePath = environmentVariables->expandText(filePath);
+
+    if (expandedFilePath.isEmpty())
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Failed to expand file path:" << filePath;
+        return {};
+    }
+
+    // Prepare absolute path to the file using the working path if needed
+    QString absoluteFilePath;
+
+    if (QDir::isAbsolutePath(expandedFilePath))
+    {
+        absoluteFilePath = QDir::cleanPath(expandedFilePath);
+    }
+    else
+    {
+        absoluteFilePath = QDir::cleanPath(workingDir.absoluteFilePath(expandedFilePath));
+    }
+
+    // Open file
+    if (!QFile::exists(absoluteFilePath))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "File at path was not found:" << absoluteFilePath;
+        return {};
+    }
+
+    ConfigDependencyRecorder::recordFile(absoluteFilePath);
+    ConfigFileBuffer fileContents;
+
+    if (!fileContents.open(absoluteFilePath, fileMappingEnabled()))
+    {
+        return {};
+    }
+
+    // Create the nodes (from an arena if needed)
+    std::unique_ptr<ConfigNodeArenaScope> arenaScope;
+
+    if (arenaAllocationEnabled())
+    {
+        arenaScope = std::make_unique<ConfigNodeArenaScope>();
+    }
+
+    auto config = readSnapshot(fileContents.data(), fileContents.size());
+
+    if (!config)
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Failed to read snapshot file:" << absoluteFilePath;
+        return {};
+    }
+
+    // Transform the configuration node based on source and destination node paths
+    auto transformedConfig = transformConfig(std::move(config),
+                                             sourceNodePath,
+                                             destinationNodePath);
+
+    if (!transformedConfig)
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Failed to transform the config";
+        return {};
+    }
+
+    return transformedConfig;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> ConfigSnapshotReader::read(
+        const QDir &workingDir,
+        const ConfigNodePath &destinationNodePath,
+        const QJsonObject &otherParameters,
+        const std::vector<const ConfigObjectNode *> &externalConfigs,
+        EnvironmentVariables *environmentVariables) const
+{
+    // A snapshot is fully resolved so it never references the external configs
+    Q_UNUSED(externalConfigs)
+
+    // Extract file path
+    QString filePath;
+
+    if (!CedarFramework::deserializeNode(otherParameters, QStringLiteral("file_path"), &filePath))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "The 'file_path' parameter is missing or invalid";
+        return {};
+    }
+
+    if (filePath.isEmpty())
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "The 'file_path' parameter is must not be empty";
+        return {};
+    }
+
+    // Extract source node
+    ConfigNodePath sourceNodePath = ConfigNodePath::ROOT_PATH;
+
+    if (!CedarFramework::deserializeOptionalNode(otherParameters,
+                                                 QStringLiteral("source_node"),
+                                                 &sourceNodePath))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "The 'source_node' parameter is invalid";
+        return {};
+    }
+
+    // Read the snapshot file
+    return read(filePath, workingDir, sourceNodePath, destinationNodePath, environmentVariables);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> ConfigSnapshotReader::readSnapshot(const char *data,
+                                                                     const size_t size)
+{
+    Internal::SnapshotDecoder decoder(data, size);
+
+    if (!decoder.validate())
+    {
+        return {};
+    }
+
+    return decoder.decode();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+namespace Internal
+{
+
+SnapshotDecoder::SnapshotDecoder(const char *data, const size_t size)
+    : m_data(data),
+      m_size(size)
+{
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool SnapshotDecoder::validate()
+{
+    using namespace ConfigSnapshotFormat;
+
+    // Header
+    if ((m_data == nullptr) ||
+        (m_size < HEADER_SIZE) ||
+        (std::memcmp(m_data, MAGIC, MAGIC_SIZE) != 0))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Data is not a configuration snapshot";
+        return false;
+    }
+
+    const auto version = qFromLittleEndian<quint16>(m_data + 4);
+
+    if (version != VERSION)
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Unsupported snapshot version:" << version;
+        return false;
+    }
+
+    const auto headerSize = qFromLittleEndian<quint16>(m_data + 6);
+    m_entryCount = qFromLittleEndian<quint32>(m_data + 8);
+    m_stringCount = qFromLittleEndian<quint32>(m_data + 12);
+    m_stringDataLength = qFromLittleEndian<quint32>(m_data + 16);
+    const auto dataSize = qFromLittleEndian<quint64>(m_data + 24);
+
+    const quint64 entryTableSize = static_cast<quint64>(m_entryCount) * ENTRY_SIZE;
+    const quint64 stringTableSize = static_cast<quint64>(m_stringCount) * STRING_TABLE_ENTRY_SIZE;
+    const quint64 stringDataSize = static_cast<quint64>(m_stringDataLength) * 2U;
+
+    if ((headerSize != HEADER_SIZE) ||
+        (m_entryCount == 0U) ||
+        (dataSize != static_cast<quint64>(m_size - HEADER_SIZE)) ||
+        (dataSize != (entryTableSize + stringTableSize + stringDataSize)))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Snapshot header is invalid or the snapshot is truncated";
+        return false;
+    }
+
+    // Checksum
+    const quint64 headerChecksum = checksum(m_data, CHECKSUM_OFFSET);
+    const quint64 expectedChecksum = qFromLittleEndian<quint64>(m_data + CHECKSUM_OFFSET);
+
+    if (checksum(m_data + HEADER_SIZE, m_size - HEADER_SIZE, headerChecksum) != expectedChecksum)
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Snapshot checksum mismatch";
+        return false;
+    }
+
+    m_entries = m_data + HEADER_SIZE;
+    m_strings = m_entries + entryTableSize;
+    m_stringData = m_strings + stringTableSize;
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> SnapshotDecoder::decode()
+{
+    m_claimedEntries.assign(m_entryCount, false);
+    m_nodeNames.assign(m_stringCount, ConfigNameTable::INVALID_ATOM);
+
+    // Root entry
+    m_claimedEntries[0] = true;
+
+    if (entryType(0U) != ConfigSnapshotFormat::EntryType::ObjectNode)
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Root entry of the snapshot is not an Object node";
+        return {};
+    }
+
+    return decodeObjectNode(0U, 0);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigSnapshotFormat::EntryType SnapshotDecoder::entryType(const quint32 index) const
+{
+    return static_cast<ConfigSnapshotFormat::EntryType>(
+                static_cast<quint8>(m_entries[index * ConfigSnapshotFormat::ENTRY_SIZE]));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+quint32 SnapshotDecoder::entryName(const quint32 index) const
+{
+    return qFromLittleEndian<quint32>(m_entries + (index * ConfigSnapshotFormat::ENTRY_SIZE) + 4U);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+quint64 SnapshotDecoder::entryData(const quint32 index) const
+{
+    return qFromLittleEndian<quint64>(m_entries + (index * ConfigSnapshotFormat::ENTRY_SIZE) + 8U);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool SnapshotDecoder::claimEntries(const quint32 parentIndex,
+                                   const quint64 data,
+                                   quint32 *first,
+                                   quint32 *count)
+{
+    *first = static_cast<quint32>(data);
+    *count = static_cast<quint32>(data >> 32U);
+
+    // Children always follow their parent which also prevents cycles
+    if ((*first <= parentIndex) ||
+        ((static_cast<quint64>(*first) + *count) > m_entryCount))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Snapshot entry references entries out of range:" << parentIndex;
+        return false;
+    }
+
+    for (quint32 index = *first; index < (*first + *count); index++)
+    {
+        if (m_claimedEntries[index])
+        {
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                    << "Snapshot entry is referenced multiple times:" << index;
+            return false;
+        }
+
+        m_claimedEntries[index] = true;
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool SnapshotDecoder::readString(const quint32 stringIndex, QString *text) const
+{
+    if (stringIndex >= m_stringCount)
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Snapshot string index is out of range:" << stringIndex;
+        return false;
+    }
+
+    const char *tableEntry =
+            m_strings + (stringIndex * ConfigSnapshotFormat::STRING_TABLE_ENTRY_SIZE);
+    const auto offset = qFromLittleEndian<quint32>(tableEntry);
+    const auto length = qFromLittleEndian<quint32>(tableEntry + 4U);
+
+    if ((static_cast<quint64>(offset) + length) > m_stringDataLength)
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Snapshot string is out of range:" << stringIndex;
+        return false;
+    }
+
+    const char *codeUnits = m_stringData + (static_cast<size_t>(offset) * 2U);
+
+#if Q_BYTE_ORDER == Q_LITTLE_ENDIAN
+    // The string data can be copied directly if it is suitably aligned
+    if ((reinterpret_cast<quintptr>(codeUnits) % alignof(QChar)) == 0U)
+    {
+        *text = QString(reinterpret_cast<const QChar *>(codeUnits), static_cast<int>(length));
+        return true;
+    }
+#endif
+
+    text->resize(static_cast<int>(length));
+
+    for (quint32 i = 0U; i < length; i++)
+    {
+        (*text)[static_cast<int>(i)] = QChar(qFromLittleEndian<quint16>(codeUnits + (i * 2U)));
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool SnapshotDecoder::readNodeName(const quint32 stringIndex, ConfigNameTable::Atom *name)
+{
+    // Each node name is interned only once
+    if ((stringIndex < m_stringCount) &&
+        (m_nodeNames[stringIndex] != ConfigNameTable::INVALID_ATOM))
+    {
+        *name = m_nodeNames[stringIndex];
+        return true;
+    }
+
+    QString text;
+
+    if (!readString(stringIndex, &text))
+    {
+        return false;
+    }
+
+    *name = ConfigNameTable::instance()->intern(text);
+
+    if (*name == ConfigNameTable::INVALID_ATOM)
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Snapshot contains an invalid node name:" << text;
+        return false;
+    }
+
+    m_nodeNames[stringIndex] = *name;
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> SnapshotDecoder::decodeObjectNode(const quint32 index,
+                                                                    const int depth)
+{
+    using ConfigSnapshotFormat::EntryType;
+
+    if (depth > ConfigSnapshotFormat::MAX_DEPTH)
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Snapshot exceeds the max nesting depth";
+        return {};
+    }
+
+    quint32 first = 0U;
+    quint32 count = 0U;
+
+    if (!claimEntries(index, entryData(index), &first, &count))
+    {
+        return {};
+    }
+
+    auto objectNode = std::make_unique<ConfigObjectNode>();
+
+    for (quint32 memberIndex = first; memberIndex < (first + count); memberIndex++)
+    {
+        ConfigNameTable::Atom name = ConfigNameTable::INVALID_ATOM;
+
+        if (!readNodeName(entryName(memberIndex), &name))
+        {
+            return {};
+        }
+
+        std::unique_ptr<ConfigNode> memberNode;
+
+        switch (entryType(memberIndex))
+        {
+            case EntryType::ObjectNode:
+            {
+                memberNode = decodeObjectNode(memberIndex, depth + 1);
+                break;
+            }
+
+            case EntryType::ValueNode:
+            {
+                // Value node references exactly one entry (its JSON value)
+                const quint64 valueData =
+                        static_cast<quint32>(entryData(memberIndex)) | (1ULL << 32U);
+                quint32 valueIndex = 0U;
+                quint32 valueCount = 0U;
+                QJsonValue value;
+
+                if (claimEntries(memberIndex, valueData, &valueIndex, &valueCount) &&
+                    decodeValue(valueIndex, depth + 1, &value))
+                {
+                    memberNode = std::make_unique<ConfigValueNode>(value);
+                }
+                break;
+            }
+
+            default:
+            {
+                qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                        << "Snapshot entry is not a configuration node:" << memberIndex;
+                break;
+            }
+        }
+
+        if (!memberNode)
+        {
+            return {};
+        }
+
+        objectNode->setMember(name, std::move(memberNode));
+    }
+
+    return objectNode;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool SnapshotDecoder::decodeValue(const quint32 index, const int depth, QJsonValue *value)
+{
+    using ConfigSnapshotFormat::EntryType;
+
+    if (depth > ConfigSnapshotFormat::MAX_DEPTH)
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Snapshot exceeds the max nesting depth";
+        return false;
+    }
+
+    const quint64 data = entryData(index);
+
+    switch (entryType(index))
+    {
+        case EntryType::Null:
+        {
+            *value = QJsonValue(QJsonValue::Null);
+            return true;
+        }
+
+        case EntryType::Bool:
+        {
+            *value = QJsonValue(data != 0U);
+            return true;
+        }
+
+        case EntryType::Double:
+        {
+            double number = 0.0;
+            std::memcpy(&number, &data, sizeof(number));
+            *value = QJsonValue(number);
+            return true;
+        }
+
+        case EntryType::String:
+        {
+            QString text;
+
+            if ((data >= m_stringCount) || (!readString(static_cast<quint32>(data), &text)))
+            {
+                qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                        << "Snapshot string value is invalid:" << index;
+                return false;
+            }
+
+            *value = QJsonValue(text);
+            return true;
+        }
+
+        case EntryType::Array:
+        {
+            quint32 first = 0U;
+            quint32 count = 0U;
+
+            if (!claimEntries(index, data, &first, &count))
+            {
+                return false;
+            }
+
+            QJsonArray array;
+
+            for (quint32 itemIndex = first; itemIndex < (first + count); itemIndex++)
+            {
+                QJsonValue item;
+
+                if (!decodeValue(itemIndex, depth + 1, &item))
+                {
+                    return false;
+                }
+
+                array.append(item);
+            }
+
+            *value = array;
+            return true;
+        }
+
+        case EntryType::Object:
+        {
+            quint32 first = 0U;
+            quint32 count = 0U;
+
+            if (!claimEntries(index, data, &first, &count))
+            {
+                return false;
+            }
+
+            QJsonObject object;
+
+            for (quint32 memberIndex = first; memberIndex < (first + count); memberIndex++)
+            {
+                QString name;
+                QJsonValue member;
+
+                if ((!readString(entryName(memberIndex), &name)) ||
+                    (!decodeValue(memberIndex, depth + 1, &member)))
+                {
+                    return false;
+                }
+
+                object.insert(name, member);
+            }
+
+            *value = object;
+            return true;
+        }
+
+        case EntryType::ObjectNode:
+        case EntryType::ValueNode:
+        default:
+        {
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                    << "Snapshot entry is not a JSON value:" << index;
+            return false;
+        }
+    }
+}
+
+} // namespace Internal
+
+} // namespace CppConfigFramework
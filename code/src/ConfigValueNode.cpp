@@ -67,6 +67,7 @@ QJsonValue ConfigValueNode::value() const
 
 void ConfigValueNode::setValue(const QJsonValue &value)
 {
+    prepareForModification();
     m_value = value;
 }
 
@@ -0,0 +1,474 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a class that watches the files of a configuration and rereads it when they are changed
+ */
+
+// Own header
+#include <CppConfigFramework/ConfigWatcher.hpp>
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/LoggingCategories.hpp>
+
+// Qt includes
+#include <QtCore/QFileInfo>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QRunnable>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+namespace Internal
+{
+
+//! This class rereads the configuration of a watcher on its thread pool
+class ConfigWatcherReload : public QRunnable
+{
+public:
+    /*!
+     * Constructor
+     *
+     * \param   watcher         Watcher whose configuration needs to be reread
+     * \param   changedFiles    Absolute paths to the files that were reported as changed
+     */
+    ConfigWatcherReload(ConfigWatcher *watcher, const QStringList &changedFiles);
+
+    //! Rereads the configuration
+    void run() override;
+
+private:
+    //! Watcher whose configuration needs to be reread
+    ConfigWatcher *m_watcher;
+
+    //! Absolute paths to the files that were reported as changed
+    QStringList m_changedFiles;
+};
+
+} // namespace Internal
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigWatcher::ConfigWatcher(const ConfigReader &reader, QObject *parent)
+    : QObject(parent),
+      m_session(reader),
+      m_reloadRunning(false),
+      m_reloadPending(false),
+      m_reloadSucceeded(false)
+{
+    // Rereads must not overlap as they share the session
+    m_threadPool.setMaxThreadCount(1);
+
+    m_debounceTimer.setSingleShot(true);
+    m_debounceTimer.setInterval(DEFAULT_DEBOUNCE_INTERVAL);
+
+    connect(&m_fileSystemWatcher, &QFileSystemWatcher::fileChanged,
+            this, &ConfigWatcher::onFileChanged);
+    connect(&m_fileSystemWatcher, &QFileSystemWatcher::directoryChanged,
+            this, &ConfigWatcher::onDirectoryChanged);
+    connect(&m_debounceTimer, &QTimer::timeout,
+            this, &ConfigWatcher::reload);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+ConfigWatcher::~ConfigWatcher()
+{
+    // The reread accesses the members so it has to finish before they are destroyed
+    stop();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigWatcher::start(const QString &filePath,
+                          const QDir &workingDir,
+                          const ConfigNodePath &sourceNodePath,
+                          const ConfigNodePath &destinationNodePath,
+                          const EnvironmentVariables &environmentVariables)
+{
+    stop();
+
+    auto config = m_session.read(filePath,
+                                 workingDir,
+                                 sourceNodePath,
+                                 destinationNodePath,
+                                 environmentVariables);
+
+    if (!config)
+    {
+        return false;
+    }
+
+    {
+        QMutexLocker locker(&m_mutex);
+        m_dependencyFiles = m_session.dependencies().files().keys();
+    }
+
+    publish(std::move(config));
+    updateWatchedFiles();
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigWatcher::stop()
+{
+    m_debounceTimer.stop();
+    m_threadPool.waitForDone();
+
+    const QStringList paths = m_fileSystemWatcher.files() + m_fileSystemWatcher.directories();
+
+    if (!paths.isEmpty())
+    {
+        m_fileSystemWatcher.removePaths(paths);
+    }
+
+    // Results of a finished reread are dropped (its queued notification is ignored)
+    m_reloadRunning = false;
+    m_reloadPending = false;
+    m_changedFiles.clear();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool ConfigWatcher::isActive() const
+{
+    return ((!m_fileSystemWatcher.files().isEmpty()) ||
+            (!m_fileSystemWatcher.directories().isEmpty()));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+int ConfigWatcher::debounceInterval() const
+{
+    return m_debounceTimer.interval();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigWatcher::setDebounceInterval(const int debounceInterval)
+{
+    m_debounceTimer.setInterval(debounceInterval);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QStringList ConfigWatcher::watchedFiles() const
+{
+    QStringList files = m_fileSystemWatcher.files();
+    files.sort();
+    return files;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+std::shared_ptr<const ConfigObjectNode> ConfigWatcher::snapshot() const
+{
+    return m_snapshotHolder.load();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+const ConfigSnapshotHolder &ConfigWatcher::snapshotHolder() const
+{
+    return m_snapshotHolder;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigWatcher::reload()
+{
+    m_debounceTimer.stop();
+
+    if (!m_session.hasConfig())
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigReader)
+                << "Configuration can only be reloaded after the watcher was started";
+        return;
+    }
+
+    if (m_reloadRunning)
+    {
+        m_reloadPending = true;
+        return;
+    }
+
+    m_reloadRunning = true;
+    m_threadPool.start(new Internal::ConfigWatcherReload(this, m_changedFiles));
+    m_changedFiles.clear();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigWatcher::onFileChanged(const QString &filePath)
+{
+    if (!m_changedFiles.contains(filePath))
+    {
+        m_changedFiles.append(filePath);
+    }
+
+    // Files that are replaced (instead of written to) are no longer watched so they have to be
+    // added again (if they don't exist yet, they are added when they appear in their directory)
+    if ((!m_fileSystemWatcher.files().contains(filePath)) && QFileInfo::exists(filePath))
+    {
+        m_fileSystemWatcher.addPath(filePath);
+    }
+
+    m_debounceTimer.start();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigWatcher::onDirectoryChanged(const QString &directoryPath)
+{
+    QStringList dependencyFiles;
+
+    {
+        QMutexLocker locker(&m_mutex);
+        dependencyFiles = m_dependencyFiles;
+    }
+
+    // Only the files that are not watched anymore and exist again are of interest, changes of the
+    // watched files are reported by the files themselves
+    const QStringList watchedFiles = m_fileSystemWatcher.files();
+    QStringList addedFiles;
+
+    for (const QString &filePath : dependencyFiles)
+    {
+        const QFileInfo fileInfo(filePath);
+
+        if ((fileInfo.absolutePath() == directoryPath) &&
+            (!watchedFiles.contains(filePath)) &&
+            fileInfo.exists())
+        {
+            addedFiles.append(filePath);
+        }
+    }
+
+    if (addedFiles.isEmpty())
+    {
+        return;
+    }
+
+    for (const QString &filePath : addedFiles)
+    {
+        if (!m_changedFiles.contains(filePath))
+        {
+            m_changedFiles.append(filePath);
+        }
+    }
+
+    m_fileSystemWatcher.addPaths(addedFiles);
+    m_debounceTimer.start();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigWatcher::onReloadFinished()
+{
+    if (!m_reloadRunning)
+    {
+        // Watcher was stopped in the meantime
+        return;
+    }
+
+    m_reloadRunning = false;
+
+    bool reloadSucceeded = false;
+    QStringList changedNodePaths;
+
+    {
+        QMutexLocker locker(&m_mutex);
+        reloadSucceeded = m_reloadSucceeded;
+        changedNodePaths = m_changedNodePaths;
+    }
+
+    // Files that were replaced or removed during the reread are watched again even if the reread
+    // failed, otherwise fixing the configuration would not be detected
+    updateWatchedFiles();
+
+    if (reloadSucceeded)
+    {
+        if (!changedNodePaths.isEmpty())
+        {
+            emit configChanged(changedNodePaths);
+        }
+    }
+    else
+    {
+        emit reloadFailed();
+    }
+
+    // Changes that were made during the reread
+    if (m_reloadPending)
+    {
+        m_reloadPending = false;
+        m_debounceTimer.start();
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigWatcher::publish(std::unique_ptr<ConfigObjectNode> config)
+{
+    m_snapshotHolder.publish(std::move(config));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigWatcher::updateWatchedFiles()
+{
+    QStringList dependencyFiles;
+
+    {
+        QMutexLocker locker(&m_mutex);
+        dependencyFiles = m_dependencyFiles;
+    }
+
+    // Stop watching the files that are no longer read
+    QStringList removedFiles;
+
+    for (const QString &filePath : m_fileSystemWatcher.files())
+    {
+        if (!dependencyFiles.contains(filePath))
+        {
+            removedFiles.append(filePath);
+        }
+    }
+
+    if (!removedFiles.isEmpty())
+    {
+        m_fileSystemWatcher.removePaths(removedFiles);
+    }
+
+    // Start watching the new files (and the files that were replaced)
+    const QStringList watchedFiles = m_fileSystemWatcher.files();
+    QStringList addedFiles;
+
+    for (const QString &filePath : dependencyFiles)
+    {
+        if ((!watchedFiles.contains(filePath)) && QFileInfo::exists(filePath))
+        {
+            addedFiles.append(filePath);
+        }
+    }
+
+    if (!addedFiles.isEmpty())
+    {
+        m_fileSystemWatcher.addPaths(addedFiles);
+    }
+
+    // Watch the directories of the files so that the replaced and recreated files are detected
+    QStringList dependencyDirectories;
+
+    for (const QString &filePath : dependencyFiles)
+    {
+        const QString directoryPath = QFileInfo(filePath).absolutePath();
+
+        if (!dependencyDirectories.contains(directoryPath))
+        {
+            dependencyDirectories.append(directoryPath);
+        }
+    }
+
+    QStringList removedDirectories;
+
+    for (const QString &directoryPath : m_fileSystemWatcher.directories())
+    {
+        if (!dependencyDirectories.contains(directoryPath))
+        {
+            removedDirectories.append(directoryPath);
+        }
+    }
+
+    if (!removedDirectories.isEmpty())
+    {
+        m_fileSystemWatcher.removePaths(removedDirectories);
+    }
+
+    const QStringList watchedDirectories = m_fileSystemWatcher.directories();
+    QStringList addedDirectories;
+
+    for (const QString &directoryPath : dependencyDirectories)
+    {
+        if ((!watchedDirectories.contains(directoryPath)) && QFileInfo::exists(directoryPath))
+        {
+            addedDirectories.append(directoryPath);
+        }
+    }
+
+    if (!addedDirectories.isEmpty())
+    {
+        m_fileSystemWatcher.addPaths(addedDirectories);
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+
+namespace Internal
+{
+
+ConfigWatcherReload::ConfigWatcherReload(ConfigWatcher *watcher, const QStringList &changedFiles)
+    : m_watcher(watcher),
+      m_changedFiles(changedFiles)
+{
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void ConfigWatcherReload::run()
+{
+    // Files reported by the file system watcher are parsed again even if their size and time of
+    // the last modification were not changed
+    m_watcher->m_session.invalidateFiles(m_changedFiles);
+
+    QStringList changedNodePaths;
+    auto config = m_watcher->m_session.reread(&changedNodePaths);
+    const bool reloadSucceeded = static_cast<bool>(config);
+
+    // Publish the new snapshot right away so that readers don't have to wait for the event loop
+    if (reloadSucceeded && (!changedNodePaths.isEmpty()))
+    {
+        m_watcher->publish(std::move(config));
+    }
+
+    {
+        QMutexLocker locker(&m_watcher->m_mutex);
+        m_watcher->m_reloadSucceeded = reloadSucceeded;
+        m_watcher->m_changedNodePaths = changedNodePaths;
+
+        if (reloadSucceeded)
+        {
+            m_watcher->m_dependencyFiles = m_watcher->m_session.dependencies().files().keys();
+        }
+    }
+
+    // Notify the watcher in its own thread
+    QMetaObject::invokeMethod(m_watcher, "onReloadFinished", Qt::QueuedConnection);
+}
+
+} // namespace Internal
+
+} // namespace CppConfigFramework
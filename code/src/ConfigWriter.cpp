@@ -24,16 +24,23 @@
 // C++ Config Framework includes
 #include <CppConfigFramework/ConfigDerivedObjectNode.hpp>
 #include <CppConfigFramework/ConfigNodeReference.hpp>
+#include <CppConfigFramework/ConfigSnapshotFormat.hpp>
 #include <CppConfigFramework/ConfigValueNode.hpp>
 #include <CppConfigFramework/LoggingCategories.hpp>
 
 // Qt includes
 #include <QtCore/QFile>
+#include <QtCore/QJsonArray>
 #include <QtCore/QJsonDocument>
 #include <QtCore/QJsonObject>
+#include <QtCore/QSaveFile>
 #include <QtCore/QStringBuilder>
+#include <QtCore/QtEndian>
 
 // System includes
+#include <cstring>
+#include <deque>
+#include <limits>
 
 // Forward declarations
 
@@ -55,6 +62,109 @@ QJsonValue toJsonConfig(const ConfigObjectNode &objectNode);
 QJsonValue toJsonConfig(const ConfigNodeReference &nodeReference);
 QJsonValue toJsonConfig(const ConfigDerivedObjectNode &derivedObjectNode);
 
+//! This class builds the entry and string tables of a binary snapshot
+class SnapshotBuilder
+{
+public:
+    /*!
+     * Adds the entries of the configuration node
+     *
+     * \param   node    Configuration node
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool build(const ConfigObjectNode &node);
+
+    /*!
+     * Serializes the built tables
+     *
+     * \return  Binary snapshot or an empty byte array in case of failure
+     */
+    QByteArray serialize() const;
+
+private:
+    //! Holds a snapshot entry
+    struct Entry
+    {
+        //! Entry type
+        ConfigSnapshotFormat::EntryType type = ConfigSnapshotFormat::EntryType::Null;
+
+        //! Index of the name in the string table
+        quint32 name = ConfigSnapshotFormat::NO_NAME;
+
+        //! Entry data
+        quint64 data = 0U;
+    };
+
+    //! Holds a configuration node or a JSON value whose entry needs to be filled in
+    struct PendingItem
+    {
+        //! Configuration node or nullptr for a JSON value
+        const ConfigNode *node;
+
+        //! JSON value
+        QJsonValue value;
+
+        //! Index of the entry
+        quint32 index;
+    };
+
+    /*!
+     * Adds a string to the string table
+     *
+     * \param   text    String
+     *
+     * \return  Index of the string
+     */
+    quint32 addString(const QString &text);
+
+    /*!
+     * Reserves consecutive entries for the members or items of a container
+     *
+     * \param   count   Number of entries
+     *
+     * \return  Data of the container entry (index of the first entry and the number of entries)
+     */
+    quint64 reserveEntries(const int count);
+
+    /*!
+     * Fills in the entry for a configuration node
+     *
+     * \param   item    Pending item
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool addNode(const PendingItem &item);
+
+    /*!
+     * Fills in the entry for a JSON value
+     *
+     * \param   item    Pending item
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool addValue(const PendingItem &item);
+
+private:
+    //! Entries
+    std::vector<Entry> m_entries;
+
+    //! Items whose entries need to be filled in (in the order of their entries)
+    std::deque<PendingItem> m_pendingItems;
+
+    //! Strings
+    QStringList m_strings;
+
+    //! Indexes of the strings
+    QHash<QString, quint32> m_stringIndexes;
+
+    //! Number of UTF-16 code units in all strings
+    quint64 m_stringDataLength = 0U;
+};
+
 // -------------------------------------------------------------------------------------------------
 
 QJsonValue toJsonConfig(const ConfigValueNode &valueNode)
@@ -66,11 +176,14 @@ QJsonValue toJsonConfig(const ConfigValueNode &valueNode)
 
 QJsonValue toJsonConfig(const ConfigObjectNode &objectNode)
 {
+    const auto *nameTable = ConfigNameTable::instance();
+    const ConfigSortedMembers members = objectNode.sortedMembers();
     QJsonObject data;
 
-    for (const auto &memberName : objectNode.names())
+    for (size_t i = 0U; i < members.count(); i++)
     {
-        const auto *member = objectNode.member(memberName);
+        const QString &memberName = nameTable->name(members.at(i).name);
+        const auto *member = members.at(i).node.get();
 
         switch (member->type())
         {
@@ -152,6 +265,286 @@ QJsonValue toJsonConfig(const ConfigDerivedObjectNode &derivedObjectNode)
     return data;
 }
 
+// -------------------------------------------------------------------------------------------------
+
+bool SnapshotBuilder::build(const ConfigObjectNode &node)
+{
+    // Entries are filled in breadth first so that the members of a container are consecutive
+    m_entries.resize(1U);
+    m_pendingItems.push_back({ &node, QJsonValue(), 0U });
+
+    while (!m_pendingItems.empty())
+    {
+        const PendingItem item = m_pendingItems.front();
+        m_pendingItems.pop_front();
+
+        const bool success = (item.node != nullptr) ? addNode(item) : addValue(item);
+
+        if (!success)
+        {
+            return false;
+        }
+
+        if (m_entries.size() > static_cast<size_t>(ConfigSnapshotFormat::NO_NAME))
+        {
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigWriter)
+                    << "Too many entries for a snapshot!";
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+QByteArray SnapshotBuilder::serialize() const
+{
+    using namespace ConfigSnapshotFormat;
+
+    if (m_stringDataLength > static_cast<quint64>(NO_NAME))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigWriter)
+                << "Too much string data for a snapshot!";
+        return {};
+    }
+
+    const quint64 entryTableSize = m_entries.size() * ENTRY_SIZE;
+    const quint64 stringTableSize = static_cast<quint64>(m_strings.size()) *
+                                    STRING_TABLE_ENTRY_SIZE;
+    const quint64 dataSize = entryTableSize + stringTableSize + (m_stringDataLength * 2U);
+    const quint64 totalSize = HEADER_SIZE + dataSize;
+
+    if (totalSize > static_cast<quint64>(std::numeric_limits<int>::max()))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigWriter)
+                << "Snapshot is too large!";
+        return {};
+    }
+
+    QByteArray snapshot(static_cast<int>(totalSize), '\0');
+    char *output = snapshot.data();
+
+    // Header
+    std::memcpy(output, MAGIC, MAGIC_SIZE);
+    qToLittleEndian<quint16>(VERSION, output + 4);
+    qToLittleEndian<quint16>(static_cast<quint16>(HEADER_SIZE), output + 6);
+    qToLittleEndian<quint32>(static_cast<quint32>(m_entries.size()), output + 8);
+    qToLittleEndian<quint32>(static_cast<quint32>(m_strings.size()), output + 12);
+    qToLittleEndian<quint32>(static_cast<quint32>(m_stringDataLength), output + 16);
+    qToLittleEndian<quint64>(dataSize, output + 24);
+
+    // Entry table
+    char *position = output + HEADER_SIZE;
+
+    for (const auto &entry : m_entries)
+    {
+        position[0] = static_cast<char>(entry.type);
+        qToLittleEndian<quint32>(entry.name, position + 4);
+        qToLittleEndian<quint64>(entry.data, position + 8);
+        position += ENTRY_SIZE;
+    }
+
+    // String table
+    quint32 offset = 0U;
+
+    for (const auto &text : m_strings)
+    {
+        qToLittleEndian<quint32>(offset, position);
+        qToLittleEndian<quint32>(static_cast<quint32>(text.size()), position + 4);
+        offset += static_cast<quint32>(text.size());
+        position += STRING_TABLE_ENTRY_SIZE;
+    }
+
+    // String data
+    for (const auto &text : m_strings)
+    {
+        const ushort *codeUnits = text.utf16();
+
+        for (int i = 0; i < text.size(); i++)
+        {
+            qToLittleEndian<quint16>(codeUnits[i], position);
+            position += 2;
+        }
+    }
+
+    // Checksum
+    const quint64 headerChecksum = checksum(output, CHECKSUM_OFFSET);
+    qToLittleEndian<quint64>(checksum(output + HEADER_SIZE, dataSize, headerChecksum),
+                             output + CHECKSUM_OFFSET);
+
+    return snapshot;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+quint32 SnapshotBuilder::addString(const QString &text)
+{
+    auto it = m_stringIndexes.find(text);
+
+    if (it != m_stringIndexes.end())
+    {
+        return it.value();
+    }
+
+    const auto index = static_cast<quint32>(m_strings.size());
+    m_strings.append(text);
+    m_stringIndexes.insert(text, index);
+    m_stringDataLength += static_cast<quint64>(text.size());
+
+    return index;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+quint64 SnapshotBuilder::reserveEntries(const int count)
+{
+    const auto first = static_cast<quint64>(m_entries.size());
+    m_entries.resize(m_entries.size() + static_cast<size_t>(count));
+
+    return (first | (static_cast<quint64>(count) << 32U));
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool SnapshotBuilder::addNode(const PendingItem &item)
+{
+    using ConfigSnapshotFormat::EntryType;
+
+    switch (item.node->type())
+    {
+        case ConfigNode::Type::Object:
+        {
+            const auto *nameTable = ConfigNameTable::instance();
+            const ConfigSortedMembers members = item.node->toObject().sortedMembers();
+            const quint64 data = reserveEntries(static_cast<int>(members.count()));
+            auto index = static_cast<quint32>(data);
+
+            m_entries[item.index].type = EntryType::ObjectNode;
+            m_entries[item.index].data = data;
+
+            for (size_t i = 0U; i < members.count(); i++)
+            {
+                const auto &member = members.at(i);
+                m_entries[index].name = addString(nameTable->name(member.name));
+                m_pendingItems.push_back({ member.node.get(), QJsonValue(), index });
+                index++;
+            }
+            break;
+        }
+
+        case ConfigNode::Type::Value:
+        {
+            const quint64 data = reserveEntries(1);
+
+            m_entries[item.index].type = EntryType::ValueNode;
+            m_entries[item.index].data = static_cast<quint32>(data);
+            m_pendingItems.push_back({ nullptr,
+                                       item.node->toValue().value(),
+                                       static_cast<quint32>(data) });
+            break;
+        }
+
+        case ConfigNode::Type::NodeReference:
+        case ConfigNode::Type::DerivedObject:
+        default:
+        {
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigWriter)
+                    << "Only Object and Value nodes can be written to a snapshot:"
+                    << item.node->nodePath().path();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool SnapshotBuilder::addValue(const PendingItem &item)
+{
+    using ConfigSnapshotFormat::EntryType;
+
+    auto &entry = m_entries[item.index];
+
+    switch (item.value.type())
+    {
+        case QJsonValue::Null:
+        {
+            entry.type = EntryType::Null;
+            break;
+        }
+
+        case QJsonValue::Bool:
+        {
+            entry.type = EntryType::Bool;
+            entry.data = item.value.toBool() ? 1U : 0U;
+            break;
+        }
+
+        case QJsonValue::Double:
+        {
+            const double value = item.value.toDouble();
+
+            entry.type = EntryType::Double;
+            std::memcpy(&entry.data, &value, sizeof(value));
+            break;
+        }
+
+        case QJsonValue::String:
+        {
+            entry.type = EntryType::String;
+            entry.data = addString(item.value.toString());
+            break;
+        }
+
+        case QJsonValue::Array:
+        {
+            const QJsonArray array = item.value.toArray();
+            const quint64 data = reserveEntries(array.size());
+            auto index = static_cast<quint32>(data);
+
+            m_entries[item.index].type = EntryType::Array;
+            m_entries[item.index].data = data;
+
+            for (const auto &arrayItem : array)
+            {
+                m_pendingItems.push_back({ nullptr, arrayItem, index });
+                index++;
+            }
+            break;
+        }
+
+        case QJsonValue::Object:
+        {
+            const QJsonObject object = item.value.toObject();
+            const quint64 data = reserveEntries(object.size());
+            auto index = static_cast<quint32>(data);
+
+            m_entries[item.index].type = EntryType::Object;
+            m_entries[item.index].data = data;
+
+            for (auto it = object.begin(); it != object.end(); it++)
+            {
+                m_entries[index].name = addString(it.key());
+                m_pendingItems.push_back({ nullptr, it.value(), index });
+                index++;
+            }
+            break;
+        }
+
+        case QJsonValue::Undefined:
+        default:
+        {
+            qCWarning(CppConfigFramework::LoggingCategory::ConfigWriter)
+                    << "Undefined values can't be written to a snapshot";
+            return false;
+        }
+    }
+
+    return true;
+}
+
 } // namespace Internal
 
 // -------------------------------------------------------------------------------------------------
@@ -210,11 +603,14 @@ bool writeToJsonConfigFile(const ConfigObjectNode &node, const QString &filePath
 
 QJsonValue convertToJsonValue(const ConfigObjectNode &node)
 {
+    const auto *nameTable = ConfigNameTable::instance();
+    const ConfigSortedMembers members = node.sortedMembers();
     QJsonObject data;
 
-    for (const auto &memberName : node.names())
+    for (size_t i = 0U; i < members.count(); i++)
     {
-        const auto *member = node.member(memberName);
+        const QString &memberName = nameTable->name(members.at(i).name);
+        const auto *member = members.at(i).node.get();
 
         switch (member->type())
         {
@@ -242,6 +638,61 @@ QJsonValue convertToJsonValue(const ConfigObjectNode &node)
     return data;
 }
 
+// -------------------------------------------------------------------------------------------------
+
+QByteArray writeToSnapshot(const ConfigObjectNode &node)
+{
+    Internal::SnapshotBuilder builder;
+
+    if (!builder.build(node))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigWriter)
+                << "Failed to build the snapshot!";
+        return {};
+    }
+
+    return builder.serialize();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool writeToSnapshotFile(const ConfigObjectNode &node, const QString &filePath)
+{
+    const QByteArray snapshot = writeToSnapshot(node);
+
+    if (snapshot.isEmpty())
+    {
+        return false;
+    }
+
+    // Write the snapshot to a temporary file and then replace the file with it
+    QSaveFile file(filePath);
+
+    if (!file.open(QIODevice::WriteOnly))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigWriter)
+                << "Failed to open file:" << filePath;
+        return false;
+    }
+
+    if (file.write(snapshot) != static_cast<qint64>(snapshot.size()))
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigWriter)
+                << "Failed to write the snapshot to the file:" << filePath;
+        file.cancelWriting();
+        return false;
+    }
+
+    if (!file.commit())
+    {
+        qCWarning(CppConfigFramework::LoggingCategory::ConfigWriter)
+                << "Failed to commit the snapshot to the file:" << filePath;
+        return false;
+    }
+
+    return true;
+}
+
 } // namespace ConfigWriter
 
 } // namespace CppConfigFramework
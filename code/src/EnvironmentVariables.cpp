@@ -22,6 +22,7 @@
 #include <CppConfigFramework/EnvironmentVariables.hpp>
 
 // C++ Config Framework includes
+#include <CppConfigFramework/ConfigDependencies.hpp>
 #include <CppConfigFramework/ConfigNodePath.hpp>
 
 // Qt includes
@@ -61,8 +62,16 @@ QStringList EnvironmentVariables::names() const
 
 // -------------------------------------------------------------------------------------------------
 
+const QHash<QString, QString> &EnvironmentVariables::variables() const
+{
+    return m_variables;
+}
+
+// -------------------------------------------------------------------------------------------------
+
 bool EnvironmentVariables::contains(const QString &name) const
 {
+    ConfigDependencyRecorder::recordEnvironmentVariable(name);
     return m_variables.contains(name);
 }
 
@@ -70,13 +79,15 @@ bool EnvironmentVariables::contains(const QString &name) const
 
 QString EnvironmentVariables::value(const QString &name) const
 {
-    return m_variables[name];
+    ConfigDependencyRecorder::recordEnvironmentVariable(name);
+    return m_variables.value(name);
 }
 
 // -------------------------------------------------------------------------------------------------
 
 void EnvironmentVariables::setValue(const QString &name, const QString &value)
 {
+    ConfigDependencyRecorder::recordWrittenEnvironmentVariable(name);
     m_variables[name] = value;
 }
 
@@ -0,0 +1,168 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains a temporary directory for the configuration files written by the tests
+ */
+
+#pragma once
+
+// C++ Config Framework includes
+
+// Qt includes
+#include <QtCore/QByteArray>
+#include <QtCore/QDateTime>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QSaveFile>
+#include <QtCore/QTemporaryDir>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// -------------------------------------------------------------------------------------------------
+
+namespace CppConfigFramework
+{
+
+namespace Test
+{
+
+/*!
+ * This class holds a temporary directory for the configuration files written by a test
+ *
+ * The directory and all of its files are removed when the object is destroyed.
+ */
+class TestConfigDir
+{
+public:
+    /*!
+     * Checks if the directory was created
+     *
+     * \retval  true    Directory is valid
+     * \retval  false   Directory could not be created
+     */
+    bool isValid() const
+    {
+        return m_dir.isValid();
+    }
+
+    /*!
+     * Gets the directory
+     *
+     * \return  Directory
+     */
+    QDir dir() const
+    {
+        return QDir(m_dir.path());
+    }
+
+    /*!
+     * Gets the absolute path of a file in the directory
+     *
+     * \param   fileName    File name (or an absolute file path)
+     *
+     * \return  Absolute file path
+     */
+    QString filePath(const QString &fileName) const
+    {
+        return dir().absoluteFilePath(fileName);
+    }
+
+    /*!
+     * Writes the file (an existing file is overwritten)
+     *
+     * \param   fileName    File name (or an absolute file path)
+     * \param   contents    File contents
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool writeFile(const QString &fileName, const QByteArray &contents) const
+    {
+        QFile file(filePath(fileName));
+
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        {
+            return false;
+        }
+
+        return (file.write(contents) == contents.size());
+    }
+
+    /*!
+     * Replaces the file with a new one (the contents are written to a temporary file which is then
+     * renamed, like most editors do)
+     *
+     * \param   fileName    File name (or an absolute file path)
+     * \param   contents    File contents
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool replaceFile(const QString &fileName, const QByteArray &contents) const
+    {
+        QSaveFile file(filePath(fileName));
+
+        if (!file.open(QIODevice::WriteOnly))
+        {
+            return false;
+        }
+
+        if (file.write(contents) != contents.size())
+        {
+            return false;
+        }
+
+        return file.commit();
+    }
+
+    /*!
+     * Moves the modification time of the file
+     *
+     * \param   fileName    File name (or an absolute file path)
+     * \param   offset      Offset from the current modification time (in milliseconds)
+     *
+     * \retval  true    Success
+     * \retval  false   Failure
+     */
+    bool setLastModified(const QString &fileName, const qint64 offset) const
+    {
+        const QDateTime lastModified = QFileInfo(filePath(fileName)).lastModified();
+        QFile file(filePath(fileName));
+
+        if (!file.open(QIODevice::ReadWrite))
+        {
+            return false;
+        }
+
+        return file.setFileTime(QDateTime::fromMSecsSinceEpoch(lastModified.toMSecsSinceEpoch() +
+                                                               offset),
+                                QFileDevice::FileModificationTime);
+    }
+
+private:
+    //! Temporary directory
+    QTemporaryDir m_dir;
+};
+
+} // namespace Test
+
+} // namespace CppConfigFramework
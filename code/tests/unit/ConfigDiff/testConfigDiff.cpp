@@ -0,0 +1,237 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains unit tests for ConfigDiff class
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigDiff.hpp>
+#include <CppConfigFramework/ConfigNodeReference.hpp>
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/ConfigValueNode.hpp>
+
+// Qt includes
+#include <QtCore/QDebug>
+#include <QtTest/QTest>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// Test class declaration --------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+
+class TestConfigDiff : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Functions executed by QtTest before and after test suite
+    void initTestCase();
+    void cleanupTestCase();
+
+    // Functions executed by QtTest before and after each test
+    void init();
+    void cleanup();
+
+    // Test functions
+    void testEqual();
+    void testChangedValues();
+    void testAddedAndRemovedMembers();
+    void testChangedType();
+    void testLargeObjects();
+    void testSharedMembers();
+    void testAffects();
+
+private:
+    std::unique_ptr<ConfigObjectNode> createConfig();
+};
+
+// Test Case init/cleanup methods ------------------------------------------------------------------
+
+void TestConfigDiff::initTestCase()
+{
+}
+
+void TestConfigDiff::cleanupTestCase()
+{
+}
+
+// Test init/cleanup methods -----------------------------------------------------------------------
+
+void TestConfigDiff::init()
+{
+}
+
+void TestConfigDiff::cleanup()
+{
+}
+
+// Test: equal configurations ----------------------------------------------------------------------
+
+void TestConfigDiff::testEqual()
+{
+    auto previous = createConfig();
+    auto current = createConfig();
+
+    const auto diff = ConfigDiff::compare(*previous, *current);
+    QVERIFY(diff.isEmpty());
+    QVERIFY(diff.nodePaths().isEmpty());
+
+    QVERIFY(ConfigDiff().isEmpty());
+}
+
+// Test: changed values ----------------------------------------------------------------------------
+
+void TestConfigDiff::testChangedValues()
+{
+    auto previous = createConfig();
+    auto current = createConfig();
+    current->member("a")->toObject().setMember("value", ConfigValueNode(10));
+    current->setMember("reference", ConfigNodeReference(ConfigNodePath("/b")));
+
+    const auto diff = ConfigDiff::compare(*previous, *current);
+    QVERIFY(!diff.isEmpty());
+    QVERIFY(diff.addedNodePaths().isEmpty());
+    QVERIFY(diff.removedNodePaths().isEmpty());
+
+    const QStringList expectedNodePaths { "/a/value", "/reference" };
+    QCOMPARE(diff.changedNodePaths(), expectedNodePaths);
+    QCOMPARE(diff.nodePaths(), expectedNodePaths);
+}
+
+// Test: added and removed members -----------------------------------------------------------------
+
+void TestConfigDiff::testAddedAndRemovedMembers()
+{
+    auto previous = createConfig();
+    auto current = createConfig();
+    QVERIFY(current->member("a")->toObject().remove("text"));
+    QVERIFY(current->remove("b"));
+    current->member("a")->toObject().setMember("new", ConfigObjectNode());
+    current->setMember("c", ConfigValueNode(true));
+
+    const auto diff = ConfigDiff::compare(*previous, *current);
+    QCOMPARE(diff.addedNodePaths(), QStringList({ "/a/new", "/c" }));
+    QCOMPARE(diff.removedNodePaths(), QStringList({ "/a/text", "/b" }));
+    QVERIFY(diff.changedNodePaths().isEmpty());
+    QCOMPARE(diff.nodePaths(), QStringList({ "/a/new", "/a/text", "/b", "/c" }));
+}
+
+// Test: changed node type -------------------------------------------------------------------------
+
+void TestConfigDiff::testChangedType()
+{
+    auto previous = createConfig();
+    auto current = createConfig();
+    current->setMember("a", ConfigValueNode("a"));
+
+    const auto diff = ConfigDiff::compare(*previous, *current);
+    QCOMPARE(diff.changedNodePaths(), QStringList { "/a" });
+    QCOMPARE(diff.nodePaths(), QStringList { "/a" });
+}
+
+// Test: Object nodes with a hash index ------------------------------------------------------------
+
+void TestConfigDiff::testLargeObjects()
+{
+    ConfigObjectNode previous;
+    ConfigObjectNode current;
+
+    // Members are inserted in a different order
+    for (int i = 0; i < 100; i++)
+    {
+        previous.setMember(QString("member%1").arg(i), ConfigValueNode(i));
+        current.setMember(QString("member%1").arg(99 - i), ConfigValueNode(99 - i));
+    }
+
+    QVERIFY(ConfigDiff::compare(previous, current).isEmpty());
+
+    current.setMember("member50", ConfigValueNode(-1));
+    QVERIFY(current.remove("member10"));
+    current.setMember("member100", ConfigValueNode(100));
+
+    const auto diff = ConfigDiff::compare(previous, current);
+    QCOMPARE(diff.addedNodePaths(), QStringList { "/member100" });
+    QCOMPARE(diff.removedNodePaths(), QStringList { "/member10" });
+    QCOMPARE(diff.changedNodePaths(), QStringList { "/member50" });
+}
+
+// Test: Object nodes that share their members -----------------------------------------------------
+
+void TestConfigDiff::testSharedMembers()
+{
+    auto previous = createConfig();
+    auto clone = previous->clone();
+
+    QVERIFY(ConfigDiff::compare(*previous, clone->toObject()).isEmpty());
+
+    // Changing the clone detaches it
+    clone->toObject().setMember("c", ConfigValueNode(1));
+    QCOMPARE(ConfigDiff::compare(*previous, clone->toObject()).nodePaths(), QStringList { "/c" });
+}
+
+// Test: affected node paths -----------------------------------------------------------------------
+
+void TestConfigDiff::testAffects()
+{
+    auto previous = createConfig();
+    auto current = createConfig();
+    current->member("a")->toObject().setMember("value", ConfigValueNode(10));
+
+    const auto diff = ConfigDiff::compare(*previous, *current);
+
+    // Node itself, its ancestors and its descendants are affected
+    QVERIFY(diff.affects(ConfigNodePath("/a/value")));
+    QVERIFY(diff.affects(ConfigNodePath("/a")));
+    QVERIFY(diff.affects(ConfigNodePath::ROOT_PATH));
+    QVERIFY(diff.affects(ConfigNodePath("/a/value/x")));
+
+    // Siblings and nodes with a common prefix are not affected
+    QVERIFY(!diff.affects(ConfigNodePath("/a/text")));
+    QVERIFY(!diff.affects(ConfigNodePath("/a/value2")));
+    QVERIFY(!diff.affects(ConfigNodePath("/b")));
+
+    QVERIFY(!ConfigDiff().affects(ConfigNodePath::ROOT_PATH));
+}
+
+// Helper methods ----------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> TestConfigDiff::createConfig()
+{
+    auto config = std::make_unique<ConfigObjectNode>();
+
+    ConfigObjectNode a;
+    a.setMember("value", ConfigValueNode(1));
+    a.setMember("text", ConfigValueNode("abc"));
+    config->setMember("a", a);
+
+    ConfigObjectNode b;
+    b.setMember("value", ConfigValueNode(2));
+    config->setMember("b", b);
+
+    config->setMember("reference", ConfigNodeReference(ConfigNodePath("/a")));
+    return config;
+}
+
+// Main function -----------------------------------------------------------------------------------
+
+QTEST_MAIN(TestConfigDiff)
+#include "testConfigDiff.moc"
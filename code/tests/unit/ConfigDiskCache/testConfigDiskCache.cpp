@@ -0,0 +1,331 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains unit tests for ConfigDiskCache class
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigDiskCache.hpp>
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/ConfigReader.hpp>
+#include <CppConfigFramework/ConfigValueNode.hpp>
+#include "TestConfigDir.hpp"
+
+// Qt includes
+#include <QtCore/QDebug>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtTest/QTest>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// Test class declaration --------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+
+class TestConfigDiskCache : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Functions executed by QtTest before and after test suite
+    void initTestCase();
+    void cleanupTestCase();
+
+    // Functions executed by QtTest before and after each test
+    void init();
+    void cleanup();
+
+    // Test functions
+    void testStoreAndLoad();
+    void testModifiedInclude();
+    void testRewrittenInclude();
+    void testEnvironmentVariables();
+    void testCorruptedSnapshot();
+    void testExternalConfigs();
+
+private:
+    QString cachePath() const;
+    std::unique_ptr<ConfigObjectNode> readConfig(const QString &fileName,
+                                                 EnvironmentVariables *environmentVariables);
+    std::unique_ptr<ConfigObjectNode> loadCachedConfig(const QString &fileName,
+                                                       EnvironmentVariables *environmentVariables);
+
+    std::unique_ptr<Test::TestConfigDir> m_dir;
+};
+
+// Test Case init/cleanup methods ------------------------------------------------------------------
+
+void TestConfigDiskCache::initTestCase()
+{
+}
+
+void TestConfigDiskCache::cleanupTestCase()
+{
+}
+
+// Test init/cleanup methods -----------------------------------------------------------------------
+
+void TestConfigDiskCache::init()
+{
+    m_dir = std::make_unique<Test::TestConfigDir>();
+    QVERIFY(m_dir->isValid());
+}
+
+void TestConfigDiskCache::cleanup()
+{
+    m_dir.reset();
+}
+
+// Test: storing and loading a configuration -------------------------------------------------------
+
+void TestConfigDiskCache::testStoreAndLoad()
+{
+    QVERIFY(m_dir->writeFile("common.json",
+                             "{\"environment_variables\": {\"CCF_TEST_SET\": \"set\"},"
+                             " \"config\": {\"common\": {\"value\": 1, \"text\": \"abc\"}}}"));
+    QVERIFY(m_dir->writeFile("config.json",
+                             "{\"includes\": [{\"file_path\": \"common.json\"}],"
+                             " \"config\": {\"&ref\": \"/common/value\", \"item\": [1, 2]}}"));
+
+    // Nothing is cached yet
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    QVERIFY(!loadCachedConfig("config.json", &environmentVariables));
+
+    // Read the configuration and store it in the cache directory
+    auto config = readConfig("config.json", &environmentVariables);
+    QVERIFY(config);
+    QCOMPARE(environmentVariables.value("CCF_TEST_SET"), QString("set"));
+
+    const QString entryName = ConfigDiskCache::entryName(m_dir->filePath("config.json"),
+                                                         ConfigNodePath::ROOT_PATH,
+                                                         ConfigNodePath::ROOT_PATH);
+    QVERIFY(QFile::exists(QDir(cachePath()).absoluteFilePath(entryName + ".ccfs")));
+    QVERIFY(QFile::exists(QDir(cachePath()).absoluteFilePath(entryName + ".json")));
+
+    // Load the configuration from the cache directory (environment variables that were set by the
+    // configuration must be set again)
+    environmentVariables = EnvironmentVariables::loadFromProcess();
+    auto cachedConfig = loadCachedConfig("config.json", &environmentVariables);
+    QVERIFY(cachedConfig);
+    QVERIFY(*cachedConfig == *config);
+    QCOMPARE(cachedConfig->nodeAtPath("/ref")->toValue().value().toInt(), 1);
+    QCOMPARE(environmentVariables.value("CCF_TEST_SET"), QString("set"));
+
+    // Other node paths are separate entries
+    ConfigDiskCache diskCache(cachePath());
+    QVERIFY(!diskCache.load(m_dir->filePath("config.json"),
+                            ConfigNodePath("/common"),
+                            ConfigNodePath::ROOT_PATH,
+                            &environmentVariables));
+}
+
+// Test: modified include --------------------------------------------------------------------------
+
+void TestConfigDiskCache::testModifiedInclude()
+{
+    QVERIFY(m_dir->writeFile("common.json", "{\"config\": {\"value\": 1}}"));
+    QVERIFY(m_dir->writeFile("config.json",
+                             "{\"includes\": [{\"file_path\": \"common.json\"}],"
+                             " \"config\": null}"));
+
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    QVERIFY(readConfig("config.json", &environmentVariables));
+    QVERIFY(loadCachedConfig("config.json", &environmentVariables));
+
+    // Same size but different contents
+    QVERIFY(m_dir->writeFile("common.json", "{\"config\": {\"value\": 2}}"));
+    QVERIFY(m_dir->setLastModified("common.json", 10000));
+    QVERIFY(!loadCachedConfig("config.json", &environmentVariables));
+
+    // The cache entry is replaced by the next read
+    auto config = readConfig("config.json", &environmentVariables);
+    QVERIFY(config);
+    QCOMPARE(config->nodeAtPath("/value")->toValue().value().toInt(), 2);
+
+    auto cachedConfig = loadCachedConfig("config.json", &environmentVariables);
+    QVERIFY(cachedConfig);
+    QCOMPARE(cachedConfig->nodeAtPath("/value")->toValue().value().toInt(), 2);
+
+    // Removed include
+    QVERIFY(QFile::remove(m_dir->filePath("common.json")));
+    QVERIFY(!loadCachedConfig("config.json", &environmentVariables));
+}
+
+// Test: include rewritten with the same contents --------------------------------------------------
+
+void TestConfigDiskCache::testRewrittenInclude()
+{
+    const QByteArray contents = "{\"config\": {\"value\": 1}}";
+    QVERIFY(m_dir->writeFile("common.json", contents));
+    QVERIFY(m_dir->writeFile("config.json",
+                             "{\"includes\": [{\"file_path\": \"common.json\"}],"
+                             " \"config\": null}"));
+
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    QVERIFY(readConfig("config.json", &environmentVariables));
+
+    // Only the time of the last modification is changed so the content hash still matches
+    QVERIFY(m_dir->writeFile("common.json", contents));
+    QVERIFY(m_dir->setLastModified("common.json", 10000));
+
+    auto cachedConfig = loadCachedConfig("config.json", &environmentVariables);
+    QVERIFY(cachedConfig);
+    QCOMPARE(cachedConfig->nodeAtPath("/value")->toValue().value().toInt(), 1);
+}
+
+// Test: environment variables ---------------------------------------------------------------------
+
+void TestConfigDiskCache::testEnvironmentVariables()
+{
+    QVERIFY(m_dir->writeFile("config.json", "{\"config\": {\"$value\": \"${CCF_TEST_VALUE}\"}}"));
+
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    environmentVariables.setValue("CCF_TEST_VALUE", "a");
+    auto config = readConfig("config.json", &environmentVariables);
+    QVERIFY(config);
+    QCOMPARE(config->nodeAtPath("/value")->toValue().value().toString(), QString("a"));
+
+    // Same value
+    environmentVariables = EnvironmentVariables::loadFromProcess();
+    environmentVariables.setValue("CCF_TEST_VALUE", "a");
+    QVERIFY(loadCachedConfig("config.json", &environmentVariables));
+
+    // Different value
+    environmentVariables = EnvironmentVariables::loadFromProcess();
+    environmentVariables.setValue("CCF_TEST_VALUE", "b");
+    QVERIFY(!loadCachedConfig("config.json", &environmentVariables));
+
+    config = readConfig("config.json", &environmentVariables);
+    QVERIFY(config);
+    QCOMPARE(config->nodeAtPath("/value")->toValue().value().toString(), QString("b"));
+
+    // Manifest doesn't contain the values of the environment variables
+    const QString entryName = ConfigDiskCache::entryName(m_dir->filePath("config.json"),
+                                                         ConfigNodePath::ROOT_PATH,
+                                                         ConfigNodePath::ROOT_PATH);
+    QFile manifestFile(QDir(cachePath()).absoluteFilePath(entryName + ".json"));
+    QVERIFY(manifestFile.open(QIODevice::ReadOnly));
+    const QByteArray manifest = manifestFile.readAll();
+    QVERIFY(manifest.contains("CCF_TEST_VALUE"));
+    QVERIFY(!manifest.contains("\"b\""));
+}
+
+// Test: corrupted snapshot ------------------------------------------------------------------------
+
+void TestConfigDiskCache::testCorruptedSnapshot()
+{
+    QVERIFY(m_dir->writeFile("config.json", "{\"config\": {\"value\": 1}}"));
+
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    QVERIFY(readConfig("config.json", &environmentVariables));
+
+    const QString entryName = ConfigDiskCache::entryName(m_dir->filePath("config.json"),
+                                                         ConfigNodePath::ROOT_PATH,
+                                                         ConfigNodePath::ROOT_PATH);
+    const QString snapshotPath = QDir(cachePath()).absoluteFilePath(entryName + ".ccfs");
+    QByteArray snapshot;
+
+    {
+        QFile file(snapshotPath);
+        QVERIFY(file.open(QIODevice::ReadOnly));
+        snapshot = file.readAll();
+    }
+
+    // Truncated snapshot
+    QVERIFY(m_dir->writeFile(snapshotPath, snapshot.left(snapshot.size() - 1)));
+    QVERIFY(!loadCachedConfig("config.json", &environmentVariables));
+
+    // Configuration is still read from the file and the cache entry is written again
+    auto config = readConfig("config.json", &environmentVariables);
+    QVERIFY(config);
+    QCOMPARE(config->nodeAtPath("/value")->toValue().value().toInt(), 1);
+    QVERIFY(loadCachedConfig("config.json", &environmentVariables));
+
+    // Invalid manifest
+    QVERIFY(m_dir->writeFile(QDir(cachePath()).absoluteFilePath(entryName + ".json"), "[]"));
+    QVERIFY(!loadCachedConfig("config.json", &environmentVariables));
+}
+
+// Test: configuration that is read with external configs ------------------------------------------
+
+void TestConfigDiskCache::testExternalConfigs()
+{
+    QVERIFY(m_dir->writeFile("config.json", "{\"config\": {\"&ref\": \"/external/value\"}}"));
+
+    ConfigObjectNode externalConfig;
+    externalConfig.setMember("external", std::make_unique<ConfigObjectNode>());
+    externalConfig.nodeAtPath("/external")->toObject().setMember(
+                "value", std::make_unique<ConfigValueNode>(5));
+
+    ConfigReader configReader;
+    configReader.setCacheDirectory(cachePath());
+
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    auto config = configReader.read("config.json",
+                                    m_dir->dir(),
+                                    ConfigNodePath::ROOT_PATH,
+                                    ConfigNodePath::ROOT_PATH,
+                                    { &externalConfig },
+                                    &environmentVariables);
+    QVERIFY(config);
+    QCOMPARE(config->nodeAtPath("/ref")->toValue().value().toInt(), 5);
+    QVERIFY(!loadCachedConfig("config.json", &environmentVariables));
+}
+
+// Helper methods ----------------------------------------------------------------------------------
+
+QString TestConfigDiskCache::cachePath() const
+{
+    return m_dir->filePath("cache");
+}
+
+std::unique_ptr<ConfigObjectNode> TestConfigDiskCache::readConfig(
+        const QString &fileName,
+        EnvironmentVariables *environmentVariables)
+{
+    ConfigReader configReader;
+    configReader.setCacheDirectory(cachePath());
+
+    return configReader.read(fileName,
+                             m_dir->dir(),
+                             ConfigNodePath::ROOT_PATH,
+                             ConfigNodePath::ROOT_PATH,
+                             {},
+                             environmentVariables);
+}
+
+std::unique_ptr<ConfigObjectNode> TestConfigDiskCache::loadCachedConfig(
+        const QString &fileName,
+        EnvironmentVariables *environmentVariables)
+{
+    ConfigDiskCache diskCache(cachePath());
+
+    return diskCache.load(m_dir->filePath(fileName),
+                          ConfigNodePath::ROOT_PATH,
+                          ConfigNodePath::ROOT_PATH,
+                          environmentVariables);
+}
+
+// Main function -----------------------------------------------------------------------------------
+
+QTEST_MAIN(TestConfigDiskCache)
+#include "testConfigDiskCache.moc"
@@ -0,0 +1,197 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains unit tests for ConfigFileBuffer class
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigFileBuffer.hpp>
+
+// Qt includes
+#include <QtCore/QDebug>
+#include <QtCore/QDir>
+#include <QtCore/QTemporaryDir>
+#include <QtTest/QTest>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// Test class declaration --------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+
+class TestConfigFileBuffer : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Functions executed by QtTest before and after test suite
+    void initTestCase();
+    void cleanupTestCase();
+
+    // Functions executed by QtTest before and after each test
+    void init();
+    void cleanup();
+
+    // Test functions
+    void testMappedFile();
+    void testMappingDisabled();
+    void testEmptyFile();
+    void testResourceFile();
+    void testMissingFile();
+};
+
+// Test Case init/cleanup methods ------------------------------------------------------------------
+
+void TestConfigFileBuffer::initTestCase()
+{
+}
+
+void TestConfigFileBuffer::cleanupTestCase()
+{
+}
+
+// Test init/cleanup methods -----------------------------------------------------------------------
+
+void TestConfigFileBuffer::init()
+{
+}
+
+void TestConfigFileBuffer::cleanup()
+{
+}
+
+// Test: regular file ------------------------------------------------------------------------------
+
+void TestConfigFileBuffer::testMappedFile()
+{
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+
+    const QByteArray contents = "{ \"config\": { \"value\": 1 } }";
+    const QString filePath = QDir(directory.path()).absoluteFilePath("config.json");
+
+    {
+        QFile file(filePath);
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        QCOMPARE(file.write(contents), static_cast<qint64>(contents.size()));
+    }
+
+    ConfigFileBuffer buffer;
+    QVERIFY(!buffer.isOpen());
+    QVERIFY(buffer.open(filePath));
+    QVERIFY(buffer.isOpen());
+    QVERIFY(buffer.isMapped());
+    QCOMPARE(buffer.size(), static_cast<size_t>(contents.size()));
+    QCOMPARE(QByteArray(buffer.data(), static_cast<int>(buffer.size())), contents);
+
+    QCOMPARE(buffer.mid(2, 8), QByteArray("\"config\""));
+    QCOMPARE(buffer.mid(contents.size() - 2, 10), QByteArray(" }"));
+    QCOMPARE(buffer.mid(contents.size() + 10, 10), QByteArray());
+
+    buffer.close();
+    QVERIFY(!buffer.isOpen());
+    QVERIFY(!buffer.isMapped());
+    QCOMPARE(buffer.size(), static_cast<size_t>(0));
+}
+
+// Test: regular file with memory mapping disabled -------------------------------------------------
+
+void TestConfigFileBuffer::testMappingDisabled()
+{
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+
+    const QByteArray contents = "{ \"config\": { \"value\": 1 } }";
+    const QString filePath = QDir(directory.path()).absoluteFilePath("config.json");
+
+    {
+        QFile file(filePath);
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        QCOMPARE(file.write(contents), static_cast<qint64>(contents.size()));
+    }
+
+    // Contents are read to the heap so the file can be rewritten while the buffer is open
+    ConfigFileBuffer buffer;
+    QVERIFY(buffer.open(filePath, false));
+    QVERIFY(buffer.isOpen());
+    QVERIFY(!buffer.isMapped());
+
+    {
+        QFile file(filePath);
+        QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+    }
+
+    QCOMPARE(QByteArray(buffer.data(), static_cast<int>(buffer.size())), contents);
+}
+
+// Test: empty file --------------------------------------------------------------------------------
+
+void TestConfigFileBuffer::testEmptyFile()
+{
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+
+    const QString filePath = QDir(directory.path()).absoluteFilePath("empty.json");
+
+    {
+        QFile file(filePath);
+        QVERIFY(file.open(QIODevice::WriteOnly));
+    }
+
+    // Empty files can't be mapped
+    ConfigFileBuffer buffer;
+    QVERIFY(buffer.open(filePath));
+    QVERIFY(!buffer.isMapped());
+    QCOMPARE(buffer.size(), static_cast<size_t>(0));
+}
+
+// Test: Qt resource file --------------------------------------------------------------------------
+
+void TestConfigFileBuffer::testResourceFile()
+{
+    const QString filePath(QStringLiteral(":/TestData/Config.json"));
+
+    QFile file(filePath);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    const QByteArray contents = file.readAll();
+    QVERIFY(!contents.isEmpty());
+
+    // Resources are read to the heap
+    ConfigFileBuffer buffer;
+    QVERIFY(buffer.open(filePath));
+    QVERIFY(!buffer.isMapped());
+    QCOMPARE(QByteArray(buffer.data(), static_cast<int>(buffer.size())), contents);
+}
+
+// Test: missing file ------------------------------------------------------------------------------
+
+void TestConfigFileBuffer::testMissingFile()
+{
+    ConfigFileBuffer buffer;
+    QVERIFY(!buffer.open(QStringLiteral(":/TestData/Missing.json")));
+    QVERIFY(!buffer.isOpen());
+    QCOMPARE(buffer.size(), static_cast<size_t>(0));
+}
+
+// Main function -----------------------------------------------------------------------------------
+
+QTEST_MAIN(TestConfigFileBuffer)
+#include "testConfigFileBuffer.moc"
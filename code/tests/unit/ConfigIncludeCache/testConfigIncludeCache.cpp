@@ -0,0 +1,389 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains unit tests for ConfigIncludeCache class
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigIncludeCache.hpp>
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/ConfigReader.hpp>
+#include <CppConfigFramework/ConfigReaderRegistry.hpp>
+#include <CppConfigFramework/ConfigValueNode.hpp>
+#include "TestConfigDir.hpp"
+
+// Qt includes
+#include <QtCore/QDebug>
+#include <QtTest/QTest>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// Test class declaration --------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+
+class TestConfigIncludeCache : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Functions executed by QtTest before and after test suite
+    void initTestCase();
+    void cleanupTestCase();
+
+    // Functions executed by QtTest before and after each test
+    void init();
+    void cleanup();
+
+    // Test functions
+    void testHitAndMiss();
+    void testModifiedInclude();
+    void testInvalidate();
+    void testEnvironmentVariables();
+    void testExternalConfigs();
+    void testParallelIncludes();
+    void testDisabled();
+
+private:
+    std::unique_ptr<ConfigObjectNode> readConfig(const QString &fileName,
+                                                 EnvironmentVariables *environmentVariables,
+                                                 const bool parallelIncludes = false);
+
+    std::unique_ptr<Test::TestConfigDir> m_dir;
+};
+
+// Test Case init/cleanup methods ------------------------------------------------------------------
+
+void TestConfigIncludeCache::initTestCase()
+{
+}
+
+void TestConfigIncludeCache::cleanupTestCase()
+{
+}
+
+// Test init/cleanup methods -----------------------------------------------------------------------
+
+void TestConfigIncludeCache::init()
+{
+    m_dir = std::make_unique<Test::TestConfigDir>();
+    QVERIFY(m_dir->isValid());
+
+    auto *includeCache = ConfigReaderRegistry::instance()->includeCache();
+    includeCache->clear();
+    includeCache->setEnabled(true);
+}
+
+void TestConfigIncludeCache::cleanup()
+{
+    auto *includeCache = ConfigReaderRegistry::instance()->includeCache();
+    includeCache->setEnabled(false);
+    includeCache->clear();
+
+    m_dir.reset();
+}
+
+// Test: repeated reads of the same configuration files --------------------------------------------
+
+void TestConfigIncludeCache::testHitAndMiss()
+{
+    QVERIFY(m_dir->writeFile("common.json",
+                             "{\"config\": {\"common\": {\"value\": 1, \"text\": \"abc\"}}}"));
+    QVERIFY(m_dir->writeFile("config1.json",
+                             "{\"includes\": [{\"file_path\": \"common.json\"}],"
+                             " \"config\": {\"&ref\": \"/common/value\"}}"));
+    QVERIFY(m_dir->writeFile("config2.json",
+                             "{\"includes\":"
+                             " [{\"file_path\":"
+                             "   \"${CPPCONFIGFRAMEWORK_CURRENT_DIR}/common.json\"}],"
+                             " \"config\": {\"item\": 2}}"));
+
+    auto *includeCache = ConfigReaderRegistry::instance()->includeCache();
+
+    // First read of both files (only the include is shared)
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    auto config1 = readConfig("config1.json", &environmentVariables);
+    QVERIFY(config1);
+    QCOMPARE(config1->nodeAtPath("/ref")->toValue().value().toInt(), 1);
+    QCOMPARE(includeCache->hitCount(), 0U);
+    QCOMPARE(includeCache->missCount(), 2U);
+    QCOMPARE(includeCache->entryCount(), 2U);
+
+    environmentVariables = EnvironmentVariables::loadFromProcess();
+    auto config2 = readConfig("config2.json", &environmentVariables);
+    QVERIFY(config2);
+    QCOMPARE(config2->nodeAtPath("/common/text")->toValue().value().toString(), QString("abc"));
+    QCOMPARE(config2->nodeAtPath("/item")->toValue().value().toInt(), 2);
+    QCOMPARE(includeCache->hitCount(), 1U);
+    QCOMPARE(includeCache->missCount(), 3U);
+    QCOMPARE(includeCache->entryCount(), 3U);
+
+    // Read the first file again
+    environmentVariables = EnvironmentVariables::loadFromProcess();
+    auto cachedConfig1 = readConfig("config1.json", &environmentVariables);
+    QVERIFY(cachedConfig1);
+    QVERIFY(*cachedConfig1 == *config1);
+    QCOMPARE(includeCache->hitCount(), 2U);
+    QCOMPARE(includeCache->missCount(), 3U);
+
+    // Returned configuration is a copy
+    QVERIFY(cachedConfig1->setMember("new", ConfigValueNode(5)));
+    environmentVariables = EnvironmentVariables::loadFromProcess();
+    auto cachedConfig1Copy = readConfig("config1.json", &environmentVariables);
+    QVERIFY(cachedConfig1Copy);
+    QVERIFY(*cachedConfig1Copy == *config1);
+
+    // Clear the cache
+    includeCache->clear();
+    QCOMPARE(includeCache->hitCount(), 0U);
+    QCOMPARE(includeCache->missCount(), 0U);
+    QCOMPARE(includeCache->entryCount(), 0U);
+}
+
+// Test: modification of an included file ----------------------------------------------------------
+
+void TestConfigIncludeCache::testModifiedInclude()
+{
+    QVERIFY(m_dir->writeFile("common.json", "{\"config\": {\"value\": 1}}"));
+    QVERIFY(m_dir->writeFile("config.json",
+                             "{\"includes\": [{\"file_path\": \"common.json\"}],"
+                             " \"config\": null}"));
+
+    auto *includeCache = ConfigReaderRegistry::instance()->includeCache();
+
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    auto config = readConfig("config.json", &environmentVariables);
+    QVERIFY(config);
+    QCOMPARE(config->nodeAtPath("/value")->toValue().value().toInt(), 1);
+    QCOMPARE(includeCache->missCount(), 2U);
+
+    // Change the size of the included file so that the change is detected even if the time of the
+    // last modification is the same
+    QVERIFY(m_dir->writeFile("common.json", "{\"config\": {\"value\": 1000}}"));
+
+    environmentVariables = EnvironmentVariables::loadFromProcess();
+    config = readConfig("config.json", &environmentVariables);
+    QVERIFY(config);
+    QCOMPARE(config->nodeAtPath("/value")->toValue().value().toInt(), 1000);
+    QCOMPARE(includeCache->hitCount(), 0U);
+    QCOMPARE(includeCache->missCount(), 4U);
+    QCOMPARE(includeCache->entryCount(), 2U);
+}
+
+// Test: invalidation of the entries that depend on a file -----------------------------------------
+
+void TestConfigIncludeCache::testInvalidate()
+{
+    QVERIFY(m_dir->writeFile("common.json", "{\"config\": {\"value\": 1}}"));
+    QVERIFY(m_dir->writeFile("other.json", "{\"config\": {\"other\": 2}}"));
+    QVERIFY(m_dir->writeFile("config.json",
+                             "{\"includes\": [{\"file_path\": \"common.json\"}],"
+                             " \"config\": null}"));
+
+    auto *includeCache = ConfigReaderRegistry::instance()->includeCache();
+
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    QVERIFY(readConfig("config.json", &environmentVariables));
+    environmentVariables = EnvironmentVariables::loadFromProcess();
+    QVERIFY(readConfig("other.json", &environmentVariables));
+    QCOMPARE(includeCache->entryCount(), size_t(3U));
+
+    // Change of the included file is not visible in its size (and possibly the time of the last
+    // modification)
+    QVERIFY(m_dir->writeFile("common.json", "{\"config\": {\"value\": 2}}"));
+
+    // Entries of the included file and the file that includes it are removed
+    QCOMPARE(includeCache->invalidate({ m_dir->filePath("common.json") }), size_t(2U));
+    QCOMPARE(includeCache->entryCount(), size_t(1U));
+    QCOMPARE(includeCache->invalidate({ m_dir->filePath("missing.json") }), size_t(0U));
+
+    environmentVariables = EnvironmentVariables::loadFromProcess();
+    auto config = readConfig("config.json", &environmentVariables);
+    QVERIFY(config);
+    QCOMPARE(config->nodeAtPath("/value")->toValue().value().toInt(), 2);
+}
+
+// Test: environment variables ---------------------------------------------------------------------
+
+void TestConfigIncludeCache::testEnvironmentVariables()
+{
+    QVERIFY(m_dir->writeFile("config.json",
+                             "{\"environment_variables\": {\"CCF_TEST_DEFINED\": \"defined\"},"
+                             " \"config\": {\"$value\": \"${CCF_TEST_VALUE}\"}}"));
+
+    auto *includeCache = ConfigReaderRegistry::instance()->includeCache();
+
+    // Read with the first value
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    environmentVariables.setValue("CCF_TEST_VALUE", "a");
+    environmentVariables.setValue("CCF_TEST_UNUSED", "1");
+    auto config = readConfig("config.json", &environmentVariables);
+    QVERIFY(config);
+    QCOMPARE(config->nodeAtPath("/value")->toValue().value().toString(), QString("a"));
+    QCOMPARE(includeCache->missCount(), 1U);
+
+    // Unused environment variables don't affect the cache and the environment variables that are
+    // set by the configuration file are set again
+    environmentVariables = EnvironmentVariables::loadFromProcess();
+    environmentVariables.setValue("CCF_TEST_VALUE", "a");
+    environmentVariables.setValue("CCF_TEST_UNUSED", "2");
+    config = readConfig("config.json", &environmentVariables);
+    QVERIFY(config);
+    QCOMPARE(config->nodeAtPath("/value")->toValue().value().toString(), QString("a"));
+    QCOMPARE(environmentVariables.value("CCF_TEST_DEFINED"), QString("defined"));
+    QCOMPARE(includeCache->hitCount(), 1U);
+
+    // Different value of a used environment variable
+    environmentVariables = EnvironmentVariables::loadFromProcess();
+    environmentVariables.setValue("CCF_TEST_VALUE", "b");
+    config = readConfig("config.json", &environmentVariables);
+    QVERIFY(config);
+    QCOMPARE(config->nodeAtPath("/value")->toValue().value().toString(), QString("b"));
+    QCOMPARE(includeCache->hitCount(), 1U);
+    QCOMPARE(includeCache->missCount(), 2U);
+    QCOMPARE(includeCache->entryCount(), 2U);
+
+    // Environment variable that is set by the configuration file is used too
+    environmentVariables = EnvironmentVariables::loadFromProcess();
+    environmentVariables.setValue("CCF_TEST_VALUE", "a");
+    environmentVariables.setValue("CCF_TEST_DEFINED", "overridden");
+    config = readConfig("config.json", &environmentVariables);
+    QVERIFY(config);
+    QCOMPARE(environmentVariables.value("CCF_TEST_DEFINED"), QString("overridden"));
+    QCOMPARE(includeCache->hitCount(), 1U);
+    QCOMPARE(includeCache->missCount(), 3U);
+
+    // Previous values
+    environmentVariables = EnvironmentVariables::loadFromProcess();
+    environmentVariables.setValue("CCF_TEST_VALUE", "b");
+    config = readConfig("config.json", &environmentVariables);
+    QVERIFY(config);
+    QCOMPARE(config->nodeAtPath("/value")->toValue().value().toString(), QString("b"));
+    QCOMPARE(includeCache->hitCount(), 2U);
+    QCOMPARE(includeCache->missCount(), 3U);
+}
+
+// Test: includes that reference nodes from the other includes -------------------------------------
+
+void TestConfigIncludeCache::testExternalConfigs()
+{
+    QVERIFY(m_dir->writeFile("include1.json", "{\"config\": {\"base\": {\"value\": 1}}}"));
+    QVERIFY(m_dir->writeFile("include2.json", "{\"config\": {\"&derived\": \"/base/value\"}}"));
+    QVERIFY(m_dir->writeFile("config.json",
+                             "{\"includes\": [{\"file_path\": \"include1.json\"},"
+                             "                {\"file_path\": \"include2.json\"}],"
+                             " \"config\": null}"));
+
+    auto *includeCache = ConfigReaderRegistry::instance()->includeCache();
+
+    // Second include depends on the first one so it must not be cached (but the config file that
+    // includes both of them can be)
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    auto config = readConfig("config.json", &environmentVariables);
+    QVERIFY(config);
+    QCOMPARE(config->nodeAtPath("/derived")->toValue().value().toInt(), 1);
+    QCOMPARE(includeCache->missCount(), 3U);
+    QCOMPARE(includeCache->entryCount(), 2U);
+
+    environmentVariables = EnvironmentVariables::loadFromProcess();
+    auto cachedConfig = readConfig("config.json", &environmentVariables);
+    QVERIFY(cachedConfig);
+    QVERIFY(*cachedConfig == *config);
+    QCOMPARE(includeCache->hitCount(), 1U);
+    QCOMPARE(includeCache->missCount(), 3U);
+}
+
+// Test: includes that are read concurrently -------------------------------------------------------
+
+void TestConfigIncludeCache::testParallelIncludes()
+{
+    QVERIFY(m_dir->writeFile("include1.json",
+                             "{\"config\": {\"$value1\": \"${CCF_TEST_VALUE}\"}}"));
+    QVERIFY(m_dir->writeFile("include2.json", "{\"config\": {\"value2\": 2}}"));
+    QVERIFY(m_dir->writeFile("config.json",
+                             "{\"includes\": [{\"file_path\": \"include1.json\"},"
+                             "                {\"file_path\": \"include2.json\"}],"
+                             " \"config\": null}"));
+
+    auto *includeCache = ConfigReaderRegistry::instance()->includeCache();
+
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    environmentVariables.setValue("CCF_TEST_VALUE", "a");
+    auto config = readConfig("config.json", &environmentVariables, true);
+    QVERIFY(config);
+    QCOMPARE(config->nodeAtPath("/value1")->toValue().value().toString(), QString("a"));
+    QCOMPARE(includeCache->missCount(), 3U);
+    QCOMPARE(includeCache->entryCount(), 3U);
+
+    // Environment variables used by the includes are dependencies of the including file too
+    environmentVariables = EnvironmentVariables::loadFromProcess();
+    environmentVariables.setValue("CCF_TEST_VALUE", "b");
+    config = readConfig("config.json", &environmentVariables, true);
+    QVERIFY(config);
+    QCOMPARE(config->nodeAtPath("/value1")->toValue().value().toString(), QString("b"));
+    QCOMPARE(config->nodeAtPath("/value2")->toValue().value().toInt(), 2);
+    QCOMPARE(includeCache->hitCount(), 1U);
+    QCOMPARE(includeCache->missCount(), 5U);
+}
+
+// Test: disabled cache ----------------------------------------------------------------------------
+
+void TestConfigIncludeCache::testDisabled()
+{
+    QVERIFY(m_dir->writeFile("config.json", "{\"config\": {\"value\": 1}}"));
+
+    auto *includeCache = ConfigReaderRegistry::instance()->includeCache();
+    includeCache->setEnabled(false);
+    QVERIFY(!includeCache->isEnabled());
+
+    for (int i = 0; i < 2; i++)
+    {
+        auto environmentVariables = EnvironmentVariables::loadFromProcess();
+        QVERIFY(readConfig("config.json", &environmentVariables));
+    }
+
+    QCOMPARE(includeCache->hitCount(), 0U);
+    QCOMPARE(includeCache->missCount(), 0U);
+    QCOMPARE(includeCache->entryCount(), 0U);
+}
+
+// Helper methods ----------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> TestConfigIncludeCache::readConfig(
+        const QString &fileName,
+        EnvironmentVariables *environmentVariables,
+        const bool parallelIncludes)
+{
+    ConfigReader configReader;
+    configReader.setParallelIncludesEnabled(parallelIncludes);
+
+    return configReader.read(fileName,
+                             m_dir->dir(),
+                             ConfigNodePath::ROOT_PATH,
+                             ConfigNodePath::ROOT_PATH,
+                             {},
+                             environmentVariables);
+}
+
+// Main function -----------------------------------------------------------------------------------
+
+QTEST_MAIN(TestConfigIncludeCache)
+#include "testConfigIncludeCache.moc"
@@ -135,6 +135,35 @@ private:
     }
 };
 
+class TestInlineValidatorConfigParameter : public ConfigItem
+{
+public:
+    int param = 0;
+    int optionalParam = -1;
+
+private:
+    bool loadConfigParameters(const ConfigObjectNode &config) override
+    {
+        const auto paramValidator = makeConfigParameterAndValidator(
+                                        ConfigParameterRangeValidator<int>(-50, 50),
+                                        [](const int &value) { return (value != 0); });
+        const auto optionalParamValidator = makeConfigParameterRangeListValidator(
+                                                0, 10, QList<int> { -1 });
+
+        return loadRequiredConfigParameter(&param, "param", config, paramValidator) &&
+                loadOptionalConfigParameter(&optionalParam,
+                                            "optionalParam",
+                                            config,
+                                            optionalParamValidator);
+    }
+
+    bool storeConfigParameters(ConfigObjectNode *config) override
+    {
+        return storeConfigParameter(param, "param", config) &&
+                storeConfigParameter(optionalParam, "optionalParam", config);
+    }
+};
+
 class TestConfigContainerItem : public ConfigItem
 {
 public:
@@ -280,6 +309,8 @@ private slots:
 
     void testLoadConfigParameter();
 
+    void testLoadConfigParameterWithInlineValidator();
+
     void testLoadConfigContainer();
 
     void testStoreConfigAtPath();
@@ -584,6 +615,53 @@ void TestConfigItem::testLoadConfigParameter()
     }
 }
 
+// Test: loading of config parameters with inlineable validators -----------------------------------
+
+void TestConfigItem::testLoadConfigParameterWithInlineValidator()
+{
+    // Valid values
+    {
+        ConfigObjectNode config;
+        config.setMember("param", ConfigValueNode(5));
+        config.setMember("optionalParam", ConfigValueNode(-1));
+
+        TestInlineValidatorConfigParameter item;
+        QVERIFY(item.loadConfig(config));
+        QCOMPARE(item.param, 5);
+        QCOMPARE(item.optionalParam, -1);
+    }
+
+    // Missing optional parameter
+    {
+        ConfigObjectNode config;
+        config.setMember("param", ConfigValueNode(-5));
+
+        TestInlineValidatorConfigParameter item;
+        QVERIFY(item.loadConfig(config));
+        QCOMPARE(item.param, -5);
+        QCOMPARE(item.optionalParam, -1);
+    }
+
+    // Value rejected by the second validator of the combination
+    {
+        ConfigObjectNode config;
+        config.setMember("param", ConfigValueNode(0));
+
+        TestInlineValidatorConfigParameter item;
+        QVERIFY(!item.loadConfig(config));
+    }
+
+    // Value out of range
+    {
+        ConfigObjectNode config;
+        config.setMember("param", ConfigValueNode(5));
+        config.setMember("optionalParam", ConfigValueNode(11));
+
+        TestInlineValidatorConfigParameter item;
+        QVERIFY(!item.loadConfig(config));
+    }
+}
+
 // Test: loading of required and optional config containers ----------------------------------------
 
 void TestConfigItem::testLoadConfigContainer()
@@ -0,0 +1,354 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains unit tests for ConfigItemError class
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigItem.hpp>
+
+// Qt includes
+#include <QtCore/QDebug>
+#include <QtCore/QLoggingCategory>
+#include <QtTest/QTest>
+
+// System includes
+#include <memory>
+#include <vector>
+
+// Forward declarations
+
+// Macros
+
+// Test config classes -----------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+
+class TestErrorConfig : public ConfigItem
+{
+public:
+    int param = 0;
+    std::vector<ConfigItemError::Code> errorCodes;
+    std::vector<const ConfigNode *> errorNodes;
+    QStringList errorNames;
+    QStringList errorMessages;
+
+private:
+    bool loadConfigParameters(const ConfigObjectNode &config) override
+    {
+        return loadRequiredConfigParameter(&param,
+                                           "param",
+                                           config,
+                                           ConfigParameterRangeValidator<int>(0, 10));
+    }
+
+    bool storeConfigParameters(ConfigObjectNode *config) override
+    {
+        return storeConfigParameter(param, "param", config);
+    }
+
+    void handleError(const ConfigItemError &error) override
+    {
+        errorCodes.push_back(error.code());
+        errorNodes.push_back(error.node());
+        errorNames.append(error.name());
+        errorMessages.append(error.message());
+    }
+};
+
+class TestLegacyErrorConfig : public ConfigItem
+{
+public:
+    int param = 0;
+    QStringList errorMessages;
+
+    explicit TestLegacyErrorConfig(const bool legacyErrorHandlerEnabled = true)
+    {
+        setLegacyErrorHandlerEnabled(legacyErrorHandlerEnabled);
+    }
+
+private:
+    bool loadConfigParameters(const ConfigObjectNode &config) override
+    {
+        return loadRequiredConfigParameter(&param, "param", config);
+    }
+
+    bool storeConfigParameters(ConfigObjectNode *config) override
+    {
+        return storeConfigParameter(param, "param", config);
+    }
+
+    void handleError(const QString &error) override
+    {
+        errorMessages.append(error);
+    }
+};
+
+// Test class declaration --------------------------------------------------------------------------
+
+class TestConfigItemError : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Functions executed by QtTest before and after test suite
+    void initTestCase();
+    void cleanupTestCase();
+
+    // Functions executed by QtTest before and after each test
+    void init();
+    void cleanup();
+
+    // Test functions
+    void testMessage();
+    void testCopiedError();
+    void testParameterNotFound();
+    void testInvalidParameterValue();
+    void testNodeNotFound();
+    void testErrorLogging();
+    void testLegacyHandleError();
+    void testErrorSweepWithoutMessages();
+};
+
+// Test Case init/cleanup methods ------------------------------------------------------------------
+
+void TestConfigItemError::initTestCase()
+{
+}
+
+void TestConfigItemError::cleanupTestCase()
+{
+}
+
+// Test init/cleanup methods -----------------------------------------------------------------------
+
+void TestConfigItemError::init()
+{
+}
+
+void TestConfigItemError::cleanup()
+{
+}
+
+// Test: error messages ----------------------------------------------------------------------------
+
+void TestConfigItemError::testMessage()
+{
+    ConfigObjectNode root;
+    root.setMember("level1", ConfigObjectNode());
+    const ConfigNode *node = root.member("level1");
+
+    QCOMPARE(ConfigItemError(ConfigItemError::Code::NullNode, nullptr).message(),
+             QString("Configuration node is a null pointer!"));
+
+    QCOMPARE(ConfigItemError(ConfigItemError::Code::InvalidParameterName, nullptr, "1a").message(),
+             QString("Parameter name [1a] is not valid!"));
+
+    QCOMPARE(ConfigItemError(ConfigItemError::Code::InvalidParameterName, node, "1a").message(),
+             QString("Configuration parameter name [1a] is not valid (configuration node "
+                     "[/level1])!"));
+
+    QCOMPARE(ConfigItemError(ConfigItemError::Code::ParameterNotFound, node, "a").message(),
+             QString("Configuration parameter node with name [a] was not found in configuration "
+                     "node [/level1]!"));
+
+    QCOMPARE(ConfigItemError(ConfigItemError::Code::NodeNotFound, node, "b/c").message(),
+             QString("Configuration node [/level1/b/c] was not found!"));
+
+    QCOMPARE(ConfigItemError(ConfigItemError::Code::InvalidConfig,
+                             node,
+                             QString(),
+                             "error").message(),
+             QString("Configuration [/level1] is not valid! Error: [error]"));
+
+    QCOMPARE(ConfigItemError(ConfigItemError::Code::StoreParameterFailed,
+                             node,
+                             "a",
+                             QString(),
+                             QJsonValue(5)).message(),
+             QString("Failed to store configuration parameter with name [a] and value: [5]"));
+}
+
+// Test: copied error outliving its configuration node ---------------------------------------------
+
+void TestConfigItemError::testCopiedError()
+{
+    std::unique_ptr<ConfigObjectNode> root = std::make_unique<ConfigObjectNode>();
+    root->setMember("level1", ConfigObjectNode());
+
+    ConfigItemError copy(ConfigItemError::Code::NullNode, nullptr);
+    QVERIFY(copy.nodePath().isEmpty());
+
+    {
+        const ConfigItemError error(ConfigItemError::Code::NodeNotFound,
+                                    root->member("level1"),
+                                    "b/c");
+        copy = error;
+    }
+
+    const ConfigItemError copyOfCopy(copy);
+    root.reset();
+
+    QCOMPARE(copy.nodePath(), QString("/level1"));
+    QCOMPARE(copy.message(), QString("Configuration node [/level1/b/c] was not found!"));
+    QCOMPARE(copyOfCopy.message(), QString("Configuration node [/level1/b/c] was not found!"));
+}
+
+// Test: missing required parameter ----------------------------------------------------------------
+
+void TestConfigItemError::testParameterNotFound()
+{
+    ConfigObjectNode config;
+
+    TestErrorConfig item;
+    QVERIFY(!item.loadConfig(config));
+
+    QCOMPARE(item.errorCodes.size(), size_t(2U));
+    QVERIFY(item.errorCodes.at(0) == ConfigItemError::Code::ParameterNotFound);
+    QVERIFY(item.errorNodes.at(0) == &config);
+    QCOMPARE(item.errorNames.at(0), QString("param"));
+
+    QVERIFY(item.errorCodes.at(1) == ConfigItemError::Code::LoadParametersFailed);
+    QVERIFY(item.errorNodes.at(1) == &config);
+}
+
+// Test: parameter value rejected by the validator -------------------------------------------------
+
+void TestConfigItemError::testInvalidParameterValue()
+{
+    ConfigObjectNode config;
+    config.setMember("param", ConfigValueNode(50));
+
+    TestErrorConfig item;
+    QVERIFY(!item.loadConfig(config));
+
+    const ConfigObjectNode &constConfig = config;
+
+    QCOMPARE(item.errorCodes.size(), size_t(2U));
+    QVERIFY(item.errorCodes.at(0) == ConfigItemError::Code::InvalidParameterValue);
+    QVERIFY(item.errorNodes.at(0) == constConfig.member("param"));
+    QCOMPARE(item.errorMessages.at(0), QString("Configuration parameter's value [/param] is not "
+                                               "valid"));
+}
+
+// Test: configuration node at path was not found --------------------------------------------------
+
+void TestConfigItemError::testNodeNotFound()
+{
+    ConfigObjectNode config;
+
+    TestErrorConfig item;
+    QVERIFY(!item.loadConfigAtPath("missing/item", config));
+
+    QCOMPARE(item.errorCodes.size(), size_t(1U));
+    QVERIFY(item.errorCodes.at(0) == ConfigItemError::Code::NodeNotFound);
+    QCOMPARE(item.errorNames.at(0), QString("missing/item"));
+    QCOMPARE(item.errorMessages.at(0),
+             QString("Configuration node [/missing/item] was not found!"));
+}
+
+// Test: disabled error logging --------------------------------------------------------------------
+
+void TestConfigItemError::testErrorLogging()
+{
+    ConfigObjectNode config;
+
+    TestErrorConfig item;
+    QVERIFY(item.isErrorLoggingEnabled());
+
+    item.setErrorLoggingEnabled(false);
+    QVERIFY(!item.isErrorLoggingEnabled());
+
+    // Errors are still passed to handleError()
+    QVERIFY(!item.loadConfig(config));
+    QCOMPARE(item.errorCodes.size(), size_t(2U));
+}
+
+// Test: deprecated error handler ------------------------------------------------------------------
+
+void TestConfigItemError::testLegacyHandleError()
+{
+    ConfigObjectNode config;
+
+    TestLegacyErrorConfig item;
+    item.setErrorLoggingEnabled(false);
+    QVERIFY(!item.loadConfig(config));
+
+    QCOMPARE(item.errorMessages.size(), 2);
+    QCOMPARE(item.errorMessages.at(0), QString("Configuration parameter node with name [param] was "
+                                               "not found in configuration node [/]!"));
+}
+
+// Test: probing configurations without formatting of the error messages ---------------------------
+
+namespace
+{
+
+int loggedMessageCount = 0;
+
+void countLoggedMessages(QtMsgType type, const QMessageLogContext &context, const QString &message)
+{
+    Q_UNUSED(type);
+    Q_UNUSED(message);
+
+    if (qstrcmp(context.category, "CppConfigFramework.ConfigItem") == 0)
+    {
+        loggedMessageCount++;
+    }
+}
+
+} // anonymous namespace
+
+void TestConfigItemError::testErrorSweepWithoutMessages()
+{
+    QLoggingCategory::setFilterRules("CppConfigFramework.ConfigItem=true");
+    loggedMessageCount = 0;
+    const auto previousHandler = qInstallMessageHandler(countLoggedMessages);
+
+    // Deprecated handler is not enabled so the error messages are not formatted
+    TestLegacyErrorConfig item(false);
+    item.setErrorLoggingEnabled(false);
+
+    int failedCount = 0;
+
+    for (int i = 0; i < 100; i++)
+    {
+        ConfigObjectNode config;
+
+        if ((i % 2) == 0)
+        {
+            config.setMember("param", ConfigValueNode(QString("invalid")));
+        }
+
+        if (!item.loadConfig(config))
+        {
+            failedCount++;
+        }
+    }
+
+    qInstallMessageHandler(previousHandler);
+    QLoggingCategory::setFilterRules(QString());
+
+    QCOMPARE(failedCount, 100);
+    QVERIFY(item.errorMessages.isEmpty());
+    QCOMPARE(loggedMessageCount, 0);
+}
+
+// Main function -----------------------------------------------------------------------------------
+
+QTEST_MAIN(TestConfigItemError)
+#include "testConfigItemError.moc"
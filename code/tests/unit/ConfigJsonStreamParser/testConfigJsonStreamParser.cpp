@@ -0,0 +1,308 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains unit tests for ConfigJsonStreamParser class
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigJsonStreamParser.hpp>
+
+// Qt includes
+#include <QtCore/QDebug>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtTest/QTest>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// Test class declaration --------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+
+class TestConfigJsonStreamParser : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Functions executed by QtTest before and after test suite
+    void initTestCase();
+    void cleanupTestCase();
+
+    // Functions executed by QtTest before and after each test
+    void init();
+    void cleanup();
+
+    // Test functions
+    void testReadValue();
+    void testReadValue_data();
+
+    void testReadInvalidValue();
+    void testReadInvalidValue_data();
+
+    void testReadNulCharacter();
+    void testReadMembers();
+    void testSkipAndSeek();
+    void testMaxDepth();
+};
+
+// Test Case init/cleanup methods ------------------------------------------------------------------
+
+void TestConfigJsonStreamParser::initTestCase()
+{
+}
+
+void TestConfigJsonStreamParser::cleanupTestCase()
+{
+}
+
+// Test init/cleanup methods -----------------------------------------------------------------------
+
+void TestConfigJsonStreamParser::init()
+{
+}
+
+void TestConfigJsonStreamParser::cleanup()
+{
+}
+
+// Test: readValue() method ------------------------------------------------------------------------
+
+void TestConfigJsonStreamParser::testReadValue()
+{
+    QFETCH(QByteArray, document);
+
+    // Parsed value must match the one parsed by QJsonDocument
+    const QJsonArray expectedArray = QJsonDocument::fromJson("[" + document + "]").array();
+    QCOMPARE(expectedArray.size(), 1);
+    const QJsonValue expectedValue = expectedArray.at(0);
+
+    ConfigJsonStreamParser parser(document.constData(), static_cast<size_t>(document.size()));
+    QJsonValue value;
+
+    QVERIFY(parser.readValue(&value));
+    QVERIFY(parser.atEnd());
+    QVERIFY(!parser.hasError());
+    QCOMPARE(value, expectedValue);
+
+    // Skipping the value must consume the same amount of the document
+    ConfigJsonStreamParser skipParser(document.constData(), static_cast<size_t>(document.size()));
+    QVERIFY(skipParser.skipValue());
+    QVERIFY(skipParser.atEnd());
+}
+
+void TestConfigJsonStreamParser::testReadValue_data()
+{
+    QTest::addColumn<QByteArray>("document");
+
+    QTest::newRow("null") << QByteArray("null");
+    QTest::newRow("true") << QByteArray(" true ");
+    QTest::newRow("false") << QByteArray("\tfalse\r\n");
+    QTest::newRow("integer") << QByteArray("123");
+    QTest::newRow("negative") << QByteArray("-0");
+    QTest::newRow("fraction") << QByteArray("-12.5e-3");
+    QTest::newRow("exponent") << QByteArray("1E+2");
+    QTest::newRow("string") << QByteArray("\"text\"");
+    QTest::newRow("escapes") << QByteArray("\"a\\\"b\\\\c\\/d\\b\\f\\n\\r\\t\"");
+    QTest::newRow("unicode escape") << QByteArray("\"\\u00e4\\u20AC\"");
+    QTest::newRow("surrogate pair") << QByteArray("\"\\ud83d\\ude00\"");
+    QTest::newRow("UTF-8") << QByteArray("\"\xc3\xa4\xe2\x82\xac\"");
+    QTest::newRow("empty array") << QByteArray("[ ]");
+    QTest::newRow("array") << QByteArray("[1, \"a\", [true, null], {\"b\": 2}]");
+    QTest::newRow("empty object") << QByteArray("{ }");
+    QTest::newRow("object") << QByteArray("{\"a\": 1, \"b\": {\"c\": [1, 2]}, \"d\": \"e\"}");
+}
+
+// Test: parse errors ------------------------------------------------------------------------------
+
+void TestConfigJsonStreamParser::testReadInvalidValue()
+{
+    QFETCH(QByteArray, document);
+    QFETCH(int, errorPosition);
+
+    ConfigJsonStreamParser parser(document.constData(), static_cast<size_t>(document.size()));
+    QJsonValue value;
+
+    QVERIFY((!parser.readValue(&value)) || (!parser.atEnd()));
+    QVERIFY(parser.hasError());
+    QVERIFY(!parser.errorString().isEmpty());
+    QCOMPARE(parser.errorPosition(), static_cast<size_t>(errorPosition));
+
+    // Skipping must detect the same error
+    ConfigJsonStreamParser skipParser(document.constData(), static_cast<size_t>(document.size()));
+    QVERIFY((!skipParser.skipValue()) || (!skipParser.atEnd()));
+    QCOMPARE(skipParser.errorString(), parser.errorString());
+}
+
+void TestConfigJsonStreamParser::testReadInvalidValue_data()
+{
+    QTest::addColumn<QByteArray>("document");
+    QTest::addColumn<int>("errorPosition");
+
+    QTest::newRow("empty") << QByteArray("") << 0;
+    QTest::newRow("literal") << QByteArray("nul") << 0;
+    QTest::newRow("leading zero") << QByteArray("01") << 1;
+    QTest::newRow("missing fraction") << QByteArray("1.") << 2;
+    QTest::newRow("unterminated string") << QByteArray("\"abc") << 4;
+    QTest::newRow("control character") << QByteArray("\"a\nb\"") << 2;
+    QTest::newRow("illegal escape") << QByteArray("\"\\x\"") << 2;
+    QTest::newRow("trailing comma") << QByteArray("[1,]") << 3;
+    QTest::newRow("missing separator") << QByteArray("{\"a\" 1}") << 5;
+    QTest::newRow("missing name") << QByteArray("{1: 2}") << 1;
+    QTest::newRow("unterminated object") << QByteArray("{\"a\": 1") << 7;
+    QTest::newRow("garbage") << QByteArray("{} x") << 3;
+}
+
+// Test: NUL character in a string -----------------------------------------------------------------
+
+void TestConfigJsonStreamParser::testReadNulCharacter()
+{
+    const QByteArray document("\"a\\u0000b\"");
+    ConfigJsonStreamParser parser(document.constData(), static_cast<size_t>(document.size()));
+    QJsonValue value;
+
+    QVERIFY(parser.readValue(&value));
+    QVERIFY(parser.atEnd());
+    QVERIFY(!parser.hasError());
+    QCOMPARE(value.toString(), QString("a") + QChar(0) + QString("b"));
+    QCOMPARE(value.toString().size(), 3);
+}
+
+// Test: reading members one by one ----------------------------------------------------------------
+
+void TestConfigJsonStreamParser::testReadMembers()
+{
+    const QByteArray document = "{\"a\": 1, \"b\": {\"c\": \"d\"}, \"e\": [1, {}]}";
+    ConfigJsonStreamParser parser(document.constData(), static_cast<size_t>(document.size()));
+
+    QCOMPARE(parser.peekValueType(), ConfigJsonStreamParser::ValueType::Object);
+    QVERIFY(parser.beginObject());
+
+    QString name;
+    QJsonValue value;
+
+    QVERIFY(parser.nextMember(&name));
+    QCOMPARE(name, QString("a"));
+    QCOMPARE(parser.peekValueType(), ConfigJsonStreamParser::ValueType::Number);
+    QVERIFY(parser.readValue(&value));
+    QCOMPARE(value.toInt(), 1);
+
+    // Nested Object
+    QVERIFY(parser.nextMember(&name));
+    QCOMPARE(name, QString("b"));
+    QVERIFY(parser.beginObject());
+    QVERIFY(parser.nextMember(&name));
+    QCOMPARE(name, QString("c"));
+    QString text;
+    QVERIFY(parser.readString(&text));
+    QCOMPARE(text, QString("d"));
+    QVERIFY(!parser.nextMember(&name));
+    QVERIFY(!parser.hasError());
+
+    // Nested Array
+    QVERIFY(parser.nextMember(&name));
+    QCOMPARE(name, QString("e"));
+    QVERIFY(parser.beginArray());
+    QVERIFY(parser.nextItem());
+    QVERIFY(parser.skipValue());
+    QVERIFY(parser.nextItem());
+    QCOMPARE(parser.peekValueType(), ConfigJsonStreamParser::ValueType::Object);
+    QVERIFY(parser.readValue(&value));
+    QCOMPARE(value, QJsonValue(QJsonObject()));
+    QVERIFY(!parser.nextItem());
+    QVERIFY(!parser.hasError());
+
+    QVERIFY(!parser.nextMember(&name));
+    QVERIFY(!parser.hasError());
+    QVERIFY(parser.atEnd());
+    QCOMPARE(parser.peekValueType(), ConfigJsonStreamParser::ValueType::Invalid);
+
+    // UTF-8 byte order mark is skipped
+    const QByteArray bomDocument = "\xef\xbb\xbf{\"a\": 1}";
+    ConfigJsonStreamParser bomParser(bomDocument.constData(),
+                                     static_cast<size_t>(bomDocument.size()));
+    QVERIFY(bomParser.readValue(&value));
+    QCOMPARE(value, QJsonValue(QJsonObject { { "a", 1 } }));
+    QVERIFY(bomParser.atEnd());
+
+    // Reading a value of a different type must fail
+    ConfigJsonStreamParser otherParser(document.constData(), static_cast<size_t>(document.size()));
+    QVERIFY(!otherParser.beginArray());
+    QVERIFY(otherParser.hasError());
+    QVERIFY(!otherParser.readString(&text));
+}
+
+// Test: skipValue() and seek() methods ------------------------------------------------------------
+
+void TestConfigJsonStreamParser::testSkipAndSeek()
+{
+    const QByteArray document = "{\"config\": {\"x\": [1, 2, 3]}, \"other\": true}";
+    ConfigJsonStreamParser parser(document.constData(), static_cast<size_t>(document.size()));
+
+    QVERIFY(parser.beginObject());
+
+    QString name;
+    QVERIFY(parser.nextMember(&name));
+    QCOMPARE(name, QString("config"));
+
+    const size_t configPosition = parser.position();
+    QVERIFY(parser.skipValue());
+
+    QVERIFY(parser.nextMember(&name));
+    QCOMPARE(name, QString("other"));
+    QVERIFY(parser.skipValue());
+    QVERIFY(!parser.nextMember(&name));
+    QVERIFY(parser.atEnd());
+
+    // Go back to the skipped value and read it
+    parser.seek(configPosition);
+
+    QJsonValue value;
+    QVERIFY(parser.readValue(&value));
+    QCOMPARE(value,
+             QJsonValue(QJsonObject { { "x", QJsonArray { 1, 2, 3 } } }));
+}
+
+// Test: maximum nesting depth ---------------------------------------------------------------------
+
+void TestConfigJsonStreamParser::testMaxDepth()
+{
+    const int maxDepth = ConfigJsonStreamParser::MAX_DEPTH;
+
+    const QByteArray validDocument =
+            QByteArray(maxDepth, '[') + QByteArray(maxDepth, ']');
+    ConfigJsonStreamParser validParser(validDocument.constData(),
+                                       static_cast<size_t>(validDocument.size()));
+    QVERIFY(validParser.skipValue());
+    QVERIFY(validParser.atEnd());
+
+    const QByteArray invalidDocument =
+            QByteArray(maxDepth + 1, '[') + QByteArray(maxDepth + 1, ']');
+    ConfigJsonStreamParser invalidParser(invalidDocument.constData(),
+                                         static_cast<size_t>(invalidDocument.size()));
+    QVERIFY(!invalidParser.skipValue());
+    QVERIFY(invalidParser.hasError());
+}
+
+// Main function -----------------------------------------------------------------------------------
+
+QTEST_MAIN(TestConfigJsonStreamParser)
+#include "testConfigJsonStreamParser.moc"
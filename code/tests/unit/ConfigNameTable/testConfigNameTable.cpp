@@ -0,0 +1,258 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains unit tests for ConfigNameTable class
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigNameTable.hpp>
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/ConfigValueNode.hpp>
+
+// Qt includes
+#include <QtCore/QDebug>
+#include <QtTest/QTest>
+
+// System includes
+#include <thread>
+#include <vector>
+
+// Forward declarations
+
+// Macros
+
+// Test class declaration --------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+
+class TestConfigNameTable : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Functions executed by QtTest before and after test suite
+    void initTestCase();
+    void cleanupTestCase();
+
+    // Functions executed by QtTest before and after each test
+    void init();
+    void cleanup();
+
+    // Test functions
+    void testIntern();
+    void testIntern_data();
+
+    void testFind();
+    void testManyNames();
+    void testConcurrentAccess();
+    void testObjectNodeMembers();
+};
+
+// Test Case init/cleanup methods ------------------------------------------------------------------
+
+void TestConfigNameTable::initTestCase()
+{
+}
+
+void TestConfigNameTable::cleanupTestCase()
+{
+}
+
+// Test init/cleanup methods -----------------------------------------------------------------------
+
+void TestConfigNameTable::init()
+{
+}
+
+void TestConfigNameTable::cleanup()
+{
+}
+
+// Test: intern() method ---------------------------------------------------------------------------
+
+void TestConfigNameTable::testIntern()
+{
+    QFETCH(QString, name);
+    QFETCH(bool, valid);
+
+    auto *nameTable = ConfigNameTable::instance();
+    const auto atom = nameTable->intern(name);
+
+    if (!valid)
+    {
+        QCOMPARE(atom, ConfigNameTable::INVALID_ATOM);
+        QCOMPARE(nameTable->name(atom), QString());
+        return;
+    }
+
+    QVERIFY(atom != ConfigNameTable::INVALID_ATOM);
+    QCOMPARE(nameTable->name(atom), name);
+
+    // Interning the same name again must return the same atom without adding a new entry
+    const int count = nameTable->count();
+    QCOMPARE(nameTable->intern(name), atom);
+    QCOMPARE(nameTable->intern(QString(name)), atom);
+    QCOMPARE(nameTable->count(), count);
+}
+
+void TestConfigNameTable::testIntern_data()
+{
+    QTest::addColumn<QString>("name");
+    QTest::addColumn<bool>("valid");
+
+    QTest::newRow("Valid: lowercase") << "name" << true;
+    QTest::newRow("Valid: mixed") << "Port_1" << true;
+
+    QTest::newRow("Invalid: empty") << "" << false;
+    QTest::newRow("Invalid: leading digit") << "1name" << false;
+    QTest::newRow("Invalid: parent reference") << ".." << false;
+}
+
+// Test: find() method -----------------------------------------------------------------------------
+
+void TestConfigNameTable::testFind()
+{
+    auto *nameTable = ConfigNameTable::instance();
+
+    QCOMPARE(nameTable->find("notInternedByAnyTest"), ConfigNameTable::INVALID_ATOM);
+    QCOMPARE(nameTable->find(""), ConfigNameTable::INVALID_ATOM);
+
+    const auto atom1 = nameTable->intern("findTest1");
+    const auto atom2 = nameTable->intern("findTest2");
+
+    QVERIFY(atom1 != atom2);
+    QCOMPARE(nameTable->find("findTest1"), atom1);
+    QCOMPARE(nameTable->find("findTest2"), atom2);
+}
+
+// Test: interning of enough names to grow the table -----------------------------------------------
+
+void TestConfigNameTable::testManyNames()
+{
+    auto *nameTable = ConfigNameTable::instance();
+    std::vector<ConfigNameTable::Atom> atoms;
+    const size_t initialMemoryUsage = nameTable->memoryUsage();
+    size_t nameLength = 0U;
+
+    for (int i = 0; i < 5000; i++)
+    {
+        const QString name = QString("manyNames%1").arg(i);
+        atoms.push_back(nameTable->intern(name));
+        QVERIFY(atoms.back() != ConfigNameTable::INVALID_ATOM);
+        nameLength += static_cast<size_t>(name.size());
+    }
+
+    // The table grows with every new name
+    const size_t memoryUsage = nameTable->memoryUsage();
+    QVERIFY(memoryUsage >= (initialMemoryUsage + (nameLength * sizeof(QChar))));
+
+    for (int i = 0; i < 5000; i++)
+    {
+        const QString name = QString("manyNames%1").arg(i);
+        QCOMPARE(nameTable->find(name), atoms.at(static_cast<size_t>(i)));
+        QCOMPARE(nameTable->name(atoms.at(static_cast<size_t>(i))), name);
+        QCOMPARE(nameTable->intern(name), atoms.at(static_cast<size_t>(i)));
+    }
+
+    // Interning the names again doesn't use more memory
+    QCOMPARE(nameTable->memoryUsage(), memoryUsage);
+}
+
+// Test: concurrent interning and lookups ----------------------------------------------------------
+
+void TestConfigNameTable::testConcurrentAccess()
+{
+    auto *nameTable = ConfigNameTable::instance();
+    const auto sharedAtom = nameTable->intern("concurrentShared");
+
+    std::vector<std::vector<ConfigNameTable::Atom>> threadAtoms(4U);
+    std::vector<int> lookupsValid(4U, 1);
+    std::vector<std::thread> threads;
+
+    for (size_t i = 0U; i < threadAtoms.size(); i++)
+    {
+        threads.emplace_back([&, i]()
+        {
+            for (int j = 0; j < 2000; j++)
+            {
+                // Names are interned by all threads (in a different order in each thread)
+                const int nameIndex = (i % 2U) == 0U ? j : (1999 - j);
+                threadAtoms[i].push_back(
+                            nameTable->intern(QString("concurrent%1").arg(nameIndex)));
+
+                if ((nameTable->find("concurrentShared") != sharedAtom) ||
+                    (nameTable->name(sharedAtom) != QString("concurrentShared")))
+                {
+                    lookupsValid[i] = 0;
+                }
+            }
+        });
+    }
+
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    for (size_t i = 0U; i < threadAtoms.size(); i++)
+    {
+        QVERIFY(lookupsValid.at(i) != 0);
+
+        for (int j = 0; j < 2000; j++)
+        {
+            const int nameIndex = (i % 2U) == 0U ? j : (1999 - j);
+            const auto atom = threadAtoms.at(i).at(static_cast<size_t>(j));
+
+            QVERIFY(atom != ConfigNameTable::INVALID_ATOM);
+            QCOMPARE(nameTable->name(atom), QString("concurrent%1").arg(nameIndex));
+            QCOMPARE(nameTable->find(QString("concurrent%1").arg(nameIndex)), atom);
+        }
+    }
+}
+
+// Test: usage of atoms in ConfigObjectNode --------------------------------------------------------
+
+void TestConfigNameTable::testObjectNodeMembers()
+{
+    auto *nameTable = ConfigNameTable::instance();
+
+    ConfigObjectNode node;
+    QVERIFY(node.setMember("zeta", ConfigValueNode(1)));
+    QVERIFY(node.setMember(nameTable->intern("alpha"), std::make_unique<ConfigValueNode>(2)));
+    QVERIFY(node.setMember("beta", ConfigValueNode(3)));
+    QVERIFY(!node.setMember(ConfigNameTable::INVALID_ATOM, std::make_unique<ConfigValueNode>(4)));
+    QVERIFY(!node.setMember("0invalid", ConfigValueNode(4)));
+
+    // Names must be sorted independently of the atom values
+    QCOMPARE(node.names(), QStringList({ "alpha", "beta", "zeta" }));
+
+    // Lookups by name and by atom must return the same member
+    const auto atom = nameTable->find("alpha");
+    QVERIFY(node.contains(atom));
+    QVERIFY(node.contains("alpha"));
+    QCOMPARE(node.member(atom), node.member("alpha"));
+    QCOMPARE(node.member(atom)->toValue().value().toInt(), 2);
+    QCOMPARE(node.name(*node.member(atom)), QString("alpha"));
+
+    QVERIFY(!node.contains(ConfigNameTable::INVALID_ATOM));
+    QVERIFY(node.member("notInternedByAnyTest") == nullptr);
+}
+
+// Main function -----------------------------------------------------------------------------------
+
+QTEST_MAIN(TestConfigNameTable)
+#include "testConfigNameTable.moc"
@@ -20,7 +20,9 @@
 
 // C++ Config Framework includes
 #include <CppConfigFramework/ConfigDerivedObjectNode.hpp>
+#include <CppConfigFramework/ConfigNodeArena.hpp>
 #include <CppConfigFramework/ConfigNodeReference.hpp>
+#include <CppConfigFramework/ConfigNodeSharingScope.hpp>
 #include <CppConfigFramework/ConfigObjectNode.hpp>
 #include <CppConfigFramework/ConfigValueNode.hpp>
 
@@ -91,7 +93,13 @@ private slots:
     void testNodePath();
 
     void testObjectNode();
+    void testObjectNodeUnresolvedReferenceCount();
+    void testObjectNodeWide();
+    void testObjectNodeMemberName();
+    void testObjectNodeSharedClone();
+    void testObjectNodeCloneWithoutSharing();
     void testApplyObject();
+    void testArenaAllocation();
 
     void testDerivedObjectNode();
 
@@ -709,6 +717,333 @@ void TestConfigNode::testObjectNode()
     QCOMPARE(object.count(), 0);
 }
 
+// Test: ConfigObjectNode::unresolvedReferenceCount() method ---------------------------------------
+
+void TestConfigNode::testObjectNodeUnresolvedReferenceCount()
+{
+    ConfigObjectNode root;
+    QCOMPARE(root.unresolvedReferenceCount(), 0);
+
+    // Add references on multiple levels
+    QVERIFY(root.setMember("value", ConfigValueNode(1)));
+    QVERIFY(root.setMember("ref", ConfigNodeReference(ConfigNodePath("/value"))));
+    QVERIFY(root.setMember("level1", ConfigObjectNode()));
+    QCOMPARE(root.unresolvedReferenceCount(), 1);
+
+    auto &level1 = root.member("level1")->toObject();
+    QVERIFY(level1.setMember("level2", ConfigObjectNode()));
+
+    auto &level2 = level1.member("level2")->toObject();
+    QVERIFY(level2.setMember("ref", ConfigNodeReference(ConfigNodePath("/value"))));
+    QVERIFY(level2.setMember("derived", ConfigDerivedObjectNode({ ConfigNodePath("/level1") })));
+    QCOMPARE(level2.unresolvedReferenceCount(), 2);
+    QCOMPARE(level1.unresolvedReferenceCount(), 2);
+    QCOMPARE(root.unresolvedReferenceCount(), 3);
+
+    // Replace a reference with a value
+    QVERIFY(level2.setMember("ref", ConfigValueNode(2)));
+    QCOMPARE(level2.unresolvedReferenceCount(), 1);
+    QCOMPARE(root.unresolvedReferenceCount(), 2);
+
+    // Clone keeps the count
+    const auto clonedNode = root.clone();
+    QCOMPARE(clonedNode->toObject().unresolvedReferenceCount(), 2);
+
+    // Remove a sub-tree with a reference
+    QVERIFY(root.remove("level1"));
+    QCOMPARE(root.unresolvedReferenceCount(), 1);
+
+    // Move a sub-tree from one node to another
+    {
+        ConfigObjectNode source = std::move(clonedNode->toObject());
+        QCOMPARE(source.unresolvedReferenceCount(), 2);
+        QCOMPARE(clonedNode->toObject().unresolvedReferenceCount(), 0);
+
+        QVERIFY(root.setMember("moved", std::make_unique<ConfigObjectNode>(std::move(source))));
+        QCOMPARE(root.unresolvedReferenceCount(), 3);
+    }
+
+    // Apply a node with references
+    {
+        ConfigObjectNode other;
+        QVERIFY(other.setMember("ref2", ConfigNodeReference(ConfigNodePath("/value"))));
+
+        root.member("moved")->toObject().apply(other);
+        QCOMPARE(root.member("moved")->toObject().unresolvedReferenceCount(), 3);
+        QCOMPARE(root.unresolvedReferenceCount(), 4);
+    }
+
+    // Remove all members
+    root.member("moved")->toObject().removeAll();
+    QCOMPARE(root.unresolvedReferenceCount(), 1);
+
+    root.removeAll();
+    QCOMPARE(root.unresolvedReferenceCount(), 0);
+}
+
+// Test: Object node with a large number of members ------------------------------------------------
+
+void TestConfigNode::testObjectNodeWide()
+{
+    const int memberCount = 1000;
+    ConfigObjectNode node;
+
+    // Insert the members in the reverse order
+    for (int i = memberCount - 1; i >= 0; i--)
+    {
+        QVERIFY(node.setMember(QString("wide%1").arg(i), ConfigValueNode(i)));
+    }
+
+    QCOMPARE(node.count(), memberCount);
+
+    // Names must be sorted
+    QStringList expectedNames;
+
+    for (int i = 0; i < memberCount; i++)
+    {
+        expectedNames.append(QString("wide%1").arg(i));
+    }
+
+    expectedNames.sort();
+    QCOMPARE(node.names(), expectedNames);
+
+    // Sorted members are ordered by the atoms of their names
+    {
+        const ConfigSortedMembers members = node.sortedMembers();
+        QCOMPARE(members.count(), static_cast<size_t>(memberCount));
+
+        for (size_t i = 0U; i < members.count(); i++)
+        {
+            QVERIFY((i == 0U) || (members.at(i - 1U).name < members.at(i).name));
+            QVERIFY(node.member(members.at(i).name) == members.at(i).node.get());
+        }
+    }
+
+    // Nodes with the same members inserted in a different order are equal
+    {
+        ConfigObjectNode otherNode;
+
+        for (int i = 0; i < memberCount; i++)
+        {
+            QVERIFY(otherNode.setMember(QString("wide%1").arg(i), ConfigValueNode(i)));
+        }
+
+        QVERIFY(otherNode == node);
+        QVERIFY(otherNode.setMember("wide0", ConfigValueNode(-1)));
+        QVERIFY(otherNode != node);
+    }
+
+    // Replace a member
+    QVERIFY(node.setMember("wide10", ConfigValueNode(-10)));
+    QCOMPARE(node.count(), memberCount);
+    QCOMPARE(node.member("wide10")->toValue().value().toInt(), -10);
+
+    // Remove all odd members and check that all of the remaining members can still be found
+    for (int i = 1; i < memberCount; i += 2)
+    {
+        QVERIFY(node.remove(QString("wide%1").arg(i)));
+    }
+
+    QVERIFY(!node.remove("wide1"));
+    QCOMPARE(node.count(), memberCount / 2);
+
+    for (int i = 0; i < memberCount; i++)
+    {
+        const auto *member = node.member(QString("wide%1").arg(i));
+
+        if ((i % 2) == 1)
+        {
+            QVERIFY(member == nullptr);
+            continue;
+        }
+
+        QVERIFY(member != nullptr);
+        QCOMPARE(member->parent(), &node);
+        QCOMPARE(node.name(*member), QString("wide%1").arg(i));
+    }
+
+    // Remove all but a few members (switches back to a small object)
+    for (int i = 10; i < memberCount; i += 2)
+    {
+        QVERIFY(node.remove(QString("wide%1").arg(i)));
+    }
+
+    QCOMPARE(node.names(), QStringList({ "wide0", "wide2", "wide4", "wide6", "wide8" }));
+    QCOMPARE(node.member("wide4")->toValue().value().toInt(), 4);
+
+    // Clone must contain the same members
+    const auto clonedNode = node.clone();
+    QVERIFY(clonedNode->toObject() == node);
+}
+
+// Test: member name stored in the member nodes ---------------------------------------------------
+
+void TestConfigNode::testObjectNodeMemberName()
+{
+    ConfigObjectNode root;
+    QVERIFY(root.setMember("aaa", ConfigObjectNode()));
+    QCOMPARE(root.memberNameAtom(), ConfigNameTable::INVALID_ATOM);
+
+    auto *aaa = &root.member("aaa")->toObject();
+    QCOMPARE(aaa->memberNameAtom(), ConfigNameTable::instance()->find("aaa"));
+    QVERIFY(aaa->setMember("bbb", ConfigValueNode(1)));
+
+    const auto *bbb = aaa->member("bbb");
+    QCOMPARE(root.name(*aaa), QString("aaa"));
+    QCOMPARE(aaa->name(*bbb), QString("bbb"));
+    QCOMPARE(bbb->nodePath().path(), QString("/aaa/bbb"));
+
+    // Member name must be kept when the parent is moved
+    ConfigObjectNode movedNode(std::move(*aaa));
+    const auto *movedMember = movedNode.member("bbb");
+    QCOMPARE(movedNode.name(*movedMember), QString("bbb"));
+
+    // Name of a node that is not a member
+    ConfigValueNode otherNode(1);
+    QCOMPARE(root.name(otherNode), QString());
+
+    // Resetting the parent also resets the member name, but the name can still be found
+    aaa = &root.member("aaa")->toObject();
+    aaa->setParent(&root);
+    QCOMPARE(aaa->memberNameAtom(), ConfigNameTable::INVALID_ATOM);
+    QCOMPARE(root.name(*aaa), QString("aaa"));
+}
+
+// Test: ConfigObjectNode::clone() sharing (copy-on-write) -----------------------------------------
+
+void TestConfigNode::testObjectNodeSharedClone()
+{
+    // Members are only shared in a sharing scope
+    const ConfigNodeSharingScope sharingScope;
+    QVERIFY(sharingScope.isOutermost());
+    QCOMPARE(ConfigNodeSharingScope::current(), sharingScope.id());
+
+    // Create a node structure
+    auto original = std::make_unique<ConfigObjectNode>();
+    QVERIFY(original->setMember("value", ConfigValueNode(1)));
+    QVERIFY(original->setMember("level1", ConfigObjectNode()));
+    QVERIFY(original->nodeAtPath("level1")->toObject().setMember("value", ConfigValueNode(2)));
+    QVERIFY(original->nodeAtPath("level1")->toObject().setMember(
+                "ref", ConfigNodeReference(ConfigNodePath("/value"))));
+    QCOMPARE(original->unresolvedReferenceCount(), 1);
+
+    auto *originalValue = &original->nodeAtPath("level1/value")->toValue();
+
+    // Clone shares the members until they are accessed
+    auto clone = original->clone();
+    auto *clonedObject = &clone->toObject();
+    QVERIFY(!clonedObject->isDetached());
+    QVERIFY(original->isDetached());
+    QCOMPARE(clonedObject->count(), 2);
+    QVERIFY(clonedObject->contains("level1"));
+    QCOMPARE(clonedObject->names(), QStringList({"level1", "value"}));
+    QCOMPARE(clonedObject->unresolvedReferenceCount(), 1);
+
+    // Const access reads the members of the shared node and doesn't copy them
+    const ConfigObjectNode &constClone = *clonedObject;
+    const ConfigObjectNode &constOriginal = *original;
+    QVERIFY(constClone.member("level1") == constOriginal.member("level1"));
+    QCOMPARE(constClone.nodeAtPath("level1/value")->toValue().value(), QJsonValue(2));
+    QCOMPARE(constClone.nodeAtPath("level1/../value")->toValue().value(), QJsonValue(1));
+    QVERIFY(constClone == constOriginal);
+    QVERIFY(!clonedObject->isDetached());
+
+    // Modification of the original node through a nested member must not be visible in the clone
+    originalValue->setValue(3);
+    QVERIFY(clonedObject->isDetached());
+    QCOMPARE(clonedObject->nodeAtPath("level1/value")->toValue().value(), QJsonValue(2));
+    QCOMPARE(original->nodeAtPath("level1/value")->toValue().value(), QJsonValue(3));
+    QCOMPARE(clonedObject->nodeAtPath("level1/value")->nodePath().path(),
+             QString("/level1/value"));
+    QVERIFY(clonedObject->nodeAtPath("level1/value")->rootNode() == clonedObject);
+
+    // Modification of the clone must not be visible in the original node
+    auto secondClone = original->clone();
+    QVERIFY(secondClone->toObject().setMember("value", ConfigValueNode(4)));
+    QCOMPARE(secondClone->toObject().member("value")->toValue().value(), QJsonValue(4));
+    QCOMPARE(original->member("value")->toValue().value(), QJsonValue(1));
+
+    // Clones must stay valid when the original node is destroyed
+    auto thirdClone = original->clone();
+    auto fourthClone = thirdClone->clone();
+    original.reset();
+
+    QVERIFY(thirdClone->toObject().isDetached());
+    QVERIFY(!fourthClone->toObject().isDetached());
+    QVERIFY(thirdClone->toObject() == fourthClone->toObject());
+    QCOMPARE(fourthClone->toObject().nodeAtPath("level1/value")->toValue().value(),
+             QJsonValue(3));
+    QCOMPARE(fourthClone->toObject().unresolvedReferenceCount(), 1);
+
+    // Detach the whole structure
+    auto fifthClone = fourthClone->clone();
+    fifthClone->toObject().detach();
+    QVERIFY(fifthClone->toObject().isDetached());
+    QVERIFY(fifthClone->toObject().member("level1")->toObject().isDetached());
+    QVERIFY(fifthClone->toObject() == fourthClone->toObject());
+}
+
+// Test: ConfigObjectNode::clone() without sharing -------------------------------------------------
+
+void TestConfigNode::testObjectNodeCloneWithoutSharing()
+{
+    QCOMPARE(ConfigNodeSharingScope::current(), ConfigNodeSharingScope::NO_SCOPE);
+
+    // Node that was created outside of a sharing scope is copied completely
+    ConfigObjectNode original;
+    QVERIFY(original.setMember("value", ConfigValueNode(1)));
+    QVERIFY(original.setMember("level1", ConfigObjectNode()));
+    QVERIFY(original.nodeAtPath("level1")->toObject().setMember("value", ConfigValueNode(2)));
+
+    {
+        const ConfigNodeSharingScope sharingScope;
+        auto clone = original.clone();
+        QVERIFY(clone->toObject().isDetached());
+        QVERIFY(clone->toObject() == original);
+    }
+
+    // Node that was created in another sharing scope is copied completely
+    std::unique_ptr<ConfigNode> scopedNode;
+
+    {
+        const ConfigNodeSharingScope sharingScope;
+        scopedNode = original.clone();
+
+        // Nested scope shares the sharing scope of the outer scope
+        const ConfigNodeSharingScope nestedScope;
+        QVERIFY(!nestedScope.isOutermost());
+        QCOMPARE(nestedScope.id(), sharingScope.id());
+
+        auto clone = scopedNode->clone();
+        QVERIFY(!clone->toObject().isDetached());
+    }
+
+    {
+        const ConfigNodeSharingScope sharingScope;
+        auto clone = scopedNode->clone();
+        QVERIFY(clone->toObject().isDetached());
+    }
+
+    auto clone = scopedNode->clone();
+    QVERIFY(clone->toObject().isDetached());
+    QVERIFY(clone->toObject() == original);
+
+    // Detached node doesn't share its members anymore, not even in its own sharing scope
+    {
+        const ConfigNodeSharingScope sharingScope;
+        auto node = original.clone();
+        auto sharedClone = node->clone();
+        QVERIFY(!sharedClone->toObject().isDetached());
+
+        node->toObject().detach();
+        QVERIFY(sharedClone->toObject().isDetached());
+
+        auto detachedClone = node->clone();
+        QVERIFY(detachedClone->toObject().isDetached());
+        QVERIFY(detachedClone->toObject() == original);
+    }
+}
+
 // Test: ConfigObjectNode::apply() method ----------------------------------------------------------
 
 void TestConfigNode::testApplyObject()
@@ -778,6 +1113,58 @@ void TestConfigNode::testApplyObject()
     QCOMPARE(node.nodeAtPath("level1/level2/value")->toValue().value(), QJsonValue(789));
 }
 
+// Test: allocation of nodes from an arena ---------------------------------------------------------
+
+void TestConfigNode::testArenaAllocation()
+{
+    // Nodes created outside of an arena are allocated from the heap
+    QVERIFY(ConfigNodeArena::current() == nullptr);
+    auto heapNode = std::make_unique<ConfigObjectNode>();
+    QVERIFY(heapNode->setMember("value", std::make_unique<ConfigValueNode>(1)));
+
+    std::unique_ptr<ConfigObjectNode> arenaNode;
+    {
+        const ConfigNodeArenaScope arenaScope;
+        const auto *arena = arenaScope.arena();
+        QVERIFY(ConfigNodeArena::current() == arena);
+        QCOMPARE(arena->allocationCount(), 0U);
+
+        // Only nodes created with operator new are allocated from the arena
+        arenaNode = std::make_unique<ConfigObjectNode>();
+        QVERIFY(arenaNode->setMember("value", std::make_unique<ConfigValueNode>(2)));
+        QCOMPARE(arena->allocationCount(), 2U);
+
+        ConfigValueNode stackNode(3);
+        QCOMPARE(arena->allocationCount(), 2U);
+
+        QVERIFY(arenaNode->setMember("moved", std::make_unique<ConfigValueNode>(
+                                         std::move(stackNode))));
+        QCOMPARE(arena->allocationCount(), 3U);
+
+        // Nodes created in a heap scope are not allocated from the arena
+        {
+            const ConfigNodeHeapScope heapScope;
+            QVERIFY(heapNode->setMember("heap", std::make_unique<ConfigValueNode>(4)));
+        }
+        QCOMPARE(arena->allocationCount(), 3U);
+
+        // Removing a node allocated from the arena doesn't affect the rest of the arena
+        QVERIFY(arenaNode->remove("moved"));
+        QCOMPARE(arena->allocationCount(), 3U);
+    }
+
+    // Nodes allocated from the arena stay usable after the arena is no longer active
+    QVERIFY(ConfigNodeArena::current() == nullptr);
+    QCOMPARE(arenaNode->member("value")->toValue().value(), QJsonValue(2));
+    QVERIFY(arenaNode->setMember("value", std::make_unique<ConfigValueNode>(5)));
+    QCOMPARE(arenaNode->member("value")->toValue().value(), QJsonValue(5));
+    arenaNode.reset();
+
+    QCOMPARE(heapNode->member("value")->toValue().value(), QJsonValue(1));
+    QCOMPARE(heapNode->member("heap")->toValue().value(), QJsonValue(4));
+    heapNode.reset();
+}
+
 // Test: DerivedObject node ------------------------------------------------------------------------
 
 void TestConfigNode::testDerivedObjectNode()
@@ -0,0 +1,267 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains unit tests for the functions that deserialize configuration nodes
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigItem.hpp>
+#include <CppConfigFramework/ConfigNodeDeserialization.hpp>
+#include <CppConfigFramework/ConfigNodeReference.hpp>
+
+// Qt includes
+#include <QtCore/QDebug>
+#include <QtTest/QTest>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// Test types --------------------------------------------------------------------------------------
+
+namespace TestTypes
+{
+
+struct Point
+{
+    int x = 0;
+    int y = 0;
+};
+
+bool deserialize(const CppConfigFramework::ConfigNode &node, Point *value)
+{
+    if (!node.isObject())
+    {
+        return false;
+    }
+
+    const auto &object = node.toObject();
+    const auto *x = object.member("x");
+    const auto *y = object.member("y");
+
+    if ((x == nullptr) || (!x->isValue()) || (y == nullptr) || (!y->isValue()))
+    {
+        return false;
+    }
+
+    value->x = x->toValue().value().toInt();
+    value->y = y->toValue().value().toInt();
+    return true;
+}
+
+} // namespace TestTypes
+
+// Test config classes -----------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+
+class TestMapConfig : public ConfigItem
+{
+public:
+    QMap<QString, int> map;
+
+private:
+    bool loadConfigParameters(const ConfigObjectNode &config) override
+    {
+        return loadRequiredConfigParameter(&map, "map", config);
+    }
+
+    bool storeConfigParameters(ConfigObjectNode *config) override
+    {
+        return storeConfigParameter(map, "map", config);
+    }
+};
+
+// Test class declaration --------------------------------------------------------------------------
+
+class TestConfigNodeDeserialization : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Functions executed by QtTest before and after test suite
+    void initTestCase();
+    void cleanupTestCase();
+
+    // Functions executed by QtTest before and after each test
+    void init();
+    void cleanup();
+
+    // Test functions
+    void testValue();
+    void testMaps();
+    void testNestedMaps();
+    void testUserOverload();
+    void testInvalidNodes();
+    void testConfigItem();
+
+private:
+    std::unique_ptr<ConfigObjectNode> createMapNode();
+};
+
+// Test Case init/cleanup methods ------------------------------------------------------------------
+
+void TestConfigNodeDeserialization::initTestCase()
+{
+}
+
+void TestConfigNodeDeserialization::cleanupTestCase()
+{
+}
+
+// Test init/cleanup methods -----------------------------------------------------------------------
+
+void TestConfigNodeDeserialization::init()
+{
+}
+
+void TestConfigNodeDeserialization::cleanup()
+{
+}
+
+// Test: Value nodes -------------------------------------------------------------------------------
+
+void TestConfigNodeDeserialization::testValue()
+{
+    int intValue = 0;
+    QVERIFY(deserialize(ConfigValueNode(123), &intValue));
+    QCOMPARE(intValue, 123);
+
+    QString stringValue;
+    QVERIFY(deserialize(ConfigValueNode("abc"), &stringValue));
+    QCOMPARE(stringValue, QString("abc"));
+
+    QVERIFY(!deserialize(ConfigValueNode("abc"), &intValue));
+    QCOMPARE(intValue, 123);
+}
+
+// Test: maps --------------------------------------------------------------------------------------
+
+void TestConfigNodeDeserialization::testMaps()
+{
+    auto node = createMapNode();
+
+    QMap<QString, int> map;
+    QVERIFY(deserialize(*node, &map));
+    QCOMPARE(map, (QMap<QString, int> { { "a", 1 }, { "b", 2 }, { "c", 3 } }));
+
+    QHash<QString, int> hash;
+    QVERIFY(deserialize(*node, &hash));
+    QCOMPARE(hash, (QHash<QString, int> { { "a", 1 }, { "b", 2 }, { "c", 3 } }));
+
+    std::map<QString, int> stdMap;
+    QVERIFY(deserialize(*node, &stdMap));
+    QVERIFY(stdMap == (std::map<QString, int> { { "a", 1 }, { "b", 2 }, { "c", 3 } }));
+
+    // An item that can't be deserialized fails the whole map and leaves the output unchanged
+    node->setMember("d", ConfigValueNode("abc"));
+    QVERIFY(!deserialize(*node, &map));
+    QCOMPARE(map, (QMap<QString, int> { { "a", 1 }, { "b", 2 }, { "c", 3 } }));
+}
+
+// Test: nested maps -------------------------------------------------------------------------------
+
+void TestConfigNodeDeserialization::testNestedMaps()
+{
+    ConfigObjectNode node;
+    node.setMember("first", *createMapNode());
+    node.setMember("second", ConfigObjectNode());
+
+    QMap<QString, QMap<QString, int>> map;
+    QVERIFY(deserialize(node, &map));
+    QCOMPARE(map.size(), 2);
+    QCOMPARE(map.value("first"), (QMap<QString, int> { { "a", 1 }, { "b", 2 }, { "c", 3 } }));
+    QVERIFY(map.value("second").isEmpty());
+}
+
+// Test: overload for a user type ------------------------------------------------------------------
+
+void TestConfigNodeDeserialization::testUserOverload()
+{
+    ConfigObjectNode point;
+    point.setMember("x", ConfigValueNode(1));
+    point.setMember("y", ConfigValueNode(2));
+
+    ConfigObjectNode node;
+    node.setMember("p1", point);
+
+    point.setMember("y", ConfigValueNode(3));
+    node.setMember("p2", point);
+
+    // The overload is found in the namespace of the item type
+    QMap<QString, TestTypes::Point> map;
+    QVERIFY(deserialize(node, &map));
+    QCOMPARE(map.size(), 2);
+    QCOMPARE(map.value("p1").x, 1);
+    QCOMPARE(map.value("p1").y, 2);
+    QCOMPARE(map.value("p2").x, 1);
+    QCOMPARE(map.value("p2").y, 3);
+}
+
+// Test: invalid nodes -----------------------------------------------------------------------------
+
+void TestConfigNodeDeserialization::testInvalidNodes()
+{
+    int intValue = 0;
+    QVERIFY(!deserialize(ConfigNodeReference(ConfigNodePath("/a")), &intValue));
+
+    QMap<QString, int> map;
+    QVERIFY(!deserialize(ConfigNodeReference(ConfigNodePath("/a")), &map));
+
+    // Unresolved references in an Object node
+    ConfigObjectNode node;
+    node.setMember("a", ConfigValueNode(1));
+    node.setMember("b", ConfigNodeReference(ConfigNodePath("/a")));
+    QVERIFY(!deserialize(node, &map));
+
+    QJsonObject jsonObject;
+    QVERIFY(!deserialize(node, &jsonObject));
+}
+
+// Test: loading of a ConfigItem parameter ---------------------------------------------------------
+
+void TestConfigNodeDeserialization::testConfigItem()
+{
+    ConfigObjectNode config;
+    config.setMember("map", *createMapNode());
+
+    TestMapConfig item;
+    QVERIFY(item.loadConfig(config));
+    QCOMPARE(item.map, (QMap<QString, int> { { "a", 1 }, { "b", 2 }, { "c", 3 } }));
+
+    // Unresolved references are reported before deserialization
+    config.member("map")->toObject().setMember("d", ConfigNodeReference(ConfigNodePath("/a")));
+    QVERIFY(!item.loadConfig(config));
+}
+
+// Helper methods ----------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> TestConfigNodeDeserialization::createMapNode()
+{
+    auto node = std::make_unique<ConfigObjectNode>();
+    node->setMember("c", ConfigValueNode(3));
+    node->setMember("a", ConfigValueNode(1));
+    node->setMember("b", ConfigValueNode(2));
+    return node;
+}
+
+// Main function -----------------------------------------------------------------------------------
+
+QTEST_MAIN(TestConfigNodeDeserialization)
+#include "testConfigNodeDeserialization.moc"
@@ -74,6 +74,7 @@ private slots:
     void testResolveReferences_data();
 
     void testNodeNames();
+    void testSegments();
 
     void testToAbsolute();
     void testToAbsolute_data();
@@ -83,6 +84,10 @@ private slots:
 
     void testAppendNodePath();
     void testAppendNodePath_data();
+
+    void testValidateNodeName();
+    void testValidateNodeName_data();
+    void testValidateNodeNameAtCompileTime();
 };
 
 // Test Case init/cleanup methods ------------------------------------------------------------------
@@ -392,6 +397,42 @@ void TestConfigNodePath::testNodeNames()
     QCOMPARE(nodePath.nodeNames(), nodeNames);
 }
 
+// Test: segments() method ------------------------------------------------------------------------
+
+void TestConfigNodePath::testSegments()
+{
+    using SegmentType = ConfigNodePath::SegmentType;
+
+    ConfigNodePath nodePath("/a/../b");
+    QVERIFY(nodePath.isAbsolute());
+    QCOMPARE(static_cast<int>(nodePath.segments().size()), 3);
+    QVERIFY(nodePath.segments().at(0).type == SegmentType::NodeName);
+    QCOMPARE(nodePath.segments().at(0).name, QString("a"));
+    QVERIFY(nodePath.segments().at(1).type == SegmentType::Parent);
+    QVERIFY(nodePath.segments().at(2).type == SegmentType::NodeName);
+    QCOMPARE(nodePath.segments().at(2).name, QString("b"));
+
+    QVERIFY(nodePath.resolveReferences());
+    QCOMPARE(nodePath.path(), QString("/b"));
+    QCOMPARE(static_cast<int>(nodePath.segments().size()), 1);
+
+    nodePath.append(ConfigNodePath("../c/d"));
+    QCOMPARE(nodePath.path(), QString("/b/../c/d"));
+    QCOMPARE(static_cast<int>(nodePath.segments().size()), 4);
+    QVERIFY(nodePath.segments().at(1).type == SegmentType::Parent);
+
+    nodePath.append(ConfigNodePath("../../.."));
+    QVERIFY(!nodePath.isValid());
+
+    nodePath.setPath("a/1b");
+    QVERIFY(nodePath.isRelative());
+    QVERIFY(!nodePath.isValid());
+    QVERIFY(nodePath.segments().at(1).type == SegmentType::Invalid);
+
+    QVERIFY(ConfigNodePath::ROOT_PATH.segments().empty());
+    QVERIFY(ConfigNodePath().segments().empty());
+}
+
 // Test: toAbsolute() method -----------------------------------------------------------------------
 
 void TestConfigNodePath::testToAbsolute()
@@ -511,6 +552,45 @@ void TestConfigNodePath::testAppendNodePath_data()
     QTest::newRow("Empty path") << "" << "aaa/bbb" << "";
 }
 
+// Test: validateNodeName() method ----------------------------------------------------------------
+
+void TestConfigNodePath::testValidateNodeName()
+{
+    QFETCH(QString, nodeName);
+    QFETCH(bool, expectedResult);
+
+    QCOMPARE(ConfigNodePath::validateNodeName(nodeName), expectedResult);
+}
+
+void TestConfigNodePath::testValidateNodeName_data()
+{
+    QTest::addColumn<QString>("nodeName");
+    QTest::addColumn<bool>("expectedResult");
+
+    QTest::newRow("Single letter") << "a" << true;
+    QTest::newRow("Uppercase letters") << "ABC" << true;
+    QTest::newRow("Letters, digits and underscores") << "aB_1_z9" << true;
+
+    QTest::newRow("Empty") << "" << false;
+    QTest::newRow("Leading digit") << "1abc" << false;
+    QTest::newRow("Leading underscore") << "_abc" << false;
+    QTest::newRow("Whitespace") << "ab c" << false;
+    QTest::newRow("Path separator") << "ab/c" << false;
+    QTest::newRow("Parent reference") << ".." << false;
+    QTest::newRow("Characters next to letters") << "a@[`{" << false;
+    QTest::newRow("Non-ASCII letter") << QString("ab") + QChar(0xE9) << false;
+}
+
+void TestConfigNodePath::testValidateNodeNameAtCompileTime()
+{
+    static_assert(ConfigNodePath::validateNodeName("abc_123"), "Valid node name");
+    static_assert(!ConfigNodePath::validateNodeName(""), "Empty node name");
+    static_assert(!ConfigNodePath::validateNodeName("1abc"), "Leading digit");
+    static_assert(!ConfigNodePath::validateNodeName("ab-c"), "Invalid character");
+
+    QCOMPARE(CPPCONFIGFRAMEWORK_NODE_NAME("abc_123"), QString("abc_123"));
+}
+
 // Main function -----------------------------------------------------------------------------------
 
 QTEST_MAIN(TestConfigNodePath)
@@ -0,0 +1,282 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains unit tests for ConfigParameterNames and ConfigParameterBatch classes
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigItem.hpp>
+
+// Qt includes
+#include <QtCore/QDebug>
+#include <QtTest/QTest>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// Test config classes -----------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+
+class TestBatchConfig : public ConfigItem
+{
+public:
+    int required = 0;
+    double optional = 1.5;
+    QString text;
+    bool optionalLoaded = false;
+    QStringList unknownNames;
+
+private:
+    bool loadConfigParameters(const ConfigObjectNode &config) override
+    {
+        static const ConfigParameterNames s_names { "required", "optional", "text" };
+        const ConfigParameterBatch batch(s_names, config);
+
+        reportUnknownConfigParameters(batch);
+
+        return loadRequiredConfigParameter(&required,
+                                           batch,
+                                           0,
+                                           makeConfigParameterRangeValidator(0, 10)) &&
+                loadOptionalConfigParameter(&optional, batch, 1, &optionalLoaded) &&
+                loadRequiredConfigParameter(&text, batch, 2);
+    }
+
+    bool storeConfigParameters(ConfigObjectNode *config) override
+    {
+        Q_UNUSED(config);
+        return true;
+    }
+
+    void handleUnknownConfigParameters(const ConfigObjectNode &config,
+                                       const QStringList &names) override
+    {
+        Q_UNUSED(config);
+        unknownNames = names;
+    }
+};
+
+// Test class declaration --------------------------------------------------------------------------
+
+class TestConfigParameterBatch : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Functions executed by QtTest before and after test suite
+    void initTestCase();
+    void cleanupTestCase();
+
+    // Functions executed by QtTest before and after each test
+    void init();
+    void cleanup();
+
+    // Test functions
+    void testNames();
+    void testInvalidNames();
+    void testBatch();
+    void testBatchLargeObject();
+    void testLoad();
+    void testLoadFailure();
+};
+
+// Test Case init/cleanup methods ------------------------------------------------------------------
+
+void TestConfigParameterBatch::initTestCase()
+{
+}
+
+void TestConfigParameterBatch::cleanupTestCase()
+{
+}
+
+// Test init/cleanup methods -----------------------------------------------------------------------
+
+void TestConfigParameterBatch::init()
+{
+}
+
+void TestConfigParameterBatch::cleanup()
+{
+}
+
+// Test: parameter names ---------------------------------------------------------------------------
+
+void TestConfigParameterBatch::testNames()
+{
+    const ConfigParameterNames names { "b", "c", "a" };
+    QVERIFY(names.isValid());
+    QVERIFY(names.invalidName().isEmpty());
+    QCOMPARE(names.count(), size_t(3U));
+    QCOMPARE(names.name(0), QString("b"));
+    QCOMPARE(names.name(2), QString("a"));
+    QCOMPARE(names.atom(1), ConfigNameTable::instance()->find("c"));
+}
+
+// Test: invalid and duplicate parameter names -----------------------------------------------------
+
+void TestConfigParameterBatch::testInvalidNames()
+{
+    {
+        const ConfigParameterNames names { "a", "1b" };
+        QVERIFY(!names.isValid());
+        QCOMPARE(names.invalidName(), QString("1b"));
+        QCOMPARE(names.atom(1), ConfigNameTable::INVALID_ATOM);
+    }
+
+    {
+        const ConfigParameterNames names(QStringList { "a", "b", "a" });
+        QVERIFY(!names.isValid());
+        QCOMPARE(names.invalidName(), QString("a"));
+    }
+}
+
+// Test: finding of the parameter nodes ------------------------------------------------------------
+
+void TestConfigParameterBatch::testBatch()
+{
+    ConfigObjectNode config;
+    config.setMember("text", ConfigValueNode("abc"));
+    config.setMember("extra2", ConfigValueNode(2));
+    config.setMember("required", ConfigValueNode(5));
+    config.setMember("extra1", ConfigValueNode(1));
+
+    const ConfigParameterNames names { "required", "optional", "text" };
+    const ConfigParameterBatch batch(names, config);
+    const ConfigObjectNode &constConfig = config;
+
+    QVERIFY(batch.member(0) == constConfig.member("required"));
+    QVERIFY(batch.member(1) == nullptr);
+    QVERIFY(batch.member(2) == constConfig.member("text"));
+    QCOMPARE(batch.unknownNames(), QStringList({ "extra1", "extra2" }));
+    QVERIFY(&batch.names() == &names);
+    QVERIFY(&batch.config() == &config);
+}
+
+// Test: finding of the parameter nodes in an Object node with a hash index ------------------------
+
+void TestConfigParameterBatch::testBatchLargeObject()
+{
+    ConfigObjectNode config;
+
+    for (int i = 0; i < 50; i++)
+    {
+        config.setMember(QString("member%1").arg(i), ConfigValueNode(i));
+    }
+
+    QStringList parameterNames;
+    QStringList expectedUnknownNames;
+
+    for (int i = 0; i < 50; i++)
+    {
+        const QString name = QString("member%1").arg(i);
+
+        if ((i % 5) == 0)
+        {
+            parameterNames.append(name);
+        }
+        else
+        {
+            expectedUnknownNames.append(name);
+        }
+    }
+
+    parameterNames.append("missing");
+    expectedUnknownNames.sort();
+
+    const ConfigParameterNames names(parameterNames);
+    const ConfigParameterBatch batch(names, config);
+    const ConfigObjectNode &constConfig = config;
+
+    for (size_t i = 0U; i < names.count(); i++)
+    {
+        QVERIFY(batch.member(i) == constConfig.member(names.name(i)));
+    }
+
+    QVERIFY(batch.member(names.count() - 1U) == nullptr);
+    QCOMPARE(batch.unknownNames(), expectedUnknownNames);
+}
+
+// Test: loading of parameters with a batch --------------------------------------------------------
+
+void TestConfigParameterBatch::testLoad()
+{
+    // All parameters
+    {
+        ConfigObjectNode config;
+        config.setMember("text", ConfigValueNode("abc"));
+        config.setMember("optional", ConfigValueNode(2.5));
+        config.setMember("required", ConfigValueNode(5));
+
+        TestBatchConfig item;
+        QVERIFY(item.loadConfig(config));
+        QCOMPARE(item.required, 5);
+        QCOMPARE(item.optional, 2.5);
+        QVERIFY(item.optionalLoaded);
+        QCOMPARE(item.text, QString("abc"));
+        QVERIFY(item.unknownNames.isEmpty());
+    }
+
+    // Without the optional parameter and with unknown parameters
+    {
+        ConfigObjectNode config;
+        config.setMember("text", ConfigValueNode("abc"));
+        config.setMember("required", ConfigValueNode(5));
+        config.setMember("unused", ConfigValueNode(true));
+
+        TestBatchConfig item;
+        QVERIFY(item.loadConfig(config));
+        QCOMPARE(item.required, 5);
+        QCOMPARE(item.optional, 1.5);
+        QVERIFY(!item.optionalLoaded);
+        QCOMPARE(item.text, QString("abc"));
+        QCOMPARE(item.unknownNames, QStringList({ "unused" }));
+    }
+}
+
+// Test: loading failures --------------------------------------------------------------------------
+
+void TestConfigParameterBatch::testLoadFailure()
+{
+    // Missing required parameter
+    {
+        ConfigObjectNode config;
+        config.setMember("required", ConfigValueNode(5));
+
+        TestBatchConfig item;
+        QVERIFY(!item.loadConfig(config));
+    }
+
+    // Invalid value
+    {
+        ConfigObjectNode config;
+        config.setMember("required", ConfigValueNode(50));
+        config.setMember("text", ConfigValueNode("abc"));
+
+        TestBatchConfig item;
+        QVERIFY(!item.loadConfig(config));
+    }
+}
+
+// Main function -----------------------------------------------------------------------------------
+
+QTEST_MAIN(TestConfigParameterBatch)
+#include "testConfigParameterBatch.moc"
@@ -0,0 +1,348 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains unit tests for ConfigParameterTable and ConfigTableItem classes
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigTableItem.hpp>
+
+// Qt includes
+#include <QtCore/QDebug>
+#include <QtTest/QTest>
+
+// System includes
+#include <algorithm>
+
+// Forward declarations
+
+// Macros
+
+// Test config classes -----------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+
+class TestTableConfig : public ConfigTableItem<TestTableConfig>
+{
+public:
+    static auto configParameters()
+    {
+        return makeConfigParameterTable(
+                    CPPCONFIGFRAMEWORK_REQUIRED_PARAMETER("required",
+                                                          &TestTableConfig::required,
+                                                          makeConfigParameterRangeValidator(0, 10)),
+                    CPPCONFIGFRAMEWORK_OPTIONAL_PARAMETER("optional", &TestTableConfig::optional),
+                    CPPCONFIGFRAMEWORK_REQUIRED_PARAMETER("text", &TestTableConfig::text));
+    }
+
+    int required = 0;
+    double optional = 1.5;
+    QString text;
+};
+
+class TestLargeTableConfig : public ConfigTableItem<TestLargeTableConfig>
+{
+public:
+    static auto configParameters()
+    {
+        return makeConfigParameterTable(
+                    CPPCONFIGFRAMEWORK_REQUIRED_PARAMETER(
+                        "member40",
+                        &TestLargeTableConfig::a,
+                        makeConfigParameterAndValidator(
+                            ConfigParameterRangeValidator<int>(0, 100),
+                            [](const int &value) { return ((value % 2) == 0); })),
+                    CPPCONFIGFRAMEWORK_REQUIRED_PARAMETER("member3", &TestLargeTableConfig::b),
+                    CPPCONFIGFRAMEWORK_OPTIONAL_PARAMETER("member99", &TestLargeTableConfig::c));
+    }
+
+    int a = 0;
+    int b = 0;
+    int c = -1;
+};
+
+class TestInvalidTableConfig : public ConfigTableItem<TestInvalidTableConfig>
+{
+public:
+    static auto configParameters()
+    {
+        // Names that are not validated at compile time
+        return makeConfigParameterTable(
+                    requiredConfigParameter(QStringLiteral("a"), &TestInvalidTableConfig::a),
+                    requiredConfigParameter(QStringLiteral("a"), &TestInvalidTableConfig::b));
+    }
+
+    int a = 0;
+    int b = 0;
+};
+
+class TestExtendedTableConfig : public ConfigTableItem<TestExtendedTableConfig>
+{
+public:
+    static auto configParameters()
+    {
+        return makeConfigParameterTable(
+                    CPPCONFIGFRAMEWORK_REQUIRED_PARAMETER("a", &TestExtendedTableConfig::a));
+    }
+
+    int a = 0;
+    int b = 0;
+
+private:
+    bool loadConfigParameters(const ConfigObjectNode &config) override
+    {
+        return ConfigTableItem::loadConfigParameters(config) &&
+                loadRequiredConfigParameter(&b, "b", config);
+    }
+
+    bool storeConfigParameters(ConfigObjectNode *config) override
+    {
+        return ConfigTableItem::storeConfigParameters(config) &&
+                storeConfigParameter(b, "b", config);
+    }
+};
+
+// Test class declaration --------------------------------------------------------------------------
+
+class TestConfigParameterTable : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Functions executed by QtTest before and after test suite
+    void initTestCase();
+    void cleanupTestCase();
+
+    // Functions executed by QtTest before and after each test
+    void init();
+    void cleanup();
+
+    // Test functions
+    void testLoad();
+    void testLoadOptional();
+    void testLoadFailure();
+    void testLoadLargeObject();
+    void testStore();
+    void testInvalidTable();
+    void testExtendedItem();
+    void testFindMembers();
+};
+
+// Test Case init/cleanup methods ------------------------------------------------------------------
+
+void TestConfigParameterTable::initTestCase()
+{
+}
+
+void TestConfigParameterTable::cleanupTestCase()
+{
+}
+
+// Test init/cleanup methods -----------------------------------------------------------------------
+
+void TestConfigParameterTable::init()
+{
+}
+
+void TestConfigParameterTable::cleanup()
+{
+}
+
+// Test: loading of all parameters -----------------------------------------------------------------
+
+void TestConfigParameterTable::testLoad()
+{
+    ConfigObjectNode config;
+    config.setMember("text", ConfigValueNode("abc"));
+    config.setMember("optional", ConfigValueNode(2.5));
+    config.setMember("required", ConfigValueNode(5));
+    config.setMember("unused", ConfigValueNode(true));
+
+    TestTableConfig item;
+    QVERIFY(item.loadConfig(config));
+    QCOMPARE(item.required, 5);
+    QCOMPARE(item.optional, 2.5);
+    QCOMPARE(item.text, QString("abc"));
+}
+
+// Test: loading without the optional parameter ----------------------------------------------------
+
+void TestConfigParameterTable::testLoadOptional()
+{
+    ConfigObjectNode config;
+    config.setMember("required", ConfigValueNode(5));
+    config.setMember("text", ConfigValueNode("abc"));
+
+    TestTableConfig item;
+    QVERIFY(item.loadConfig(config));
+    QCOMPARE(item.required, 5);
+    QCOMPARE(item.optional, 1.5);
+    QCOMPARE(item.text, QString("abc"));
+}
+
+// Test: loading failures --------------------------------------------------------------------------
+
+void TestConfigParameterTable::testLoadFailure()
+{
+    // Missing required parameter
+    {
+        ConfigObjectNode config;
+        config.setMember("required", ConfigValueNode(5));
+
+        TestTableConfig item;
+        QVERIFY(!item.loadConfig(config));
+    }
+
+    // Invalid value
+    {
+        ConfigObjectNode config;
+        config.setMember("required", ConfigValueNode(50));
+        config.setMember("text", ConfigValueNode("abc"));
+
+        TestTableConfig item;
+        QVERIFY(!item.loadConfig(config));
+    }
+
+    // Invalid type
+    {
+        ConfigObjectNode config;
+        config.setMember("required", ConfigValueNode(5));
+        config.setMember("text", ConfigValueNode("abc"));
+        config.setMember("optional", ConfigValueNode("abc"));
+
+        TestTableConfig item;
+        QVERIFY(!item.loadConfig(config));
+    }
+}
+
+// Test: loading from an Object node with a hash index ---------------------------------------------
+
+void TestConfigParameterTable::testLoadLargeObject()
+{
+    ConfigObjectNode config;
+
+    for (int i = 0; i < 50; i++)
+    {
+        config.setMember(QString("member%1").arg(i), ConfigValueNode(i));
+    }
+
+    TestLargeTableConfig item;
+    QVERIFY(item.loadConfig(config));
+    QCOMPARE(item.a, 40);
+    QCOMPARE(item.b, 3);
+    QCOMPARE(item.c, -1);
+}
+
+// Test: storing of all parameters -----------------------------------------------------------------
+
+void TestConfigParameterTable::testStore()
+{
+    TestTableConfig item;
+    item.required = 7;
+    item.optional = 3.5;
+    item.text = "xyz";
+
+    ConfigObjectNode config;
+    QVERIFY(item.storeConfig(&config));
+    QCOMPARE(config.count(), 3);
+    QCOMPARE(config.member("required")->toValue().value(), QJsonValue(7));
+    QCOMPARE(config.member("optional")->toValue().value(), QJsonValue(3.5));
+    QCOMPARE(config.member("text")->toValue().value(), QJsonValue("xyz"));
+
+    TestTableConfig loaded;
+    QVERIFY(loaded.loadConfig(config));
+    QCOMPARE(loaded.required, 7);
+    QCOMPARE(loaded.optional, 3.5);
+    QCOMPARE(loaded.text, QString("xyz"));
+}
+
+// Test: table with duplicate names ----------------------------------------------------------------
+
+void TestConfigParameterTable::testInvalidTable()
+{
+    ConfigObjectNode config;
+    config.setMember("a", ConfigValueNode(1));
+
+    TestInvalidTableConfig item;
+    QVERIFY(!item.loadConfig(config));
+    QVERIFY(!item.storeConfig(&config));
+
+    const auto table = makeConfigParameterTable(
+                requiredConfigParameter(QStringLiteral("1a"), &TestInvalidTableConfig::a),
+                requiredConfigParameter(QStringLiteral("b"), &TestInvalidTableConfig::b));
+    QVERIFY(!table.names().isValid());
+    QCOMPARE(table.names().invalidName(), QString("1a"));
+}
+
+// Test: item that loads additional parameters -----------------------------------------------------
+
+void TestConfigParameterTable::testExtendedItem()
+{
+    ConfigObjectNode config;
+    config.setMember("a", ConfigValueNode(1));
+    config.setMember("b", ConfigValueNode(2));
+
+    TestExtendedTableConfig item;
+    QVERIFY(item.loadConfig(config));
+    QCOMPARE(item.a, 1);
+    QCOMPARE(item.b, 2);
+
+    ConfigObjectNode stored;
+    QVERIFY(item.storeConfig(&stored));
+    QCOMPARE(stored.names(), QStringList({ "a", "b" }));
+}
+
+// Test: ConfigObjectNode::findMembers() -----------------------------------------------------------
+
+void TestConfigParameterTable::testFindMembers()
+{
+    auto *nameTable = ConfigNameTable::instance();
+
+    for (const int memberCount : { 5, 50 })
+    {
+        ConfigObjectNode config;
+
+        for (int i = 0; i < memberCount; i++)
+        {
+            config.setMember(QString("member%1").arg(i), ConfigValueNode(i));
+        }
+
+        std::vector<ConfigNameTable::Atom> names
+        {
+            nameTable->intern("member0"),
+            nameTable->intern("member4"),
+            nameTable->intern("member49"),
+            nameTable->intern("missing")
+        };
+        std::sort(names.begin(), names.end());
+
+        std::vector<const ConfigNode *> members(names.size(), nullptr);
+        config.findMembers(names.data(), names.size(), members.data());
+
+        const ConfigObjectNode &constConfig = config;
+
+        for (size_t i = 0U; i < names.size(); i++)
+        {
+            QVERIFY(members[i] == constConfig.member(names[i]));
+        }
+    }
+}
+
+// Main function -----------------------------------------------------------------------------------
+
+QTEST_MAIN(TestConfigParameterTable)
+#include "testConfigParameterTable.moc"
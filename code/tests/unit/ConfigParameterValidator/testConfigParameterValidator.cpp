@@ -57,6 +57,17 @@ private slots:
 
     void testConfigParameterListValidator();
     void testConfigParameterListValidator_data();
+
+    void testConfigParameterDefaultValidator();
+
+    void testConfigParameterRangeListValidator();
+    void testConfigParameterRangeListValidator_data();
+
+    void testConfigParameterAndValidator();
+    void testConfigParameterAndValidator_data();
+
+    void testConfigParameterOrValidator();
+    void testConfigParameterOrValidator_data();
 };
 
 // Test Case init/cleanup methods ------------------------------------------------------------------
@@ -156,6 +167,110 @@ void TestConfigParameterValidator::testConfigParameterListValidator_data()
     QTest::newRow("default") << QString() << false;
 }
 
+// Test: ConfigParameterDefaultValidator ----------------------------------------------------------
+
+void TestConfigParameterValidator::testConfigParameterDefaultValidator()
+{
+    // Validates everything as true
+    ConfigParameterDefaultValidator<int> validator;
+
+    QVERIFY(validator(std::numeric_limits<int>::min()));
+    QVERIFY(validator(0));
+    QVERIFY(validator(std::numeric_limits<int>::max()));
+}
+
+// Test: ConfigParameterRangeListValidator ---------------------------------------------------------
+
+void TestConfigParameterValidator::testConfigParameterRangeListValidator()
+{
+    QFETCH(int, parameterValue);
+    QFETCH(bool, expectedResult);
+
+    // Validates values in range and the additional values from the list
+    const auto validator = makeConfigParameterRangeListValidator(0, 100, QList<int> { -1, 1000 });
+
+    QCOMPARE(validator(parameterValue), expectedResult);
+}
+
+void TestConfigParameterValidator::testConfigParameterRangeListValidator_data()
+{
+    QTest::addColumn<int>("parameterValue");
+    QTest::addColumn<bool>("expectedResult");
+
+    QTest::newRow("0") << 0 << true;
+    QTest::newRow("50") << 50 << true;
+    QTest::newRow("100") << 100 << true;
+    QTest::newRow("-1") << -1 << true;
+    QTest::newRow("1000") << 1000 << true;
+
+    QTest::newRow("-2") << -2 << false;
+    QTest::newRow("101") << 101 << false;
+    QTest::newRow("999") << 999 << false;
+}
+
+// Test: ConfigParameterAndValidator ---------------------------------------------------------------
+
+void TestConfigParameterValidator::testConfigParameterAndValidator()
+{
+    QFETCH(int, parameterValue);
+    QFETCH(bool, expectedResult);
+
+    // Validates even values in range
+    const auto validator = makeConfigParameterAndValidator(
+                               ConfigParameterRangeValidator<int>(-10, 10),
+                               [](const int &value) { return ((value % 2) == 0); });
+
+    QCOMPARE(validator(parameterValue), expectedResult);
+
+    // Same validation through a type-erased validator
+    const ConfigParameterValidator<int> wrappedValidator(validator);
+
+    QCOMPARE(wrappedValidator(parameterValue), expectedResult);
+}
+
+void TestConfigParameterValidator::testConfigParameterAndValidator_data()
+{
+    QTest::addColumn<int>("parameterValue");
+    QTest::addColumn<bool>("expectedResult");
+
+    QTest::newRow("-10") << -10 << true;
+    QTest::newRow("0") << 0 << true;
+    QTest::newRow("4") << 4 << true;
+
+    QTest::newRow("-9") << -9 << false;
+    QTest::newRow("3") << 3 << false;
+    QTest::newRow("12") << 12 << false;
+}
+
+// Test: ConfigParameterOrValidator ----------------------------------------------------------------
+
+void TestConfigParameterValidator::testConfigParameterOrValidator()
+{
+    QFETCH(QString, parameterValue);
+    QFETCH(bool, expectedResult);
+
+    // Validates all from the list and all values with the prefix
+    const auto validator = makeConfigParameterOrValidator(
+                               ConfigParameterListValidator<QString>({ "a", "b" }),
+                               [](const QString &value) { return value.startsWith("x_"); });
+
+    QCOMPARE(validator(parameterValue), expectedResult);
+}
+
+void TestConfigParameterValidator::testConfigParameterOrValidator_data()
+{
+    QTest::addColumn<QString>("parameterValue");
+    QTest::addColumn<bool>("expectedResult");
+
+    QTest::newRow("a") << "a" << true;
+    QTest::newRow("b") << "b" << true;
+    QTest::newRow("x_c") << "x_c" << true;
+
+    QTest::newRow("c") << "c" << false;
+    QTest::newRow("x") << "x" << false;
+    QTest::newRow("empty") << "" << false;
+}
+
 // Main function -----------------------------------------------------------------------------------
 
 QTEST_MAIN(TestConfigParameterValidator)
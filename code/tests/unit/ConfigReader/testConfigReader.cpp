@@ -19,12 +19,17 @@
  */
 
 // C++ Config Framework includes
+#include <CppConfigFramework/ConfigNodeArena.hpp>
+#include <CppConfigFramework/ConfigNodeSharingScope.hpp>
 #include <CppConfigFramework/ConfigObjectNode.hpp>
 #include <CppConfigFramework/ConfigReader.hpp>
 #include <CppConfigFramework/ConfigValueNode.hpp>
 
 // Qt includes
 #include <QtCore/QDebug>
+#include <QtCore/QFile>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QRegularExpression>
 #include <QtTest/QTest>
 
 // System includes
@@ -54,15 +59,26 @@ private slots:
     void testReadValidConfig();
     void testReadConfigWithNodeReference();
     void testReadConfigWithDerivedObject();
+    void testReadConfigWithForwardReferences();
     void testReadConfigWithIncludes();
     void testReadConfigWithIncludesAndEnv();
     void testReadConfigWithOnlyIncludes();
+    void testReadConfigWithArenaAllocation();
+    void testReadConfigIsDetached();
+    void testReadConfigIsDetached_data();
+    void testReadConfigFileAndJsonObject();
+    void testReadConfigFileAndJsonObject_data();
+    void testReadConfigWithParallelIncludes();
+    void testReadConfigWithDependentParallelIncludes();
+    void testReadConfigWithDependentParallelIncludes_data();
     void testReadConfigWithExternalConfigReferences();
     void testReadInvalidPathParameters();
     void testReadInvalidPathParameters_data();
     void testReadInvalidExternalConfigsParameter();
     void testReadInvalidConfigFile();
     void testReadInvalidConfigFile_data();
+    void testReadCyclicReferences();
+    void testReadCyclicReferences_data();
     void testCurrentDirectoryEnvironmentVariable();
     void testReadConfigNullEnvironmentVariables();
 };
@@ -326,6 +342,62 @@ void TestConfigReader::testReadConfigWithDerivedObject()
     }
 }
 
+// Test: read a config file with references to nodes that are resolved later -----------------------
+
+void TestConfigReader::testReadConfigWithForwardReferences()
+{
+    // Read config file (the max number of cycles is ignored since all references are resolved in a
+    // single pass in the order of their dependencies)
+    const QString configFilePath(QStringLiteral(":/TestData/ConfigWithForwardReferences.json"));
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    ConfigReader configReader;
+    configReader.setReferenceResolutionMaxCycles(1U);
+
+    auto config = configReader.read(configFilePath,
+                                    QDir::current(),
+                                    ConfigNodePath::ROOT_PATH,
+                                    ConfigNodePath::ROOT_PATH,
+                                    {},
+                                    &environmentVariables);
+    QVERIFY(config);
+    QCOMPARE(config->count(), 5);
+
+    // Check "/ref1" (references "/ref2" which references a member of "/derived")
+    {
+        const auto *ref1 = config->nodeAtPath("/ref1");
+        QVERIFY(ref1 != nullptr);
+        QVERIFY(ref1->isValue());
+        QCOMPARE(ref1->toValue().value(), QJsonValue(1));
+    }
+
+    // Check "/ref2"
+    {
+        const auto *ref2 = config->nodeAtPath("/ref2");
+        QVERIFY(ref2 != nullptr);
+        QVERIFY(ref2->isValue());
+        QCOMPARE(ref2->toValue().value(), QJsonValue(1));
+    }
+
+    // Check "/derived" (derived from "/ref3" which references "/base")
+    {
+        const auto *derived = config->nodeAtPath("/derived");
+        QVERIFY(derived != nullptr);
+        QVERIFY(derived->isObject());
+        QCOMPARE(derived->toObject().count(), 2);
+        QCOMPARE(derived->toObject().member("value")->toValue().value(), QJsonValue(1));
+        QCOMPARE(derived->toObject().member("extra")->toValue().value(), QJsonValue(2));
+    }
+
+    // Check "/ref3"
+    {
+        const auto *ref3 = config->nodeAtPath("/ref3");
+        QVERIFY(ref3 != nullptr);
+        QVERIFY(ref3->isObject());
+        QCOMPARE(ref3->toObject().count(), 1);
+        QCOMPARE(ref3->toObject().member("value")->toValue().value(), QJsonValue(1));
+    }
+}
+
 // Test: read a config file with includes ----------------------------------------------------------
 
 void TestConfigReader::testReadConfigWithIncludes()
@@ -526,6 +598,278 @@ void TestConfigReader::testReadConfigWithOnlyIncludes()
     }
 }
 
+// Test: read a config file with arena allocation --------------------------------------------------
+
+void TestConfigReader::testReadConfigWithArenaAllocation()
+{
+    // Read config file with and without arena allocation
+    const QString configFilePath(QStringLiteral(":/TestData/ConfigWithIncludes.json"));
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    ConfigReader configReader;
+    QVERIFY(!configReader.arenaAllocationEnabled());
+
+    auto expectedConfig = configReader.read(configFilePath,
+                                            QDir::current(),
+                                            ConfigNodePath::ROOT_PATH,
+                                            ConfigNodePath::ROOT_PATH,
+                                            {},
+                                            &environmentVariables);
+    QVERIFY(expectedConfig);
+
+    configReader.setArenaAllocationEnabled(true);
+    QVERIFY(configReader.arenaAllocationEnabled());
+
+    environmentVariables = EnvironmentVariables::loadFromProcess();
+    auto config = configReader.read(configFilePath,
+                                    QDir::current(),
+                                    ConfigNodePath::ROOT_PATH,
+                                    ConfigNodePath::ROOT_PATH,
+                                    {},
+                                    &environmentVariables);
+    QVERIFY(config);
+    QVERIFY(*config == *expectedConfig);
+
+    // The arena must not be active anymore, but the read configuration must still be usable
+    QVERIFY(ConfigNodeArena::current() == nullptr);
+    QVERIFY(config->setMember("new_member", std::make_unique<ConfigValueNode>(1)));
+    QVERIFY(config->remove("included_config1"));
+    QCOMPARE(config->count(), 3);
+}
+
+// Test: read configuration doesn't share its members ----------------------------------------------
+
+/*!
+ * Checks if the Object node and all of its descendants are detached
+ *
+ * \param   node    Object node
+ *
+ * \retval  true    All nodes are detached
+ * \retval  false   At least one node is not detached
+ */
+static bool isDetachedTree(const ConfigObjectNode &node)
+{
+    if (!node.isDetached())
+    {
+        return false;
+    }
+
+    for (const QString &name : node.names())
+    {
+        const auto *member = node.member(name);
+
+        if (member->isObject() && (!isDetachedTree(member->toObject())))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void TestConfigReader::testReadConfigIsDetached()
+{
+    QFETCH(QString, filePath);
+    QFETCH(bool, parallelIncludes);
+
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    environmentVariables.setValue("TEST_DATA_DIR", ":/TestData");
+    ConfigReader configReader;
+    configReader.setParallelIncludesEnabled(parallelIncludes);
+
+    auto config = configReader.read(filePath,
+                                    QDir::current(),
+                                    ConfigNodePath::ROOT_PATH,
+                                    ConfigNodePath::ROOT_PATH,
+                                    {},
+                                    &environmentVariables);
+    QVERIFY(config);
+    QCOMPARE(ConfigNodeSharingScope::current(), ConfigNodeSharingScope::NO_SCOPE);
+    QVERIFY(isDetachedTree(*config));
+
+    // Clones of the read configuration are complete copies (also in a sharing scope)
+    const ConfigNodeSharingScope sharingScope;
+    auto clone = config->clone();
+    QVERIFY(isDetachedTree(clone->toObject()));
+    QVERIFY(clone->toObject() == *config);
+}
+
+void TestConfigReader::testReadConfigIsDetached_data()
+{
+    QTest::addColumn<QString>("filePath");
+    QTest::addColumn<bool>("parallelIncludes");
+
+    QTest::newRow("ConfigWithNodeReferences")
+            << ":/TestData/ConfigWithNodeReferences.json" << false;
+    QTest::newRow("ConfigWithDerivedObjects")
+            << ":/TestData/ConfigWithDerivedObjects.json" << false;
+    QTest::newRow("ConfigWithIncludes")
+            << ":/TestData/ConfigWithIncludes.json" << false;
+    QTest::newRow("ConfigWithParallelIncludes")
+            << ":/TestData/ConfigWithParallelIncludes.json" << true;
+}
+
+// Test: read a config file directly and through a JSON Object -------------------------------------
+
+void TestConfigReader::testReadConfigFileAndJsonObject()
+{
+    QFETCH(QString, filePath);
+
+    // Read config file (its 'config' member is read directly from the file contents)
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    environmentVariables.setValue("TEST_DATA_DIR", ":/TestData");
+    ConfigReader configReader;
+
+    auto config = configReader.read(filePath,
+                                    QDir::current(),
+                                    ConfigNodePath::ROOT_PATH,
+                                    ConfigNodePath::ROOT_PATH,
+                                    {},
+                                    &environmentVariables);
+    QVERIFY(config);
+
+    // Read the same config from the JSON Object
+    QFile file(filePath);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+
+    const auto doc = QJsonDocument::fromJson(file.readAll());
+    QVERIFY(doc.isObject());
+
+    environmentVariables = EnvironmentVariables::loadFromProcess();
+    environmentVariables.setValue("TEST_DATA_DIR", ":/TestData");
+    auto expectedConfig = configReader.read(doc.object(),
+                                            QFileInfo(filePath).absoluteDir(),
+                                            ConfigNodePath::ROOT_PATH,
+                                            ConfigNodePath::ROOT_PATH,
+                                            {},
+                                            &environmentVariables);
+    QVERIFY(expectedConfig);
+    QVERIFY(*config == *expectedConfig);
+}
+
+void TestConfigReader::testReadConfigFileAndJsonObject_data()
+{
+    QTest::addColumn<QString>("filePath");
+
+    QTest::newRow("ValidConfig") << ":/TestData/ValidConfig.json";
+    QTest::newRow("ConfigWithNodeReferences") << ":/TestData/ConfigWithNodeReferences.json";
+    QTest::newRow("ConfigWithDerivedObjects") << ":/TestData/ConfigWithDerivedObjects.json";
+    QTest::newRow("ConfigWithIncludes") << ":/TestData/ConfigWithIncludes.json";
+    QTest::newRow("ConfigWithIncludesAndEnv") << ":/TestData/ConfigWithIncludesAndEnv.json";
+}
+
+// Test: read a config file with includes that are read concurrently -------------------------------
+
+void TestConfigReader::testReadConfigWithParallelIncludes()
+{
+    // Read config file with sequential includes
+    const QString configFilePath(QStringLiteral(":/TestData/ConfigWithParallelIncludes.json"));
+    auto expectedEnvironmentVariables = EnvironmentVariables::loadFromProcess();
+    expectedEnvironmentVariables.setValue("TEST_DATA_DIR", ":/TestData");
+    ConfigReader configReader;
+    QVERIFY(!configReader.parallelIncludesEnabled());
+
+    auto expectedConfig = configReader.read(configFilePath,
+                                            QDir::current(),
+                                            ConfigNodePath::ROOT_PATH,
+                                            ConfigNodePath::ROOT_PATH,
+                                            {},
+                                            &expectedEnvironmentVariables);
+    QVERIFY(expectedConfig);
+    QCOMPARE(expectedConfig->nodeAtPath("/included_config1/value")->toValue().value().toInt(), 99);
+    QCOMPARE(expectedConfig->nodeAtPath("/included_value1")->toValue().value().toInt(), 1);
+    QCOMPARE(expectedConfig->nodeAtPath("/included_value3/sub_node/value")->toValue().value(),
+             QJsonValue(3));
+
+    // Read the same config file with concurrent includes (with and without arena allocation)
+    configReader.setParallelIncludesEnabled(true);
+    QVERIFY(configReader.parallelIncludesEnabled());
+
+    for (const bool arenaAllocation : { false, true })
+    {
+        configReader.setArenaAllocationEnabled(arenaAllocation);
+
+        auto environmentVariables = EnvironmentVariables::loadFromProcess();
+        environmentVariables.setValue("TEST_DATA_DIR", ":/TestData");
+
+        auto config = configReader.read(configFilePath,
+                                        QDir::current(),
+                                        ConfigNodePath::ROOT_PATH,
+                                        ConfigNodePath::ROOT_PATH,
+                                        {},
+                                        &environmentVariables);
+        QVERIFY(config);
+        QVERIFY(*config == *expectedConfig);
+
+        // Environment variables from the includes must be merged back
+        QCOMPARE(environmentVariables.value("include2_file_path"),
+                 expectedEnvironmentVariables.value("include2_file_path"));
+        QVERIFY(!environmentVariables.value("include2_file_path").isEmpty());
+        QCOMPARE(environmentVariables.names(), expectedEnvironmentVariables.names());
+    }
+}
+
+// Test: read a config file with includes that depend on each other concurrently -------------------
+
+void TestConfigReader::testReadConfigWithDependentParallelIncludes()
+{
+    QFETCH(QString, filePath);
+    QFETCH(QString, nodePath);
+    QFETCH(QJsonValue, expectedValue);
+
+    // Read config file with sequential includes
+    auto expectedEnvironmentVariables = EnvironmentVariables::loadFromProcess();
+    expectedEnvironmentVariables.setValue("TEST_DATA_DIR", ":/TestData");
+    ConfigReader configReader;
+
+    auto expectedConfig = configReader.read(filePath,
+                                            QDir::current(),
+                                            ConfigNodePath::ROOT_PATH,
+                                            ConfigNodePath::ROOT_PATH,
+                                            {},
+                                            &expectedEnvironmentVariables);
+    QVERIFY(expectedConfig);
+    QCOMPARE(expectedConfig->nodeAtPath(nodePath)->toValue().value(), expectedValue);
+
+    // The includes depend on each other so they must give the same result when they are read with
+    // concurrent includes enabled
+    configReader.setParallelIncludesEnabled(true);
+
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    environmentVariables.setValue("TEST_DATA_DIR", ":/TestData");
+
+    auto config = configReader.read(filePath,
+                                    QDir::current(),
+                                    ConfigNodePath::ROOT_PATH,
+                                    ConfigNodePath::ROOT_PATH,
+                                    {},
+                                    &environmentVariables);
+    QVERIFY(config);
+    QVERIFY(*config == *expectedConfig);
+    QCOMPARE(environmentVariables.variables(), expectedEnvironmentVariables.variables());
+}
+
+void TestConfigReader::testReadConfigWithDependentParallelIncludes_data()
+{
+    QTest::addColumn<QString>("filePath");
+    QTest::addColumn<QString>("nodePath");
+    QTest::addColumn<QJsonValue>("expectedValue");
+
+    QTest::newRow("ReferenceToPreviousInclude")
+            << ":/TestData/ConfigWithExternalConfigReferences.json"
+            << "/ref_absolute_path"
+            << QJsonValue(1);
+
+    QTest::newRow("FilePathFromPreviousInclude")
+            << ":/TestData/ConfigWithIncludesAndEnv.json"
+            << "/included_value2"
+            << QJsonValue(2);
+
+    QTest::newRow("EnvironmentVariableFromPreviousInclude")
+            << ":/TestData/ConfigWithDependentEnvironmentVariables.json"
+            << "/include2_file_path"
+            << QJsonValue(":/TestData/includes/Include2.json");
+}
+
 // Test: read a config file with an include that references a node from "external configs" ---------
 
 void TestConfigReader::testReadConfigWithExternalConfigReferences()
@@ -656,6 +1000,7 @@ void TestConfigReader::testReadInvalidConfigFile_data()
     QTest::addColumn<QString>("filePath");
 
     QTest::newRow("InvalidJsonFile") << ":/TestData/InvalidJsonFile.json";
+    QTest::newRow("InvalidJsonTrailingData") << ":/TestData/InvalidJsonTrailingData.json";
     QTest::newRow("NonObjectConfigFile") << ":/TestData/NonObjectConfigFile.json";
     QTest::newRow("IncludesNotArray") << ":/TestData/IncludesNotArray.json";
     QTest::newRow("IncludesItemNotObject") << ":/TestData/IncludesItemNotObject.json";
@@ -696,6 +1041,9 @@ void TestConfigReader::testReadInvalidConfigFile_data()
     QTest::newRow("ConfigInvalidReferenceType") << ":/TestData/ConfigInvalidReferenceType.json";
     QTest::newRow("ConfigInvalidSubObjectNode") << ":/TestData/ConfigInvalidSubObjectNode.json";
     QTest::newRow("ConfigUnresolvedReference") << ":/TestData/ConfigUnresolvedReference.json";
+    QTest::newRow("ConfigCyclicReferences1") << ":/TestData/ConfigCyclicReferences1.json";
+    QTest::newRow("ConfigCyclicReferences2") << ":/TestData/ConfigCyclicReferences2.json";
+    QTest::newRow("ConfigCyclicReferences3") << ":/TestData/ConfigCyclicReferences3.json";
     QTest::newRow("ConfigUnresolvableExternalConfigReferences")
             << ":/TestData/ConfigUnresolvableExternalConfigReferences.json";
     QTest::newRow("ConfigUnresolvedFilePath") << ":/TestData/ConfigUnresolvedFilePath.json";
@@ -705,6 +1053,46 @@ void TestConfigReader::testReadInvalidConfigFile_data()
     QTest::newRow("ConfigInvalidEnvVar4") << ":/TestData/ConfigInvalidEnvVar4.json";
 }
 
+// Test: read a config file with cyclic references -------------------------------------------------
+
+void TestConfigReader::testReadCyclicReferences()
+{
+    QFETCH(QString, filePath);
+    QFETCH(QString, cycle);
+
+    // The reported cycle names the reference nodes that are waiting for each other
+    QTest::ignoreMessage(
+                QtWarningMsg,
+                QRegularExpression(QRegularExpression::escape(QString("cycle: [%1]").arg(cycle))));
+
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    ConfigReader configReader;
+
+    auto config = configReader.read(filePath,
+                                    QDir::current(),
+                                    ConfigNodePath::ROOT_PATH,
+                                    ConfigNodePath::ROOT_PATH,
+                                    {},
+                                    &environmentVariables);
+    QVERIFY(!config);
+}
+
+void TestConfigReader::testReadCyclicReferences_data()
+{
+    QTest::addColumn<QString>("filePath");
+    QTest::addColumn<QString>("cycle");
+
+    QTest::newRow("ConfigCyclicReferences1")
+            << ":/TestData/ConfigCyclicReferences1.json"
+            << "/ref1 -> /ref2 -> /ref1";
+    QTest::newRow("ConfigCyclicReferences2")
+            << ":/TestData/ConfigCyclicReferences2.json"
+            << "/ref1 -> /ref2 -> /ref3 -> /ref1";
+    QTest::newRow("ConfigCyclicReferences3")
+            << ":/TestData/ConfigCyclicReferences3.json"
+            << "/object/derived -> /object/derived";
+}
+
 // Test: using the current directory environment variable ------------------------------------------
 
 void TestConfigReader::testCurrentDirectoryEnvironmentVariable()
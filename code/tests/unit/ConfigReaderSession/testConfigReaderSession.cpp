@@ -0,0 +1,247 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains unit tests for ConfigReaderSession class
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/ConfigReaderSession.hpp>
+#include <CppConfigFramework/ConfigValueNode.hpp>
+#include "TestConfigDir.hpp"
+
+// Qt includes
+#include <QtCore/QDebug>
+#include <QtTest/QTest>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// Test class declaration --------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+
+class TestConfigReaderSession : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Functions executed by QtTest before and after test suite
+    void initTestCase();
+    void cleanupTestCase();
+
+    // Functions executed by QtTest before and after each test
+    void init();
+    void cleanup();
+
+    // Test functions
+    void testRereadChangedInclude();
+    void testRereadUnchanged();
+    void testRereadInvalidatedFile();
+    void testRereadAddedAndRemovedMembers();
+    void testRereadFailure();
+
+private:
+    std::unique_ptr<ConfigObjectNode> readConfig(ConfigReaderSession *session);
+
+    std::unique_ptr<Test::TestConfigDir> m_dir;
+};
+
+// Test Case init/cleanup methods ------------------------------------------------------------------
+
+void TestConfigReaderSession::initTestCase()
+{
+}
+
+void TestConfigReaderSession::cleanupTestCase()
+{
+}
+
+// Test init/cleanup methods -----------------------------------------------------------------------
+
+void TestConfigReaderSession::init()
+{
+    m_dir = std::make_unique<Test::TestConfigDir>();
+    QVERIFY(m_dir->isValid());
+
+    QVERIFY(m_dir->writeFile("first.json",
+                             "{\"config\": {\"first\": {\"value\": 1, \"text\": \"abc\"}}}"));
+    QVERIFY(m_dir->writeFile("second.json",
+                             "{\"config\": {\"second\": {\"value\": 2, \"items\": [1, 2]}}}"));
+    QVERIFY(m_dir->writeFile("config.json",
+                             "{\"includes\": [{\"file_path\": \"first.json\"},"
+                             "                {\"file_path\": \"second.json\"}],"
+                             " \"config\": {\"main\": true}}"));
+}
+
+void TestConfigReaderSession::cleanup()
+{
+    m_dir.reset();
+}
+
+// Test: rereading after an include was changed ----------------------------------------------------
+
+void TestConfigReaderSession::testRereadChangedInclude()
+{
+    ConfigReaderSession session;
+    auto config = readConfig(&session);
+    QVERIFY(config);
+    QVERIFY(session.hasConfig());
+    QCOMPARE(config->nodeAtPath("/second/value")->toValue().value().toInt(), 2);
+
+    const auto dependencies = session.dependencies().files().keys();
+    QVERIFY(dependencies.contains(m_dir->filePath("config.json")));
+    QVERIFY(dependencies.contains(m_dir->filePath("first.json")));
+    QVERIFY(dependencies.contains(m_dir->filePath("second.json")));
+
+    // Change one of the includes
+    QVERIFY(m_dir->writeFile("second.json",
+                             "{\"config\": {\"second\": {\"value\": 20, \"items\": [1, 2]}}}"));
+    QVERIFY(m_dir->setLastModified("second.json", 10000));
+
+    const quint64 hitCount = session.includeCache().hitCount();
+    QStringList changedNodePaths;
+    auto rereadConfig = session.reread(&changedNodePaths);
+    QVERIFY(rereadConfig);
+    QCOMPARE(rereadConfig->nodeAtPath("/second/value")->toValue().value().toInt(), 20);
+    QCOMPARE(rereadConfig->nodeAtPath("/first/text")->toValue().value().toString(),
+             QString("abc"));
+    QCOMPARE(changedNodePaths, QStringList { "/second/value" });
+
+    // Unchanged include was taken from the session's include cache
+    QVERIFY(session.includeCache().hitCount() > hitCount);
+
+    // Configuration returned by the first read is not affected
+    QCOMPARE(config->nodeAtPath("/second/value")->toValue().value().toInt(), 2);
+}
+
+// Test: rereading without changes -----------------------------------------------------------------
+
+void TestConfigReaderSession::testRereadUnchanged()
+{
+    ConfigReaderSession session;
+    auto config = readConfig(&session);
+    QVERIFY(config);
+
+    QStringList changedNodePaths { "/invalid" };
+    auto rereadConfig = session.reread(&changedNodePaths);
+    QVERIFY(rereadConfig);
+    QVERIFY(*rereadConfig == *config);
+    QVERIFY(changedNodePaths.isEmpty());
+}
+
+// Test: rereading after a file was marked as changed ----------------------------------------------
+
+void TestConfigReaderSession::testRereadInvalidatedFile()
+{
+    ConfigReaderSession session;
+    QVERIFY(readConfig(&session));
+
+    // Change is not visible in the size of the file (and possibly the time of the last
+    // modification) so the file has to be marked as changed
+    QVERIFY(m_dir->writeFile("first.json",
+                             "{\"config\": {\"first\": {\"value\": 1, \"text\": \"xyz\"}}}"));
+    session.invalidateFiles({ m_dir->filePath("first.json") });
+
+    QStringList changedNodePaths;
+    auto config = session.reread(&changedNodePaths);
+    QVERIFY(config);
+    QCOMPARE(config->nodeAtPath("/first/text")->toValue().value().toString(), QString("xyz"));
+    QCOMPARE(changedNodePaths, QStringList { "/first/text" });
+}
+
+// Test: rereading after members were added and removed --------------------------------------------
+
+void TestConfigReaderSession::testRereadAddedAndRemovedMembers()
+{
+    ConfigReaderSession session;
+    QVERIFY(readConfig(&session));
+
+    QVERIFY(m_dir->writeFile("first.json",
+                             "{\"config\": {\"first\": {\"value\": \"one\","
+                             "                       \"new\": {\"x\": 1}}}}"));
+    QVERIFY(m_dir->setLastModified("first.json", 10000));
+    QVERIFY(m_dir->writeFile("config.json",
+                             "{\"includes\": [{\"file_path\": \"first.json\"},"
+                             "                {\"file_path\": \"second.json\"}],"
+                             " \"config\": {\"other\": null}}"));
+    QVERIFY(m_dir->setLastModified("config.json", 10000));
+
+    QStringList changedNodePaths;
+    auto config = session.reread(&changedNodePaths);
+    QVERIFY(config);
+
+    const QStringList expectedNodePaths
+    {
+        "/first/new",
+        "/first/text",
+        "/first/value",
+        "/main",
+        "/other"
+    };
+    QCOMPARE(changedNodePaths, expectedNodePaths);
+}
+
+// Test: failed reread -----------------------------------------------------------------------------
+
+void TestConfigReaderSession::testRereadFailure()
+{
+    ConfigReaderSession session;
+
+    // Reread is not possible before the first read
+    QVERIFY(!session.reread());
+
+    QVERIFY(readConfig(&session));
+
+    // Break one of the includes
+    QVERIFY(m_dir->writeFile("first.json", "{\"config\": {\"first\": "));
+    QVERIFY(m_dir->setLastModified("first.json", 10000));
+
+    QStringList changedNodePaths;
+    QVERIFY(!session.reread(&changedNodePaths));
+    QVERIFY(changedNodePaths.isEmpty());
+    QVERIFY(session.hasConfig());
+
+    // Fix the include, the changes are reported relative to the last successful read
+    QVERIFY(m_dir->writeFile("first.json",
+                             "{\"config\": {\"first\": {\"value\": 1, \"text\": \"xyz\"}}}"));
+    QVERIFY(m_dir->setLastModified("first.json", 20000));
+
+    auto config = session.reread(&changedNodePaths);
+    QVERIFY(config);
+    QCOMPARE(changedNodePaths, QStringList { "/first/text" });
+}
+
+// Helper methods ----------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> TestConfigReaderSession::readConfig(
+        ConfigReaderSession *session)
+{
+    return session->read("config.json",
+                         m_dir->dir(),
+                         ConfigNodePath::ROOT_PATH,
+                         ConfigNodePath::ROOT_PATH,
+                         EnvironmentVariables::loadFromProcess());
+}
+
+// Main function -----------------------------------------------------------------------------------
+
+QTEST_MAIN(TestConfigReaderSession)
+#include "testConfigReaderSession.moc"
@@ -0,0 +1,377 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains unit tests for ConfigSnapshotHolder class
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigNodeSharingScope.hpp>
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/ConfigReader.hpp>
+#include <CppConfigFramework/ConfigSnapshotHolder.hpp>
+#include <CppConfigFramework/ConfigValueNode.hpp>
+
+// Qt includes
+#include <QtCore/QDebug>
+#include <QtCore/QDir>
+#include <QtCore/QJsonObject>
+#include <QtTest/QTest>
+
+// System includes
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// Forward declarations
+
+// Macros
+
+// Test class declaration --------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+
+class TestConfigSnapshotHolder : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Functions executed by QtTest before and after test suite
+    void initTestCase();
+    void cleanupTestCase();
+
+    // Functions executed by QtTest before and after each test
+    void init();
+    void cleanup();
+
+    // Test functions
+    void testEmpty();
+    void testPublish();
+    void testPinnedSnapshotOutlivesPublish();
+    void testOldSnapshotReleased();
+    void testMultipleHolders();
+    void testConcurrentReaders();
+    void testConcurrentReadersOfReadConfig();
+
+private:
+    std::unique_ptr<ConfigObjectNode> createSnapshot(const int value);
+    int snapshotValue(const ConfigObjectNode &snapshot);
+};
+
+// Test Case init/cleanup methods ------------------------------------------------------------------
+
+void TestConfigSnapshotHolder::initTestCase()
+{
+}
+
+void TestConfigSnapshotHolder::cleanupTestCase()
+{
+}
+
+// Test init/cleanup methods -----------------------------------------------------------------------
+
+void TestConfigSnapshotHolder::init()
+{
+}
+
+void TestConfigSnapshotHolder::cleanup()
+{
+}
+
+// Test: empty holder ------------------------------------------------------------------------------
+
+void TestConfigSnapshotHolder::testEmpty()
+{
+    ConfigSnapshotHolder holder;
+    QCOMPARE(holder.version(), quint64(1U));
+    QVERIFY(!holder.load());
+
+    auto pin = holder.pin();
+    QVERIFY(!pin);
+    QVERIFY(pin.get() == nullptr);
+    QCOMPARE(pin.version(), quint64(1U));
+}
+
+// Test: publishing snapshots ----------------------------------------------------------------------
+
+void TestConfigSnapshotHolder::testPublish()
+{
+    ConfigSnapshotHolder holder(createSnapshot(1));
+
+    {
+        auto pin = holder.pin();
+        QVERIFY(pin);
+        QCOMPARE(snapshotValue(*pin), 1);
+        QCOMPARE(pin.version(), quint64(1U));
+    }
+
+    holder.publish(createSnapshot(2));
+    QCOMPARE(holder.version(), quint64(2U));
+
+    auto pin = holder.pin();
+    QCOMPARE(snapshotValue(*pin), 2);
+    QCOMPARE(pin.version(), quint64(2U));
+
+    // Pins taken again in the same thread share the cached snapshot
+    auto otherPin = holder.pin();
+    QVERIFY(otherPin.get() == pin.get());
+    QVERIFY(otherPin.toSharedPointer() == holder.load());
+}
+
+// Test: pinned snapshot stays valid after a new one is published ----------------------------------
+
+void TestConfigSnapshotHolder::testPinnedSnapshotOutlivesPublish()
+{
+    ConfigSnapshotHolder holder(createSnapshot(1));
+    auto pin = holder.pin();
+    std::weak_ptr<const ConfigObjectNode> previousSnapshot = pin.toSharedPointer();
+
+    holder.publish(createSnapshot(2));
+
+    // New snapshot can't replace the pinned one in the cache but is still available
+    auto newPin = holder.pin();
+    QCOMPARE(snapshotValue(*newPin), 2);
+    QCOMPARE(snapshotValue(*pin), 1);
+
+    // Moved pin keeps the snapshot
+    auto movedPin = std::move(pin);
+    QVERIFY(!pin);
+    QCOMPARE(snapshotValue(*movedPin), 1);
+
+    // Previous snapshot is destroyed once it is no longer pinned or cached
+    movedPin = ConfigSnapshotHolder::Pin();
+    newPin = ConfigSnapshotHolder::Pin();
+    QVERIFY(holder.pin());
+    QVERIFY(previousSnapshot.expired());
+}
+
+// Test: old snapshot is destroyed once all of its pins are released -------------------------------
+
+void TestConfigSnapshotHolder::testOldSnapshotReleased()
+{
+    ConfigSnapshotHolder holder(createSnapshot(1));
+    ConfigSnapshotHolder otherHolder(createSnapshot(10));
+
+    // Snapshot that is pinned during a publish is destroyed with its last pin
+    auto pin = holder.pin();
+    auto secondPin = holder.pin();
+    std::weak_ptr<const ConfigObjectNode> snapshot = pin.toSharedPointer();
+
+    holder.publish(createSnapshot(2));
+    pin = ConfigSnapshotHolder::Pin();
+    QVERIFY(!snapshot.expired());
+    secondPin = ConfigSnapshotHolder::Pin();
+    QVERIFY(snapshot.expired());
+
+    // Cached snapshot that is not pinned is destroyed by the next pin of any holder
+    snapshot = holder.pin().toSharedPointer();
+    QCOMPARE(snapshotValue(*snapshot.lock()), 2);
+    QVERIFY(!snapshot.expired());
+
+    holder.publish(createSnapshot(3));
+    QVERIFY(!snapshot.expired());
+    QCOMPARE(snapshotValue(*otherHolder.pin()), 10);
+    QVERIFY(snapshot.expired());
+    QCOMPARE(snapshotValue(*holder.pin()), 3);
+
+    // Cached snapshot of a destroyed holder is destroyed by the next pin of any holder
+    {
+        ConfigSnapshotHolder destroyedHolder(createSnapshot(20));
+        snapshot = destroyedHolder.pin().toSharedPointer();
+    }
+
+    QVERIFY(!snapshot.expired());
+    QCOMPARE(snapshotValue(*otherHolder.pin()), 10);
+    QVERIFY(snapshot.expired());
+}
+
+// Test: multiple holders in the same thread -------------------------------------------------------
+
+void TestConfigSnapshotHolder::testMultipleHolders()
+{
+    std::vector<std::unique_ptr<ConfigSnapshotHolder>> holders;
+
+    for (int i = 0; i < 10; i++)
+    {
+        holders.push_back(std::make_unique<ConfigSnapshotHolder>(createSnapshot(i)));
+    }
+
+    for (int round = 0; round < 3; round++)
+    {
+        for (int i = 0; i < 10; i++)
+        {
+            auto pin = holders.at(static_cast<size_t>(i))->pin();
+            QCOMPARE(snapshotValue(*pin), i);
+        }
+    }
+
+    // Snapshots of a destroyed holder are not taken for a new holder
+    holders.clear();
+    ConfigSnapshotHolder holder;
+    QVERIFY(!holder.pin());
+}
+
+// Test: concurrent readers ------------------------------------------------------------------------
+
+void TestConfigSnapshotHolder::testConcurrentReaders()
+{
+    ConfigSnapshotHolder holder(createSnapshot(0));
+    std::atomic<bool> stop(false);
+    std::atomic<int> failures(0);
+    std::vector<std::thread> readers;
+
+    for (int i = 0; i < 8; i++)
+    {
+        readers.emplace_back([&]()
+        {
+            int previousValue = 0;
+
+            while (!stop.load())
+            {
+                auto pin = holder.pin();
+                const int value = snapshotValue(*pin);
+
+                // Values are published in increasing order
+                if (value < previousValue)
+                {
+                    failures++;
+                }
+
+                previousValue = value;
+            }
+        });
+    }
+
+    for (int i = 1; i <= 1000; i++)
+    {
+        holder.publish(createSnapshot(i));
+    }
+
+    stop = true;
+
+    for (auto &reader : readers)
+    {
+        reader.join();
+    }
+
+    QCOMPARE(failures.load(), 0);
+    QCOMPARE(snapshotValue(*holder.pin()), 1000);
+}
+
+// Test: concurrent readers of a read configuration with references --------------------------------
+
+void TestConfigSnapshotHolder::testConcurrentReadersOfReadConfig()
+{
+    const QJsonObject base
+    {
+        { "a", 1 },
+        { "b", QJsonObject { { "c", 2 } } }
+    };
+    const QJsonObject derived
+    {
+        { "base", "/base" },
+        { "config", QJsonObject { { "a", 3 } } }
+    };
+    const QJsonObject json
+    {
+        {
+            "config", QJsonObject
+            {
+                { "base", base },
+                { "&reference", "/base" },
+                { "&derived", derived }
+            }
+        }
+    };
+
+    EnvironmentVariables environmentVariables;
+    auto config = ConfigReader().read(json,
+                                      QDir::current(),
+                                      ConfigNodePath::ROOT_PATH,
+                                      ConfigNodePath::ROOT_PATH,
+                                      {},
+                                      &environmentVariables);
+    QVERIFY(config);
+
+    // Copy of the configuration that shares its members with another node
+    const ConfigObjectNode expectedConfig(std::move(config->clone()->toObject()));
+    std::unique_ptr<ConfigObjectNode> scopedConfig;
+    std::unique_ptr<ConfigObjectNode> sharedConfig;
+
+    {
+        const ConfigNodeSharingScope sharingScope;
+        scopedConfig = std::make_unique<ConfigObjectNode>(std::move(config->clone()->toObject()));
+        sharedConfig = std::make_unique<ConfigObjectNode>(
+                           std::move(scopedConfig->clone()->toObject()));
+    }
+
+    // Published configurations are read and cloned by multiple threads
+    ConfigSnapshotHolder holder(std::move(config));
+    QVERIFY(holder.pin()->isDetached());
+
+    std::atomic<int> failures(0);
+    std::vector<std::thread> readers;
+
+    for (int i = 0; i < 8; i++)
+    {
+        readers.emplace_back([&]()
+        {
+            for (int j = 0; j < 500; j++)
+            {
+                auto pin = holder.pin();
+                const auto clone = pin->clone();
+
+                if ((pin->nodeAtPath("/reference/b/c")->toValue().value().toInt() != 2) ||
+                    (pin->nodeAtPath("/derived/a")->toValue().value().toInt() != 3) ||
+                    (pin->nodeAtPath("/derived/b/c")->toValue().value().toInt() != 2) ||
+                    (!(clone->toObject() == *pin)) ||
+                    (!(*pin == expectedConfig)))
+                {
+                    failures++;
+                }
+            }
+        });
+    }
+
+    holder.publish(std::move(sharedConfig));
+    QVERIFY(holder.pin()->isDetached());
+
+    for (auto &reader : readers)
+    {
+        reader.join();
+    }
+
+    QCOMPARE(failures.load(), 0);
+}
+
+// Helper methods ----------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> TestConfigSnapshotHolder::createSnapshot(const int value)
+{
+    auto snapshot = std::make_unique<ConfigObjectNode>();
+    snapshot->setMember("value", ConfigValueNode(value));
+    return snapshot;
+}
+
+int TestConfigSnapshotHolder::snapshotValue(const ConfigObjectNode &snapshot)
+{
+    return snapshot.member("value")->toValue().value().toInt();
+}
+
+// Main function -----------------------------------------------------------------------------------
+
+QTEST_MAIN(TestConfigSnapshotHolder)
+#include "testConfigSnapshotHolder.moc"
@@ -0,0 +1,309 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains unit tests for ConfigSnapshotReader class and the snapshot writer
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigNodeReference.hpp>
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/ConfigReader.hpp>
+#include <CppConfigFramework/ConfigSnapshotFormat.hpp>
+#include <CppConfigFramework/ConfigSnapshotReader.hpp>
+#include <CppConfigFramework/ConfigValueNode.hpp>
+#include <CppConfigFramework/ConfigWriter.hpp>
+#include "TestConfigDir.hpp"
+
+// Qt includes
+#include <QtCore/QDebug>
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonObject>
+#include <QtTest/QTest>
+
+// System includes
+#include <limits>
+
+// Forward declarations
+
+// Macros
+
+// Test class declaration --------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+
+class TestConfigSnapshotReader : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Functions executed by QtTest before and after test suite
+    void initTestCase();
+    void cleanupTestCase();
+
+    // Functions executed by QtTest before and after each test
+    void init();
+    void cleanup();
+
+    // Test functions
+    void testRoundTrip();
+    void testInvalidSnapshot();
+    void testInvalidSnapshot_data();
+    void testWriteUnresolvedConfig();
+    void testReadFile();
+    void testInclude();
+
+private:
+    std::unique_ptr<ConfigObjectNode> createConfig();
+
+    std::unique_ptr<Test::TestConfigDir> m_dir;
+};
+
+// Test Case init/cleanup methods ------------------------------------------------------------------
+
+void TestConfigSnapshotReader::initTestCase()
+{
+}
+
+void TestConfigSnapshotReader::cleanupTestCase()
+{
+}
+
+// Test init/cleanup methods -----------------------------------------------------------------------
+
+void TestConfigSnapshotReader::init()
+{
+    m_dir = std::make_unique<Test::TestConfigDir>();
+    QVERIFY(m_dir->isValid());
+}
+
+void TestConfigSnapshotReader::cleanup()
+{
+    m_dir.reset();
+}
+
+// Test: writing and reading a snapshot ------------------------------------------------------------
+
+void TestConfigSnapshotReader::testRoundTrip()
+{
+    const auto config = createConfig();
+    const QByteArray snapshot = ConfigWriter::writeToSnapshot(*config);
+    QVERIFY(!snapshot.isEmpty());
+    QCOMPARE(snapshot.left(4), QByteArray("CCFS"));
+
+    const auto readConfig = ConfigSnapshotReader::readSnapshot(
+                                snapshot.constData(), static_cast<size_t>(snapshot.size()));
+    QVERIFY(readConfig);
+    QVERIFY(*readConfig == *config);
+    QCOMPARE(readConfig->nodeAtPath("/object/text")->toValue().value().toString(),
+             QString("abc"));
+    QCOMPARE(readConfig->nodeAtPath("/object/nested/array")->toValue().value(),
+             QJsonValue(QJsonArray { 1, 2.5, "abc", QJsonValue(), true }));
+
+    // Snapshot of an empty Object node
+    const QByteArray emptySnapshot = ConfigWriter::writeToSnapshot(ConfigObjectNode());
+    const auto emptyConfig = ConfigSnapshotReader::readSnapshot(
+                                 emptySnapshot.constData(),
+                                 static_cast<size_t>(emptySnapshot.size()));
+    QVERIFY(emptyConfig);
+    QCOMPARE(emptyConfig->count(), 0);
+}
+
+// Test: invalid snapshots -------------------------------------------------------------------------
+
+void TestConfigSnapshotReader::testInvalidSnapshot()
+{
+    QFETCH(int, offset);
+    QFETCH(int, size);
+
+    const auto config = createConfig();
+    QByteArray snapshot = ConfigWriter::writeToSnapshot(*config);
+    QVERIFY(!snapshot.isEmpty());
+
+    if ((offset < 0) && (offset != std::numeric_limits<int>::min()))
+    {
+        // Offset relative to the end of the snapshot
+        offset += snapshot.size();
+    }
+
+    if (offset >= 0)
+    {
+        // Corrupt a byte
+        snapshot[offset] = static_cast<char>(snapshot.at(offset) ^ 0x5A);
+    }
+
+    if (size >= 0)
+    {
+        snapshot.resize(size);
+    }
+
+    QVERIFY(!ConfigSnapshotReader::readSnapshot(snapshot.constData(),
+                                                static_cast<size_t>(snapshot.size())));
+}
+
+void TestConfigSnapshotReader::testInvalidSnapshot_data()
+{
+    QTest::addColumn<int>("offset");
+    QTest::addColumn<int>("size");
+
+    // Negative offset is relative to the end of the snapshot and a negative size keeps the size
+    const int noOffset = std::numeric_limits<int>::min();
+    const int headerSize = static_cast<int>(ConfigSnapshotFormat::HEADER_SIZE);
+
+    QTest::newRow("empty") << noOffset << 0;
+    QTest::newRow("truncated header") << noOffset << 20;
+    QTest::newRow("truncated data") << noOffset << (headerSize + 20);
+    QTest::newRow("magic") << 0 << -1;
+    QTest::newRow("version") << 4 << -1;
+    QTest::newRow("entry count") << 8 << -1;
+    QTest::newRow("checksum") << static_cast<int>(ConfigSnapshotFormat::CHECKSUM_OFFSET) << -1;
+    QTest::newRow("entry table") << headerSize << -1;
+    QTest::newRow("string data") << -1 << -1;
+}
+
+// Test: writing a configuration with unresolved references ----------------------------------------
+
+void TestConfigSnapshotReader::testWriteUnresolvedConfig()
+{
+    ConfigObjectNode config;
+    config.setMember("value", std::make_unique<ConfigValueNode>(1));
+    config.setMember("ref", std::make_unique<ConfigNodeReference>(ConfigNodePath("/value")));
+
+    QVERIFY(ConfigWriter::writeToSnapshot(config).isEmpty());
+    QVERIFY(!ConfigWriter::writeToSnapshotFile(config,
+                                               m_dir->filePath("a.ccfs")));
+    QVERIFY(!QFile::exists(m_dir->filePath("a.ccfs")));
+}
+
+// Test: reading a snapshot file -------------------------------------------------------------------
+
+void TestConfigSnapshotReader::testReadFile()
+{
+    const auto config = createConfig();
+    QVERIFY(ConfigWriter::writeToSnapshotFile(*config,
+                                              m_dir->filePath("a.ccfs")));
+
+    ConfigSnapshotReader reader;
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+
+    // Whole snapshot
+    auto readConfig = reader.read("a.ccfs",
+                                  m_dir->dir(),
+                                  ConfigNodePath::ROOT_PATH,
+                                  ConfigNodePath::ROOT_PATH,
+                                  &environmentVariables);
+    QVERIFY(readConfig);
+    QVERIFY(*readConfig == *config);
+
+    // Source and destination node paths
+    readConfig = reader.read("a.ccfs",
+                             m_dir->dir(),
+                             ConfigNodePath("/object/nested"),
+                             ConfigNodePath("/destination"),
+                             &environmentVariables);
+    QVERIFY(readConfig);
+    QCOMPARE(readConfig->nodeAtPath("/destination/array")->toValue().value().toArray().size(), 5);
+    QVERIFY(readConfig->nodeAtPath("/destination/text") == nullptr);
+
+    // Missing file
+    readConfig = reader.read("missing.ccfs",
+                             m_dir->dir(),
+                             ConfigNodePath::ROOT_PATH,
+                             ConfigNodePath::ROOT_PATH,
+                             &environmentVariables);
+    QVERIFY(!readConfig);
+
+    // JSON file is not a snapshot
+    QVERIFY(m_dir->writeFile("b.ccfs", "{\"config\": null}"));
+    readConfig = reader.read("b.ccfs",
+                             m_dir->dir(),
+                             ConfigNodePath::ROOT_PATH,
+                             ConfigNodePath::ROOT_PATH,
+                             &environmentVariables);
+    QVERIFY(!readConfig);
+}
+
+// Test: including a snapshot in a configuration file ----------------------------------------------
+
+void TestConfigSnapshotReader::testInclude()
+{
+    const auto config = createConfig();
+    QVERIFY(ConfigWriter::writeToSnapshotFile(*config,
+                                              m_dir->filePath("a.ccfs")));
+    QVERIFY(m_dir->writeFile("config.json",
+                             "{"
+                             "  \"includes\": ["
+                             "    {"
+                             "      \"type\": \"CppConfigFrameworkSnapshot\","
+                             "      \"file_path\": \"${CPPCONFIGFRAMEWORK_CURRENT_DIR}/a.ccfs\","
+                             "      \"source_node\": \"/object\","
+                             "      \"destination_node\": \"/included\""
+                             "    }"
+                             "  ],"
+                             "  \"config\": {"
+                             "    \"&ref\": \"/included/value\","
+                             "    \"included\": { \"text\": \"xyz\" }"
+                             "  }"
+                             "}"));
+
+    ConfigReader reader;
+    auto environmentVariables = EnvironmentVariables::loadFromProcess();
+    const auto readConfig = reader.read("config.json",
+                                        m_dir->dir(),
+                                        ConfigNodePath::ROOT_PATH,
+                                        ConfigNodePath::ROOT_PATH,
+                                        {},
+                                        &environmentVariables);
+    QVERIFY(readConfig);
+    QCOMPARE(readConfig->nodeAtPath("/ref")->toValue().value().toInt(), 123);
+    QCOMPARE(readConfig->nodeAtPath("/included/text")->toValue().value().toString(),
+             QString("xyz"));
+    QCOMPARE(readConfig->nodeAtPath("/included/nested/array")->toValue().value().toArray().size(),
+             5);
+}
+
+// Helper methods ----------------------------------------------------------------------------------
+
+std::unique_ptr<ConfigObjectNode> TestConfigSnapshotReader::createConfig()
+{
+    auto nested = std::make_unique<ConfigObjectNode>();
+    nested->setMember("array",
+                      std::make_unique<ConfigValueNode>(
+                          QJsonArray { 1, 2.5, "abc", QJsonValue(), true }));
+    nested->setMember("object",
+                      std::make_unique<ConfigValueNode>(
+                          QJsonObject { { "a", 1 }, { "b", QJsonArray { "c" } } }));
+    nested->setMember("empty", std::make_unique<ConfigObjectNode>());
+
+    auto object = std::make_unique<ConfigObjectNode>();
+    object->setMember("value", std::make_unique<ConfigValueNode>(123));
+    object->setMember("text", std::make_unique<ConfigValueNode>("abc"));
+    object->setMember("flag", std::make_unique<ConfigValueNode>(false));
+    object->setMember("null", std::make_unique<ConfigValueNode>(QJsonValue()));
+    object->setMember("nested", std::move(nested));
+
+    auto config = std::make_unique<ConfigObjectNode>();
+    config->setMember("object", std::move(object));
+    config->setMember("number", std::make_unique<ConfigValueNode>(-0.125));
+
+    return config;
+}
+
+// Main function -----------------------------------------------------------------------------------
+
+QTEST_MAIN(TestConfigSnapshotReader)
+#include "testConfigSnapshotReader.moc"
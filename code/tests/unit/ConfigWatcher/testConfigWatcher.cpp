@@ -0,0 +1,233 @@
+/* This file is part of C++ Config Framework.
+ *
+ * C++ Config Framework is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * C++ Config Framework is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with C++ Config
+ * Framework. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * Contains unit tests for ConfigWatcher class
+ */
+
+// C++ Config Framework includes
+#include <CppConfigFramework/ConfigObjectNode.hpp>
+#include <CppConfigFramework/ConfigValueNode.hpp>
+#include <CppConfigFramework/ConfigWatcher.hpp>
+#include "TestConfigDir.hpp"
+
+// Qt includes
+#include <QtCore/QDebug>
+#include <QtCore/QFile>
+#include <QtTest/QSignalSpy>
+#include <QtTest/QTest>
+
+// System includes
+
+// Forward declarations
+
+// Macros
+
+// Test class declaration --------------------------------------------------------------------------
+
+using namespace CppConfigFramework;
+
+class TestConfigWatcher : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // Functions executed by QtTest before and after test suite
+    void initTestCase();
+    void cleanupTestCase();
+
+    // Functions executed by QtTest before and after each test
+    void init();
+    void cleanup();
+
+    // Test functions
+    void testStart();
+    void testFileChanged();
+    void testFileReplaced();
+    void testBurstOfChanges();
+    void testReloadFailed();
+
+private:
+    bool startWatcher(ConfigWatcher *watcher);
+
+    std::unique_ptr<Test::TestConfigDir> m_dir;
+};
+
+// Test Case init/cleanup methods ------------------------------------------------------------------
+
+void TestConfigWatcher::initTestCase()
+{
+}
+
+void TestConfigWatcher::cleanupTestCase()
+{
+}
+
+// Test init/cleanup methods -----------------------------------------------------------------------
+
+void TestConfigWatcher::init()
+{
+    m_dir = std::make_unique<Test::TestConfigDir>();
+    QVERIFY(m_dir->isValid());
+
+    QVERIFY(m_dir->writeFile("first.json", "{\"config\": {\"first\": {\"value\": 1}}}"));
+    QVERIFY(m_dir->writeFile("config.json",
+                             "{\"includes\": [{\"file_path\": \"first.json\"}],"
+                             " \"config\": {\"main\": true}}"));
+}
+
+void TestConfigWatcher::cleanup()
+{
+    m_dir.reset();
+}
+
+// Test: starting the watcher ----------------------------------------------------------------------
+
+void TestConfigWatcher::testStart()
+{
+    ConfigWatcher watcher;
+    QVERIFY(!watcher.isActive());
+    QVERIFY(!watcher.snapshot());
+    QCOMPARE(watcher.debounceInterval(), ConfigWatcher::DEFAULT_DEBOUNCE_INTERVAL);
+
+    QVERIFY(startWatcher(&watcher));
+    QVERIFY(watcher.isActive());
+
+    const QStringList expectedFiles {
+        m_dir->filePath("config.json"), m_dir->filePath("first.json")
+    };
+    QCOMPARE(watcher.watchedFiles(), expectedFiles);
+
+    auto snapshot = watcher.snapshot();
+    QVERIFY(snapshot);
+    QCOMPARE(snapshot->nodeAtPath("/first/value")->toValue().value().toInt(), 1);
+
+    watcher.stop();
+    QVERIFY(!watcher.isActive());
+    QVERIFY(watcher.snapshot() == snapshot);
+
+    // Starting fails for a missing configuration file
+    QVERIFY(QFile::remove(m_dir->filePath("config.json")));
+    QVERIFY(!startWatcher(&watcher));
+}
+
+// Test: rereading a changed file ------------------------------------------------------------------
+
+void TestConfigWatcher::testFileChanged()
+{
+    ConfigWatcher watcher;
+    watcher.setDebounceInterval(10);
+    QVERIFY(startWatcher(&watcher));
+
+    const auto previousSnapshot = watcher.snapshot();
+    QSignalSpy spy(&watcher, &ConfigWatcher::configChanged);
+
+    // Change doesn't need to be visible in the size or the time of the last modification
+    QVERIFY(m_dir->writeFile("first.json", "{\"config\": {\"first\": {\"value\": 2}}}"));
+    QVERIFY(spy.wait(5000));
+    QCOMPARE(spy.count(), 1);
+    QCOMPARE(spy.at(0).at(0).toStringList(), QStringList { "/first/value" });
+
+    auto snapshot = watcher.snapshot();
+    QCOMPARE(snapshot->nodeAtPath("/first/value")->toValue().value().toInt(), 2);
+
+    // Previous snapshot stays valid
+    QCOMPARE(previousSnapshot->nodeAtPath("/first/value")->toValue().value().toInt(), 1);
+}
+
+// Test: rereading a file that was replaced --------------------------------------------------------
+
+void TestConfigWatcher::testFileReplaced()
+{
+    ConfigWatcher watcher;
+    watcher.setDebounceInterval(10);
+    QVERIFY(startWatcher(&watcher));
+
+    QSignalSpy spy(&watcher, &ConfigWatcher::configChanged);
+
+    // File is replaced with a new one (like most editors do) so it has to be watched again
+    for (int i = 2; i <= 3; i++)
+    {
+        const QByteArray contents =
+                QString("{\"config\": {\"first\": {\"value\": %1}}}").arg(i).toUtf8();
+        QVERIFY(m_dir->replaceFile("first.json", contents));
+        QVERIFY(spy.wait(5000));
+        QCOMPARE(watcher.snapshot()->nodeAtPath("/first/value")->toValue().value().toInt(), i);
+    }
+
+    QVERIFY(watcher.watchedFiles().contains(m_dir->filePath("first.json")));
+}
+
+// Test: merging a burst of changes into a single reread -------------------------------------------
+
+void TestConfigWatcher::testBurstOfChanges()
+{
+    ConfigWatcher watcher;
+    watcher.setDebounceInterval(500);
+    QVERIFY(startWatcher(&watcher));
+
+    QSignalSpy spy(&watcher, &ConfigWatcher::configChanged);
+
+    for (int i = 2; i <= 5; i++)
+    {
+        const QByteArray contents =
+                QString("{\"config\": {\"first\": {\"value\": %1}}}").arg(i).toUtf8();
+        QVERIFY(m_dir->writeFile("first.json", contents));
+    }
+
+    QVERIFY(spy.wait(5000));
+    QCOMPARE(spy.count(), 1);
+    QCOMPARE(watcher.snapshot()->nodeAtPath("/first/value")->toValue().value().toInt(), 5);
+}
+
+// Test: failed reread -----------------------------------------------------------------------------
+
+void TestConfigWatcher::testReloadFailed()
+{
+    ConfigWatcher watcher;
+    watcher.setDebounceInterval(10);
+    QVERIFY(startWatcher(&watcher));
+
+    const auto snapshot = watcher.snapshot();
+    QSignalSpy spy(&watcher, &ConfigWatcher::reloadFailed);
+
+    QVERIFY(m_dir->replaceFile("first.json", "{\"config\": {\"first\": "));
+    QVERIFY(spy.wait(5000));
+    QVERIFY(watcher.snapshot() == snapshot);
+
+    // Replaced file is still watched after the failure so fixing it is detected
+    QSignalSpy changedSpy(&watcher, &ConfigWatcher::configChanged);
+
+    QVERIFY(m_dir->replaceFile("first.json", "{\"config\": {\"first\": {\"value\": 3}}}"));
+    QVERIFY(changedSpy.wait(5000));
+    QCOMPARE(watcher.snapshot()->nodeAtPath("/first/value")->toValue().value().toInt(), 3);
+}
+
+// Helper methods ----------------------------------------------------------------------------------
+
+bool TestConfigWatcher::startWatcher(ConfigWatcher *watcher)
+{
+    return watcher->start("config.json",
+                          m_dir->dir(),
+                          ConfigNodePath::ROOT_PATH,
+                          ConfigNodePath::ROOT_PATH,
+                          EnvironmentVariables::loadFromProcess());
+}
+
+// Main function -----------------------------------------------------------------------------------
+
+QTEST_MAIN(TestConfigWatcher)
+#include "testConfigWatcher.moc"